@@ -9,6 +9,7 @@ INSTALLS += text_files_target
 ############### Install Qt5 ##############
 
 win32 {
+    QT5_LIBRARIES *= Qt5Concurrent$${DLL_DEBUG_SUFFIX}.dll
     QT5_LIBRARIES *= Qt5Core$${DLL_DEBUG_SUFFIX}.dll
     QT5_LIBRARIES *= Qt5DBus$${DLL_DEBUG_SUFFIX}.dll
     QT5_LIBRARIES *= Qt5Gui$${DLL_DEBUG_SUFFIX}.dll
@@ -40,6 +41,7 @@ else:macx {
     qt5_target.extra += rsync -avzl --exclude \'Headers*\' --exclude \'*debug*\' $$[QT_INSTALL_LIBS]/QtXml.framework/ $${PREFIX}/lib/QtXml.framework/
 }
 else:unix: {
+    QT5_LIBRARIES *= libQt5Concurrent.so.5
     QT5_LIBRARIES *= libQt5Core.so.5
     QT5_LIBRARIES *= libQt5DBus.so.5
     QT5_LIBRARIES *= libQt5Gui.so.5
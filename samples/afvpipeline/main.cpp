@@ -0,0 +1,185 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+//! \ingroup sampleafvpipeline
+
+#include "blackcore/afv/clients/afvpipelineharness.h"
+#include "blackmisc/registermetadata.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <new>
+
+using namespace BlackCore::Afv::Clients;
+
+namespace
+{
+    std::atomic<qint64> g_allocations { 0 };     //!< allocations so far
+    std::atomic<qint64> g_liveAllocations { 0 }; //!< allocations not yet freed
+
+    //! Count an allocation
+    void allocated(const void *p)
+    {
+        if (!p) { return; }
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        g_liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //! Count a free
+    void freed(const void *p)
+    {
+        if (p) { g_liveAllocations.fetch_sub(1, std::memory_order_relaxed); }
+    }
+}
+
+#if defined(__GLIBC__)
+// all allocations of the process, including Qt, Opus and libsodium, every allocation function freed by free is counted
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t n, size_t size);
+    void *__libc_realloc(void *p, size_t size);
+    void *__libc_memalign(size_t alignment, size_t size);
+    void *__libc_valloc(size_t size);
+    void *__libc_pvalloc(size_t size);
+    void __libc_free(void *p);
+
+    void *malloc(size_t size)
+    {
+        void *p = __libc_malloc(size);
+        allocated(p);
+        return p;
+    }
+
+    void *calloc(size_t n, size_t size)
+    {
+        void *p = __libc_calloc(n, size);
+        allocated(p);
+        return p;
+    }
+
+    void *realloc(void *p, size_t size)
+    {
+        if (!p) { return malloc(size); }
+        if (size == 0) { free(p); return nullptr; }
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+        return __libc_realloc(p, size);
+    }
+
+    int posix_memalign(void **p, size_t alignment, size_t size)
+    {
+        // invalid alignments are rejected as by glibc
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment % sizeof(void *) != 0) { return EINVAL; }
+        *p = __libc_memalign(alignment, size);
+        allocated(*p);
+        return *p ? 0 : ENOMEM;
+    }
+
+    void *aligned_alloc(size_t alignment, size_t size)
+    {
+        void *p = __libc_memalign(alignment, size);
+        allocated(p);
+        return p;
+    }
+
+    void *memalign(size_t alignment, size_t size)
+    {
+        void *p = __libc_memalign(alignment, size);
+        allocated(p);
+        return p;
+    }
+
+    void *valloc(size_t size)
+    {
+        void *p = __libc_valloc(size);
+        allocated(p);
+        return p;
+    }
+
+    void *pvalloc(size_t size)
+    {
+        void *p = __libc_pvalloc(size);
+        allocated(p);
+        return p;
+    }
+
+    void free(void *p)
+    {
+        freed(p);
+        __libc_free(p);
+    }
+}
+#else
+// C++ allocations only
+void *operator new(std::size_t size)
+{
+    void *p = std::malloc(size ? size : 1);
+    if (!p) { throw std::bad_alloc(); }
+    allocated(p);
+    return p;
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { freed(p); std::free(p); }
+void operator delete[](void *p) noexcept { operator delete(p); }
+void operator delete(void *p, std::size_t) noexcept { operator delete(p); }
+void operator delete[](void *p, std::size_t) noexcept { operator delete(p); }
+#endif
+
+//! main
+int main(int argc, char *argv[])
+{
+    QCoreApplication qa(argc, argv);
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Offline benchmark and soak test of the AFV receive path");
+    parser.addHelpOption();
+    const QCommandLineOption speakersOption("speakers", "Synthetic speakers", "N", "4");
+    const QCommandLineOption receiversOption("receivers", "Receivers (transceivers)", "N", "2");
+    const QCommandLineOption secondsOption("seconds", "Simulated time", "seconds", "60");
+    const QCommandLineOption jitterOption("jitter", "Packets are delayed by 0..ms", "ms", "20");
+    const QCommandLineOption lossOption("loss", "Ratio of packets lost", "ratio", "0");
+    const QCommandLineOption readSizeOption("readsize", "Samples per sound card read", "samples", "960");
+    const QCommandLineOption seedOption("seed", "Seed for jitter and loss", "seed", "1");
+    const QCommandLineOption threadedOption("threaded", "Render the receivers in threads, in real time");
+    const QCommandLineOption progressOption("progress", "Progress every N simulated seconds, for soak tests", "seconds", "0");
+    parser.addOptions({ speakersOption, receiversOption, secondsOption, jitterOption, lossOption, readSizeOption, seedOption, threadedOption, progressOption });
+    parser.process(qa);
+
+    BlackMisc::registerMetadata();
+
+    CAfvPipelineHarness::Config config;
+    config.speakers = parser.value(speakersOption).toInt();
+    config.receivers = parser.value(receiversOption).toInt();
+    config.durationMs = parser.value(secondsOption).toLongLong() * 1000;
+    config.jitterMs = parser.value(jitterOption).toInt();
+    config.lossRatio = parser.value(lossOption).toDouble();
+    config.readSize = parser.value(readSizeOption).toInt();
+    config.seed = parser.value(seedOption).toUInt();
+    config.threaded = parser.isSet(threadedOption);
+    config.progressMs = parser.value(progressOption).toLongLong() * 1000;
+
+    QTextStream out(stdout);
+    CAfvPipelineHarness harness(config);
+    harness.setAllocationCounters([] { return g_allocations.load(); }, [] { return g_liveAllocations.load(); });
+    QObject::connect(&harness, &CAfvPipelineHarness::progress, [&](qint64, const QString &text)
+    {
+        out << text << Qt::endl;
+    });
+
+    if (!harness.run())
+    {
+        parser.showHelp(EXIT_FAILURE);
+    }
+    out << harness.getStatisticsAsText() << Qt::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,20 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#ifndef BLACKSAMPLE_AFVPIPELINE_H
+#define BLACKSAMPLE_AFVPIPELINE_H
+
+// just a dummy header, documentation will go here
+
+/*!
+ * \defgroup sampleafvpipeline Sample AFV pipeline
+ * \ingroup samples
+ * \brief Offline benchmark and soak test of the AFV receive path, see BlackCore::Afv::Clients::CAfvPipelineHarness
+ */
+
+#endif
@@ -0,0 +1,23 @@
+load(common_pre)
+
+QT       += core dbus network multimedia
+
+TARGET = sampleafvpipeline
+TEMPLATE = app
+
+CONFIG   += console
+CONFIG   += blackconfig blackmisc blacksound blackcore
+CONFIG  -= app_bundle
+
+DEPENDPATH += . $$SourceRoot/src
+INCLUDEPATH += . $$SourceRoot/src
+
+HEADERS += *.h
+SOURCES += *.cpp
+
+DESTDIR = $$DestRoot/bin
+
+target.path = $$PREFIX/bin
+INSTALLS += target
+
+load(common_post)
@@ -55,6 +55,8 @@ int main(int argc, char *argv[])
         qtout << "6e .. string utils vs.regex" << Qt::endl;
         qtout << "6f .. string concatenation (+=, arg, ..)" << Qt::endl;
         qtout << "6g .. const &QString vs. QStringLiteral" << Qt::endl;
+        qtout << "6h .. runtime vs. compile time PQ units" << Qt::endl;
+        qtout << "6i .. ICAO code list vs. lookup" << Qt::endl;
         qtout << "7 .. Algorithms" << Qt::endl;
         qtout << "8 .. File/Directory" << Qt::endl;
         qtout << "-----" << Qt::endl;
@@ -73,6 +75,8 @@ int main(int argc, char *argv[])
         else if (s.startsWith("6e")) { CSamplesPerformance::samplesStringUtilsVsRegEx(qtout); }
         else if (s.startsWith("6f")) { CSamplesPerformance::samplesStringConcat(qtout); }
         else if (s.startsWith("6g")) { CSamplesPerformance::samplesStringLiteralVsConstQString(qtout); }
+        else if (s.startsWith("6h")) { CSamplesPerformance::samplesStaticQuantities(qtout); }
+        else if (s.startsWith("6i")) { CSamplesPerformance::samplesIcaoCodeLookup(qtout); }
         else if (s.startsWith("7"))  { CSamplesAlgorithm::samples(); }
         else if (s.startsWith("8"))  { CSamplesFile::samples(qtout); }
         else if (s.startsWith("x"))  { break; }
@@ -13,16 +13,21 @@
 #include "blackcore/db/databasereader.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
 #include "blackmisc/simulation/distributorlist.h"
+#include "blackmisc/aviation/aircraftcategorylist.h"
 #include "blackmisc/aviation/aircrafticaocodelist.h"
+#include "blackmisc/aviation/airlineicaocodelist.h"
 #include "blackmisc/aviation/aircraftsituation.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/altitude.h"
 #include "blackmisc/aviation/atcstation.h"
 #include "blackmisc/aviation/atcstationlist.h"
 #include "blackmisc/aviation/callsign.h"
+#include "blackmisc/aviation/callsignid.h"
+#include "blackmisc/aviation/icaocodelookup.h"
 #include "blackmisc/aviation/liverylist.h"
 #include "blackmisc/geo/coordinategeodetic.h"
 #include "blackmisc/math/mathutils.h"
+#include "blackmisc/pq/staticquantity.h"
 #include "blackmisc/pq/units.h"
 #include "blackmisc/test/testing.h"
 #include "blackmisc/swiftdirectories.h"
@@ -564,6 +569,101 @@ namespace BlackSample
         return EXIT_SUCCESS;
     }
 
+    int CSamplesPerformance::samplesStaticQuantities(QTextStream &out)
+    {
+        const int loop = 1e6;
+        const CSpeed gs1(250, CSpeedUnit::kts());
+        const CSpeed gs2(480, CSpeedUnit::km_h());
+        const CAngle a1(10, CAngleUnit::deg());
+        const CAngle a2(0.5, CAngleUnit::rad());
+        double sum = 0;
+
+        QElapsedTimer time;
+        time.start();
+        for (int i = 0; i < loop; i++)
+        {
+            const double f = (i % 100) / 100.0;
+            const CSpeed gs = (gs2 - gs1) * f + gs1;
+            const CAngle a = (a2 - a1) * f + a1;
+            sum += gs.value(CSpeedUnit::kts()) + a.value(CAngleUnit::deg());
+        }
+        out << "runtime units interpolation: " << time.elapsed() << "ms " << sum << Qt::endl;
+
+        sum = 0;
+        time.start();
+        for (int i = 0; i < loop; i++)
+        {
+            const double f = (i % 100) / 100.0;
+            const CStaticSpeed gs = CStaticSpeed::interpolate(CStaticSpeed(gs1), CStaticSpeed(gs2), f);
+            const CStaticAngle a = CStaticAngle::interpolate(CStaticAngle(a1), CStaticAngle(a2), f);
+            sum += gs.value<StaticUnits::kts>() + a.value<StaticUnits::deg>();
+        }
+        out << "static units, converted per loop: " << time.elapsed() << "ms " << sum << Qt::endl;
+
+        sum = 0;
+        const CStaticSpeed sgs1(gs1);
+        const CStaticSpeed sgs2(gs2);
+        const CStaticAngle sa1(a1);
+        const CStaticAngle sa2(a2);
+        time.start();
+        for (int i = 0; i < loop; i++)
+        {
+            const double f = (i % 100) / 100.0;
+            const CStaticSpeed gs = CStaticSpeed::interpolate(sgs1, sgs2, f);
+            const CStaticAngle a = CStaticAngle::interpolate(sa1, sa2, f);
+            sum += gs.value<StaticUnits::kts>() + a.value<StaticUnits::deg>();
+        }
+        out << "static units, converted once: " << time.elapsed() << "ms " << sum << Qt::endl;
+
+        return EXIT_SUCCESS;
+    }
+
+    int CSamplesPerformance::samplesIcaoCodeLookup(QTextStream &out)
+    {
+        const QString dir = CSwiftDirectories::staticDbFilesDirectory();
+        const QString aircraftData = CFileUtils::readFileToString(QDir(dir).filePath("aircrafticao.json"));
+        const QString airlineData = CFileUtils::readFileToString(QDir(dir).filePath("airlineicao.json"));
+        Q_ASSERT_X(!aircraftData.isEmpty() && !airlineData.isEmpty(), Q_FUNC_INFO, "ICAO files empty");
+
+        CDatabaseReader::JsonDatastoreResponse response;
+        CDatabaseReader::stringToDatastoreResponse(aircraftData, response);
+        const CAircraftIcaoCodeList aircraft = CAircraftIcaoCodeList::fromDatabaseJson(response, CAircraftCategoryList());
+        CDatabaseReader::stringToDatastoreResponse(airlineData, response);
+        const CAirlineIcaoCodeList airlines = CAirlineIcaoCodeList::fromDatabaseJson(response);
+        out << "Loaded " << aircraft.size() << " aircraft and " << airlines.size() << " airline ICAO codes" << Qt::endl;
+
+        QElapsedTimer time;
+        time.start();
+        const CIcaoCodeLookup lookup(aircraft, airlines);
+        out << "lookup built in " << time.elapsed() << "ms" << Qt::endl;
+
+        // every 10th code
+        QStringList designators;
+        for (int i = 0; i < aircraft.size(); i += 10) { designators.push_back(aircraft[i].getDesignator()); }
+        QStringList vDesignators;
+        for (int i = 0; i < airlines.size(); i += 10) { vDesignators.push_back(airlines[i].getVDesignator()); }
+
+        int found = 0;
+        time.start();
+        for (const QString &d : std::as_const(designators)) { found += aircraft.findByDesignator(d).size(); }
+        out << designators.size() << " aircraft by designator, list: " << time.elapsed() << "ms " << found << Qt::endl;
+        found = 0;
+        time.start();
+        for (const QString &d : std::as_const(designators)) { found += lookup.findAircraftByDesignator(d).size(); }
+        out << designators.size() << " aircraft by designator, lookup: " << time.elapsed() << "ms " << found << Qt::endl;
+
+        found = 0;
+        time.start();
+        for (const QString &d : std::as_const(vDesignators)) { found += airlines.findByVDesignator(d).size(); }
+        out << vDesignators.size() << " airlines by v-designator, list: " << time.elapsed() << "ms " << found << Qt::endl;
+        found = 0;
+        time.start();
+        for (const QString &d : std::as_const(vDesignators)) { found += lookup.findAirlinesByVDesignator(d).size(); }
+        out << vDesignators.size() << " airlines by v-designator, lookup: " << time.elapsed() << "ms " << found << Qt::endl;
+
+        return EXIT_SUCCESS;
+    }
+
     int CSamplesPerformance::sampleQMapVsQHashByCallsign(QTextStream &out)
     {
         const CCallsignSet cs10 = CSamplesPerformance::callsigns(10);
@@ -665,6 +765,44 @@ namespace BlackSample
         }
         out << "hash 100 out of 50: " << time.elapsed() << "ms" << Qt::endl;
 
+        // interned callsign IDs, lookup by callsign and by pre-resolved ID
+        const QList<QPair<QString, const QList<CCallsign> *>> idCases =
+        {
+            { "10", &cs_10_100_rnd }, { "25", &cs_25_100_rnd }, { "50", &cs_50_100_rnd }
+        };
+        const QList<const QHash<CCallsign, CAircraftSituation> *> idSources = { &h10, &h25, &h50 };
+        for (int c = 0; c < idCases.size(); ++c)
+        {
+            CCallsignIdHash<CAircraftSituation> idHash;
+            for (const CAircraftSituation &situation : *idSources.at(c)) { idHash.insert(situation.getCallsign(), situation); }
+
+            const QList<CCallsign> &callsigns = *idCases.at(c).second;
+            QList<int> ids;
+            for (const CCallsign &cs : callsigns) { ids.push_back(CCallsignIds::find(cs)); }
+
+            time.start();
+            for (int i = 1; i < 10000; ++i)
+            {
+                for (const CCallsign &cs : callsigns)
+                {
+                    CAircraftSituation s = idHash.value(cs);
+                    Q_ASSERT_X(s.getCallsign() == cs, Q_FUNC_INFO, "Wromg callsign");
+                }
+            }
+            out << "id hash (callsign) 100 out of " << idCases.at(c).first << ": " << time.elapsed() << "ms" << Qt::endl;
+
+            time.start();
+            for (int i = 1; i < 10000; ++i)
+            {
+                for (int id : std::as_const(ids))
+                {
+                    CAircraftSituation s = idHash.value(id);
+                    Q_ASSERT_X(!s.getCallsign().isEmpty(), Q_FUNC_INFO, "Wromg callsign");
+                }
+            }
+            out << "id hash (id) 100 out of " << idCases.at(c).first << ": " << time.elapsed() << "ms" << Qt::endl;
+        }
+
         return EXIT_SUCCESS;
     }
 
@@ -53,6 +53,12 @@ namespace BlackSample
         //! Callsign based hash/map comparison
         static int sampleQMapVsQHashByCallsign(QTextStream &out);
 
+        //! Runtime unit vs. compile time unit physical quantities
+        static int samplesStaticQuantities(QTextStream &out);
+
+        //! ICAO code list scans vs. indexed lookup, full DB ICAO data
+        static int samplesIcaoCodeLookup(QTextStream &out);
+
     private:
         static const qint64 DeltaTime = 10;
 
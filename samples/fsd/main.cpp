@@ -11,20 +11,60 @@
 //! \ingroup samplefsd
 
 #include "blackcore/fsd/fsdclient.h"
+#include "blackcore/fsd/fsdreplay.h"
+#include "blackmisc/aviation/aircraftsituation.h"
 #include "blackmisc/network/clientprovider.h"
 #include "blackmisc/simulation/ownaircraftproviderdummy.h"
 #include "blackmisc/simulation/remoteaircraftproviderdummy.h"
+#include "blackmisc/registermetadata.h"
 #include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTextStream>
 #include <QThread>
 
+using namespace BlackMisc::Aviation;
 using namespace BlackMisc::Network;
 using namespace BlackMisc::Simulation;
 using namespace BlackCore::Fsd;
 
+//! Replay a raw FSD message log through the client and the remote aircraft provider
+int replay(QCoreApplication &qa, CFSDClient &client, const QString &file, double speed, int fanOut)
+{
+    BlackMisc::registerMetadata();
+    CRemoteAircraftProviderDummy *provider = CRemoteAircraftProviderDummy::instance();
+    QObject::connect(&client, &CFSDClient::pilotDataUpdateReceived, provider, [ = ](const CAircraftSituation &situation)
+    {
+        provider->insertNewSituation(situation);
+    });
+    QObject::connect(&client, &CFSDClient::visualPilotDataUpdateReceived, provider, &CRemoteAircraftProviderDummy::insertNewSituation);
+
+    CFsdReplay fsdReplay(&client);
+    if (fsdReplay.loadFromFile(file) < 1) { return EXIT_FAILURE; }
+    fsdReplay.setSpeedFactor(speed);
+    fsdReplay.setFanOut(fanOut);
+    fsdReplay.measureStoredSituations(provider);
+    fsdReplay.setMeasureInterpolation(true);
+    QObject::connect(&fsdReplay, &CFsdReplay::finished, &qa, [&]
+    {
+        QTextStream(stdout) << fsdReplay.getStatisticsAsText() << Qt::endl;
+        qa.quit();
+    }, Qt::QueuedConnection);
+    fsdReplay.start();
+    return qa.exec();
+}
+
 //! main
 int main(int argc, char *argv[])
 {
     QCoreApplication qa(argc, argv);
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    const QCommandLineOption replayOption("replay", "Replay a raw FSD message log instead of connecting", "file");
+    const QCommandLineOption speedOption("speed", "Replay speed factor, 0 means as fast as possible", "factor", "1");
+    const QCommandLineOption fanOutOption("fanout", "Replay each recorded pilot N times", "N", "1");
+    parser.addOptions({ replayOption, speedOption, fanOutOption });
+    parser.process(qa);
+
     COwnAircraftProviderDummy::instance()->updateOwnCallsign("BER368");
 
     CFSDClient client(CClientProviderDummy::instance(), COwnAircraftProviderDummy::instance(), CRemoteAircraftProviderDummy::instance(), &qa);
@@ -41,6 +81,12 @@ int main(int argc, char *argv[])
     client.setServer(server);
     client.setSimType(CSimulatorInfo::xplane());
     client.setPilotRating(PilotRating::Student);
+
+    if (parser.isSet(replayOption))
+    {
+        return replay(qa, client, parser.value(replayOption), parser.value(speedOption).toDouble(), parser.value(fanOutOption).toInt());
+    }
+
     client.printToConsole(true);
 
     /*client.sendFsdMessage("$CRLOWW_F_APP:LHA449:ATIS:V:voice.vacc.ch/loww_f_app\r\n");
@@ -11,6 +11,7 @@ SUBDIRS += sampleblackmiscsim
 SUBDIRS += samplehotkey
 SUBDIRS += sampleweatherdata
 SUBDIRS += samplefsd
+SUBDIRS += sampleafvpipeline
 # SUBDIRS += afvclient
 
 samplecliclient.file = cliclient/samplecliclient.pro
@@ -21,6 +22,7 @@ sampleblackmiscsim.file = blackmiscsim/sampleblackmiscsim.pro
 samplehotkey.file = hotkey/samplehotkey.pro
 sampleweatherdata.file = weatherdata/sampleweatherdata.pro
 samplefsd.file = fsd/samplefsd.pro
+sampleafvpipeline.file = afvpipeline/sampleafvpipeline.pro
 # afvclient.file = afvclient/afvclient.pro
 
 load(common_post)
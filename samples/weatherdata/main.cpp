@@ -37,12 +37,15 @@ int main(int argc, char *argv[])
     CLineReader lineReader(&a);
     CWeatherDataPrinter printer(&a);
     QObject::connect(&lineReader, &CLineReader::weatherDataRequest, &printer, &CWeatherDataPrinter::fetchAndPrintWeatherData);
+    QObject::connect(&lineReader, &CLineReader::weatherDataFromFileRequest, &printer, &CWeatherDataPrinter::fetchAndPrintWeatherDataFromFile);
     QObject::connect(&lineReader, &CLineReader::wantsToQuit, &lineReader, &CLineReader::terminate);
     QObject::connect(&lineReader, &CLineReader::finished, &a, &QCoreApplication::quit);
 
     QTextStream qtout(stdout);
     qtout << "Usage: <lat> <lon>" << Qt::endl;
     qtout << "Example: 48.5 11.5" << Qt::endl;
+    qtout << "Usage: file <grib2 file> <lat> <lon> [repeat]" << Qt::endl;
+    qtout << "Example: file gfs.t00z.pgrb2.0p25.f001 48.5 11.5 10" << Qt::endl;
     qtout << "Type x to quit" << Qt::endl;
 
     lineReader.start();
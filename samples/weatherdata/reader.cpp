@@ -54,11 +54,22 @@ void CLineReader::run()
             const CCoordinateGeodetic position { latitude, longitude, alt};
             emit weatherDataRequest(position);
         }
+        else if ((parts.size() == 4 || parts.size() == 5) && parts.front() == "file")
+        {
+            const CLatitude  latitude(CAngle::parsedFromString(parts.at(2), CPqString::SeparatorBestGuess, CAngleUnit::deg()));
+            const CLongitude longitude(CAngle::parsedFromString(parts.at(3), CPqString::SeparatorBestGuess, CAngleUnit::deg()));
+            const CAltitude  alt(600, CLengthUnit::m());
+            const int repeat = parts.size() == 5 ? qMax(1, parts.at(4).toInt()) : 1;
+
+            const CCoordinateGeodetic position { latitude, longitude, alt};
+            emit weatherDataFromFileRequest(parts.at(1), position, repeat);
+        }
         else
         {
             QTextStream qtout(stdout);
             qtout << "Invalid command." << Qt::endl;
             qtout << "Usage: <lat> <lon>" << Qt::endl;
+            qtout << "Usage: file <grib2 file> <lat> <lon> [repeat]" << Qt::endl;
         }
     }
 }
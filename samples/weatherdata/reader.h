@@ -36,6 +36,9 @@ signals:
     //! User is asking for weather data
     void weatherDataRequest(const BlackMisc::Geo::CCoordinateGeodetic &position);
 
+    //! User is asking for weather data from a local GRIB file, parsed repeat times
+    void weatherDataFromFileRequest(const QString &filePath, const BlackMisc::Geo::CCoordinateGeodetic &position, int repeat);
+
     //! User is asking to quit
     void wantsToQuit();
 };
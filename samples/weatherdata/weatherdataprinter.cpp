@@ -55,6 +55,45 @@ void CWeatherDataPrinter::fetchAndPrintWeatherData(const CCoordinateGeodetic &po
     m_weatherManger.requestWeatherGrid(weatherGrid, { this, &CWeatherDataPrinter::printWeatherData });
 }
 
+void CWeatherDataPrinter::fetchAndPrintWeatherDataFromFile(const QString &filePath, const CCoordinateGeodetic &position, int repeat)
+{
+    QTextStream qtout(stdout);
+    qtout << "Position:" << position.toQString(true) << Qt::endl;
+    qtout << "Parsing " << filePath << " " << repeat << " times..." << Qt::endl;
+
+    m_filePath = filePath;
+    m_fileGrid = CWeatherGrid { { "", position } };
+    m_fileRunsLeft = repeat;
+    m_fileRuns = 0;
+    m_fileRunsTotalMs = 0;
+    this->startFileRun();
+}
+
+void CWeatherDataPrinter::startFileRun()
+{
+    m_fileRunsLeft--;
+    m_fileRunTime.start();
+    m_weatherManger.requestWeatherGridFromFile(m_filePath, m_fileGrid, { this, &CWeatherDataPrinter::fileRunFinished });
+}
+
+void CWeatherDataPrinter::fileRunFinished(const CWeatherGrid &weatherGrid)
+{
+    const qint64 ms = m_fileRunTime.elapsed();
+    m_fileRuns++;
+    m_fileRunsTotalMs += ms;
+
+    QTextStream qtout(stdout);
+    qtout << "run " << m_fileRuns << ": " << ms << "ms, " << weatherGrid.size() << " grid points" << Qt::endl;
+    if (m_fileRunsLeft > 0)
+    {
+        this->startFileRun();
+        return;
+    }
+
+    qtout << "average: " << (m_fileRunsTotalMs / m_fileRuns) << "ms" << Qt::endl;
+    this->printWeatherData(weatherGrid);
+}
+
 void CWeatherDataPrinter::printWeatherData(const CWeatherGrid &weatherGrid)
 {
     QTextStream qtout(stdout);
@@ -16,6 +16,7 @@
 #include "blackmisc/geo/coordinategeodetic.h"
 #include "blackmisc/weather/weathergrid.h"
 
+#include <QElapsedTimer>
 #include <QObject>
 
 /*!
@@ -32,10 +33,26 @@ public:
     //! Fetch new weather data for given position and print it once received
     void fetchAndPrintWeatherData(const BlackMisc::Geo::CCoordinateGeodetic &position);
 
+    //! Parse weather data for given position from a local GRIB file repeat times and print the timing
+    void fetchAndPrintWeatherDataFromFile(const QString &filePath, const BlackMisc::Geo::CCoordinateGeodetic &position, int repeat);
+
 private:
     //! Print weather data to stdout
     void printWeatherData(const BlackMisc::Weather::CWeatherGrid &weatherGrid);
 
+    //! One file based run has finished
+    void fileRunFinished(const BlackMisc::Weather::CWeatherGrid &weatherGrid);
+
+    //! Next file based run
+    void startFileRun();
+
+    QString m_filePath;                          //!< GRIB file of the benchmark
+    BlackMisc::Weather::CWeatherGrid m_fileGrid; //!< requested grid of the benchmark
+    int m_fileRunsLeft = 0;                      //!< remaining runs
+    int m_fileRuns = 0;                          //!< finished runs
+    qint64 m_fileRunsTotalMs = 0;                //!< total time of all runs
+    QElapsedTimer m_fileRunTime;                 //!< time of current run
+
     BlackCore::CWeatherManager m_weatherManger { this };
 };
 
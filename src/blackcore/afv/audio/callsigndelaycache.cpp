@@ -8,40 +8,58 @@
 
 #include "blackcore/afv/audio/callsigndelaycache.h"
 
+#include <QMutexLocker>
+
 namespace BlackCore::Afv::Audio
 {
     void CallsignDelayCache::initialise(const QString &callsign)
     {
+        QMutexLocker l(&m_mutex);
         if (!m_delayCache.contains(callsign)) { m_delayCache[callsign] = delayDefault; }
         if (!successfulTransmissionsCache.contains(callsign)) { successfulTransmissionsCache[callsign] = 0; }
     }
 
     int CallsignDelayCache::get(const QString &callsign)
     {
+        QMutexLocker l(&m_mutex);
         return m_delayCache[callsign];
     }
 
     void CallsignDelayCache::underflow(const QString &callsign)
     {
+        QMutexLocker l(&m_mutex);
         if (!successfulTransmissionsCache.contains(callsign)) return;
 
         successfulTransmissionsCache[callsign] = 0;
-        increaseDelayMs(callsign);
+        increaseDelayMsImpl(callsign);
     }
 
     void CallsignDelayCache::success(const QString &callsign)
     {
+        QMutexLocker l(&m_mutex);
         if (!successfulTransmissionsCache.contains(callsign)) return;
 
         successfulTransmissionsCache[callsign]++;
         if (successfulTransmissionsCache[callsign] > 5)
         {
-            decreaseDelayMs(callsign);
+            decreaseDelayMsImpl(callsign);
             successfulTransmissionsCache[callsign] = 0;
         }
     }
 
     void CallsignDelayCache::increaseDelayMs(const QString &callsign)
+    {
+        QMutexLocker l(&m_mutex);
+        this->increaseDelayMsImpl(callsign);
+    }
+
+    void CallsignDelayCache::decreaseDelayMs(const QString &callsign)
+    {
+        QMutexLocker l(&m_mutex);
+        this->decreaseDelayMsImpl(callsign);
+    }
+
+    void CallsignDelayCache::increaseDelayMsImpl(const QString &callsign)
     {
         if (!m_delayCache.contains(callsign))
             return;
@@ -53,7 +71,7 @@ namespace BlackCore::Afv::Audio
         }
     }
 
-    void CallsignDelayCache::decreaseDelayMs(const QString &callsign)
+    void CallsignDelayCache::decreaseDelayMsImpl(const QString &callsign)
     {
         if (!m_delayCache.contains(callsign))
             return;
@@ -12,11 +12,13 @@
 #define BLACKORE_AFV_AUDIO_CALLSIGNDELAYCACHE_H
 
 #include <QHash>
+#include <QMutex>
 #include <QString>
 
 namespace BlackCore::Afv::Audio
 {
     //! Callsign delay cache
+    //! \remark underflows are reported from the receiver render threads, so all access is locked
     class CallsignDelayCache
     {
     public:
@@ -45,11 +47,18 @@ namespace BlackCore::Afv::Audio
         //! Ctor
         CallsignDelayCache() = default;
 
+        //! Delay plus/minus, caller holds the lock
+        //! @{
+        void increaseDelayMsImpl(const QString &callsign);
+        void decreaseDelayMsImpl(const QString &callsign);
+        //! @}
+
         static constexpr int delayDefault = 60;
         static constexpr int delayMin = 40;
         static constexpr int delayIncrement = 20;
         static constexpr int delayMax = 300;
 
+        QMutex m_mutex;
         QHash<QString, int> m_delayCache;
         QHash<QString, int> successfulTransmissionsCache;
     };
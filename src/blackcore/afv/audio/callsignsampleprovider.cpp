@@ -18,8 +18,10 @@
 
 #include <QtMath>
 #include <QDebug>
+#include <QMutexLocker>
 #include <QStringLiteral>
 #include <QStringBuilder>
+#include <QThread>
 
 using namespace BlackMisc;
 using namespace BlackSound::SampleProvider;
@@ -88,15 +90,22 @@ namespace BlackCore::Afv::Audio
             m_underflow = true;
         }
 
+        // offline rendering, simulated time instead of the timer
+        if (m_simulatedClockMs && this->isIdleTimeout()) { idle(); }
+
         return noOfSamples;
     }
 
     void CCallsignSampleProvider::timerElapsed()
     {
-        if (m_inUse && m_audioInput->getBufferedBytes() == 0 && m_lastSamplesAddedUtc.msecsTo(QDateTime::currentDateTimeUtc()) > m_idleTimeoutMs)
-        {
-            idle();
-        }
+        // the receiver may be rendering this provider in another thread
+        QMutexLocker l(m_receiver->mutex());
+        if (this->isIdleTimeout()) { idle(); }
+    }
+
+    bool CCallsignSampleProvider::isIdleTimeout() const
+    {
+        return m_inUse && m_audioInput->getBufferedBytes() == 0 && this->nowMs() - m_lastSamplesAddedMs > m_idleTimeoutMs;
     }
 
     void CCallsignSampleProvider::active(const QString &callsign, const QString &aircraftType)
@@ -145,8 +154,8 @@ namespace BlackCore::Afv::Audio
         m_audioInput->addSamples(BlackSound::convertFromShortToFloat(audio));
         m_lastPacketLatch = audioDto.lastPacket;
         if (audioDto.lastPacket && !m_underflow) { CallsignDelayCache::instance().success(m_callsign); }
-        m_lastSamplesAddedUtc = QDateTime::currentDateTimeUtc();
-        if (!m_timer->isActive()) { m_timer->start(); }
+        m_lastSamplesAddedMs = this->nowMs();
+        if (!m_simulatedClockMs && !m_timer->isActive()) { m_timer->start(); }
     }
 
     void CCallsignSampleProvider::addSilentSamples(const IAudioDto &audioDto)
@@ -157,13 +166,15 @@ namespace BlackCore::Afv::Audio
         // TODO audioInput->addSamples(decoderByteBuffer, 0, frameCount * 2);
         m_lastPacketLatch = audioDto.lastPacket;
 
-        m_lastSamplesAddedUtc = QDateTime::currentDateTimeUtc();
-        if (!m_timer->isActive()) { m_timer->start(); }
+        m_lastSamplesAddedMs = this->nowMs();
+        if (!m_simulatedClockMs && !m_timer->isActive()) { m_timer->start(); }
     }
 
     void CCallsignSampleProvider::idle()
     {
-        m_timer->stop();
+        // also called when rendering in a thread of the mixer, the timer can only be stopped in its own thread
+        if (QThread::currentThread() == m_timer->thread()) { m_timer->stop(); }
+        else { QMetaObject::invokeMethod(m_timer, &QTimer::stop, Qt::QueuedConnection); }
         m_inUse = false;
         setEffects();
         m_callsign.clear();
@@ -26,6 +26,7 @@
 #include <QSharedPointer>
 #include <QTimer>
 #include <QDateTime>
+#include <functional>
 
 namespace BlackCore::Afv::Audio
 {
@@ -70,12 +71,18 @@ namespace BlackCore::Afv::Audio
         //! Bypass effects
         void setBypassEffects(bool bypassEffects);
 
+        //! Simulated time in ms instead of the wall clock, for offline rendering
+        //! \remark without timer, idle is detected when reading the samples
+        void setSimulatedClock(const std::function<qint64()> &clockMs) { m_simulatedClockMs = clockMs; }
+
         //! Info
         QString toQString() const;
 
     private:
         void timerElapsed();
         void idle();
+        bool isIdleTimeout() const;
+        qint64 nowMs() const { return m_simulatedClockMs ? m_simulatedClockMs() : QDateTime::currentMSecsSinceEpoch(); }
         QVector<qint16> decodeOpus(const QByteArray &opusData);
         void setEffects(bool noEffects = false);
 
@@ -106,7 +113,8 @@ namespace BlackCore::Afv::Audio
 
         BlackSound::Codecs::COpusDecoder m_decoder;
         bool m_lastPacketLatch = false;
-        QDateTime m_lastSamplesAddedUtc;
+        qint64 m_lastSamplesAddedMs = 0;
+        std::function<qint64()> m_simulatedClockMs; //!< offline rendering, otherwise wall clock
         bool m_underflow = false;
     };
 } // ns
@@ -15,7 +15,9 @@
 #include "blacksound/sampleprovider/samples.h"
 
 #include <QDebug>
+#include <QMutexLocker>
 #include <QStringBuilder>
+#include <QThread>
 
 using namespace BlackMisc;
 using namespace BlackMisc::Audio;
@@ -52,14 +54,25 @@ namespace BlackCore::Afv::Audio
 
     void CReceiverSampleProvider::setBypassEffects(bool value)
     {
+        QMutexLocker l(&m_mutex);
         for (CCallsignSampleProvider *voiceInput : std::as_const(m_voiceInputs))
         {
             voiceInput->setBypassEffects(value);
         }
     }
 
+    void CReceiverSampleProvider::setSimulatedClock(const std::function<qint64()> &clockMs)
+    {
+        QMutexLocker l(&m_mutex);
+        for (CCallsignSampleProvider *voiceInput : std::as_const(m_voiceInputs))
+        {
+            voiceInput->setSimulatedClock(clockMs);
+        }
+    }
+
     void CReceiverSampleProvider::setFrequency(const uint &frequencyHz)
     {
+        QMutexLocker l(&m_mutex);
         if (frequencyHz != m_frequencyHz)
         {
             for (CCallsignSampleProvider *voiceInput : std::as_const(m_voiceInputs))
@@ -71,6 +84,12 @@ namespace BlackCore::Afv::Audio
     }
 
     int CReceiverSampleProvider::activeCallsigns() const
+    {
+        QMutexLocker l(&m_mutex);
+        return this->activeCallsignsImpl();
+    }
+
+    int CReceiverSampleProvider::activeCallsignsImpl() const
     {
         const int numberOfCallsigns = static_cast<int>(std::count_if(m_voiceInputs.begin(), m_voiceInputs.end(), [](const CCallsignSampleProvider * p)
         {
@@ -81,6 +100,7 @@ namespace BlackCore::Afv::Audio
 
     void CReceiverSampleProvider::setMute(bool value)
     {
+        QMutexLocker l(&m_mutex);
         m_mute = value;
         if (value)
         {
@@ -93,7 +113,8 @@ namespace BlackCore::Afv::Audio
 
     int CReceiverSampleProvider::readSamples(QVector<float> &samples, qint64 count)
     {
-        int numberOfInUseInputs = activeCallsigns();
+        QMutexLocker l(&m_mutex);
+        int numberOfInUseInputs = this->activeCallsignsImpl();
         if (numberOfInUseInputs > 1 && m_doBlockWhenAppropriate)
         {
             m_blockTone->setFrequency(180.0);
@@ -106,16 +127,24 @@ namespace BlackCore::Afv::Audio
 
         if (m_doClickWhenAppropriate && numberOfInUseInputs == 0)
         {
-            CResourceSoundSampleProvider *resourceSound = new CResourceSoundSampleProvider(Samples::instance().click(), m_mixer);
-            m_mixer->addMixerInput(resourceSound);
+            if (QThread::currentThread() == this->thread())
+            {
+                CResourceSoundSampleProvider *resourceSound = new CResourceSoundSampleProvider(Samples::instance().click(), m_mixer);
+                m_mixer->addMixerInput(resourceSound);
+            }
+            else
+            {
+                this->queueClick();
+            }
             m_doClickWhenAppropriate = false;
             // CLogMessage(this).debug(u"AFV Click...");
         }
 
         //! \todo KB 2020-04 not entirely correct, as it can be the number is the same, but changed callsign
-        if (numberOfInUseInputs != m_lastNumberOfInUseInputs)
+        const bool callsignsChanged = numberOfInUseInputs != m_lastNumberOfInUseInputs;
+        QStringList receivingCallsigns;
+        if (callsignsChanged)
         {
-            QStringList receivingCallsigns;
             for (const CCallsignSampleProvider *voiceInput : std::as_const(m_voiceInputs))
             {
                 const QString callsign = voiceInput->callsign();
@@ -127,15 +156,23 @@ namespace BlackCore::Afv::Audio
 
             m_receivingCallsignsString = receivingCallsigns.join(',');
             m_receivingCallsigns = CCallsignSet(receivingCallsigns);
+        }
+        m_lastNumberOfInUseInputs = numberOfInUseInputs;
+        const int samplesRead = m_volume->readSamples(samples, count);
+        l.unlock();
+
+        // emitted without the lock, the receivers may call back
+        if (callsignsChanged)
+        {
             const TransceiverReceivingCallsignsChangedArgs args = { m_id, receivingCallsigns };
             emit receivingCallsignsChanged(args);
         }
-        m_lastNumberOfInUseInputs = numberOfInUseInputs;
-        return m_volume->readSamples(samples, count);
+        return samplesRead;
     }
 
     void CReceiverSampleProvider::addOpusSamples(const IAudioDto &audioDto, uint frequency, float distanceRatio)
     {
+        QMutexLocker l(&m_mutex);
         if (m_frequencyHz != frequency) { return; } // Lag in the backend means we get the tail end of a transmission
         CCallsignSampleProvider *voiceInput = nullptr;
 
@@ -172,6 +209,7 @@ namespace BlackCore::Afv::Audio
     void CReceiverSampleProvider::addSilentSamples(const IAudioDto &audioDto, uint frequency, float distanceRatio)
     {
         Q_UNUSED(distanceRatio)
+        QMutexLocker l(&m_mutex);
         if (m_frequencyHz != frequency) { return; } // Lag in the backend means we get the tail end of a transmission
 
         CCallsignSampleProvider *voiceInput = nullptr;
@@ -201,9 +239,32 @@ namespace BlackCore::Afv::Audio
         }
     }
 
-    uint CReceiverSampleProvider::getFrequencyHz() const
+    QString CReceiverSampleProvider::getReceivingCallsignsString() const
+    {
+        QMutexLocker l(&m_mutex);
+        return m_receivingCallsignsString;
+    }
+
+    CCallsignSet CReceiverSampleProvider::getReceivingCallsigns() const
+    {
+        QMutexLocker l(&m_mutex);
+        return m_receivingCallsigns;
+    }
+
+    bool CReceiverSampleProvider::setGainRatio(double gainRatio)
+    {
+        QMutexLocker l(&m_mutex);
+        return m_volume->setGainRatio(gainRatio);
+    }
+
+    void CReceiverSampleProvider::queueClick()
     {
-        return m_frequencyHz;
+        QMetaObject::invokeMethod(this, [ = ]
+        {
+            QMutexLocker l(&m_mutex);
+            CResourceSoundSampleProvider *resourceSound = new CResourceSoundSampleProvider(Samples::instance().click(), m_mixer);
+            m_mixer->addMixerInput(resourceSound);
+        }, Qt::QueuedConnection);
     }
 
     void CReceiverSampleProvider::logVoiceInputs(const QString &prefix, qint64 timeCheckOffsetMs)
@@ -215,6 +276,7 @@ namespace BlackCore::Afv::Audio
             m_lastLogMessage = now;
         }
 
+        QMutexLocker lock(&m_mutex);
         QString l;
         int no = 0;
         for (const CCallsignSampleProvider *sp : std::as_const(m_voiceInputs))
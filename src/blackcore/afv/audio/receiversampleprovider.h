@@ -21,7 +21,10 @@
 #include "blackmisc/aviation/callsignset.h"
 #include "blackmisc/audio/audiosettings.h"
 
+#include <QMutex>
 #include <QtGlobal>
+#include <atomic>
+#include <functional>
 
 namespace BlackCore::Afv::Audio
 {
@@ -33,6 +36,7 @@ namespace BlackCore::Afv::Audio
     };
 
     //! A sample provider
+    //! \remark rendered in a thread of CParallelMixingSampleProvider, all public methods lock the receiver
     class CReceiverSampleProvider : public BlackSound::SampleProvider::ISampleProvider
     {
         Q_OBJECT
@@ -47,6 +51,9 @@ namespace BlackCore::Afv::Audio
         //! Bypass effects
         void setBypassEffects(bool value);
 
+        //! \copydoc CCallsignSampleProvider::setSimulatedClock
+        void setSimulatedClock(const std::function<qint64()> &clockMs);
+
         //! Frequency
         void setFrequency(const uint &frequencyHz);
 
@@ -76,17 +83,21 @@ namespace BlackCore::Afv::Audio
 
         //! Receiving callsigns as string
         //! \remark those callsigns are transmitting and "I do receive them"
-        const QString &getReceivingCallsignsString() const { return m_receivingCallsignsString; }
+        QString getReceivingCallsignsString() const;
 
         //! Receiving callsigns
         //! \remark those callsigns are transmitting and "I do receive them"
-        const BlackMisc::Aviation::CCallsignSet &getReceivingCallsigns() { return m_receivingCallsigns; }
+        BlackMisc::Aviation::CCallsignSet getReceivingCallsigns() const;
 
         //! Get frequency in Hz
-        uint getFrequencyHz() const;
+        //! \remark lock free, also used by the voice inputs while rendering
+        uint getFrequencyHz() const { return m_frequencyHz; }
 
         //! Set gain ratio
-        bool setGainRatio(double gainRatio) { return m_volume->setGainRatio(gainRatio); }
+        bool setGainRatio(double gainRatio);
+
+        //! Lock of the receiver and its voice inputs, held while rendering
+        QMutex *mutex() const { return &m_mutex; }
 
         //! Log all inputs
         //! \private DEBUG only
@@ -97,8 +108,15 @@ namespace BlackCore::Afv::Audio
         void receivingCallsignsChanged(const TransceiverReceivingCallsignsChangedArgs &args);
 
     private:
-        uint m_frequencyHz = 122800000;
-        bool m_mute        = false;
+        //! Number of active callsigns, caller holds the lock
+        int activeCallsignsImpl() const;
+
+        //! Play the click in the thread of the receiver, as it creates a QObject
+        void queueClick();
+
+        mutable QMutex m_mutex;
+        std::atomic<uint> m_frequencyHz { 122800000 };
+        std::atomic_bool  m_mute { false };
         const double m_clickGain     = 1.0;
         const double m_blockToneGain = 0.10;
 
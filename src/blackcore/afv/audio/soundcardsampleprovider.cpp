@@ -17,8 +17,11 @@ using namespace BlackSound::SampleProvider;
 namespace BlackCore::Afv::Audio
 {
     CSoundcardSampleProvider::CSoundcardSampleProvider(int sampleRate, const QVector<quint16> &transceiverIDs, QObject *parent) :
-        ISampleProvider(parent),
-        m_mixer(new CMixingSampleProvider())
+        CSoundcardSampleProvider(sampleRate, transceiverIDs, CParallelMixingSampleProvider::Threaded, parent)
+    { }
+
+    CSoundcardSampleProvider::CSoundcardSampleProvider(int sampleRate, const QVector<quint16> &transceiverIDs, CParallelMixingSampleProvider::RenderMode renderMode, QObject *parent) :
+        ISampleProvider(parent)
     {
         const QString on = QStringLiteral("%1 sample rate: %2, transceivers: %3").arg(classNameShort(this)).arg(sampleRate).arg(transceiverIDs.size());
         this->setObjectName(on);
@@ -30,7 +33,7 @@ namespace BlackCore::Afv::Audio
         m_waveFormat.setByteOrder(QAudioFormat::LittleEndian);
         m_waveFormat.setCodec("audio/pcm");
 
-        m_mixer = new CMixingSampleProvider(this);
+        m_mixer = new CParallelMixingSampleProvider(renderMode, this);
         m_receiverIDs = transceiverIDs;
 
         constexpr int voiceInputNumber = 4; // number of CallsignSampleProviders
@@ -52,6 +55,14 @@ namespace BlackCore::Afv::Audio
         }
     }
 
+    void CSoundcardSampleProvider::setSimulatedClock(const std::function<qint64()> &clockMs)
+    {
+        for (CReceiverSampleProvider *receiverInput : std::as_const(m_receiverInputs))
+        {
+            receiverInput->setSimulatedClock(clockMs);
+        }
+    }
+
     void CSoundcardSampleProvider::pttUpdate(bool active, const QVector<TxTransceiverDto> &txTransceivers)
     {
         if (active)
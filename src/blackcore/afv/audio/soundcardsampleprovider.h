@@ -12,16 +12,17 @@
 #define BLACKCORE_AFV_AUDIO_SOUNDCARDSAMPLEPROVIDER_H
 
 #include "blacksound/sampleprovider/sampleprovider.h"
-#include "blacksound/sampleprovider/mixingsampleprovider.h"
+#include "blacksound/sampleprovider/parallelmixingsampleprovider.h"
 #include "blackcore/afv/audio/receiversampleprovider.h"
 #include "blackmisc/aviation/callsignset.h"
 
 #include <QAudioFormat>
 #include <QObject>
+#include <functional>
 
 namespace BlackCore::Afv::Audio
 {
-    //! Soundcard sample
+    //! Soundcard sample, the receivers are rendered in parallel one frame ahead
     class CSoundcardSampleProvider : public BlackSound::SampleProvider::ISampleProvider
     {
         Q_OBJECT
@@ -30,12 +31,19 @@ namespace BlackCore::Afv::Audio
         //! Ctor
         CSoundcardSampleProvider(int sampleRate, const QVector<quint16> &transceiverIDs, QObject *parent = nullptr);
 
+        //! Ctor with render mode, BlackSound::SampleProvider::CParallelMixingSampleProvider::Offline for tests
+        CSoundcardSampleProvider(int sampleRate, const QVector<quint16> &transceiverIDs,
+                                 BlackSound::SampleProvider::CParallelMixingSampleProvider::RenderMode renderMode, QObject *parent = nullptr);
+
         //! Wave format
         const QAudioFormat &waveFormat() const { return m_waveFormat; }
 
         //! Bypass effects
         void setBypassEffects(bool value);
 
+        //! \copydoc CCallsignSampleProvider::setSimulatedClock
+        void setSimulatedClock(const std::function<qint64()> &clockMs);
+
         //! Update PTT
         void pttUpdate(bool active, const QVector<TxTransceiverDto> &txTransceivers);
 
@@ -57,13 +65,17 @@ namespace BlackCore::Afv::Audio
         //! Setting gain for specified receiver
         bool setGainRatioForTransceiver(quint16 transceiverID, double gainRatio);
 
+        //! Mixing statistics, including the underruns
+        //! \threadsafe
+        BlackSound::SampleProvider::CParallelMixingSampleProvider::Metrics getMixingMetrics() const { return m_mixer->getMetrics(); }
+
     signals:
         //! Changed callsigns
         void receivingCallsignsChanged(const TransceiverReceivingCallsignsChangedArgs &args);
 
     private:
         QAudioFormat m_waveFormat;
-        BlackSound::SampleProvider::CMixingSampleProvider *m_mixer = nullptr;
+        BlackSound::SampleProvider::CParallelMixingSampleProvider *m_mixer = nullptr;
         QVector<CReceiverSampleProvider *> m_receiverInputs;
         QVector<quint16> m_receiverIDs;
     };
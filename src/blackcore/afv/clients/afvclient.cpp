@@ -37,6 +37,8 @@ using namespace BlackSound::SampleProvider;
 namespace BlackCore::Afv::Clients
 {
     constexpr int CAfvClient::PositionUpdatesMs;
+    constexpr int CAfvClient::TransceiverRefreshMs;
+    constexpr double CAfvClient::AliasCachePositionThresholdM;
     constexpr int CAfvClient::SampleRate;
     constexpr int CAfvClient::FrameSize;
     constexpr double CAfvClient::MinDbIn;
@@ -98,17 +100,14 @@ namespace BlackCore::Afv::Clients
 
     void CAfvClient::initTransceivers()
     {
+        m_transceiverState.sharedWrite([](CTransceiverState & state)
         {
-            QMutexLocker lock(&m_mutexTransceivers);
-            m_transceivers =
+            state = CTransceiverState(
             {
                 { 0, UniCom, 48.5, 11.5, 1000.0, 1000.0 },
                 { 1, UniCom, 48.5, 11.5, 1000.0, 1000.0 }
-            };
-
-            m_enabledTransceivers = { 0, 1 };
-            m_transmittingTransceivers = { { 0 } }; // TxTransceiverDto
-        }
+            }, { 0, 1 }, { { 0 } }); // TxTransceiverDto
+        });
 
         // init with context values
         this->connectWithContexts();
@@ -124,6 +123,11 @@ namespace BlackCore::Afv::Clients
         this->disconnect(sApp->getIContextOwnAircraft());
         sApp->getIContextOwnAircraft()->disconnect(this);
         connect(sApp->getIContextOwnAircraft(), &IContextOwnAircraft::changedAircraftCockpit, this, &CAfvClient::onUpdateTransceiversFromContext, Qt::QueuedConnection);
+
+        // the closest station of an aliased frequency might have changed
+        this->disconnect(sApp->getIContextNetwork());
+        sApp->getIContextNetwork()->disconnect(this);
+        connect(sApp->getIContextNetwork(), &IContextNetwork::changedAtcStationsOnlineDigest, this, [ = ] { this->clearAliasFrequencyCache(); }, Qt::QueuedConnection);
         m_connectedWithContext = true;
     }
 
@@ -193,6 +197,12 @@ namespace BlackCore::Afv::Clients
                     // HF stations aliased
                     const QVector<StationDto> aliasedStations = m_connection->getAllAliasedStations();
                     this->setAliasedStations(aliasedStations); // threadsafe
+
+                    // new session, the voice server knows nothing about our transceivers
+                    {
+                        QMutexLocker lock2(&m_mutexConnection);
+                        m_sentTransceiversMsSinceEpoch = -1;
+                    }
                     this->onTimerUpdate();
 
                     // const bool isConnected = this->isConnected(); // threadsafe
@@ -391,6 +401,10 @@ namespace BlackCore::Afv::Clients
             m_output->stop();
         }
         CLogMessage(this).info(u"AFV Client stopped");
+        if (m_soundcardSampleProvider)
+        {
+            CLogMessage(this).info(u"AFV receiver mixing %1") << m_soundcardSampleProvider->getMixingMetrics().toQString();
+        }
 
         if (this->isMuted()) { this->setMuted(false); }
 
@@ -451,12 +465,7 @@ namespace BlackCore::Afv::Clients
 
     void CAfvClient::enableTransceiver(quint16 id, bool enable)
     {
-        {
-            QMutexLocker lock(&m_mutexTransceivers);
-            if (enable) { m_enabledTransceivers.insert(id); }
-            else        { m_enabledTransceivers.remove(id); }
-        }
-
+        m_transceiverState.sharedWrite([ = ](CTransceiverState & state) { state.setEnabled(id, enable); });
         this->updateTransceivers();
     }
 
@@ -468,15 +477,7 @@ namespace BlackCore::Afv::Clients
     bool CAfvClient::isEnabledTransceiver(quint16 id) const
     {
         // we double check, enabled and exist!
-        const auto enabledTransceivers = this->getEnabledTransceivers(); // threadsafe
-        if (!enabledTransceivers.contains(id)) { return false; }
-
-        const auto transceivers = this->getTransceivers(); // threadsafe
-        for (const TransceiverDto &dto : transceivers)
-        {
-            if (dto.id == id) { return true; }
-        }
-        return false;
+        return m_transceiverState.read()->isEnabled(id);
     }
 
     bool CAfvClient::isEnabledComUnit(CComSystem::ComUnit comUnit) const
@@ -492,20 +493,11 @@ namespace BlackCore::Afv::Clients
         quint32 roundedFrequencyHz = static_cast<quint32>(qRound(frequencyHz / 1000.0)) * 1000;
         roundedFrequencyHz = this->getAliasFrequencyHz(roundedFrequencyHz);
 
-        bool update = false;
-        {
-            QMutexLocker lockTransceivers(&m_mutexTransceivers);
-            if (m_transceivers.size() >= id + 1)
-            {
-                if (m_transceivers[id].frequencyHz != roundedFrequencyHz)
-                {
-                    update = true;
-                    m_transceivers[id].frequencyHz = roundedFrequencyHz;
-                }
-            }
-        }
+        // unchanged frequencies do not create a new snapshot
+        if (m_transceiverState.read()->getFrequencyHz(id, roundedFrequencyHz) == roundedFrequencyHz) { return; }
 
-        // outside lock to avoid deadlock
+        bool update = false;
+        m_transceiverState.sharedWrite([&](CTransceiverState & state) { update = state.setFrequencyHz(id, roundedFrequencyHz); });
         if (update)
         {
             this->updateTransceivers(false); // no frequency update
@@ -525,14 +517,11 @@ namespace BlackCore::Afv::Clients
 
     void CAfvClient::updatePosition(double latitudeDeg, double longitudeDeg, double heightMeters)
     {
-        QMutexLocker lock(&m_mutexTransceivers);
-        for (TransceiverDto &transceiver : m_transceivers)
-        {
-            transceiver.LatDeg = latitudeDeg;
-            transceiver.LonDeg = longitudeDeg;
-            transceiver.HeightAglM = heightMeters;
-            transceiver.HeightMslM = heightMeters;
-        }
+        // small movements do not create a new snapshot
+        CTransceiverState moved(m_transceiverState.read().get());
+        moved.setPosition(latitudeDeg, longitudeDeg, heightMeters);
+        if (!moved.isChanged(m_transceiverState.read())) { return; }
+        m_transceiverState.sharedWrite([ = ](CTransceiverState & state) { state.setPosition(latitudeDeg, longitudeDeg, heightMeters); });
     }
 
     void CAfvClient::updateTransceivers(bool updateFrequencies)
@@ -553,29 +542,33 @@ namespace BlackCore::Afv::Clients
             }
         }
 
-        // threadsafe copies
-        const auto transceivers = this->getTransceivers();
-        const auto enabledTransceivers = this->getEnabledTransceivers();
-        const QString callsign = this->getCallsign(); // threadsafe
-
-        // transceivers
-        QVector<TransceiverDto> newEnabledTransceivers;
-        for (const TransceiverDto &transceiver : transceivers)
-        {
-            if (enabledTransceivers.contains(transceiver.id))
-            {
-                newEnabledTransceivers.push_back(transceiver);
-            }
-        }
+        this->updateTransceiversOnServer(m_transceiverState.read()); // threadsafe snapshot
+    }
 
+    void CAfvClient::updateTransceiversOnServer(const CTransceiverState &state)
+    {
         // in connection and soundcard only use the enabled transceivers
+        const QVector<TransceiverDto> &enabledTransceivers = state.getEnabledTransceivers();
+        const QString callsign = this->getCallsign(); // threadsafe
         {
             QMutexLocker lock(&m_mutexConnection);
-            if (m_connection) { m_connection->updateTransceivers(callsign, newEnabledTransceivers); }
+            if (m_connection && m_connection->isConnected())
+            {
+                // fire to network and forget, but only if something relevant changed
+                const qint64 now = QDateTime::currentMSecsSinceEpoch();
+                const bool refresh = m_sentTransceiversMsSinceEpoch < 0 || now - m_sentTransceiversMsSinceEpoch > TransceiverRefreshMs;
+                if (refresh || callsign != m_sentTransceiversCallsign || state.isChangedForVoiceServer(m_sentTransceivers))
+                {
+                    m_connection->updateTransceivers(callsign, enabledTransceivers);
+                    m_sentTransceivers = enabledTransceivers;
+                    m_sentTransceiversCallsign = callsign;
+                    m_sentTransceiversMsSinceEpoch = now;
+                }
+            }
         }
         {
             QMutexLocker lock(&m_mutexSampleProviders);
-            if (m_soundcardSampleProvider) { m_soundcardSampleProvider->updateRadioTransceivers(newEnabledTransceivers); }
+            if (m_soundcardSampleProvider) { m_soundcardSampleProvider->updateRadioTransceivers(enabledTransceivers); }
         }
     }
 
@@ -592,18 +585,12 @@ namespace BlackCore::Afv::Clients
 
     void CAfvClient::setTransmittingTransceivers(const QVector<TxTransceiverDto> &transceivers)
     {
-        QMutexLocker lock(&m_mutexTransceivers);
-        m_transmittingTransceivers = transceivers;
+        m_transceiverState.sharedWrite([&](CTransceiverState & state) { state.setTransmittingTransceivers(transceivers); });
     }
 
     bool CAfvClient::isTransmittingTransceiver(quint16 id) const
     {
-        QMutexLocker lock(&m_mutexTransceivers);
-        for (const TxTransceiverDto &dto : m_transmittingTransceivers)
-        {
-            if (dto.id == id) { return true; }
-        }
-        return false;
+        return m_transceiverState.read()->isTransmitting(id);
     }
 
     bool CAfvClient::isTransmittingComUnit(CComSystem::ComUnit comUnit) const
@@ -624,7 +611,6 @@ namespace BlackCore::Afv::Clients
             const TxTransceiverDto tx = { comUnitToTransceiverId(CComSystem::Com2) };
             txs.push_back(tx);
         }
-        this->setTransmittingTransceivers(txs);
 
         QSet<quint16> enabledTransceivers;
         if (rx1 || tx1)
@@ -637,10 +623,11 @@ namespace BlackCore::Afv::Clients
             enabledTransceivers.insert(comUnitToTransceiverId(CComSystem::Com2));
         }
 
+        m_transceiverState.sharedWrite([&](CTransceiverState & state)
         {
-            QMutexLocker lock(&m_mutexTransceivers);
-            m_enabledTransceivers = enabledTransceivers;
-        }
+            state.setTransmittingTransceivers(txs);
+            state.setEnabledTransceiverIds(enabledTransceivers);
+        });
 
         // force update
         this->onTimerUpdate();
@@ -653,34 +640,26 @@ namespace BlackCore::Afv::Clients
         tx1 = false;
         tx2 = false;
 
-        const QSet<quint16> enabled = getEnabledTransceivers();
-        rx1 = enabled.contains(comUnitToTransceiverId(CComSystem::Com1));
-        rx2 = enabled.contains(comUnitToTransceiverId(CComSystem::Com2));
-
-        const QVector<TxTransceiverDto> transmits = getTransmittingTransceivers();
-        for (const TxTransceiverDto &dto : transmits)
-        {
-            if (dto.id == comUnitToTransceiverId(CComSystem::Com1)) { tx1 = true; }
-            if (dto.id == comUnitToTransceiverId(CComSystem::Com2)) { tx2 = true; }
-        }
+        const auto state = m_transceiverState.read(); // one consistent snapshot
+        rx1 = state->getEnabledTransceiverIds().contains(comUnitToTransceiverId(CComSystem::Com1));
+        rx2 = state->getEnabledTransceiverIds().contains(comUnitToTransceiverId(CComSystem::Com2));
+        tx1 = state->isTransmitting(comUnitToTransceiverId(CComSystem::Com1));
+        tx2 = state->isTransmitting(comUnitToTransceiverId(CComSystem::Com2));
     }
 
     QVector<TransceiverDto> CAfvClient::getTransceivers() const
     {
-        QMutexLocker lock(&m_mutexTransceivers);
-        return m_transceivers;
+        return m_transceiverState.read()->getTransceivers();
     }
 
     QSet<quint16> CAfvClient::getEnabledTransceivers() const
     {
-        QMutexLocker lock(&m_mutexTransceivers);
-        return m_enabledTransceivers;
+        return m_transceiverState.read()->getEnabledTransceiverIds();
     }
 
     QVector<TxTransceiverDto> CAfvClient::getTransmittingTransceivers() const
     {
-        QMutexLocker lock(&m_mutexTransceivers);
-        return m_transmittingTransceivers;
+        return m_transceiverState.read()->getTransmittingTransceivers();
     }
 
     void CAfvClient::setPtt(bool active)
@@ -698,15 +677,16 @@ namespace BlackCore::Afv::Clients
             return;
         }
 
-        if (m_transmit == active) { return; }
-        m_transmit = active;
+        if (m_pttActive == active) { return; }
+        m_pttActive = active;
+        m_pttSwitch.regularPath(active); // no change if already switched by the fast path
 
         // thread safe block
         {
             QMutexLocker lock(&m_mutexSampleProviders);
             if (m_soundcardSampleProvider)
             {
-                m_soundcardSampleProvider->pttUpdate(active, m_transmittingTransceivers);
+                m_soundcardSampleProvider->pttUpdate(active, this->getTransmittingTransceivers());
             }
 
             /** TODO: RR 2019-10 as discussed https://discordapp.com/channels/539048679160676382/623947987822837779/633320595978846208
@@ -724,6 +704,12 @@ namespace BlackCore::Afv::Clients
         emit this->ptt(active, com, this->identifier());
     }
 
+    void CAfvClient::setPttFast(bool active)
+    {
+        if (!m_isStarted) { return; }
+        m_pttSwitch.fastPath(active);
+    }
+
     double CAfvClient::getInputVolumeDb() const
     {
         QMutexLocker lock(&m_mutex);
@@ -892,10 +878,10 @@ namespace BlackCore::Afv::Clients
 
     void CAfvClient::opusDataAvailable(const OpusDataAvailableArgs &args)
     {
-        const bool transmit = m_transmit;
+        const bool transmit = m_pttSwitch.isTransmitting();
         const bool loopback = m_loopbackOn;
         const bool transmitHistory = m_transmitHistory; // threadsafe
-        const auto transceivers = this->getTransceivers();
+        const auto state = m_transceiverState.read(); // lock free, for every frame
 
         if (loopback && transmit)
         {
@@ -905,8 +891,8 @@ namespace BlackCore::Afv::Clients
             audioData.lastPacket = false;
             audioData.sequenceCounter = 0;
 
-            const RxTransceiverDto com1 = { 0, transceivers.size() > 0 ?  transceivers[0].frequencyHz : UniCom, 1.0 };
-            const RxTransceiverDto com2 = { 1, transceivers.size() > 1 ?  transceivers[1].frequencyHz : UniCom, 1.0 };
+            const RxTransceiverDto com1 = { 0, state->getFrequencyHz(0, UniCom), 1.0 };
+            const RxTransceiverDto com2 = { 1, state->getFrequencyHz(1, UniCom), 1.0 };
 
             QMutexLocker lock(&m_mutexSampleProviders);
             m_soundcardSampleProvider->addOpusSamples(audioData, { com1, com2 });
@@ -916,7 +902,7 @@ namespace BlackCore::Afv::Clients
         if (!this->isConnected()) { return; } // threadsafe
 
         const QString callsign = this->getCallsign(); // threadsafe
-        const auto transmittingTransceivers = this->getTransmittingTransceivers(); // threadsafe
+        const QVector<TxTransceiverDto> &transmittingTransceivers = state->getTransmittingTransceivers();
         if (!transmittingTransceivers.isEmpty())
         {
             if (transmit)
@@ -927,8 +913,11 @@ namespace BlackCore::Afv::Clients
                 dto.audio = std::vector<char>(args.audio.begin(), args.audio.end());
                 dto.lastPacket = false;
                 dto.transceivers = std::vector<TxTransceiverDto>(transmittingTransceivers.begin(), transmittingTransceivers.end());
-                QMutexLocker lock(&m_mutexConnection);
-                m_connection->sendToVoiceServer(dto);
+                {
+                    QMutexLocker lock(&m_mutexConnection);
+                    m_connection->sendToVoiceServer(dto);
+                }
+                m_pttSwitch.latency().frameSent(); // only the first frame of a transmission is measured
             }
 
             if (!transmit && transmitHistory)
@@ -1182,8 +1171,12 @@ namespace BlackCore::Afv::Clients
         transceiverCom1.frequencyHz = this->getAliasFrequencyHz(f1);
         transceiverCom2.frequencyHz = this->getAliasFrequencyHz(f2);
 
-        QVector<TransceiverDto> newEnabledTransceivers;
-        if (m_integratedComUnit)
+        // transceivers
+        const QVector<TransceiverDto> newTransceivers { transceiverCom1, transceiverCom2 };
+        QSet<quint16> newEnabledTransceiverIds;
+        QVector<TxTransceiverDto> newTransmittingTransceivers;
+        const bool integratedComUnit = m_integratedComUnit;
+        if (integratedComUnit)
         {
             const bool tx1 = com1.isTransmitEnabled();
             const bool rx1 = com1.isReceiveEnabled();
@@ -1202,58 +1195,42 @@ namespace BlackCore::Afv::Clients
             const bool e1 = rx1;
             const bool e2 = rx2;
 
-            // transceivers
-            const QVector<TransceiverDto> newTransceivers { transceiverCom1, transceiverCom2 };
-            QSet<quint16> newEnabledTransceiverIds;
-            QVector<TxTransceiverDto> newTransmittingTransceivers;
-            if (e1) { newEnabledTransceivers.push_back(transceiverCom1); newEnabledTransceiverIds.insert(transceiverCom1.id); }
-            if (e2) { newEnabledTransceivers.push_back(transceiverCom2); newEnabledTransceiverIds.insert(transceiverCom2.id); }
+            if (e1) { newEnabledTransceiverIds.insert(transceiverCom1.id); }
+            if (e2) { newEnabledTransceiverIds.insert(transceiverCom2.id); }
 
             // Transmitting transceivers, currently ALLOW ONLY ONE
             if (tx1 && e1) { newTransmittingTransceivers.push_back(transceiverCom1); }
             else if (tx2 && e2) { newTransmittingTransceivers.push_back(transceiverCom2); }
-
-            // lock and update
-            {
-                QMutexLocker lock(&m_mutexTransceivers);
-                m_transceivers = newTransceivers;
-                m_enabledTransceivers = newEnabledTransceiverIds;
-                m_transmittingTransceivers = newTransmittingTransceivers;
-            }
-        }
-        else
-        {
-            // update position and frequencies, but keep enabled as it was
-            const QSet<quint16> ids = getEnabledTransceivers();
-            if (ids.contains(comUnitToTransceiverId(CComSystem::Com1)))
-            {
-                newEnabledTransceivers.push_back(transceiverCom1);
-            }
-
-            if (ids.contains(comUnitToTransceiverId(CComSystem::Com2)))
-            {
-                newEnabledTransceivers.push_back(transceiverCom2);
-            }
         }
+        // else: update position and frequencies, but keep enabled as it was
 
-        // in connection and soundcard only use the enabled tarnsceivers
-        const QString callsign = this->getCallsign(); // threadsafe
+        // applied to the current state, so changes from other threads (i.e. enableTransceiver, setRxTx) are kept
+        const auto applyCockpit = [&](CTransceiverState & state)
         {
-            {
-                QMutexLocker lock(&m_mutexConnection);
-                if (m_connection)
-                {
-                    // fire to network and forget
-                    m_connection->updateTransceivers(callsign, newEnabledTransceivers);
-                }
-            }
+            state.setTransceivers(newTransceivers);
+            if (!integratedComUnit) { return; }
+            state.setEnabledTransceiverIds(newEnabledTransceiverIds);
+            state.setTransmittingTransceivers(newTransmittingTransceivers);
+        };
 
+        // only publish a new snapshot if something relevant changed, small movements are ignored
+        const auto current = m_transceiverState.read();
+        CTransceiverState newState(current.get());
+        applyCockpit(newState);
+        if (newState.isChanged(current.get()))
+        {
+            m_transceiverState.sharedWrite([&](CTransceiverState & state)
             {
-                QMutexLocker lock(&m_mutexSampleProviders);
-                if (m_soundcardSampleProvider) { m_soundcardSampleProvider->updateRadioTransceivers(newEnabledTransceivers); }
-            }
+                const CTransceiverState before(state);
+                applyCockpit(state);
+                if (!state.isChanged(before)) { state = before; } // changed meanwhile, nothing left to do
+                newState = state;
+            });
         }
 
+        // only sent to the voice server if changed
+        this->updateTransceiversOnServer(newState);
+
         if (withSignals) { emit this->updatedFromOwnAircraftCockpit(); }
     }
 
@@ -1315,28 +1292,75 @@ namespace BlackCore::Afv::Clients
 
     QVector<StationDto> CAfvClient::getAliasedStations() const
     {
-        QMutexLocker lock(&m_mutex);
-        return m_aliasedStations;
+        return m_aliasedStations.read();
     }
 
     void CAfvClient::setAliasedStations(const QVector<StationDto> &stations)
     {
-        QMutexLocker lock(&m_mutex);
-        m_aliasedStations = stations;
+        m_aliasedStations.sharedWrite([&](QVector<StationDto> &aliasedStations) { aliasedStations = stations; });
+        this->clearAliasFrequencyCache();
     }
 
     quint32 CAfvClient::getAliasFrequencyHz(quint32 frequencyHz) const
     {
         // void rounding issues from float/double
-        quint32 roundedFrequencyHz = static_cast<quint32>(qRound(frequencyHz / 1000.0)) * 1000;
+        const quint32 roundedFrequencyHz = static_cast<quint32>(qRound(frequencyHz / 1000.0)) * 1000;
 
         // disabled?
         if (!m_enableAliased) { return roundedFrequencyHz; }
 
+        // the closest matching station only changes if we move, or if the stations change
+        TransceiverDto position {};
+        {
+            const auto transceivers = m_transceiverState.read();
+            if (!transceivers->getTransceivers().isEmpty()) { position = transceivers->getTransceivers().front(); }
+        }
+        int generation = 0;
+        {
+            const auto cache = m_aliasFrequencyCache.read();
+            TransceiverDto cachedPosition {};
+            cachedPosition.LatDeg = cache->m_latDeg;
+            cachedPosition.LonDeg = cache->m_lonDeg;
+            const auto it = cache->m_aliasedHz.constFind(roundedFrequencyHz);
+            if (it != cache->m_aliasedHz.constEnd() && CTransceiverState::distanceM(position, cachedPosition) <= AliasCachePositionThresholdM) { return *it; }
+            generation = cache->m_generation;
+        }
+
+        const quint32 aliasedFrequencyHz = this->findAliasFrequencyHz(roundedFrequencyHz);
+        m_aliasFrequencyCache.sharedWrite([&](AliasFrequencyCache & cache)
+        {
+            if (cache.m_generation != generation) { return; } // cleared meanwhile, result might be outdated
+            TransceiverDto cachedPosition {};
+            cachedPosition.LatDeg = cache.m_latDeg;
+            cachedPosition.LonDeg = cache.m_lonDeg;
+            if (CTransceiverState::distanceM(position, cachedPosition) > AliasCachePositionThresholdM)
+            {
+                cache.m_aliasedHz.clear();
+                cache.m_latDeg = position.LatDeg;
+                cache.m_lonDeg = position.LonDeg;
+            }
+            cache.m_aliasedHz.insert(roundedFrequencyHz, aliasedFrequencyHz);
+        });
+        return aliasedFrequencyHz;
+    }
+
+    void CAfvClient::clearAliasFrequencyCache() const
+    {
+        m_aliasFrequencyCache.sharedWrite([](AliasFrequencyCache & cache)
+        {
+            cache.m_aliasedHz.clear();
+            cache.m_generation++;
+        });
+    }
+
+    quint32 CAfvClient::findAliasFrequencyHz(quint32 frequencyHz) const
+    {
+        quint32 roundedFrequencyHz = frequencyHz;
+
         // change to aliased frequency if needed
         {
-            QMutexLocker lock(&m_mutex);
-            const auto it = std::find_if(m_aliasedStations.constBegin(), m_aliasedStations.constEnd(), [roundedFrequencyHz](const StationDto & d)
+            const auto aliasedStations = m_aliasedStations.read();
+            const auto it = std::find_if(aliasedStations->constBegin(), aliasedStations->constEnd(), [roundedFrequencyHz](const StationDto & d)
             {
                 if (d.frequencyAliasHz > 100000000 && roundedFrequencyHz > 100000000) // both VHF
                 {
@@ -1346,7 +1370,7 @@ namespace BlackCore::Afv::Clients
                 return d.frequencyAliasHz == roundedFrequencyHz;
             });
 
-            if (it != m_aliasedStations.constEnd())
+            if (it != aliasedStations->constEnd())
             {
                 if (sApp && sApp->getIContextNetwork())
                 {
@@ -16,6 +16,8 @@
 #include "blackcore/afv/audio/input.h"
 #include "blackcore/afv/audio/output.h"
 #include "blackcore/afv/audio/soundcardsampleprovider.h"
+#include "blackcore/afv/clients/pttswitch.h"
+#include "blackcore/afv/clients/transceiverstate.h"
 #include "blackcore/afv/dto.h"
 #include "blackcore/blackcoreexport.h"
 
@@ -26,10 +28,12 @@
 #include "blackmisc/audio/audiodeviceinfo.h"
 #include "blackmisc/logcategories.h"
 #include "blackmisc/identifiable.h"
+#include "blackmisc/lockfree.h"
 #include "blackmisc/settingscache.h"
 #include "blackmisc/worker.h"
 
 #include <QDateTime>
+#include <QHash>
 #include <QAudioInput>
 #include <QAudioOutput>
 #include <QObject>
@@ -186,7 +190,7 @@ namespace BlackCore::Afv::Clients
         //! \threadsafe
         //! @{
         bool isAliasedStationsEnabled() const    { return m_enableAliased; }
-        void enableAliasedStations(bool enabled) { m_enableAliased = enabled; }
+        void enableAliasedStations(bool enabled) { m_enableAliased = enabled; this->clearAliasFrequencyCache(); }
         //! @}
 
         //! Update frequency
@@ -213,6 +217,23 @@ namespace BlackCore::Afv::Clients
         void setPttForCom(bool active, BlackMisc::Audio::PTTCOM com);
         //! @}
 
+        //! Push to talk fast path, called directly from the input device thread
+        //! \remark only switches transmitting, the regular setPttForCom follows via the event loop
+        //! \threadsafe
+        void setPttFast(bool active);
+
+        //! Forget fast path PTT changes the regular path will not follow, i.e. after a hotkey capture
+        //! \threadsafe
+        void resetPttFast() { m_pttSwitch.reset(); }
+
+        //! PTT key down to first frame sent
+        //! \threadsafe
+        //! @{
+        const CPttLatency &getPttLatency() const { return m_pttSwitch.latency(); }
+        QString getPttLatencyStatistics() const { return m_pttSwitch.latency().toQString(); }
+        void resetPttLatency() { m_pttSwitch.latency().reset(); }
+        //! @}
+
         //! Loopback
         //! \threadsafe
         //! @{
@@ -355,6 +376,18 @@ namespace BlackCore::Afv::Clients
         //! \threadsafe
         quint32 getAliasFrequencyHz(quint32 frequencyHz) const;
 
+        //! Frequency from aliased stations for an already rounded frequency, without cache
+        //! \threadsafe
+        quint32 findAliasFrequencyHz(quint32 frequencyHz) const;
+
+        //! Forget the cached aliased frequencies
+        //! \threadsafe
+        void clearAliasFrequencyCache() const;
+
+        //! Send the enabled transceivers to the voice server if changed and update the sound card
+        //! \threadsafe
+        void updateTransceiversOnServer(const CTransceiverState &state);
+
         //! Voice server alive
         //! \threadsafe
         bool isVoiceServerAlive() const;
@@ -367,6 +400,8 @@ namespace BlackCore::Afv::Clients
         void getPrefixSuffix(const QString &callsign, QString &prefix, QString &suffix) const;
 
         static constexpr int PositionUpdatesMs = 20000; //!< position timer
+        static constexpr int TransceiverRefreshMs = 60000; //!< unchanged transceivers are sent again after this time
+        static constexpr double AliasCachePositionThresholdM = 5000.0; //!< cached aliased frequencies are recalculated when moved further
         static constexpr int SampleRate   = 48000;
         static constexpr int FrameSize    = static_cast<int>(SampleRate * 0.02); //!< 20ms
         static constexpr double MinDbIn   = -18.0;
@@ -388,11 +423,9 @@ namespace BlackCore::Afv::Clients
         Audio::CSoundcardSampleProvider *m_soundcardSampleProvider = nullptr;
         BlackSound::SampleProvider::CVolumeSampleProvider *m_outputSampleProvider = nullptr;
 
-        std::atomic_bool m_transmit        { false };
+        std::atomic_bool m_pttActive       { false }; //!< PTT state of the regular path
         std::atomic_bool m_transmitHistory { false };
-        QVector<TxTransceiverDto> m_transmittingTransceivers;
-        QVector<TransceiverDto>   m_transceivers;
-        QSet<quint16>             m_enabledTransceivers;
+        BlackMisc::LockFree<CTransceiverState> m_transceiverState; //!< snapshot, recalculated only if something changed
         static const QVector<quint16> &allTransceiverIds() { static const QVector<quint16> transceiverIds{0, 1}; return transceiverIds; }
 
         std::atomic_int  m_fsdConnectMismatches { 0 }; //!< FSD no longer connected?
@@ -413,9 +446,24 @@ namespace BlackCore::Afv::Clients
         double m_outputVolumeDbCom2  = 0.0;
         double m_outputGainRatioCom2 = 1.0; //!< 0dB
         double m_maxDbReadingInPTTInterval = -100;
+        CPttSwitch m_pttSwitch; //!< transmitting, switched by the PTT fast path and the regular path
+
+        //! Aliased frequencies of the own position
+        struct AliasFrequencyCache
+        {
+            double m_latDeg = 0.0;
+            double m_lonDeg = 0.0;
+            QHash<quint32, quint32> m_aliasedHz; //!< rounded frequency, aliased frequency
+            int m_generation = 0; //!< incremented when cleared
+        };
+
+        QTimer *m_voiceServerTimer = nullptr;
+        BlackMisc::LockFree<QVector<StationDto>> m_aliasedStations;
+        mutable BlackMisc::LockFree<AliasFrequencyCache> m_aliasFrequencyCache;
 
-        QTimer             *m_voiceServerTimer = nullptr;
-        QVector<StationDto> m_aliasedStations;
+        QVector<TransceiverDto> m_sentTransceivers; //!< last sent to the voice server, guarded by m_mutexConnection
+        QString m_sentTransceiversCallsign;         //!< guarded by m_mutexConnection
+        qint64  m_sentTransceiversMsSinceEpoch = -1; //!< guarded by m_mutexConnection
 
         Audio::InputVolumeStreamArgs  m_inputVolumeStream;
         Audio::OutputVolumeStreamArgs m_outputVolumeStream;
@@ -432,7 +480,6 @@ namespace BlackCore::Afv::Clients
         mutable QRecursiveMutex m_mutex;
         mutable QRecursiveMutex m_mutexInputStream;
         mutable QRecursiveMutex m_mutexOutputStream;
-        mutable QRecursiveMutex m_mutexTransceivers;
         mutable QRecursiveMutex m_mutexCallsign;
         mutable QRecursiveMutex m_mutexConnection;
         mutable QRecursiveMutex m_mutexVolume;
@@ -0,0 +1,433 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/afv/clients/afvpipelineharness.h"
+#include "blackcore/afv/audio/callsigndelaycache.h"
+#include "blackcore/afv/audio/soundcardsampleprovider.h"
+#include "blackcore/afv/connection/clientconnection.h"
+#include "blackcore/afv/crypto/cryptodtoserializer.h"
+#include "blacksound/codecs/opusencoder.h"
+#include "blackmisc/logcategories.h"
+#include "blackmisc/logmessage.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QStringBuilder>
+#include <QThread>
+#include <QtMath>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+using namespace BlackMisc;
+using namespace BlackSound::Codecs;
+using namespace BlackSound::SampleProvider;
+using namespace BlackCore::Afv::Audio;
+using namespace BlackCore::Afv::Connection;
+using namespace BlackCore::Afv::Crypto;
+
+namespace BlackCore::Afv::Clients
+{
+    //! Synthetic speaker
+    struct CAfvPipelineHarness::Speaker
+    {
+        //! Ctor
+        Speaker(int sampleRate) : encoder(sampleRate, 1, OPUS_APPLICATION_VOIP) { encoder.setBitRate(16 * 1024); }
+
+        QString callsign;        //!< callsign
+        quint16 receiverId = 0;  //!< transceiver id of the receiver
+        quint32 frequencyHz = 0; //!< frequency talked on
+        double toneHz = 0;       //!< tone of the synthetic voice
+        double phase = 0;        //!< phase of the tone
+        qint64 offsetMs = 0;     //!< start of the first transmission
+        qint64 nextPacketMs = 0; //!< nominal time of the next packet
+        uint sequenceCounter = 0; //!< sequence of the audio DTO
+        COpusEncoder encoder;    //!< as CInput
+        QVector<qint16> pcm;     //!< one frame
+        bool received = false;   //!< a packet reached the receiver, delay is known
+        int lastDelayMs = 0;     //!< jitter buffer delay when last sampled
+        int minDelayMs = std::numeric_limits<int>::max(); //!< jitter buffer delay
+        int maxDelayMs = 0;      //!< jitter buffer delay
+        qint64 sumDelayMs = 0;   //!< jitter buffer delay of all samples
+        qint64 delaySamples = 0; //!< number of samples
+        int underflows = 0;      //!< delay increased by an underflow
+        int recoveries = 0;      //!< delay decreased after successful transmissions
+    };
+
+    constexpr int SampleRate = 48000; //!< as CAfvClient
+    constexpr int PacketMs = 20;      //!< audio per packet
+    constexpr int PacketSamples = SampleRate * PacketMs / 1000;
+
+    const QStringList &CAfvPipelineHarness::getLogCategories()
+    {
+        static const QStringList cats { CLogCategories::audio(), CLogCategories::vatsimSpecific() };
+        return cats;
+    }
+
+    void CAfvPipelineHarness::StageStatistics::add(qint64 ns, qint64 allocs)
+    {
+        count++;
+        sumNs += ns;
+        minNs = qMin(minNs, ns);
+        maxNs = qMax(maxNs, ns);
+        allocations += allocs;
+    }
+
+    CAfvPipelineHarness::CAfvPipelineHarness(const Config &config, QObject *parent) :
+        QObject(parent), m_config(config), m_random(config.seed), m_key(32, '\x5a')
+    {
+        this->setObjectName("CAfvPipelineHarness");
+    }
+
+    CAfvPipelineHarness::~CAfvPipelineHarness()
+    {
+        // receivers first, their render threads may still read
+        delete m_soundcard;
+        m_soundcard = nullptr;
+    }
+
+    void CAfvPipelineHarness::setAllocationCounters(const Counter &allocations, const Counter &liveAllocations)
+    {
+        m_allocations = allocations;
+        m_liveAllocations = liveAllocations;
+    }
+
+    bool CAfvPipelineHarness::run()
+    {
+        if (m_config.speakers < 1 || m_config.receivers < 1 || m_config.durationMs < 1 || m_config.readSize < 1 ||
+                m_config.talkMs < PacketMs || m_config.pauseMs < 0 || m_config.jitterMs < 0 ||
+                m_config.lossRatio < 0.0 || m_config.lossRatio > 1.0)
+        {
+            CLogMessage(this).error(u"Invalid AFV pipeline harness configuration");
+            return false;
+        }
+
+        this->setup();
+        CLogMessage(this).info(u"AFV pipeline harness: %1 speakers, %2 receivers, %3s %4") <<
+                               m_config.speakers << m_config.receivers << (m_config.durationMs / 1000) <<
+                               (m_config.threaded ? QStringLiteral("threaded, real time") : QStringLiteral("offline"));
+
+        const qint64 durationUs = m_config.durationMs * 1000;
+        qint64 samplesRead = 0;
+        qint64 nextProgressUs = m_config.progressMs > 0 ? m_config.progressMs * 1000 : std::numeric_limits<qint64>::max();
+        QElapsedTimer wall;
+        wall.start();
+        while (m_simulatedUs < durationUs)
+        {
+            this->sendPackets(m_simulatedUs);
+            this->deliverPackets(m_simulatedUs);
+            this->render();
+            samplesRead += m_config.readSize;
+            m_simulatedUs = samplesRead * 1000000 / SampleRate;
+            this->sampleDelays();
+
+            // timers and queued calls of the receivers, deleted objects
+            QCoreApplication::processEvents();
+            QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+            if (m_config.threaded)
+            {
+                // like the sound card, which reads when the samples are due
+                const qint64 aheadUs = m_simulatedUs - wall.nsecsElapsed() / 1000;
+                if (aheadUs > 0) { QThread::usleep(static_cast<unsigned long>(aheadUs)); }
+            }
+
+            if (m_simulatedUs >= nextProgressUs)
+            {
+                nextProgressUs += m_config.progressMs * 1000;
+                m_wallNs = wall.nsecsElapsed();
+                emit this->progress(m_simulatedUs / 1000, this->getProgressAsText());
+            }
+        }
+        m_wallNs = wall.nsecsElapsed();
+
+        CLogMessage(this).info(u"AFV pipeline harness: %1") << this->getStatisticsAsText(", ");
+        return true;
+    }
+
+    double CAfvPipelineHarness::getRealTimeFactor() const
+    {
+        return m_wallNs > 0 ? m_simulatedUs * 1000.0 / m_wallNs : 0.0;
+    }
+
+    QByteArray CAfvPipelineHarness::getOutputHash() const
+    {
+        return m_outputHash.result().toHex();
+    }
+
+    QString CAfvPipelineHarness::getStatisticsAsText(const QString &separator) const
+    {
+        const double rms = m_outputSamples > 0 ? qSqrt(m_outputSumSquares / m_outputSamples) : 0.0;
+        QString stats = QStringLiteral("simulated: %1s wall: %2ms real time factor: %3").
+                        arg(m_simulatedUs / 1000000.0, 0, 'f', 1).
+                        arg(m_wallNs / 1000000.0, 0, 'f', 1).
+                        arg(this->getRealTimeFactor(), 0, 'f', 1);
+        stats += separator % QStringLiteral("packets sent: %1 lost: %2 delivered: %3 received: %4").
+                 arg(m_packetsSent).arg(m_packetsLost).arg(m_packetsDelivered).arg(m_packetsReceived);
+
+        // CPU of the harness thread, the render threads in threaded mode are part of the mixer statistics
+        const double simulatedSeconds = qMax(m_simulatedUs / 1000000.0, 1e-6);
+        for (int i = 0; i < StageCount; ++i)
+        {
+            const StageStatistics &s = m_stages[i];
+            if (s.count < 1) { continue; }
+            stats += separator % stageToString(static_cast<Stage>(i)) %
+                     QStringLiteral(": %1 avg %2us min %3us max %4us cpu %5ms/s allocs %6/s").arg(s.count).
+                     arg(s.sumNs / 1000.0 / s.count, 0, 'f', 1).
+                     arg(s.minNs / 1000.0, 0, 'f', 1).
+                     arg(s.maxNs / 1000.0, 0, 'f', 1).
+                     arg(s.sumNs / 1000000.0 / simulatedSeconds, 0, 'f', 2).
+                     arg(s.allocations / simulatedSeconds, 0, 'f', 1);
+        }
+
+        if (m_soundcard) { stats += separator % QStringLiteral("mixer: ") % m_soundcard->getMixingMetrics().toQString(); }
+
+        for (const auto &speaker : m_speakers)
+        {
+            if (speaker->delaySamples < 1) { continue; }
+            stats += separator % speaker->callsign %
+                     QStringLiteral(" jitter buffer: delay min/avg/max %1/%2/%3ms underflows: %4 recoveries: %5").
+                     arg(speaker->minDelayMs).
+                     arg(static_cast<double>(speaker->sumDelayMs) / speaker->delaySamples, 0, 'f', 1).
+                     arg(speaker->maxDelayMs).
+                     arg(speaker->underflows).arg(speaker->recoveries);
+        }
+
+        stats += separator % QStringLiteral("output: peak %1 rms %2 md5 %3").
+                 arg(static_cast<double>(m_outputPeak), 0, 'f', 4).
+                 arg(rms, 0, 'f', 4).
+                 arg(QString::fromLatin1(this->getOutputHash()));
+        return stats;
+    }
+
+    QString CAfvPipelineHarness::getProgressAsText() const
+    {
+        int underflows = 0;
+        for (const auto &speaker : m_speakers) { underflows += speaker->underflows; }
+        QString progress = QStringLiteral("%1s real time factor: %2 received: %3 underflows: %4 underruns: %5").
+                           arg(m_simulatedUs / 1000000).
+                           arg(this->getRealTimeFactor(), 0, 'f', 1).
+                           arg(m_packetsReceived).arg(underflows).
+                           arg(m_soundcard ? m_soundcard->getMixingMetrics().underruns : 0);
+        if (m_liveAllocations) { progress += QStringLiteral(" live allocations: %1").arg(m_liveAllocations()); }
+        return progress;
+    }
+
+    const QString &CAfvPipelineHarness::stageToString(Stage stage)
+    {
+        static const QString send("send");
+        static const QString receive("receive");
+        static const QString decode("decode");
+        static const QString render("render");
+        static const QString unknown("unknown");
+
+        switch (stage)
+        {
+        case StageSend:    return send;
+        case StageReceive: return receive;
+        case StageDecode:  return decode;
+        case StageRender:  return render;
+        default: break;
+        }
+        return unknown;
+    }
+
+    void CAfvPipelineHarness::setup()
+    {
+        const QString channelTag("offline");
+        CryptoDtoChannelConfigDto channelConfig;
+        channelConfig.channelTag = channelTag;
+        channelConfig.aeadReceiveKey = m_key;
+        channelConfig.aeadTransmitKey = m_key;
+        channelConfig.hmacKey = m_key;
+
+        m_connection = new CClientConnection(channelTag, this);
+        m_connection->connectOffline(QStringLiteral("HARNESS"), channelConfig);
+
+        QVector<quint16> transceiverIDs;
+        QVector<TransceiverDto> transceivers;
+        for (int r = 0; r < m_config.receivers; ++r)
+        {
+            const quint16 id = static_cast<quint16>(r);
+            transceiverIDs.push_back(id);
+            transceivers.push_back({ id, static_cast<quint32>(118000000 + r * 25000), 48.5, 11.5, 1000.0, 1000.0 });
+        }
+
+        const CParallelMixingSampleProvider::RenderMode mode = m_config.threaded ? CParallelMixingSampleProvider::Threaded : CParallelMixingSampleProvider::Offline;
+        m_soundcard = new CSoundcardSampleProvider(SampleRate, transceiverIDs, mode);
+        m_soundcard->updateRadioTransceivers(transceivers);
+
+        // offline the callsigns go idle in simulated time, not by the wall clock timers
+        if (!m_config.threaded) { m_soundcard->setSimulatedClock([this] { return m_simulatedUs / 1000; }); }
+
+        // same conversion as CAfvClient::audioOutDataAvailable, runs nested in processOfflineMessage
+        connect(m_connection, &CClientConnection::audioReceived, this, [ = ](const AudioRxOnTransceiversDto &dto)
+        {
+            const qint64 allocs = this->allocations();
+            QElapsedTimer timer;
+            timer.start();
+
+            IAudioDto audioData;
+            audioData.audio           = QByteArray(dto.audio.data(), static_cast<int>(dto.audio.size()));
+            audioData.callsign        = QString::fromStdString(dto.callsign);
+            audioData.lastPacket      = dto.lastPacket;
+            audioData.sequenceCounter = dto.sequenceCounter;
+            m_soundcard->addOpusSamples(audioData, QVector<RxTransceiverDto>(dto.transceivers.begin(), dto.transceivers.end()));
+
+            const qint64 ns = timer.nsecsElapsed();
+            const qint64 decodeAllocs = this->allocations() - allocs;
+            m_stages[StageDecode].add(ns, decodeAllocs);
+            m_decodeNsInReceive += ns;
+            m_decodeAllocsInReceive += decodeAllocs;
+            m_packetsReceived++;
+
+            const auto it = std::find_if(m_speakers.begin(), m_speakers.end(), [&](const auto & speaker) { return speaker->callsign == audioData.callsign; });
+            if (it != m_speakers.end()) { (*it)->received = true; }
+        });
+
+        // transmissions are staggered, so the speakers of a receiver overlap only partially
+        const int cycleMs = m_config.talkMs + m_config.pauseMs;
+        for (int i = 0; i < m_config.speakers; ++i)
+        {
+            auto speaker = std::make_unique<Speaker>(SampleRate);
+            speaker->callsign = QStringLiteral("SPK%1").arg(i, 2, 10, QChar('0'));
+            speaker->receiverId = transceivers[i % m_config.receivers].id;
+            speaker->frequencyHz = transceivers[i % m_config.receivers].frequencyHz;
+            speaker->toneHz = 150.0 + 37.0 * i;
+            speaker->offsetMs = static_cast<qint64>(cycleMs) * i / m_config.speakers / PacketMs * PacketMs;
+            speaker->nextPacketMs = speaker->offsetMs;
+            speaker->pcm.resize(PacketSamples);
+            m_speakers.push_back(std::move(speaker));
+        }
+        m_samples.reserve(m_config.readSize);
+    }
+
+    void CAfvPipelineHarness::sendPackets(qint64 nowUs)
+    {
+        for (const auto &speaker : m_speakers)
+        {
+            while (speaker->nextPacketMs * 1000 <= nowUs) { this->sendPacket(*speaker); }
+        }
+    }
+
+    void CAfvPipelineHarness::sendPacket(Speaker &speaker)
+    {
+        const qint64 allocs = this->allocations();
+        QElapsedTimer timer;
+        timer.start();
+
+        const int cycleMs = m_config.talkMs + m_config.pauseMs;
+        const qint64 sentMs = speaker.nextPacketMs;
+        const qint64 inCycleMs = (sentMs - speaker.offsetMs) % cycleMs;
+        const bool lastPacket = inCycleMs + PacketMs >= m_config.talkMs;
+        speaker.nextPacketMs = lastPacket ? sentMs - inCycleMs + cycleMs : sentMs + PacketMs;
+
+        // a tone with a slow syllable like envelope
+        const double step = 2.0 * M_PI * speaker.toneHz / SampleRate;
+        for (int n = 0; n < PacketSamples; ++n)
+        {
+            const double envelope = 0.6 + 0.4 * qSin(2.0 * M_PI * 3.0 * (inCycleMs * SampleRate / 1000 + n) / SampleRate);
+            speaker.pcm[n] = static_cast<qint16>(9000.0 * envelope * qSin(speaker.phase));
+            speaker.phase += step;
+        }
+        speaker.phase = std::fmod(speaker.phase, 2.0 * M_PI);
+
+        int encodedLength = 0;
+        const QByteArray encoded = speaker.encoder.encode(speaker.pcm, speaker.pcm.size(), &encodedLength);
+
+        AudioRxOnTransceiversDto dto;
+        dto.callsign = speaker.callsign.toStdString();
+        dto.sequenceCounter = speaker.sequenceCounter++;
+        dto.audio = std::vector<char>(encoded.begin(), encoded.end());
+        dto.lastPacket = lastPacket;
+        dto.transceivers = { RxTransceiverDto { speaker.receiverId, speaker.frequencyHz, 1.0f } };
+
+        // lost packets still consume a sequence number, as on the network
+        const uint sequence = m_sequence++;
+        std::uniform_real_distribution<double> lossDistribution(0.0, 1.0);
+        const bool lost = m_config.lossRatio > 0.0 && lossDistribution(m_random) < m_config.lossRatio;
+        std::uniform_int_distribution<qint64> jitterDistribution(0, m_config.jitterMs * 1000);
+        const qint64 jitterUs = jitterDistribution(m_random);
+
+        m_packetsSent++;
+        if (lost)
+        {
+            m_packetsLost++;
+        }
+        else
+        {
+            Packet packet;
+            packet.deliveryUs = sentMs * 1000 + jitterUs;
+            packet.order = m_packetOrder++;
+            packet.data = CryptoDtoSerializer::serialize(QStringLiteral("offline"), CryptoDtoMode::AEAD_ChaCha20Poly1305, m_key, sequence, dto);
+            m_packets.push_back(std::move(packet));
+            std::push_heap(m_packets.begin(), m_packets.end(), std::greater<Packet>());
+        }
+
+        m_stages[StageSend].add(timer.nsecsElapsed(), this->allocations() - allocs);
+    }
+
+    void CAfvPipelineHarness::deliverPackets(qint64 nowUs)
+    {
+        while (!m_packets.empty() && m_packets.front().deliveryUs <= nowUs)
+        {
+            std::pop_heap(m_packets.begin(), m_packets.end(), std::greater<Packet>());
+            const QByteArray data = std::move(m_packets.back().data);
+            m_packets.pop_back();
+            m_packetsDelivered++;
+
+            m_decodeNsInReceive = 0;
+            m_decodeAllocsInReceive = 0;
+            const qint64 allocs = this->allocations();
+            QElapsedTimer timer;
+            timer.start();
+            m_connection->processOfflineMessage(data);
+            const qint64 ns = timer.nsecsElapsed() - m_decodeNsInReceive;
+            m_stages[StageReceive].add(ns, this->allocations() - allocs - m_decodeAllocsInReceive);
+        }
+    }
+
+    void CAfvPipelineHarness::render()
+    {
+        const qint64 allocs = this->allocations();
+        QElapsedTimer timer;
+        timer.start();
+        const int read = m_soundcard->readSamples(m_samples, m_config.readSize);
+        m_stages[StageRender].add(timer.nsecsElapsed(), this->allocations() - allocs);
+
+        const int count = qBound(0, read, m_samples.size());
+        m_outputHash.addData(reinterpret_cast<const char *>(m_samples.constData()), count * static_cast<int>(sizeof(float)));
+        for (int n = 0; n < count; ++n)
+        {
+            const float sample = m_samples.at(n);
+            m_outputPeak = qMax(m_outputPeak, qAbs(sample));
+            m_outputSumSquares += static_cast<double>(sample) * sample;
+        }
+        m_outputSamples += count;
+    }
+
+    void CAfvPipelineHarness::sampleDelays()
+    {
+        for (const auto &speaker : m_speakers)
+        {
+            if (!speaker->received) { continue; } // not yet in the delay cache
+            const int delayMs = CallsignDelayCache::instance().get(speaker->callsign);
+            if (speaker->delaySamples > 0)
+            {
+                if (delayMs > speaker->lastDelayMs) { speaker->underflows++; }
+                else if (delayMs < speaker->lastDelayMs) { speaker->recoveries++; }
+            }
+            speaker->lastDelayMs = delayMs;
+            speaker->minDelayMs = qMin(speaker->minDelayMs, delayMs);
+            speaker->maxDelayMs = qMax(speaker->maxDelayMs, delayMs);
+            speaker->sumDelayMs += delayMs;
+            speaker->delaySamples++;
+        }
+    }
+} // ns
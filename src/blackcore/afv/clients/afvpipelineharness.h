@@ -0,0 +1,208 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_AFV_CLIENTS_AFVPIPELINEHARNESS_H
+#define BLACKCORE_AFV_CLIENTS_AFVPIPELINEHARNESS_H
+
+#include "blackcore/blackcoreexport.h"
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace BlackCore::Afv::Connection { class CClientConnection; }
+namespace BlackCore::Afv::Audio { class CSoundcardSampleProvider; }
+namespace BlackCore::Afv::Clients
+{
+    /*!
+     * Drives the AFV receive path offline with synthetic speakers, as benchmark and soak test.
+     *
+     * Synthetic speakers talk on the frequencies of the receivers, their Opus packets are encrypted as by the
+     * voice server and delivered with jitter and loss into CClientConnection. From there the packets take the
+     * same path as in CAfvClient: decryption, Opus decoding into the jitter buffers and the receiver rendering.
+     * The sound card is replaced by reads of the configured size on a simulated clock.
+     *
+     * \remark Offline rendering runs as fast as possible on the simulated clock and is deterministic for a given seed,
+     *         the threaded rendering is paced in real time like a sound card
+     * \remark no socket, API server or audio device is used
+     */
+    class BLACKCORE_EXPORT CAfvPipelineHarness : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        //! Measured stages
+        enum Stage
+        {
+            StageSend,    //!< synthetic speakers: PCM, Opus encoding and encryption, not part of the client
+            StageReceive, //!< decryption and deserialization in CClientConnection
+            StageDecode,  //!< Opus decoding into the jitter buffers
+            StageRender,  //!< receivers rendered and mixed for one sound card read
+            StageCount    //!< number of stages
+        };
+
+        //! Run configuration
+        struct Config
+        {
+            int speakers = 4;        //!< synthetic speakers, distributed over the receivers
+            int receivers = 2;       //!< receivers (transceivers)
+            qint64 durationMs = 60000; //!< simulated time
+            int talkMs = 4000;       //!< length of a transmission
+            int pauseMs = 2000;      //!< pause between the transmissions of a speaker
+            int jitterMs = 20;       //!< packets are delayed by 0..jitterMs
+            double lossRatio = 0.0;  //!< ratio of packets lost, 0..1
+            int readSize = 960;      //!< samples per sound card read
+            quint32 seed = 1;        //!< seed for jitter and loss
+            bool threaded = false;   //!< render the receivers in threads, paced in real time
+            qint64 progressMs = 0;   //!< emit progress every progressMs of simulated time, 0 for none
+        };
+
+        //! Returns a counter, e.g. the number of allocations so far
+        using Counter = std::function<qint64()>;
+
+        //! Categories
+        static const QStringList &getLogCategories();
+
+        //! Ctor
+        CAfvPipelineHarness(const Config &config, QObject *parent = nullptr);
+
+        //! Dtor
+        virtual ~CAfvPipelineHarness() override;
+
+        //! Allocation counters of the process, optional
+        //! \param allocations allocations so far, counted per stage
+        //! \param liveAllocations allocations not yet freed, reported with the progress to detect leaks
+        void setAllocationCounters(const Counter &allocations, const Counter &liveAllocations);
+
+        //! Configuration
+        const Config &getConfig() const { return m_config; }
+
+        //! Run for the configured duration
+        //! \remark blocking, events of the calling thread are processed in between
+        //! \return false if the configuration is invalid
+        bool run();
+
+        //! Simulated time per wall time, > 1 is faster than real time
+        double getRealTimeFactor() const;
+
+        //! Packets
+        //! @{
+        qint64 getPacketsSent() const { return m_packetsSent; }
+        qint64 getPacketsLost() const { return m_packetsLost; }
+        qint64 getPacketsReceived() const { return m_packetsReceived; }
+        //! @}
+
+        //! MD5 of the output samples, to compare runs
+        QByteArray getOutputHash() const;
+
+        //! Statistics of the run
+        QString getStatisticsAsText(const QString &separator = "\n") const;
+
+        //! Short progress line
+        QString getProgressAsText() const;
+
+        //! Stage as string
+        static const QString &stageToString(Stage stage);
+
+    signals:
+        //! Progress of a long run, every Config::progressMs of simulated time
+        void progress(qint64 simulatedMs, const QString &text);
+
+    private:
+        struct Speaker;
+
+        //! Timing of a stage
+        struct StageStatistics
+        {
+            qint64 count = 0;       //!< measurements
+            qint64 sumNs = 0;       //!< sum
+            qint64 minNs = std::numeric_limits<qint64>::max(); //!< min
+            qint64 maxNs = 0;       //!< max
+            qint64 allocations = 0; //!< allocations in this stage
+
+            //! Add a measurement
+            void add(qint64 ns, qint64 allocs);
+        };
+
+        //! Packet on the way to the client
+        struct Packet
+        {
+            qint64 deliveryUs = 0; //!< simulated delivery time
+            qint64 order = 0;      //!< keeps packets with the same delivery time in send order
+            QByteArray data;       //!< encrypted packet
+
+            //! Later delivered packets are greater, for the min heap
+            bool operator>(const Packet &other) const
+            {
+                return deliveryUs != other.deliveryUs ? deliveryUs > other.deliveryUs : order > other.order;
+            }
+        };
+
+        //! Create the speakers and the receive path
+        void setup();
+
+        //! Generate the packets of all speakers sent up to simulated time
+        void sendPackets(qint64 nowUs);
+
+        //! Generate the next packet of the speaker
+        void sendPacket(Speaker &speaker);
+
+        //! Pass the packets delivered up to simulated time to the client
+        void deliverPackets(qint64 nowUs);
+
+        //! Read from the sound card sample provider
+        void render();
+
+        //! Sample the jitter buffer delays of the speakers
+        void sampleDelays();
+
+        //! Allocations so far, 0 without counter
+        qint64 allocations() const { return m_allocations ? m_allocations() : 0; }
+
+        Config m_config;
+        Connection::CClientConnection *m_connection = nullptr;
+        Audio::CSoundcardSampleProvider *m_soundcard = nullptr;
+        std::vector<std::unique_ptr<Speaker>> m_speakers;
+        std::vector<Packet> m_packets; //!< min heap by delivery time
+        std::mt19937 m_random;
+        QByteArray m_key;
+        uint m_sequence = 1;
+        qint64 m_packetOrder = 0;
+
+        Counter m_allocations;
+        Counter m_liveAllocations;
+
+        StageStatistics m_stages[StageCount];
+        qint64 m_decodeNsInReceive = 0;     //!< decode time nested in the current receive
+        qint64 m_decodeAllocsInReceive = 0; //!< decode allocations nested in the current receive
+        qint64 m_packetsSent = 0;
+        qint64 m_packetsLost = 0;
+        qint64 m_packetsDelivered = 0;
+        qint64 m_packetsReceived = 0;
+        qint64 m_simulatedUs = 0;
+        qint64 m_wallNs = 0;
+
+        QVector<float> m_samples;
+        QCryptographicHash m_outputHash { QCryptographicHash::Md5 };
+        float m_outputPeak = 0.0f;
+        double m_outputSumSquares = 0.0;
+        qint64 m_outputSamples = 0;
+    };
+} // ns
+
+#endif // guard
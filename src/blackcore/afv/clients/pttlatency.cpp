@@ -0,0 +1,93 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/afv/clients/pttlatency.h"
+#include "blackmisc/latencytrace.h"
+
+#include <QMutexLocker>
+#include <QStringBuilder>
+
+using namespace BlackMisc;
+
+namespace BlackCore::Afv::Clients
+{
+    void CPttLatency::keyDown(qint64 nowNs)
+    {
+        qint64 expected = Idle;
+        m_keyDownNs.compare_exchange_strong(expected, nowNs);
+    }
+
+    qint64 CPttLatency::frameSent(qint64 nowNs)
+    {
+        qint64 keyDownNs = m_keyDownNs.load();
+        if (keyDownNs < 0) { return -1; }
+        if (!m_keyDownNs.compare_exchange_strong(keyDownNs, Measured)) { return -1; }
+
+        const qint64 latencyNs = qMax<qint64>(0, nowNs - keyDownNs);
+        QMutexLocker lock(&m_mutex);
+        m_lastNs = latencyNs;
+        m_minNs = m_count < 1 ? latencyNs : qMin(m_minNs, latencyNs);
+        m_maxNs = m_count < 1 ? latencyNs : qMax(m_maxNs, latencyNs);
+        m_sumNs += latencyNs;
+        m_count++;
+        return latencyNs;
+    }
+
+    int CPttLatency::getCount() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_count;
+    }
+
+    double CPttLatency::getLastMs() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_count < 1 ? -1.0 : m_lastNs / 1.0e6;
+    }
+
+    double CPttLatency::getMinMs() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_count < 1 ? -1.0 : m_minNs / 1.0e6;
+    }
+
+    double CPttLatency::getMaxMs() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_count < 1 ? -1.0 : m_maxNs / 1.0e6;
+    }
+
+    double CPttLatency::getAverageMs() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return m_count < 1 ? -1.0 : m_sumNs / 1.0e6 / m_count;
+    }
+
+    void CPttLatency::reset()
+    {
+        QMutexLocker lock(&m_mutex);
+        m_count = 0;
+        m_lastNs = m_minNs = m_maxNs = m_sumNs = 0;
+    }
+
+    QString CPttLatency::toQString() const
+    {
+        QMutexLocker lock(&m_mutex);
+        if (m_count < 1) { return QStringLiteral("PTT to first frame: no transmissions measured"); }
+        return u"PTT to first frame: " % QString::number(m_count) % u" transmissions, last " %
+               QString::number(m_lastNs / 1.0e6, 'f', 1) % u"ms avg " %
+               QString::number(m_sumNs / 1.0e6 / m_count, 'f', 1) % u"ms min " %
+               QString::number(m_minNs / 1.0e6, 'f', 1) % u"ms max " %
+               QString::number(m_maxNs / 1.0e6, 'f', 1) % u"ms";
+    }
+
+    qint64 CPttLatency::nowNs()
+    {
+        return CLatencyTrace::nowNs();
+    }
+} // ns
@@ -0,0 +1,91 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_AFV_CLIENTS_PTTLATENCY_H
+#define BLACKCORE_AFV_CLIENTS_PTTLATENCY_H
+
+#include "blackcore/blackcoreexport.h"
+
+#include <QMutex>
+#include <QString>
+#include <QtGlobal>
+#include <atomic>
+
+namespace BlackCore::Afv::Clients
+{
+    /*!
+     * Measures the time from PTT key down to the first encoded audio frame sent to the voice server.
+     * Key down is reported by the fast path and the regular hotkey path, only the first one of a
+     * transmission starts a measurement, and only the first frame sent ends it.
+     */
+    class BLACKCORE_EXPORT CPttLatency
+    {
+    public:
+        //! Key pressed
+        //! \threadsafe
+        void keyDown() { this->keyDown(nowNs()); }
+
+        //! Key pressed at given time
+        //! \threadsafe
+        void keyDown(qint64 nowNs);
+
+        //! Key released, a transmission without any frame sent is not measured
+        //! \threadsafe
+        void keyUp() { m_keyDownNs.store(Idle); }
+
+        //! A frame was sent
+        //! \threadsafe
+        //! \return latency in ns if this ended a measurement, otherwise -1
+        qint64 frameSent() { return this->frameSent(nowNs()); }
+
+        //! A frame was sent at given time
+        //! \threadsafe
+        qint64 frameSent(qint64 nowNs);
+
+        //! Number of measured transmissions
+        //! \threadsafe
+        int getCount() const;
+
+        //! Latencies in ms, -1 if nothing measured
+        //! \threadsafe
+        //! @{
+        double getLastMs() const;
+        double getMinMs() const;
+        double getMaxMs() const;
+        double getAverageMs() const;
+        //! @}
+
+        //! Reset the statistics
+        //! \threadsafe
+        void reset();
+
+        //! Statistics as text
+        //! \threadsafe
+        QString toQString() const;
+
+        //! Monotonic time in ns
+        static qint64 nowNs();
+
+    private:
+        static constexpr qint64 Idle = -1;     //!< no key down
+        static constexpr qint64 Measured = -2; //!< key down, first frame already sent
+
+        std::atomic<qint64> m_keyDownNs { Idle }; //!< key down time of the current transmission, or Idle/Measured
+
+        mutable QMutex m_mutex; //!< statistics
+        int m_count = 0;
+        qint64 m_lastNs = 0;
+        qint64 m_minNs = 0;
+        qint64 m_maxNs = 0;
+        qint64 m_sumNs = 0;
+    };
+} // ns
+
+#endif // guard
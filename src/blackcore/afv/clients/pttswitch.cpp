@@ -0,0 +1,45 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/afv/clients/pttswitch.h"
+
+namespace BlackCore::Afv::Clients
+{
+    void CPttSwitch::fastPath(bool active)
+    {
+        if (m_fastActive.exchange(active) == active) { return; }
+        m_fastSwitched++;
+        this->setTransmit(active);
+    }
+
+    bool CPttSwitch::regularPath(bool active)
+    {
+        m_regularActive = active;
+        int fastSwitched = m_fastSwitched.load();
+        while (fastSwitched > 0)
+        {
+            if (m_fastSwitched.compare_exchange_weak(fastSwitched, fastSwitched - 1)) { return false; }
+        }
+        this->setTransmit(active);
+        return true;
+    }
+
+    void CPttSwitch::reset()
+    {
+        const bool active = m_regularActive;
+        m_fastSwitched = 0;
+        m_fastActive = active;
+        if (m_transmit != active) { this->setTransmit(active); }
+    }
+
+    void CPttSwitch::setTransmit(bool active)
+    {
+        if (active) { m_latency.keyDown(); } else { m_latency.keyUp(); }
+        m_transmit = active;
+    }
+} // ns
@@ -0,0 +1,70 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_AFV_CLIENTS_PTTSWITCH_H
+#define BLACKCORE_AFV_CLIENTS_PTTSWITCH_H
+
+#include "blackcore/afv/clients/pttlatency.h"
+#include "blackcore/blackcoreexport.h"
+
+#include <atomic>
+
+namespace BlackCore::Afv::Clients
+{
+    /*!
+     * Transmit state switched by the PTT fast path and the regular PTT path.
+     *
+     * A PTT key event is reported by the fast path directly in the input device thread, the same event
+     * follows via the event loop in the regular path. Changes already switched by the fast path are counted,
+     * and the regular path skips as many changes. So a short tap, whose fast key up arrives before the regular
+     * key down, does not switch transmitting on again. PTT without fast path, e.g. from the UI, is switched
+     * by the regular path.
+     */
+    class BLACKCORE_EXPORT CPttSwitch
+    {
+    public:
+        //! PTT from the fast path
+        //! \threadsafe
+        void fastPath(bool active);
+
+        //! PTT from the regular path
+        //! \threadsafe
+        //! \return true if transmitting was switched, false if the fast path did already
+        bool regularPath(bool active);
+
+        //! Back to the state of the regular path, forgetting fast path changes the regular path will not follow
+        //! \remark i.e. after a hotkey capture, which the regular path ignores
+        //! \threadsafe
+        void reset();
+
+        //! Transmitting?
+        //! \threadsafe
+        bool isTransmitting() const { return m_transmit; }
+
+        //! Latency from key down to the first frame sent
+        //! \threadsafe
+        //! @{
+        const CPttLatency &latency() const { return m_latency; }
+        CPttLatency &latency() { return m_latency; }
+        //! @}
+
+    private:
+        //! Switch transmitting and the latency measurement
+        void setTransmit(bool active);
+
+        std::atomic_bool m_transmit      { false };
+        std::atomic_bool m_regularActive { false }; //!< last state of the regular path
+        std::atomic_bool m_fastActive    { false }; //!< last state of the fast path
+        std::atomic_int  m_fastSwitched  { 0 };     //!< changes of the fast path not yet seen by the regular path
+        CPttLatency m_latency;
+    };
+} // ns
+
+#endif // guard
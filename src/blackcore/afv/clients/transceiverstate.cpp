@@ -0,0 +1,130 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/afv/clients/transceiverstate.h"
+
+#include <QtMath>
+#include <algorithm>
+
+namespace BlackCore::Afv::Clients
+{
+    constexpr double CTransceiverState::PositionThresholdM;
+    constexpr double CTransceiverState::HeightThresholdM;
+
+    CTransceiverState::CTransceiverState(const QVector<TransceiverDto> &transceivers, const QSet<quint16> &enabledIds, const QVector<TxTransceiverDto> &transmitting) :
+        m_transceivers(transceivers), m_enabledIds(enabledIds), m_transmitting(transmitting)
+    {
+        this->updateEnabled();
+    }
+
+    quint32 CTransceiverState::getFrequencyHz(quint16 id, quint32 defaultHz) const
+    {
+        for (const TransceiverDto &dto : m_transceivers)
+        {
+            if (dto.id == id) { return dto.frequencyHz; }
+        }
+        return defaultHz;
+    }
+
+    bool CTransceiverState::isEnabled(quint16 id) const
+    {
+        return std::any_of(m_enabled.cbegin(), m_enabled.cend(), [id](const TransceiverDto & dto) { return dto.id == id; });
+    }
+
+    bool CTransceiverState::isTransmitting(quint16 id) const
+    {
+        return std::any_of(m_transmitting.cbegin(), m_transmitting.cend(), [id](const TxTransceiverDto & dto) { return dto.id == id; });
+    }
+
+    void CTransceiverState::setTransceivers(const QVector<TransceiverDto> &transceivers)
+    {
+        m_transceivers = transceivers;
+        this->updateEnabled();
+    }
+
+    void CTransceiverState::setEnabled(quint16 id, bool enabled)
+    {
+        if (enabled) { m_enabledIds.insert(id); }
+        else         { m_enabledIds.remove(id); }
+        this->updateEnabled();
+    }
+
+    void CTransceiverState::setEnabledTransceiverIds(const QSet<quint16> &ids)
+    {
+        m_enabledIds = ids;
+        this->updateEnabled();
+    }
+
+    void CTransceiverState::setPosition(double latitudeDeg, double longitudeDeg, double heightMeters)
+    {
+        for (TransceiverDto &transceiver : m_transceivers)
+        {
+            transceiver.LatDeg = latitudeDeg;
+            transceiver.LonDeg = longitudeDeg;
+            transceiver.HeightAglM = heightMeters;
+            transceiver.HeightMslM = heightMeters;
+        }
+        this->updateEnabled();
+    }
+
+    bool CTransceiverState::setFrequencyHz(quint16 id, quint32 frequencyHz)
+    {
+        bool changed = false;
+        for (TransceiverDto &transceiver : m_transceivers)
+        {
+            if (transceiver.id != id || transceiver.frequencyHz == frequencyHz) { continue; }
+            transceiver.frequencyHz = frequencyHz;
+            changed = true;
+        }
+        if (changed) { this->updateEnabled(); }
+        return changed;
+    }
+
+    bool CTransceiverState::isChanged(const CTransceiverState &other) const
+    {
+        if (m_enabledIds != other.m_enabledIds) { return true; }
+        if (m_transmitting.size() != other.m_transmitting.size()) { return true; }
+        for (const TxTransceiverDto &tx : m_transmitting)
+        {
+            if (!other.isTransmitting(tx.id)) { return true; }
+        }
+        return isChanged(m_transceivers, other.m_transceivers);
+    }
+
+    bool CTransceiverState::isChanged(const QVector<TransceiverDto> &transceivers, const QVector<TransceiverDto> &other)
+    {
+        if (transceivers.size() != other.size()) { return true; }
+        for (int i = 0; i < transceivers.size(); ++i)
+        {
+            const TransceiverDto &a = transceivers[i];
+            const TransceiverDto &b = other[i];
+            if (a.id != b.id || a.frequencyHz != b.frequencyHz) { return true; }
+            if (qAbs(a.HeightMslM - b.HeightMslM) > HeightThresholdM) { return true; }
+            if (distanceM(a, b) > PositionThresholdM) { return true; }
+        }
+        return false;
+    }
+
+    double CTransceiverState::distanceM(const TransceiverDto &a, const TransceiverDto &b)
+    {
+        // equirectangular projection
+        constexpr double EarthRadiusM = 6371000.0;
+        const double dLat = qDegreesToRadians(b.LatDeg - a.LatDeg);
+        const double dLon = qDegreesToRadians(b.LonDeg - a.LonDeg) * qCos(qDegreesToRadians((a.LatDeg + b.LatDeg) / 2.0));
+        return EarthRadiusM * qSqrt(dLat * dLat + dLon * dLon);
+    }
+
+    void CTransceiverState::updateEnabled()
+    {
+        m_enabled.clear();
+        for (const TransceiverDto &transceiver : std::as_const(m_transceivers))
+        {
+            if (m_enabledIds.contains(transceiver.id)) { m_enabled.push_back(transceiver); }
+        }
+    }
+} // ns
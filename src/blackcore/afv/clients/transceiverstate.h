@@ -0,0 +1,105 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_AFV_CLIENTS_TRANSCEIVERSTATE_H
+#define BLACKCORE_AFV_CLIENTS_TRANSCEIVERSTATE_H
+
+#include "blackcore/afv/dto.h"
+#include "blackcore/blackcoreexport.h"
+
+#include <QSet>
+#include <QVector>
+
+namespace BlackCore::Afv::Clients
+{
+    /*!
+     * Transceivers of the AFV client with their enabled and transmitting flags.
+     * CAfvClient publishes it as a snapshot through BlackMisc::LockFree, so readers
+     * never need a lock, and writers modify a copy.
+     */
+    class BLACKCORE_EXPORT CTransceiverState
+    {
+    public:
+        //! Horizontal movement which requires a transceiver update on the voice server
+        static constexpr double PositionThresholdM = 100.0;
+
+        //! Vertical movement which requires a transceiver update on the voice server
+        static constexpr double HeightThresholdM = 30.0;
+
+        //! Default ctor
+        CTransceiverState() = default;
+
+        //! Ctor
+        CTransceiverState(const QVector<TransceiverDto> &transceivers, const QSet<quint16> &enabledIds, const QVector<TxTransceiverDto> &transmitting);
+
+        //! All transceivers
+        const QVector<TransceiverDto> &getTransceivers() const { return m_transceivers; }
+
+        //! Ids of the enabled transceivers
+        const QSet<quint16> &getEnabledTransceiverIds() const { return m_enabledIds; }
+
+        //! Enabled transceivers, the ones used for the voice server and the sound card
+        const QVector<TransceiverDto> &getEnabledTransceivers() const { return m_enabled; }
+
+        //! Transmitting transceivers
+        const QVector<TxTransceiverDto> &getTransmittingTransceivers() const { return m_transmitting; }
+
+        //! Frequency of the transceiver, or defaultHz if there is no such transceiver
+        quint32 getFrequencyHz(quint16 id, quint32 defaultHz) const;
+
+        //! Is the transceiver enabled and existing?
+        bool isEnabled(quint16 id) const;
+
+        //! Is the transceiver transmitting?
+        bool isTransmitting(quint16 id) const;
+
+        //! Set all transceivers
+        void setTransceivers(const QVector<TransceiverDto> &transceivers);
+
+        //! Enable or disable one transceiver
+        void setEnabled(quint16 id, bool enabled);
+
+        //! Set the enabled transceivers
+        void setEnabledTransceiverIds(const QSet<quint16> &ids);
+
+        //! Set the transmitting transceivers
+        void setTransmittingTransceivers(const QVector<TxTransceiverDto> &transmitting) { m_transmitting = transmitting; }
+
+        //! Set the position of all transceivers
+        void setPosition(double latitudeDeg, double longitudeDeg, double heightMeters);
+
+        //! Set the frequency of one transceiver
+        //! \return true if changed
+        bool setFrequencyHz(quint16 id, quint32 frequencyHz);
+
+        //! Do the enabled transceivers differ from the other ones in frequency, or in position beyond the thresholds?
+        bool isChangedForVoiceServer(const QVector<TransceiverDto> &other) const { return isChanged(m_enabled, other); }
+
+        //! Does the other state differ in enabled or transmitting transceivers, frequency, or in position beyond the thresholds?
+        bool isChanged(const CTransceiverState &other) const;
+
+        //! Approximate horizontal distance in meters, good enough for the small distances compared here
+        static double distanceM(const TransceiverDto &a, const TransceiverDto &b);
+
+    private:
+        //! Transceivers differ?
+        static bool isChanged(const QVector<TransceiverDto> &transceivers, const QVector<TransceiverDto> &other);
+
+        //! Recalculate the enabled transceivers
+        void updateEnabled();
+
+        QVector<TransceiverDto>   m_transceivers;
+        QSet<quint16>             m_enabledIds;
+        QVector<TransceiverDto>   m_enabled; //!< cached from m_transceivers and m_enabledIds
+        QVector<TxTransceiverDto> m_transmitting;
+    };
+} // ns
+
+#endif // guard
@@ -81,6 +81,18 @@ namespace BlackCore::Afv::Connection
         });
     }
 
+    void CClientConnection::connectOffline(const QString &callsign, const CryptoDtoChannelConfigDto &voiceChannelConfig)
+    {
+        m_connection.reset();
+        m_connection.setCallsign(callsign);
+        m_connection.m_voiceCryptoChannel.reset(new CCryptoDtoChannel(voiceChannelConfig));
+        m_connection.setTsAuthenticatedToNow();
+        m_connection.setTsHeartbeatToNow();
+        m_connection.setReceiveAudio(true);
+        m_connection.setConnected(true);
+        CLogMessage(this).info(u"Connected: '%1' offline") << callsign;
+    }
+
     void CClientConnection::disconnectFrom(const QString &reason)
     {
         if (!m_connection.isConnected())
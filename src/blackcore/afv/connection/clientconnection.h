@@ -48,6 +48,14 @@ namespace BlackCore::Afv::Connection
         //! Disconnect
         void disconnectFrom(const QString &reason = {});
 
+        //! Connect without API and voice server, received messages are passed in by processOfflineMessage
+        //! \remark for offline harnesses like CAfvPipelineHarness, no socket is opened
+        void connectOffline(const QString &callsign, const CryptoDtoChannelConfigDto &voiceChannelConfig);
+
+        //! Process a message as if received from the voice server
+        //! \remark only after connectOffline
+        void processOfflineMessage(const QByteArray &message) { this->processMessage(message); }
+
         //! Is connected?
         bool isConnected() const { return m_connection.isConnected(); }
 
@@ -7,6 +7,7 @@
  */
 
 #include "blackcore/aircraftmatcher.h"
+#include "blackcore/matchingscriptenginepool.h"
 #include "blackcore/application.h"
 #include "blackcore/webdataservices.h"
 #include "blackmisc/simulation/simulatedaircraft.h"
@@ -307,7 +308,7 @@ namespace BlackCore
             // try to find in installed models by model string
             if (setup.getMatchingMode().testFlag(CAircraftMatcherSetup::ByModelString))
             {
-                matchedModel = matchByExactModelString(remoteAircraft, modelSet, whatToLog, log);
+                matchedModel = matchByExactModelString(remoteAircraft, modelSet, m_modelSetStrings, whatToLog, log);
                 if (matchedModel.hasModelString())
                 {
                     CMatchingUtils::addLogDetailsToList(log, remoteAircraft, u"Exact match by model string '" % matchedModel.getModelStringAndDbKey() % "'", getLogCategories(), CStatusMessage::SeverityError);
@@ -507,7 +508,7 @@ namespace BlackCore
     {
         if (!setup.doRunMsReverseLookupScript()) { return MatchingScriptReturnValues(inModel); }
         if (!sApp || sApp->isShuttingDown() || !sApp->hasWebDataServices()) { return inModel; }
-        const QString js = CFileUtils::readFileToString(setup.getMsReverseLookupFile());
+        const QString js = CMatchingScriptEnginePool::scriptSource(setup.getMsReverseLookupFile());
         const MatchingScriptReturnValues rv = CAircraftMatcher::matchingScript(js, inModel, inModel, setup, modelSet, ReverseLookup, log);
         return rv;
     }
@@ -516,7 +517,7 @@ namespace BlackCore
     {
         if (!setup.doRunMsMatchingStageScript()) { return MatchingScriptReturnValues(inModel); }
         if (!sApp || sApp->isShuttingDown() || !sApp->hasWebDataServices()) { return inModel; }
-        const QString js = CFileUtils::readFileToString(setup.getMsMatchingStageFile());
+        const QString js = CMatchingScriptEnginePool::scriptSource(setup.getMsMatchingStageFile());
         const MatchingScriptReturnValues rv = CAircraftMatcher::matchingScript(js, inModel, matchedModel, setup, modelSet, MatchingStage, log);
         return rv;
     }
@@ -546,17 +547,6 @@ namespace BlackCore
                 CCallsign::addLogDetailsToList(log, callsign, QStringLiteral("Matching script models: %1").arg(modelSet.coverageSummary()));
             }
 
-            QJSEngine engine;
-            // engine.installExtensions(QJSEngine::ConsoleExtension);
-
-            // Meta objects to create new JS objects, here causing JSValue can't be reassigned to another engine.
-            // static const QJSValue jsInOutMetaObject = engine.newQMetaObject(&MSInOutValues::staticMetaObject);
-            // engine.globalObject().setProperty("SwiftInOutObject", jsInOutMetaObject); // JS: new SwiftInOutObject();
-            // static const QJSValue jsSetMetaObject = engine.newQMetaObject(&MSModelSet::staticMetaObject);
-            // engine.globalObject().setProperty("SwiftModelSet", jsSetMetaObject); // JS: new SwiftModelSet
-            // static const QJSValue jsWebServicesMetaObject = engine.newQMetaObject(&MSWebServices::staticMetaObject);
-            // engine.globalObject().setProperty("SwiftWebServices", jsWebServicesMetaObject); // JS: new SwiftWebServices
-
             // init models and set
             MSInOutValues inObject(inModel);
             MSInOutValues matchedObject(matchedModel); // same as inModel for reverse lookup
@@ -566,28 +556,34 @@ namespace BlackCore
             modelSetObject.initByAircraftAndAirline(inModel.getAircraftIcaoCode(), inModel.getAirlineIcaoCode());
             MSWebServices webServices; // web services encapsulated
 
-            // object as from network
-            const QJSValue jsInObject = engine.newQObject(&inObject);
-            engine.globalObject().setProperty("inObject", jsInObject);
-
-            // object that will be returned
-            const QJSValue jsOutObject = engine.newQObject(&outObject);
-            engine.globalObject().setProperty("outObject", jsOutObject);
-
-            // object as matched so far, same as inObject in reverse lookup
-            const QJSValue jsMatchedObject = engine.newQObject(&matchedObject);
-            engine.globalObject().setProperty("matchedObject", jsMatchedObject);
-
-            // wrapper for model set
-            const QJSValue jsModelSetObject = engine.newQObject(&modelSetObject);
-            engine.globalObject().setProperty("modelSet", jsModelSetObject);
-
-            // wrapper for web services
-            const QJSValue jsWebServices = engine.newQObject(&webServices);
-            engine.globalObject().setProperty("webServices", jsWebServices);
+            // engine and compiled script are reused, the objects are set as globals for this call
+            const CMatchingScriptEnginePool::GlobalObjects globals
+            {
+                { QStringLiteral("inObject"), &inObject },           // object as from network
+                { QStringLiteral("outObject"), &outObject },         // object that will be returned
+                { QStringLiteral("matchedObject"), &matchedObject }, // object as matched so far, same as inObject in reverse lookup
+                { QStringLiteral("modelSet"), &modelSetObject },     // wrapper for model set
+                { QStringLiteral("webServices"), &webServices }      // wrapper for web services
+            };
+
+            const CMatchingScriptEnginePool::RunResult run = CMatchingScriptEnginePool::run(js, msReverse ? logFileR : logFileM, globals);
+            const QJSValue &ms = run.value;
+            if (log) { CCallsign::addLogDetailsToList(log, callsign, QStringLiteral("Matching script (%1) took %2ms").arg(msToString(script)).arg(run.elapsedMs)); }
+            if (run.timedOut)
+            {
+                const QString msg = QStringLiteral("Matching script (%1) interrupted after %2ms, timeout %3ms").arg(msToString(script)).arg(run.elapsedMs).arg(CMatchingScriptEnginePool::getTimeoutMs());
+                CLogMessage(static_cast<CAircraftMatcher *>(nullptr)).warning(msg);
+                if (log) { CCallsign::addLogDetailsToList(log, callsign, msg); }
+                break;
+            }
+            if (run.compileError)
+            {
+                const QString msg = QStringLiteral("Matching script syntax error: %1 '%2'").arg(ms.property("lineNumber").toInt()).arg(ms.toString());
+                CLogMessage(static_cast<CAircraftMatcher *>(nullptr)).warning(msg);
+                if (log) { CCallsign::addLogDetailsToList(log, callsign, msg); }
+                break;
+            }
 
-            QJSValue ms = engine.evaluate(js, msReverse ? logFileR : logFileM);
-            ms = ms.call();
             if (ms.isError())
             {
                 const QString msg = QStringLiteral("Matching script error: %1 '%2'").arg(ms.property("lineNumber").toInt()).arg(ms.toString());
@@ -1292,6 +1288,7 @@ namespace BlackCore
 
         // set values
         m_modelSet  = modelsCleaned;
+        m_modelSetStrings = CModelStringDictionary(modelsCleaned);
         m_simulator = simulator;
         m_modelSetInfo = QStringLiteral("Set: '%1' entries: %2").arg(simulator.toQString()).arg(modelsCleaned.size());
         return models.size();
@@ -1302,6 +1299,7 @@ namespace BlackCore
         if (incremental)
         {
             m_modelSet.removeModelsWithString(removedModels, Qt::CaseInsensitive);
+            m_modelSetStrings.removeModelStrings(removedModels);
             m_disabledModels.push_back(removedModels);
         }
         else
@@ -1309,12 +1307,15 @@ namespace BlackCore
             this->restoreDisabledModels();
             m_disabledModels = removedModels;
             m_modelSet.removeModelsWithString(removedModels, Qt::CaseInsensitive);
+            m_modelSetStrings.removeModelStrings(removedModels);
         }
     }
 
     void CAircraftMatcher::restoreDisabledModels()
     {
         m_modelSet.replaceOrAddModelsWithString(m_disabledModels, Qt::CaseInsensitive);
+        m_modelSetStrings.removeModelStrings(m_disabledModels);
+        m_modelSetStrings.insert(m_disabledModels);
     }
 
     void CAircraftMatcher::setDefaultModel(const CAircraftModel &defaultModel)
@@ -1449,7 +1450,7 @@ namespace BlackCore
             // if not yet reduced, reduce to VTOL
             if (!reduced && remoteAircraft.isVtol() && matchedModels.containsVtol() && mode.testFlag(CAircraftMatcherSetup::ByVtol))
             {
-                matchedModels = matchedModels.findByVtolFlag(true);
+                matchedModels.removeIf(&CAircraftModel::isVtol, false);
                 CMatchingUtils::addLogDetailsToList(log, remoteAircraft, QStringLiteral("Aircraft is VTOL, reduced to VTOL"), getLogCategories());
             }
 
@@ -1547,7 +1548,7 @@ namespace BlackCore
         return matchedModels.front();
     }
 
-    CAircraftModel CAircraftMatcher::matchByExactModelString(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &models, MatchingLog whatToLog, CStatusMessageList *log)
+    CAircraftModel CAircraftMatcher::matchByExactModelString(const CSimulatedAircraft &remoteAircraft, const CAircraftModelList &models, const CModelStringDictionary &modelStrings, MatchingLog whatToLog, CStatusMessageList *log)
     {
         CStatusMessageList *msLog = log && whatToLog.testFlag(MatchingLogModelstring) ? log : nullptr;
         if (remoteAircraft.getModelString().isEmpty())
@@ -1556,7 +1557,8 @@ namespace BlackCore
             return CAircraftModel();
         }
 
-        CAircraftModel model = models.findFirstByModelStringAliasOrDefault(remoteAircraft.getModelString());
+        CAircraftModel model = modelStrings.findFirstByModelStringOrDefault(remoteAircraft.getModelString());
+        if (!model.hasModelString()) { model = models.findFirstByModelStringAliasOrDefault(remoteAircraft.getModelString()); }
         if (msLog)
         {
             if (model.hasModelString())
@@ -19,6 +19,7 @@
 #include "blackmisc/simulation/matchingscriptmisc.h"
 #include "blackmisc/simulation/matchingstatistics.h"
 #include "blackmisc/simulation/matchinglog.h"
+#include "blackmisc/simulation/modelstringdictionary.h"
 #include "blackmisc/simulation/categorymatcher.h"
 #include "blackmisc/statusmessage.h"
 #include "blackmisc/valueobject.h"
@@ -329,7 +330,8 @@ namespace BlackCore
 
         //! Search in models by key (aka model string)
         //! \threadsafe
-        static BlackMisc::Simulation::CAircraftModel matchByExactModelString(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &models, BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log);
+        //! \remark modelStrings is the dictionary of models, model string aliases are searched in models
+        static BlackMisc::Simulation::CAircraftModel matchByExactModelString(const BlackMisc::Simulation::CSimulatedAircraft &remoteAircraft, const BlackMisc::Simulation::CAircraftModelList &models, const BlackMisc::Simulation::CModelStringDictionary &modelStrings, BlackMisc::Simulation::MatchingLog whatToLog, BlackMisc::CStatusMessageList *log);
 
         //! Installed models by ICAO data
         //! \threadsafe
@@ -402,6 +404,7 @@ namespace BlackCore
         BlackMisc::Simulation::CAircraftMatcherSetup m_setup;           //!< setup
         BlackMisc::Simulation::CAircraftModel        m_defaultModel;    //!< model to be used as default model
         BlackMisc::Simulation::CAircraftModelList    m_modelSet;        //!< models used for model matching
+        BlackMisc::Simulation::CModelStringDictionary m_modelSetStrings; //!< model strings of m_modelSet
         BlackMisc::Simulation::CAircraftModelList    m_disabledModels;  //!< disabled models for matching
         BlackMisc::Simulation::CSimulatorInfo        m_simulator;       //!< simulator (optional)
         BlackMisc::Simulation::CMatchingStatistics   m_statistics;      //!< matching statistics
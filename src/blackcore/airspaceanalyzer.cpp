@@ -9,6 +9,7 @@
 #include "blackcore/airspaceanalyzer.h"
 #include "blackcore/airspacemonitor.h"
 #include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/aviation/transponder.h"
 #include "blackmisc/logmessage.h"
@@ -59,13 +60,12 @@ namespace BlackCore
         Q_ASSERT(c);
 
         // network situations
-        c = connect(fsdClient, &CFSDClient::pilotDataUpdateReceived, this, &CAirspaceAnalyzer::onNetworkPositionUpdate, Qt::QueuedConnection);
-        Q_ASSERT(c);
         c = connect(fsdClient, &CFSDClient::atcDataUpdateReceived, this, &CAirspaceAnalyzer::watchdogTouchAtcCallsign, Qt::QueuedConnection);
         Q_ASSERT(c);
 
         // Monitor
-        c = connect(airspaceMonitorParent, &CAirspaceMonitor::addedAircraftSituation, this, &CAirspaceAnalyzer::watchdogTouchAircraftCallsign);
+        // coalesced: one batch per tick instead of a queued signal per (fast) position update
+        c = connect(airspaceMonitorParent, &CAirspaceMonitor::addedAircraftSituationsCoalesced, this, &CAirspaceAnalyzer::watchdogTouchAircraftCallsigns);
         Q_ASSERT(c);
         c = connect(airspaceMonitorParent, &CAirspaceMonitor::removedAircraft, this, &CAirspaceAnalyzer::watchdogRemoveAircraftCallsign);
         Q_ASSERT(c);
@@ -97,12 +97,6 @@ namespace BlackCore
     CAirspaceAnalyzer::~CAirspaceAnalyzer()
     { }
 
-    void CAirspaceAnalyzer::onNetworkPositionUpdate(const CAircraftSituation &situation, const CTransponder &transponder)
-    {
-        Q_UNUSED(transponder)
-        this->watchdogTouchAircraftCallsign(situation);
-    }
-
     void CAirspaceAnalyzer::onChangedAtcStationOnlineConnectionStatus(const CAtcStation &station, bool isConnected)
     {
         const CCallsign cs = station.getCallsign();
@@ -116,11 +110,15 @@ namespace BlackCore
         }
     }
 
-    void CAirspaceAnalyzer::watchdogTouchAircraftCallsign(const CAircraftSituation &situation)
+    void CAirspaceAnalyzer::watchdogTouchAircraftCallsigns(const CAircraftSituationList &situations)
     {
-        const CCallsign cs = situation.getCallsign();
-        Q_ASSERT_X(!cs.isEmpty(), Q_FUNC_INFO, "No callsign in situaton");
-        m_aircraftCallsignTimestamps[cs] = QDateTime::currentMSecsSinceEpoch();
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        for (const CAircraftSituation &situation : situations)
+        {
+            const CCallsign &cs = situation.getCallsign();
+            Q_ASSERT_X(!cs.isEmpty(), Q_FUNC_INFO, "No callsign in situaton");
+            m_aircraftCallsignTimestamps[cs] = now;
+        }
     }
 
     void CAirspaceAnalyzer::watchdogTouchAtcCallsign(const CCallsign &callsign, const CFrequency &frequency, const CCoordinateGeodetic &position, const CLength &range)
@@ -100,8 +100,8 @@ namespace BlackCore
         //! Remove callsign from watch list
         void watchdogRemoveAtcCallsign(const BlackMisc::Aviation::CCallsign &callsign);
 
-        //! Reset timestamp for callsign
-        void watchdogTouchAircraftCallsign(const BlackMisc::Aviation::CAircraftSituation &situation);
+        //! Reset timestamps for the callsigns of the situations
+        void watchdogTouchAircraftCallsigns(const BlackMisc::Aviation::CAircraftSituationList &situations);
 
         //! Reset timestamp for callsign
         void watchdogTouchAtcCallsign(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::PhysicalQuantities::CFrequency &frequency,
@@ -110,9 +110,6 @@ namespace BlackCore
         //! Connection status of network changed
         void onConnectionStatusChanged(BlackMisc::Network::CConnectionStatus oldStatus, BlackMisc::Network::CConnectionStatus newStatus);
 
-        //! Network position update
-        void onNetworkPositionUpdate(const BlackMisc::Aviation::CAircraftSituation &situation, const BlackMisc::Aviation::CTransponder &transponder);
-
         //! ATC stations online
         void onChangedAtcStationOnlineConnectionStatus(const BlackMisc::Aviation::CAtcStation &station, bool isConnected);
 
@@ -27,6 +27,7 @@
 #include "blackmisc/test/testing.h"
 #include "blackmisc/mixin/mixincompare.h"
 #include "blackmisc/iterator.h"
+#include "blackmisc/latencytrace.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/propertyindexvariantmap.h"
 #include "blackmisc/range.h"
@@ -361,9 +362,7 @@ namespace BlackCore
 
     void CAirspaceMonitor::testAddAircraftParts(const CCallsign &callsign, const CAircraftParts &parts, bool incremental)
     {
-        this->onAircraftConfigReceived(callsign,
-                                       incremental ? parts.toIncrementalJson() : parts.toFullJson(),
-                                       5000);
+        this->onAircraftConfigReceived(callsign, CAircraftPartsDelta::fromParts(parts, !incremental), 5000);
     }
 
     const QString &CAirspaceMonitor::enumFlagToString(CAirspaceMonitor::MatchingReadinessFlag r)
@@ -414,6 +413,15 @@ namespace BlackCore
                 const CLength d = CLength::parsedFromString(r);
                 this->setMaxRange(d);
             }
+            else if (parser.matchesPart(1, "coalesce") && parser.countParts() > 2)
+            {
+                const int ms = parser.toInt(2, -1);
+                if (ms < 0) { return false; }
+                QPointer<CAirspaceMonitor> myself(this);
+                QTimer::singleShot(0, this, [ = ] { if (myself) { myself->setSituationsCoalescingIntervalMs(ms); } });
+                CLogMessage(this).info(u"Situation coalescing tick: %1ms") << ms;
+                return true;
+            }
         }
         return false;
     }
@@ -592,13 +600,23 @@ namespace BlackCore
     void CAirspaceMonitor::onReceivedVatsimDataFile()
     {
         Q_ASSERT(CThreadUtils::isInThisThread(this));
-        if (!sApp || sApp->isShuttingDown() || !sApp->getWebDataServices()) { return; }
+        if (!sApp || sApp->isShuttingDown() || !sApp->getWebDataServices() || !sApp->getWebDataServices()->getVatsimDataFileReader()) { return; }
+        const CVatsimDataFileSnapshot::ConstPtr snapshot = sApp->getWebDataServices()->getVatsimDataFileReader()->getSnapshot();
+
+        // clients get their voice capabilities when added, so only pilots changed in the data file need an update
+        // if a data file was missed, all clients are checked
+        const bool useDiff = m_vatsimDataFileProcessed.isValid() && snapshot->getPreviousUpdateTimestamp() == m_vatsimDataFileProcessed;
+        m_vatsimDataFileProcessed = snapshot->getUpdateTimestamp();
+        const CCallsignSet changedPilots = useDiff ? snapshot->getDiff().getAddedOrChangedPilots() : CCallsignSet();
+        if (useDiff && changedPilots.isEmpty()) { return; }
+
         CClientList clients(this->getClients()); // copy
         bool changed = false;
         for (auto client = clients.begin(); client != clients.end(); ++client)
         {
             if (client->hasSpecifiedVoiceCapabilities()) { continue; } // we already have voice caps
-            const CVoiceCapabilities vc = sApp->getWebDataServices()->getVoiceCapabilityForCallsign(client->getCallsign());
+            if (useDiff && !changedPilots.contains(client->getCallsign())) { continue; }
+            const CVoiceCapabilities vc = snapshot->getFlightPlanRemarksForCallsign(client->getCallsign()).getVoiceCapabilities();
             if (vc.isUnknown()) { continue; }
             changed = true;
             client->setVoiceCapabilities(vc);
@@ -1258,6 +1276,7 @@ namespace BlackCore
         if (!this->isConnectedAndNotShuttingDown()) { return; }
 
         const CCallsign callsign(situation.getCallsign());
+        const CLatencySpan span(CLatencyTrace::AirspaceMonitor, callsign.asString());
         Q_ASSERT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Empty callsign");
 
         if (this->isCopilotAircraft(callsign)) { return; }
@@ -1308,6 +1327,7 @@ namespace BlackCore
         if (!this->isConnectedAndNotShuttingDown()) { return; }
 
         const CCallsign callsign(situation.getCallsign());
+        const CLatencySpan span(CLatencyTrace::AirspaceMonitor, callsign.asString());
 
         // checks
         Q_ASSERT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Empty callsign");
@@ -1354,6 +1374,7 @@ namespace BlackCore
         if (!this->isConnectedAndNotShuttingDown()) { return; }
 
         const CCallsign callsign(situation.getCallsign());
+        const CLatencySpan span(CLatencyTrace::AirspaceMonitor, callsign.asString());
 
         // checks
         Q_ASSERT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Empty callsign");
@@ -1404,8 +1425,7 @@ namespace BlackCore
             onIcaoCodesReceived(situation.getCallsign(), aircraftIcao, airlineIcao, airlineIcao);
         }
 
-        //! \fixme Converting CAircraftParts to JSON then converting JSON right back to CAircraftParts, should just directly use CAircraftParts without conversion.
-        onAircraftConfigReceived(situation.getCallsign(), parts.toFullJson(), currentOffsetMs);
+        onAircraftConfigReceived(situation.getCallsign(), CAircraftPartsDelta::fromParts(parts, true), currentOffsetMs);
     }
 
     void CAirspaceMonitor::onConnectionStatusChanged(CConnectionStatus oldStatus, CConnectionStatus newStatus)
@@ -1506,14 +1526,14 @@ namespace BlackCore
 
     }
 
-    void CAirspaceMonitor::onAircraftConfigReceived(const CCallsign &callsign, const QJsonObject &jsonObject, qint64 currentOffsetMs)
+    void CAirspaceMonitor::onAircraftConfigReceived(const CCallsign &callsign, const CAircraftPartsDelta &delta, qint64 currentOffsetMs)
     {
         Q_ASSERT(CThreadUtils::isInThisThread(this));
         BLACK_AUDIT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Need callsign");
         if (callsign.isEmpty()) { return; }
 
         // store parts
-        this->storeAircraftParts(callsign, jsonObject, currentOffsetMs);
+        this->storeAircraftParts(callsign, delta, currentOffsetMs);
 
         // update client capability
         CClient client = this->getClientOrDefaultForCallsign(callsign);
@@ -1541,6 +1561,7 @@ namespace BlackCore
             // b) elevations not needed pollute the cache with "useless" values
             //
             if (canLikelySkipNearGround || correctedSituation.hasGroundElevation()) { break; }
+            const CLatencySpan span(CLatencyTrace::ElevationLookup, callsign.asString());
 
             // set a defined state
             correctedSituation.resetGroundElevation();
@@ -39,6 +39,7 @@
 #include "blackmisc/simplecommandparser.h"
 #include "blackmisc/identifier.h"
 
+#include <QDateTime>
 #include <QJsonObject>
 #include <QList>
 #include <QHash>
@@ -187,6 +188,7 @@ namespace BlackCore
         {
             if (BlackMisc::CSimpleCommandParser::registered("BlackCore::Fsd::CFSDClient")) { return; }
             BlackMisc::CSimpleCommandParser::registerCommand({".fsd range distance", "FSD max. range"});
+            BlackMisc::CSimpleCommandParser::registerCommand({".fsd coalesce ms", "tick of coalesced situation updates, 0 no coalescing"});
         }
 
     signals:
@@ -292,6 +294,7 @@ namespace BlackCore
         Fsd::CFSDClient   *m_fsdClient = nullptr;            //!< corresponding network interface
         CAirspaceAnalyzer *m_analyzer  = nullptr;            //!< owned analyzer
         bool m_bookingsRequested       = false;              //!< bookings have been requested, it can happen we receive an BlackCore::Vatsim::CVatsimBookingReader::atcBookingsReadUnchanged signal
+        QDateTime m_vatsimDataFileProcessed;                  //!< timestamp of the last processed VATSIM data file snapshot
         int m_maxDistanceNM            = 125;                //!< position range / FSD range
         int m_maxDistanceNMHysteresis  = qRound(1.1 * m_maxDistanceNM);
         int m_foundInNonMovingAircraft = 0;
@@ -452,7 +455,7 @@ namespace BlackCore
         void onReceivedAtcBookings(const BlackMisc::Aviation::CAtcStationList &bookedStations);
         void onReadUnchangedAtcBookings();
         void onReceivedVatsimDataFile();
-        void onAircraftConfigReceived(const BlackMisc::Aviation::CCallsign &callsign, const QJsonObject &jsonObject, qint64 currentOffsetMs);
+        void onAircraftConfigReceived(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::Aviation::CAircraftPartsDelta &delta, qint64 currentOffsetMs);
         void onAircraftInterimUpdateReceived(const BlackMisc::Aviation::CAircraftSituation &situation);
         void onAircraftVisualUpdateReceived(const BlackMisc::Aviation::CAircraftSituation &situation);
         void onAircraftSimDataUpdateReceived(const BlackMisc::Aviation::CAircraftSituation &situation, const BlackMisc::Aviation::CAircraftParts &parts, qint64 currentOffsetMs, const QString &aircraftIcao, const QString &airlineIcao);
@@ -32,6 +32,7 @@
 #include "blackmisc/loghandler.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/logpattern.h"
+#include "blackmisc/network/httpdiskcache.h"
 #include "blackmisc/network/networkutils.h"
 #include "blackmisc/registermetadata.h"
 #include "blackmisc/settingscache.h"
@@ -1264,6 +1265,11 @@ namespace BlackCore
     void CApplication::initNetwork()
     {
         if (!m_accessManager) { m_accessManager = new QNetworkAccessManager(this); }
+        if (!m_accessManager->cache())
+        {
+            // conditional requests, unchanged data files are answered with "304 not modified"
+            m_accessManager->setCache(new CHttpDiskCache(CSwiftDirectories::httpCacheDirectory(), CHttpDiskCache::DefaultMaximumCacheSize, m_accessManager));
+        }
         if (!m_networkConfigManager) { m_networkConfigManager = new QNetworkConfigurationManager(this); }
 
         if (!m_networkWatchDog)
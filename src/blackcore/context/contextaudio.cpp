@@ -13,6 +13,9 @@
 #include "blackcore/context/contextaudioimpl.h"
 #include "blackcore/context/contextaudioproxy.h"
 #include "blackcore/afv/clients/afvclient.h"
+#include "blackcore/application.h"
+#include "blackcore/inputmanager.h"
+#include "blackmisc/input/actionhotkeydefs.h"
 #include "blackmisc/simplecommandparser.h"
 #include "blackmisc/dbusserver.h"
 #include "blackmisc/stringutils.h"
@@ -88,7 +91,8 @@ namespace BlackCore::Context
             ".vol", ".volume",    // output volume
             ".mute",              // mute
             ".unmute",            // unmute
-            ".aliased"
+            ".aliased",
+            ".pttlatency"
         });
         parser.parse(commandLine);
         if (!parser.isKnownCommand()) { return false; }
@@ -117,6 +121,12 @@ namespace BlackCore::Context
             CLogMessage(this).info(u"Aliased stations are: %1") << boolToOnOff(enable);
             return true;
         }
+        else if (afvClient() && parser.matchesCommand(".pttlatency"))
+        {
+            CLogMessage(this).info(u"%1") << afvClient()->getPttLatencyStatistics();
+            if (parser.matchesPart(1, "reset")) { afvClient()->resetPttLatency(); }
+            return true;
+        }
         return false;
     }
 
@@ -208,10 +218,30 @@ namespace BlackCore::Context
         connect(m_voiceClient, &CAfvClient::changedMute,  this, &CContextAudioBase::changedMute,  Qt::QueuedConnection);
         connect(m_voiceClient, &CAfvClient::connectionStatusChanged, this, &CContextAudioBase::onAfvConnectionStatusChanged, Qt::QueuedConnection);
         connect(m_voiceClient, &CAfvClient::afvConnectionFailure,    this, &CContextAudioBase::onAfvConnectionFailure,       Qt::QueuedConnection);
+
+        // PTT directly from the input device, the regular binding m_actionPtt follows via the event loop
+        if (sApp && !sApp->isShuttingDown() && sApp->getInputManager() && !sApp->getApplicationInfo().isUnitTest())
+        {
+            CAfvClient *voiceClient = m_voiceClient; // not called anymore once unbound in terminateVoiceClient
+            m_pttFastPathIndex = sApp->getInputManager()->bindFastPath(BlackMisc::Input::pttHotkeyAction(), [voiceClient](bool active) { voiceClient->setPttFast(active); });
+
+            // the regular path ignores PTT while a hotkey is captured
+            m_pttCaptureConnection = connect(sApp->getInputManager(), &CInputManager::combinationSelectionFinished, this, [voiceClient]
+            {
+                voiceClient->resetPttFast();
+            }, Qt::DirectConnection);
+        }
     }
 
     void CContextAudioBase::terminateVoiceClient()
     {
+        if (m_pttFastPathIndex >= 0)
+        {
+            if (sApp && sApp->getInputManager()) { sApp->getInputManager()->unbindFastPath(m_pttFastPathIndex); }
+            m_pttFastPathIndex = -1;
+            QObject::disconnect(m_pttCaptureConnection);
+        }
+
         if (m_voiceClient)
         {
             m_voiceClient->gracefulShutdown();
@@ -249,6 +249,7 @@ namespace BlackCore
                 BlackMisc::CSimpleCommandParser::registerCommand({".unmute", "unmute audio"});
                 BlackMisc::CSimpleCommandParser::registerCommand({".vol volume", "volume 0..100"});
                 BlackMisc::CSimpleCommandParser::registerCommand({".aliased on|off", "aliased HF frequencies"});
+                BlackMisc::CSimpleCommandParser::registerCommand({".pttlatency [reset]", "PTT key down to first frame sent"});
             }
 
             // -------- parts which can run in core and GUI, referring to local voice client ------------
@@ -264,6 +265,7 @@ namespace BlackCore
             //! .unmute                        unmute           BlackCore::Context::CContextAudioBase
             //! .vol .volume   volume 0..100   set volume       BlackCore::Context::CContextAudioBase
             //! .aliased on|off                aliased stations BlackCore::Context::CContextAudioBase
+            //! .pttlatency [reset]            PTT latency      BlackCore::Context::CContextAudioBase
             //! </pre>
             virtual bool parseCommandLine(const QString &commandLine, const BlackMisc::CIdentifier &originator) override;
             //! \endcond
@@ -375,6 +377,8 @@ namespace BlackCore
 
             // AFV
             Afv::Clients::CAfvClient *m_voiceClient = nullptr;
+            int m_pttFastPathIndex = -1; //!< PTT fast path bound with the input manager
+            QMetaObject::Connection m_pttCaptureConnection; //!< resets the PTT fast path after a hotkey capture
             bool m_winCoInitialized = false;
             BlackMisc::Audio::CAudioDeviceInfoList m_activeLocalDevices;
 
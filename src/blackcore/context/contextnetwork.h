@@ -343,6 +343,17 @@ namespace BlackCore::Context
         //! Statistics enable/disable
         virtual bool setNetworkStatisticsEnable(bool enabled) = 0;
 
+        //! Latency trace histograms per pipeline stage
+        //! \sa BlackMisc::CLatencyTrace
+        virtual QString getLatencyTraceStatistics(bool reset, const QString &separator) = 0;
+
+        //! Latency trace enable/disable, only the given callsigns are traced (empty means all)
+        virtual bool setLatencyTraceEnabled(bool enabled, const QStringList &callsigns) = 0;
+
+        //! Write the latency trace as Chrome/Perfetto trace JSON to the log directory
+        //! \return file name, empty if failed
+        virtual QString writeLatencyTraceFile() = 0;
+
         //! Network preset values
         virtual QStringList getNetworkPresetValues() const = 0;
 
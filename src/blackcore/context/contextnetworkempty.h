@@ -505,6 +505,31 @@ namespace BlackCore::Context
             return false;
         }
 
+        //! \copydoc IContextNetwork::getLatencyTraceStatistics
+        virtual QString getLatencyTraceStatistics(bool reset, const QString &separator) override
+        {
+            logEmptyContextWarning(Q_FUNC_INFO);
+            Q_UNUSED(reset)
+            Q_UNUSED(separator)
+            return {};
+        }
+
+        //! \copydoc IContextNetwork::setLatencyTraceEnabled
+        virtual bool setLatencyTraceEnabled(bool enabled, const QStringList &callsigns) override
+        {
+            logEmptyContextWarning(Q_FUNC_INFO);
+            Q_UNUSED(enabled)
+            Q_UNUSED(callsigns)
+            return false;
+        }
+
+        //! \copydoc IContextNetwork::writeLatencyTraceFile
+        virtual QString writeLatencyTraceFile() override
+        {
+            logEmptyContextWarning(Q_FUNC_INFO);
+            return {};
+        }
+
     public:
         //! \copydoc IContextNetwork::connectRawFsdMessageSignal
         virtual QMetaObject::Connection connectRawFsdMessageSignal(QObject *receiver, RawFsdMessageReceivedSlot rawFsdMessageReceivedSlot) override
@@ -30,11 +30,14 @@
 #include "blackmisc/pq/time.h"
 #include "blackmisc/pq/units.h"
 #include "blackmisc/dbusserver.h"
+#include "blackmisc/fileutils.h"
+#include "blackmisc/latencytrace.h"
 #include "blackmisc/logcategories.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/sequence.h"
 #include "blackmisc/simplecommandparser.h"
 #include "blackmisc/stringutils.h"
+#include "blackmisc/swiftdirectories.h"
 #include "blackconfig/buildconfig.h"
 
 #include <stdbool.h>
@@ -348,7 +351,7 @@ namespace BlackCore::Context
         if (!this->canUseFsd())             { return false; }
         if (commandLine.isEmpty())          { return false; }
 
-        static const QStringList cmds({ ".msg", ".m", ".chat", ".altos", ".altoffset", ".addtimeos", ".addtimeoffset", ".wallop", ".watchdog", ".reinit", ".reinitialize", ".enable", ".disable", ".ignore", ".unignore", ".fsd" });
+        static const QStringList cmds({ ".msg", ".m", ".chat", ".altos", ".altoffset", ".addtimeos", ".addtimeoffset", ".wallop", ".watchdog", ".reinit", ".reinitialize", ".enable", ".disable", ".ignore", ".unignore", ".fsd", ".trace" });
         CSimpleCommandParser parser(cmds);
         parser.parse(commandLine);
         if (!parser.isKnownCommand()) { return false; }
@@ -544,6 +547,29 @@ namespace BlackCore::Context
             const CCallsign cs(parser.part(1));
             if (cs.isValid()) { this->updateAircraftEnabled(cs, false); }
         }
+        else if (parser.matchesCommand(".trace"))
+        {
+            if (parser.countParts() < 2) { return false; }
+            const QString what = parser.part(1).toLower();
+            if (what == QStringView(u"show"))
+            {
+                CLogMessage(this).info(u"Latency trace:\n%1") << this->getLatencyTraceStatistics(false, "\n");
+            }
+            else if (what == QStringView(u"write"))
+            {
+                const QString fn = this->writeLatencyTraceFile();
+                if (fn.isEmpty()) { return false; }
+                CLogMessage(this).info(u"Written latency trace '%1'") << fn;
+            }
+            else
+            {
+                QStringList callsigns;
+                for (int i = 2; i < parser.countParts(); ++i) { callsigns << parser.part(i); }
+                const bool enabled = this->setLatencyTraceEnabled(parser.toBool(1, true), callsigns);
+                CLogMessage(this).info(u"Latency trace: %1 %2") << boolToOnOff(enabled) << callsigns.join(' ');
+            }
+            return true;
+        }
         else if (m_airspace && parser.matchesCommand(".fsd"))
         {
             return m_airspace->parseCommandLine(commandLine, originator);
@@ -1032,6 +1058,36 @@ namespace BlackCore::Context
         return m_fsdClient->setStatisticsEnable(enabled);
     }
 
+    QString CContextNetwork::getLatencyTraceStatistics(bool reset, const QString &separator)
+    {
+        if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
+        const QString stats = CLatencyTrace::getHistogramsAsText(separator);
+        if (reset) { CLatencyTrace::reset(); }
+        return stats;
+    }
+
+    bool CContextNetwork::setLatencyTraceEnabled(bool enabled, const QStringList &callsigns)
+    {
+        if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO << enabled << callsigns; }
+        CLatencyTrace::setSampledCallsigns(callsigns);
+        if (enabled && !CLatencyTrace::isEnabled()) { CLatencyTrace::reset(); }
+        CLatencyTrace::setEnabled(enabled);
+        return enabled;
+    }
+
+    QString CContextNetwork::writeLatencyTraceFile()
+    {
+        if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
+        const QString ts = QDateTime::currentDateTimeUtc().toString(QStringLiteral("yyyyMMddhhmmss"));
+        const QString fn = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1_latencytrace.json").arg(ts));
+        if (!CLatencyTrace::writeChromeTraceFile(fn))
+        {
+            CLogMessage(this).warning(u"Cannot write latency trace file '%1'") << fn;
+            return {};
+        }
+        return fn;
+    }
+
     bool CContextNetwork::testAddAltitudeOffset(const CCallsign &callsign, const CLength &offset)
     {
         if (this->isDebugEnabled()) { CLogMessage(this, CLogCategories::contextSlot()).debug() << Q_FUNC_INFO; }
@@ -200,6 +200,9 @@ namespace BlackCore
             virtual qint64 partsLastModified(const BlackMisc::Aviation::CCallsign &callsign) const override;
             virtual QString getNetworkStatistics(bool reset, const QString &separator) override;
             virtual bool setNetworkStatisticsEnable(bool enabled) override;
+            virtual QString getLatencyTraceStatistics(bool reset, const QString &separator) override;
+            virtual bool setLatencyTraceEnabled(bool enabled, const QStringList &callsigns) override;
+            virtual QString writeLatencyTraceFile() override;
             virtual bool testAddAltitudeOffset(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::PhysicalQuantities::CLength &offset = BlackMisc::PhysicalQuantities::CLength::null()) override;
             virtual QStringList getNetworkPresetValues() const override;
             virtual BlackMisc::Aviation::CCallsign getPartnerCallsign() const override;
@@ -248,6 +251,8 @@ namespace BlackCore
                 BlackMisc::CSimpleCommandParser::registerCommand({".enable callsign", "enable/unignore callsign"});
                 BlackMisc::CSimpleCommandParser::registerCommand({".disable", "alias: .ignore"});
                 BlackMisc::CSimpleCommandParser::registerCommand({".disable callsign", "disable/ignore callsign"});
+                BlackMisc::CSimpleCommandParser::registerCommand({".trace on|off [callsigns]", "enable/disable latency trace, optionally only for the callsigns"});
+                BlackMisc::CSimpleCommandParser::registerCommand({".trace show|write", "show latency histograms/write Chrome trace file"});
             }
 
             //! \publicsection
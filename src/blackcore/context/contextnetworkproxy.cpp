@@ -315,6 +315,21 @@ namespace BlackCore::Context
         return m_dBusInterface->callDBusRet<bool>(QLatin1String("setNetworkStatisticsEnable"), enabled);
     }
 
+    QString CContextNetworkProxy::getLatencyTraceStatistics(bool reset, const QString &separator)
+    {
+        return m_dBusInterface->callDBusRet<QString>(QLatin1String("getLatencyTraceStatistics"), reset, separator);
+    }
+
+    bool CContextNetworkProxy::setLatencyTraceEnabled(bool enabled, const QStringList &callsigns)
+    {
+        return m_dBusInterface->callDBusRet<bool>(QLatin1String("setLatencyTraceEnabled"), enabled, callsigns);
+    }
+
+    QString CContextNetworkProxy::writeLatencyTraceFile()
+    {
+        return m_dBusInterface->callDBusRet<QString>(QLatin1String("writeLatencyTraceFile"));
+    }
+
     QStringList CContextNetworkProxy::getNetworkPresetValues() const
     {
         return m_dBusInterface->callDBusRet<QStringList>(QLatin1String("getNetworkPresetValues"));
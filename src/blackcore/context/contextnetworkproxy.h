@@ -127,6 +127,9 @@ namespace BlackCore
             virtual void enableAircraftPartsHistory(bool enabled) override;
             virtual QString getNetworkStatistics(bool reset, const QString &separator) override;
             virtual bool setNetworkStatisticsEnable(bool enabled) override;
+            virtual QString getLatencyTraceStatistics(bool reset, const QString &separator) override;
+            virtual bool setLatencyTraceEnabled(bool enabled, const QStringList &callsigns) override;
+            virtual QString writeLatencyTraceFile() override;
             virtual QStringList getNetworkPresetValues() const override;
             virtual BlackMisc::Aviation::CCallsign getPartnerCallsign() const override;
             virtual void testCreateDummyOnlineAtcStations(int number) override;
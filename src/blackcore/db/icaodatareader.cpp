@@ -54,29 +54,35 @@ namespace BlackCore::Db
         return m_aircraftIcaoCache.get();
     }
 
+    CIcaoCodeLookup::ConstPtr CIcaoDataReader::getIcaoCodeLookup() const
+    {
+        QReadLocker l(&m_lookupLock);
+        return m_lookup;
+    }
+
     CAircraftIcaoCode CIcaoDataReader::getAircraftIcaoCodeForDesignator(const QString &designator) const
     {
-        return this->getAircraftIcaoCodes().findFirstByDesignatorAndRank(designator);
+        return this->getIcaoCodeLookup()->findFirstAircraftByDesignatorAndRank(designator);
     }
 
     CAircraftIcaoCodeList CIcaoDataReader::getAircraftIcaoCodesForDesignator(const QString &designator) const
     {
-        return this->getAircraftIcaoCodes().findByDesignator(designator);
+        return this->getIcaoCodeLookup()->findAircraftByDesignator(designator);
     }
 
     CAircraftIcaoCodeList CIcaoDataReader::getAircraftIcaoCodesForIataCode(const QString &iataCode) const
     {
-        return this->getAircraftIcaoCodes().findByIataCode(iataCode);
+        return this->getIcaoCodeLookup()->findAircraftByIataCode(iataCode);
     }
 
     CAircraftIcaoCode CIcaoDataReader::getAircraftIcaoCodeForDbKey(int key) const
     {
-        return this->getAircraftIcaoCodes().findByKey(key);
+        return this->getIcaoCodeLookup()->findAircraftByKey(key);
     }
 
     bool CIcaoDataReader::containsAircraftIcaoDesignator(const QString &designator) const
     {
-        return this->getAircraftIcaoCodes().containsDesignator(designator);
+        return this->getIcaoCodeLookup()->containsAircraftDesignator(designator);
     }
 
     CAirlineIcaoCodeList CIcaoDataReader::getAirlineIcaoCodes() const
@@ -107,32 +113,32 @@ namespace BlackCore::Db
 
     CAirlineIcaoCodeList CIcaoDataReader::getAirlineIcaoCodesForDesignator(const QString &designator) const
     {
-        return this->getAirlineIcaoCodes().findByVDesignator(designator);
+        return this->getIcaoCodeLookup()->findAirlinesByVDesignator(designator);
     }
 
     bool CIcaoDataReader::containsAirlineIcaoDesignator(const QString &designator) const
     {
-        return this->getAirlineIcaoCodes().containsVDesignator(designator);
+        return this->getIcaoCodeLookup()->containsAirlineVDesignator(designator);
     }
 
     CAirlineIcaoCode CIcaoDataReader::getAirlineIcaoCodeForUniqueDesignatorOrDefault(const QString &designator, bool preferOperatingAirlines) const
     {
-        return this->getAirlineIcaoCodes().findByUniqueVDesignatorOrDefault(designator, preferOperatingAirlines);
+        return this->getIcaoCodeLookup()->findAirlineByUniqueVDesignatorOrDefault(designator, preferOperatingAirlines);
     }
 
     CAirlineIcaoCodeList CIcaoDataReader::getAirlineIcaoCodesForIataCode(const QString &iataCode) const
     {
-        return this->getAirlineIcaoCodes().findByIataCode(iataCode);
+        return this->getIcaoCodeLookup()->findAirlinesByIataCode(iataCode);
     }
 
     CAirlineIcaoCode CIcaoDataReader::getAirlineIcaoCodeForUniqueIataCodeOrDefault(const QString &iataCode) const
     {
-        return this->getAirlineIcaoCodes().findByUniqueIataCodeOrDefault(iataCode);
+        return this->getIcaoCodeLookup()->findAirlineByUniqueIataCodeOrDefault(iataCode);
     }
 
     CAirlineIcaoCode CIcaoDataReader::getAirlineIcaoCodeForDbKey(int key) const
     {
-        return this->getAirlineIcaoCodes().findByKey(key);
+        return this->getIcaoCodeLookup()->findAirlineByKey(key);
     }
 
     CAirlineIcaoCode CIcaoDataReader::smartAirlineIcaoSelector(const CAirlineIcaoCode &icaoPattern, const CCallsign &callsign) const
@@ -253,11 +259,13 @@ namespace BlackCore::Db
 
     void CIcaoDataReader::aircraftIcaoCacheChanged()
     {
+        this->rebuildIcaoCodeLookup();
         this->cacheHasChanged(CEntityFlags::AircraftIcaoEntity);
     }
 
     void CIcaoDataReader::airlineIcaoCacheChanged()
     {
+        this->rebuildIcaoCodeLookup();
         this->cacheHasChanged(CEntityFlags::AirlineIcaoEntity);
     }
 
@@ -276,6 +284,23 @@ namespace BlackCore::Db
         // void
     }
 
+    void CIcaoDataReader::rebuildIcaoCodeLookup()
+    {
+        const qint64 aircraftTs = m_aircraftIcaoCache.getTimestampMsSinceEpoch();
+        const qint64 airlineTs  = m_airlineIcaoCache.getTimestampMsSinceEpoch();
+        {
+            QReadLocker l(&m_lookupLock);
+            if (aircraftTs == m_lookupAircraftIcaoTs && airlineTs == m_lookupAirlineIcaoTs) { return; }
+        }
+
+        // build outside the lock, readers keep using the old lookup meanwhile
+        const CIcaoCodeLookup::ConstPtr lookup(new CIcaoCodeLookup(this->getAircraftIcaoCodes(), this->getAirlineIcaoCodes()));
+        QWriteLocker l(&m_lookupLock);
+        m_lookup = lookup;
+        m_lookupAircraftIcaoTs = aircraftTs;
+        m_lookupAirlineIcaoTs  = airlineTs;
+    }
+
     void CIcaoDataReader::updateReaderUrl(const CUrl &url)
     {
         const CUrl current = m_readerUrlCache.get();
@@ -342,6 +367,7 @@ namespace BlackCore::Db
         }
 
         m_aircraftIcaoCache.set(codes, latestTimestamp);
+        this->rebuildIcaoCodeLookup();
         this->updateReaderUrl(this->getBaseUrl(CDbFlags::DbReading));
 
         this->emitAndLogDataRead(CEntityFlags::AircraftIcaoEntity, n, res);
@@ -398,6 +424,7 @@ namespace BlackCore::Db
         }
 
         m_airlineIcaoCache.set(codes, latestTimestamp);
+        this->rebuildIcaoCodeLookup();
         this->updateReaderUrl(this->getBaseUrl(CDbFlags::DbReading));
 
         this->emitAndLogDataRead(CEntityFlags::AirlineIcaoEntity, n, res);
@@ -575,6 +602,7 @@ namespace BlackCore::Db
                         const CAircraftIcaoCodeList aircraftIcaos = CAircraftIcaoCodeList::fromMultipleJsonFormats(aircraftJson);
                         const int c = aircraftIcaos.size();
                         msgs.push_back(m_aircraftIcaoCache.set(aircraftIcaos, fi.birthTime().toUTC().toMSecsSinceEpoch()));
+                        this->rebuildIcaoCodeLookup();
                         reallyRead |= CEntityFlags::AircraftIcaoEntity;
                         emit this->dataRead(CEntityFlags::AircraftIcaoEntity, CEntityFlags::ReadFinished, c, url);
                     }
@@ -614,6 +642,7 @@ namespace BlackCore::Db
                         const CAirlineIcaoCodeList airlineIcaos = CAirlineIcaoCodeList::fromMultipleJsonFormats(airlineJson);
                         const int c = airlineIcaos.size();
                         msgs.push_back(m_airlineIcaoCache.set(airlineIcaos, fi.birthTime().toUTC().toMSecsSinceEpoch()));
+                        this->rebuildIcaoCodeLookup();
                         reallyRead |= CEntityFlags::AirlineIcaoEntity;
                         emit this->dataRead(CEntityFlags::AirlineIcaoEntity, CEntityFlags::ReadFinished, c, url);
                     }
@@ -731,8 +760,8 @@ namespace BlackCore::Db
 
     void CIcaoDataReader::synchronizeCaches(CEntityFlags::Entity entities)
     {
-        if (entities.testFlag(CEntityFlags::AircraftIcaoEntity)) { if (m_syncedAircraftIcaoCache) { return; } m_syncedAircraftIcaoCache = true; m_aircraftIcaoCache.synchronize(); }
-        if (entities.testFlag(CEntityFlags::AirlineIcaoEntity))  { if (m_syncedAirlineIcaoCache)  { return; } m_syncedAirlineIcaoCache  = true; m_airlineIcaoCache.synchronize(); }
+        if (entities.testFlag(CEntityFlags::AircraftIcaoEntity)) { if (m_syncedAircraftIcaoCache) { return; } m_syncedAircraftIcaoCache = true; m_aircraftIcaoCache.synchronize(); this->rebuildIcaoCodeLookup(); }
+        if (entities.testFlag(CEntityFlags::AirlineIcaoEntity))  { if (m_syncedAirlineIcaoCache)  { return; } m_syncedAirlineIcaoCache  = true; m_airlineIcaoCache.synchronize(); this->rebuildIcaoCodeLookup(); }
         if (entities.testFlag(CEntityFlags::CountryEntity))      { if (m_syncedCountryCache)      { return; } m_syncedCountryCache      = true; m_countryCache.synchronize(); }
         if (entities.testFlag(CEntityFlags::AircraftCategoryEntity)) { if (m_syncedCategories)    { return; } m_syncedCategories        = true; m_categoryCache.synchronize(); }
     }
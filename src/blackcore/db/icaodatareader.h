@@ -16,6 +16,7 @@
 #include "blackcore/data/dbcaches.h"
 #include "blackmisc/aviation/aircrafticaocodelist.h"
 #include "blackmisc/aviation/airlineicaocodelist.h"
+#include "blackmisc/aviation/icaocodelookup.h"
 #include "blackmisc/network/entityflags.h"
 #include "blackmisc/network/url.h"
 #include "blackmisc/country.h"
@@ -49,6 +50,10 @@ namespace BlackCore::Db
         //! \threadsafe
         int getAircraftIcaoCodesCount() const;
 
+        //! Indexed lookup of the aircraft and airline ICAO codes, rebuilt when the codes have changed
+        //! \threadsafe
+        BlackMisc::Aviation::CIcaoCodeLookup::ConstPtr getIcaoCodeLookup() const;
+
         //! Get aircraft ICAO information for designator
         //! \threadsafe
         BlackMisc::Aviation::CAircraftIcaoCode getAircraftIcaoCodeForDesignator(const QString &designator) const;
@@ -169,6 +174,11 @@ namespace BlackCore::Db
         std::atomic_bool m_syncedCountryCache      { false }; //!< already synchronized?
         std::atomic_bool m_syncedCategories        { false }; //!< already synchronized?
 
+        mutable QReadWriteLock m_lookupLock; //!< lock for the ICAO code lookup
+        BlackMisc::Aviation::CIcaoCodeLookup::ConstPtr m_lookup { new BlackMisc::Aviation::CIcaoCodeLookup() }; //!< built when the ICAO codes have changed
+        qint64 m_lookupAircraftIcaoTs = -1; //!< aircraft ICAO cache timestamp m_lookup was built from
+        qint64 m_lookupAirlineIcaoTs  = -1; //!< airline ICAO cache timestamp m_lookup was built from
+
         //! \copydoc CDatabaseReader::read
         virtual void read(BlackMisc::Network::CEntityFlags::Entity entities,
                             BlackMisc::Db::CDbFlags::DataRetrievalModeFlag mode, const QDateTime &newerThan) override;
@@ -197,6 +207,10 @@ namespace BlackCore::Db
         //! Cache has changed elsewhere
         void countryCacheChanged();
 
+        //! Rebuild the ICAO code lookup if the aircraft or airline ICAO codes have changed
+        //! \remark called whenever codes are read or the caches change, not by the users of the lookup
+        void rebuildIcaoCodeLookup();
+
         //! Cache has changed elsewhere
         void aircraftCategoryCacheChanged();
 
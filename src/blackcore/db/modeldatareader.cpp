@@ -101,14 +101,48 @@ namespace BlackCore::Db
     CAircraftModel CModelDataReader::getModelForModelString(const QString &modelString) const
     {
         if (modelString.isEmpty()) { return CAircraftModel(); }
-        const CAircraftModelList models(this->getModels());
-        return models.findFirstByModelStringOrDefault(modelString);
+        this->synchronizeModelStrings();
+        QReadLocker l(&m_modelStringsLock);
+        return m_modelStrings.findFirstByModelStringOrDefault(modelString);
     }
 
     bool CModelDataReader::containsModelString(const QString &modelString) const
     {
         if (modelString.isEmpty()) { return false; }
-        return this->getModels().containsModelString(modelString);
+        this->synchronizeModelStrings();
+        QReadLocker l(&m_modelStringsLock);
+        return m_modelStrings.contains(modelString);
+    }
+
+    QStringList CModelDataReader::getModelStringsStartingWith(const QString &prefix, int maxNumber) const
+    {
+        this->synchronizeModelStrings();
+        QReadLocker l(&m_modelStringsLock);
+        return m_modelStrings.findModelStringsStartingWith(prefix, maxNumber);
+    }
+
+    void CModelDataReader::synchronizeModelStrings() const
+    {
+        const qint64 ts = m_modelCache.getTimestampMsSinceEpoch();
+        {
+            QReadLocker l(&m_modelStringsLock);
+            if (ts == m_modelStringsTs) { return; }
+        }
+
+        // rebuild under the write lock, so concurrent callers do not build it twice
+        QWriteLocker l(&m_modelStringsLock);
+        if (ts == m_modelStringsTs) { return; }
+        m_modelStrings = CModelStringDictionary(this->getModels());
+        m_modelStringsTs = ts;
+    }
+
+    void CModelDataReader::updateModelStringsIncrementally(const CAircraftModelList &replacedModels, const CAircraftModelList &incrementalModels, qint64 previousCacheTs)
+    {
+        QWriteLocker l(&m_modelStringsLock);
+        if (m_modelStringsTs < 0 || m_modelStringsTs != previousCacheTs) { return; } // not built for the previous models, next access rebuilds it
+        for (const CAircraftModel &model : replacedModels) { m_modelStrings.removeModel(model); }
+        m_modelStrings.insert(incrementalModels);
+        m_modelStringsTs = m_modelCache.getTimestampMsSinceEpoch();
     }
 
     CAircraftModel CModelDataReader::getModelForDbKey(int dbKey) const
@@ -415,12 +449,16 @@ namespace BlackCore::Db
         const CDistributorList distributors = this->getDistributors();
 
         CAircraftModelList models;
+        CAircraftModelList incrementalModels;
+        CAircraftModelList replacedModels;
+        const qint64 previousCacheTs = m_modelCache.getTimestampMsSinceEpoch();
         if (res.isRestricted())
         {
             // create full list if it was just incremental
-            const CAircraftModelList incrementalModels(CAircraftModelList::fromDatabaseJsonCaching(res, icaos, categories, liveries, distributors));
+            incrementalModels = CAircraftModelList::fromDatabaseJsonCaching(res, icaos, categories, liveries, distributors);
             if (incrementalModels.isEmpty()) { return; } // currently ignored
             models = this->getModels();
+            replacedModels = models.findByKeys(incrementalModels.toDbKeySet());
             models.replaceOrAddObjectsByKey(incrementalModels);
         }
         else
@@ -442,6 +480,10 @@ namespace BlackCore::Db
         }
         const CStatusMessage cacheMsg = m_modelCache.set(models, latestTimestamp);
         CLogMessage::preformatted(cacheMsg);
+        if (res.isRestricted() && !cacheMsg.isFailure())
+        {
+            this->updateModelStringsIncrementally(replacedModels, incrementalModels, previousCacheTs);
+        }
 
         this->updateReaderUrl(this->getBaseUrl(CDbFlags::DbReading));
         this->emitAndLogDataRead(CEntityFlags::ModelEntity, n, res);
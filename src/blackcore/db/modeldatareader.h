@@ -16,6 +16,7 @@
 #include "blackcore/blackcoreexport.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
 #include "blackmisc/simulation/distributorlist.h"
+#include "blackmisc/simulation/modelstringdictionary.h"
 #include "blackmisc/aviation/aircraftcategorylist.h"
 #include "blackmisc/aviation/airlineicaocode.h"
 #include "blackmisc/aviation/liverylist.h"
@@ -83,6 +84,10 @@ namespace BlackCore::Db
         //! \threadsafe
         bool containsModelString(const QString &modelString) const;
 
+        //! Model strings starting with prefix (case insensitive)
+        //! \threadsafe
+        QStringList getModelStringsStartingWith(const QString &prefix, int maxNumber = -1) const;
+
         //! Get model for DB key
         //! \threadsafe
         BlackMisc::Simulation::CAircraftModel getModelForDbKey(int dbKey) const;
@@ -161,6 +166,20 @@ namespace BlackCore::Db
         std::atomic_bool m_syncedModelCache  { false }; //!< already synchronized?
         std::atomic_bool m_syncedDistributorCache { false }; //!< already synchronized?
 
+        mutable BlackMisc::Simulation::CModelStringDictionary m_modelStrings; //!< model strings of m_modelCache
+        mutable qint64 m_modelStringsTs = -1;                                  //!< cache timestamp m_modelStrings refers to
+        mutable QReadWriteLock m_modelStringsLock;                             //!< lock for m_modelStrings
+
+        //! Rebuild m_modelStrings if the model cache has changed
+        //! \threadsafe
+        void synchronizeModelStrings() const;
+
+        //! Update m_modelStrings for models replaced or added by an incremental read
+        //! \threadsafe
+        void updateModelStringsIncrementally(const BlackMisc::Simulation::CAircraftModelList &replacedModels,
+                                             const BlackMisc::Simulation::CAircraftModelList &incrementalModels,
+                                             qint64 previousCacheTs);
+
         //! \copydoc CDatabaseReader::read
         virtual void read(BlackMisc::Network::CEntityFlags::Entity entities = BlackMisc::Network::CEntityFlags::DistributorLiveryModel,
                             BlackMisc::Db::CDbFlags::DataRetrievalModeFlag mode = BlackMisc::Db::CDbFlags::DbReading, const QDateTime &newerThan = QDateTime()) override;
@@ -42,6 +42,7 @@
 #include "blackcore/fsd/rehost.h"
 
 #include "blackmisc/aviation/flightplan.h"
+#include "blackmisc/latencytrace.h"
 #include "blackmisc/network/rawfsdmessage.h"
 #include "blackmisc/swiftdirectories.h"
 #include "blackmisc/threadutils.h"
@@ -1501,11 +1502,12 @@ namespace BlackCore::Fsd
             const bool inRange = isAircraftInRange(callsign);
             if (!inRange) { return; } // sort out all broadcasted we DO NOT NEED
             if (!getSetupForServer().receiveAircraftParts()) { return; }
-            const QJsonObject config = doc.object().value("config").toObject();
+            const QJsonObject config = packet.value("config").toObject();
             if (config.isEmpty()) { return; }
 
+            // typed once here, receivers apply it without further JSON conversions
             const qint64 offsetTimeMs = currentOffsetTime(callsign);
-            emit aircraftConfigReceived(clientQuery.sender(), config, offsetTimeMs);
+            emit aircraftConfigReceived(clientQuery.sender(), CAircraftPartsDelta::fromJson(config), offsetTimeMs);
         }
     }
 
@@ -1943,6 +1945,7 @@ namespace BlackCore::Fsd
         m_lastOffsetTimes.clear();
         m_atcStations.clear();
         m_queuedFsdMessages.clear();
+        m_receivedLines.clear();
         m_sentAircraftConfig = CAircraftParts::null();
         m_loginSince = -1;
     }
@@ -2114,6 +2117,7 @@ namespace BlackCore::Fsd
         QWriteLocker l(&m_lockStatistics);
         m_callStatistics.clear();
         m_callByTime.clear();
+        m_receiveStatistics = ReceiveStatistics();
     }
 
     QString CFSDClient::getNetworkStatisticsAsText(bool reset, const QString &separator)
@@ -2162,6 +2166,9 @@ namespace BlackCore::Fsd
             }
         }
 
+        const QString receiveStats = this->getReceiveStatisticsAsText(separator);
+        if (!receiveStats.isEmpty()) { stats += separator % receiveStats; }
+
         if (reset) { this->clearStatistics(); }
         return stats;
     }
@@ -2172,40 +2179,112 @@ namespace BlackCore::Fsd
         quitAndWait();
     }
 
-    void CFSDClient::readDataFromSocketMaxLines(int maxLines)
+    void CFSDClient::readDataFromSocket()
     {
-        if (m_socket->bytesAvailable() < 1) { return; }
-
-        int lines = 0;
+        const qint64 backlog = m_socket->bytesAvailable();
+        if (backlog < 1) { return; }
+        if (!m_receiveClock.isValid()) { m_receiveClock.start(); }
+        const CLatencySpan span(CLatencyTrace::FsdRead);
+        const qint64 traceNs = CLatencyTrace::isEnabled() ? CLatencyTrace::nowNs() : -1;
 
-        // reads at least one line if available
-        while (m_socket->canReadLine())
+        // read ahead, but bounded: if the parser falls behind data remains in the socket
+        const qint64 nowNs = m_receiveClock.nsecsElapsed();
+        while (m_receivedLines.size() < c_maxReceivedLines && m_socket->canReadLine())
         {
             const QByteArray dataEncoded = m_socket->readLine();
             if (dataEncoded.isEmpty()) { continue; }
-            const QString data = m_fsdTextCodec->toUnicode(dataEncoded);
-            this->parseMessage(data);
+            m_receivedLines.enqueue({ m_fsdTextCodec->toUnicode(dataEncoded), nowNs, traceNs });
+        }
+
+        {
+            QWriteLocker l(&m_lockStatistics);
+            m_receiveStatistics.maxSocketBacklogBytes = qMax(m_receiveStatistics.maxSocketBacklogBytes, backlog);
+            m_receiveStatistics.maxQueuedLines = qMax(m_receiveStatistics.maxQueuedLines, m_receivedLines.size());
+            if (m_receivedLines.size() >= c_maxReceivedLines) { m_receiveStatistics.queueFullCount++; }
+        }
+
+        this->scheduleParseReceivedLines();
+    }
+
+    void CFSDClient::scheduleParseReceivedLines()
+    {
+        if (m_parseScheduled || m_receivedLines.isEmpty()) { return; }
+        m_parseScheduled = true;
+
+        // a 0ms timer lets the send timers run in between two slices
+        QPointer<CFSDClient> myself(this);
+        QTimer::singleShot(0, this, [ = ]
+        {
+            if (!myself) { return; }
+            if (sApp && sApp->isShuttingDown()) { m_parseScheduled = false; return; }
+            myself->parseReceivedLines();
+        });
+    }
+
+    void CFSDClient::parseReceivedLines()
+    {
+        m_parseScheduled = false;
+        if (m_receivedLines.isEmpty()) { return; }
+
+        const qint64 sliceStartNs = m_receiveClock.nsecsElapsed();
+        const int sliceMs = m_parseSliceMs;
+        const qint64 sliceEndNs   = sliceStartNs + static_cast<qint64>(sliceMs) * 1000 * 1000;
+        qint64 nowNs = sliceStartNs;
+        qint64 lagSumNs = 0;
+        qint64 lagMaxNs = 0;
+        int lines = 0;
+
+        // at least one line, then until the slice is used up
+        do
+        {
+            const ReceivedLine received = m_receivedLines.dequeue();
+            const qint64 lagNs = nowNs - received.receivedNs;
+            lagSumNs += lagNs;
+            lagMaxNs = qMax(lagMaxNs, lagNs);
+            if (received.traceNs >= 0 && CLatencyTrace::isEnabled()) { CLatencyTrace::record(CLatencyTrace::FsdQueue, {}, received.traceNs, CLatencyTrace::nowNs()); }
+
+            this->parseMessage(received.line); // can clear m_receivedLines, e.g. on disconnect
+            nowNs = m_receiveClock.nsecsElapsed();
             lines++;
+        }
+        while (!m_receivedLines.isEmpty() && nowNs < sliceEndNs);
 
-            static constexpr int MaxLines = 75 - 1;
-            if (maxLines < 0) { maxLines = MaxLines; }
+        // adapt the slice: a growing backlog gets more time, an empty queue gives it back
+        if (m_receivedLines.isEmpty()) { m_parseSliceMs = qMax(c_parseSliceMinMs, sliceMs / 2); }
+        else if (m_receivedLines.size() > c_maxReceivedLines / 2) { m_parseSliceMs = qMin(c_parseSliceMaxMs, sliceMs * 2); }
 
-            if (lines > maxLines)
-            {
-                static constexpr int DelayMs  = 10;
-                const int newMax = qRound(1.2 * lines); // 20% more
+        {
+            QWriteLocker l(&m_lockStatistics);
+            m_receiveStatistics.lines += lines;
+            m_receiveStatistics.slices++;
+            m_receiveStatistics.parseNs += nowNs - sliceStartNs;
+            m_receiveStatistics.dispatchLagSumNs += lagSumNs;
+            m_receiveStatistics.dispatchLagMaxNs = qMax(m_receiveStatistics.dispatchLagMaxNs, lagMaxNs);
+        }
 
-                CLogMessage(this).debug(u"ReadDataFromSocket has too many lines (>%1), will read again in %2ms") << MaxLines << DelayMs;
-                QPointer<CFSDClient> myself(this);
-                QTimer::singleShot(DelayMs, this, [ = ]
-                {
-                    if (!sApp || sApp->isShuttingDown()) { return; }
-                    if (myself) { myself->readDataFromSocketMaxLines(newMax); }
-                });
-                break;
-            }
+        // refill from the socket, which also schedules the next slice
+        if (m_socket->bytesAvailable() > 0) { this->readDataFromSocket(); }
+        this->scheduleParseReceivedLines();
+    }
 
+    QString CFSDClient::getReceiveStatisticsAsText(const QString &separator) const
+    {
+        ReceiveStatistics rs;
+        {
+            QReadLocker l(&m_lockStatistics);
+            rs = m_receiveStatistics;
         }
+        const int sliceMs = m_parseSliceMs;
+        if (rs.lines < 1) { return {}; }
+
+        return
+            u"received lines: " % QString::number(rs.lines) % separator %
+            u"parse slices: " % QString::number(rs.slices) % u" current slice: " % QString::number(sliceMs) % u"ms" % separator %
+            u"parse time: " % QString::number(rs.parseNs / 1000.0 / rs.lines, 'f', 1) % u"us/line" % separator %
+            u"dispatch lag: avg " % QString::number(rs.dispatchLagSumNs / 1.0e6 / rs.lines, 'f', 2) %
+            u"ms max " % QString::number(rs.dispatchLagMaxNs / 1.0e6, 'f', 2) % u"ms" % separator %
+            u"socket backlog max: " % QString::number(rs.maxSocketBacklogBytes) % u" bytes" % separator %
+            u"queued lines max: " % QString::number(rs.maxQueuedLines) % u" queue full: " % QString::number(rs.queueFullCount);
     }
 
     QString CFSDClient::socketErrorString(QAbstractSocket::SocketError error) const
@@ -2226,6 +2305,7 @@ namespace BlackCore::Fsd
 
     void CFSDClient::parseMessage(const QString &lineRaw)
     {
+        const CLatencySpan span(CLatencyTrace::FsdParse);
         MessageType messageType = MessageType::Unknown;
         QString cmd;
         const QString line = lineRaw.trimmed();
@@ -24,6 +24,7 @@
 #include "blackmisc/aviation/flightplan.h"
 #include "blackmisc/aviation/informationmessage.h"
 #include "blackmisc/aviation/aircrafticaocode.h"
+#include "blackmisc/aviation/aircraftpartsdelta.h"
 #include "blackmisc/network/rawfsdmessage.h"
 #include "blackmisc/network/connectionstatus.h"
 #include "blackmisc/network/loginmode.h"
@@ -47,6 +48,7 @@
 #include <QTextCodec>
 #include <QReadWriteLock>
 #include <QQueue>
+#include <QElapsedTimer>
 
 #include <atomic>
 
@@ -61,6 +63,8 @@
 namespace BlackFsdTest { class CTestFSDClient; }
 namespace BlackCore::Fsd
 {
+    class CFsdReplay;
+
     //! Message groups
     enum class TextMessageGroups
     {
@@ -199,6 +203,10 @@ namespace BlackCore::Fsd
         //! Text statistics
         QString getNetworkStatisticsAsText(bool reset, const QString &separator = "\n");
 
+        //! Receive pipeline statistics (socket backlog, parse time, dispatch lag)
+        //! \threadsafe
+        QString getReceiveStatisticsAsText(const QString &separator = "\n") const;
+
         //! Debugging and UNIT tests
         void printToConsole(bool on)  { m_printToConsole = on; }
 
@@ -216,7 +224,7 @@ namespace BlackCore::Fsd
         void pongReceived(const QString &sender, double elapsedTimeMs);
         void flightPlanReceived(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::Aviation::CFlightPlan &flightPlan);
         void textMessagesReceived(const BlackMisc::Network::CTextMessageList &messages);
-        void aircraftConfigReceived(const QString &sender, const QJsonObject &config, qint64 currentOffsetTimeMs);
+        void aircraftConfigReceived(const QString &sender, const BlackMisc::Aviation::CAircraftPartsDelta &config, qint64 currentOffsetTimeMs);
         void validAtcResponseReceived(const QString &callsign, bool isValidAtc);
         void capabilityResponseReceived(const BlackMisc::Aviation::CCallsign &sender, BlackMisc::Network::CClient::Capabilities capabilities);
         void com1FrequencyResponseReceived(const QString &sender, const BlackMisc::PhysicalQuantities::CFrequency &frequency);
@@ -254,6 +262,7 @@ namespace BlackCore::Fsd
     private:
         //! \cond
         friend BlackFsdTest::CTestFSDClient;
+        friend CFsdReplay;
         //! \endcond
 
         //! Convenience functions for sendClientQuery
@@ -345,8 +354,15 @@ namespace BlackCore::Fsd
         void sendClientIdentification(const QString &fsdChallenge);
         void sendIncrementalAircraftConfig();
 
-        void readDataFromSocket() { this->readDataFromSocketMaxLines(); }
-        void readDataFromSocketMaxLines(int maxLines = -1);
+        //! Read and decode stage: socket to m_receivedLines
+        void readDataFromSocket();
+
+        //! Parse and dispatch stage: drains m_receivedLines within a time slice
+        void parseReceivedLines();
+
+        //! Schedule parseReceivedLines in the next event loop cycle
+        void scheduleParseReceivedLines();
+
         void parseMessage(const QString &lineRaw);
 
         QString socketErrorString(QAbstractSocket::SocketError error) const;
@@ -569,6 +585,33 @@ namespace BlackCore::Fsd
 
         QQueue<QString> m_queuedFsdMessages;
 
+        //! Received, decoded line waiting to be parsed
+        struct ReceivedLine
+        {
+            QString line;
+            qint64 receivedNs = 0; //!< m_receiveClock when read from socket
+            qint64 traceNs = -1;   //!< BlackMisc::CLatencyTrace::nowNs when read from socket, -1 if not traced
+        };
+
+        //! Statistics of the receive stages
+        struct ReceiveStatistics
+        {
+            qint64 lines = 0;                 //!< parsed lines
+            qint64 slices = 0;                //!< parse slices
+            qint64 parseNs = 0;               //!< total time parsing and dispatching
+            qint64 dispatchLagSumNs = 0;      //!< read from socket until parsed
+            qint64 dispatchLagMaxNs = 0;      //!< max. lag
+            qint64 maxSocketBacklogBytes = 0; //!< max. bytes waiting in socket
+            int    maxQueuedLines = 0;        //!< max. lines waiting to be parsed
+            int    queueFullCount = 0;        //!< how often reading was stopped because the queue was full
+        };
+
+        QQueue<ReceivedLine> m_receivedLines;  //!< read and decoded, not yet parsed
+        QElapsedTimer m_receiveClock;          //!< monotonic clock for the receive stages
+        ReceiveStatistics m_receiveStatistics; //!< guarded by m_lockStatistics
+        std::atomic_int m_parseSliceMs { c_parseSliceMinMs }; //!< adaptive parse slice, read by the statistics in any thread
+        bool m_parseScheduled = false;
+
         //! An illegal FSD state has been detected
         void handleIllegalFsdState(const QString &message);
 
@@ -578,6 +621,9 @@ namespace BlackCore::Fsd
         static int constexpr c_updateInterimPostionIntervalMsec = 1000; //!< interval for iterim position updates (send our position as interim position)
         static int constexpr c_updateVisualPositionIntervalMsec = 200;  //!< interval for the VATSIM visual position updates (send our position and 6DOF velocity)
         static int constexpr c_sendFsdMsgIntervalMsec           = 10;   //!< interval for FSD send messages
+        static int constexpr c_parseSliceMinMs                  = 4;    //!< min. time slice parsing received lines before other events are processed
+        static int constexpr c_parseSliceMaxMs                  = 20;   //!< max. time slice if the backlog grows
+        static int constexpr c_maxReceivedLines                 = 1000; //!< max. lines read ahead, then data stays in the socket
         bool m_stoppedSendingVisualPositions = false; //!< for when velocity drops to zero
         bool m_serverWantsVisualPositions = false;    //!< there are interested clients in range
         unsigned m_visualPositionUpdateSentCount = 0; //!< for choosing when to send a periodic (slowfast) packet
@@ -0,0 +1,421 @@
+/* Copyright (C) 2020
+ * swift project community / contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/fsd/fsdreplay.h"
+#include "blackcore/fsd/fsdclient.h"
+
+#include "blackmisc/simulation/remoteaircraftprovider.h"
+#include "blackmisc/simulation/interpolatorspline.h"
+#include "blackmisc/simulation/interpolationrenderingsetup.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/transponder.h"
+#include "blackmisc/logcategories.h"
+#include "blackmisc/logmessage.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QTextStream>
+#include <QTime>
+#include <QThread>
+#include <QStringBuilder>
+
+#include <algorithm>
+#include <limits>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+
+namespace BlackCore::Fsd
+{
+    const QStringList &CFsdReplay::getLogCategories()
+    {
+        static const QStringList cats { CLogCategories::network(), CLogCategories::fsd() };
+        return cats;
+    }
+
+    CFsdReplay::CFsdReplay(CFSDClient *client, QObject *parent) : QObject(parent), m_client(client)
+    {
+        Q_ASSERT_X(client, Q_FUNC_INFO, "Need client");
+        this->setObjectName("CFsdReplay");
+        m_timer.setObjectName(this->objectName().append(":m_timer"));
+        connect(&m_timer, &QTimer::timeout, this, &CFsdReplay::replayDueMessages);
+
+        // emitted in the client's thread while parsing, measure there
+        connect(client, &CFSDClient::pilotDataUpdateReceived, this, [ = ](const CAircraftSituation &situation, const CTransponder &)
+        {
+            this->onParsed(situation);
+        }, Qt::DirectConnection);
+        connect(client, &CFSDClient::visualPilotDataUpdateReceived, this, [ = ](const CAircraftSituation &situation)
+        {
+            this->onParsed(situation);
+        }, Qt::DirectConnection);
+    }
+
+    CFsdReplay::~CFsdReplay()
+    {
+        m_timer.stop();
+        for (const QMetaObject::Connection &c : std::as_const(m_providerConnections)) { QObject::disconnect(c); }
+    }
+
+    int CFsdReplay::loadFromFile(const QString &fileName)
+    {
+        QFile file(fileName);
+        if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        {
+            CLogMessage(this).warning(u"Cannot read FSD capture '%1'") << fileName;
+            return -1;
+        }
+
+        QStringList lines;
+        QTextStream stream(&file);
+        while (!stream.atEnd()) { lines.push_back(stream.readLine()); }
+        return this->loadFromLines(lines);
+    }
+
+    int CFsdReplay::loadFromLines(const QStringList &lines)
+    {
+        Q_ASSERT_X(!m_running, Q_FUNC_INFO, "Loading while running");
+        m_messages.clear();
+        m_pilotCallsigns.clear();
+
+        static const QString recv("FSD Recv=>");
+        static const QString sent("FSD Sent=>");
+        qint64 firstMs = -1;
+        qint64 lastMs  = 0;
+        qint64 dayOffsetMs = 0;
+        constexpr qint64 DayMs = 24 * 3600 * 1000;
+
+        for (const QString &l : lines)
+        {
+            const QString trimmed = l.trimmed();
+            if (trimmed.isEmpty()) { continue; }
+
+            QString line;
+            qint64 offsetMs = lastMs;
+            const int recvPos = trimmed.indexOf(recv);
+            if (recvPos >= 0)
+            {
+                // "hh:mm:ss.zzz FSD Recv=>..." as written by CFSDClient
+                line = trimmed.mid(recvPos + recv.length());
+                const QTime t = QTime::fromString(trimmed.left(recvPos).trimmed(), QStringLiteral("hh:mm:ss.zzz"));
+                if (t.isValid())
+                {
+                    qint64 ms = t.msecsSinceStartOfDay() + dayOffsetMs;
+                    if (firstMs < 0) { firstMs = ms; }
+                    if (ms < lastMs + firstMs - DayMs / 2) { dayOffsetMs += DayMs; ms += DayMs; } // midnight
+                    offsetMs = qMax(lastMs, ms - firstMs);
+                }
+            }
+            else if (trimmed.contains(sent)) { continue; } // our own messages
+            else { line = trimmed; }
+
+            if (line.isEmpty()) { continue; }
+            ReplayMessage message;
+            message.offsetMs = offsetMs;
+            message.line = line;
+            message.pilotCallsign = CFsdReplay::positionPacketSender(line);
+            if (!message.pilotCallsign.isEmpty()) { m_pilotCallsigns.insert(message.pilotCallsign); }
+            m_messages.push_back(message);
+            lastMs = offsetMs;
+        }
+
+        CLogMessage(this).info(u"Loaded %1 FSD messages, %2 pilots, %3ms") << m_messages.size() << m_pilotCallsigns.size() << this->getRecordedDurationMs();
+        return m_messages.size();
+    }
+
+    void CFsdReplay::measureStoredSituations(IRemoteAircraftProvider *provider)
+    {
+        for (const QMetaObject::Connection &c : std::as_const(m_providerConnections)) { QObject::disconnect(c); }
+        m_providerConnections.clear();
+        m_interpolators.clear();
+        m_provider = provider;
+        if (!provider) { return; }
+
+        m_providerConnections = provider->connectRemoteAircraftProviderSignals(this,
+                                [ = ](const CAircraftSituation &situation) { this->onStored(situation); },
+                                nullptr, nullptr, nullptr);
+    }
+
+    bool CFsdReplay::start()
+    {
+        if (m_running || !m_client || m_messages.isEmpty()) { return false; }
+        m_nextMessage  = 0;
+        m_sentMessages = 0;
+        m_dispatchedChunks = 0;
+        m_parsedChunks = 0;
+        m_runElapsedMs = 0;
+        m_running = true;
+        m_clock.start();
+        m_timer.start(this->isAsFastAsPossible() ? 0 : ReplayIntervalMs);
+        return true;
+    }
+
+    void CFsdReplay::stop()
+    {
+        if (!m_running) { return; }
+        this->finish();
+    }
+
+    double CFsdReplay::getMessagesPerSecond() const
+    {
+        const qint64 ms = m_running ? m_clock.elapsed() : m_runElapsedMs;
+        if (ms <= 0) { return 0.0; }
+        QMutexLocker l(&m_mutexStatistics);
+        return 1000.0 * m_parsedMessages / ms;
+    }
+
+    double CFsdReplay::getAverageLatencyUs(Stage stage) const
+    {
+        if (stage < 0 || stage >= StageCount) { return -1.0; }
+        QMutexLocker l(&m_mutexStatistics);
+        const StageStatistics &s = m_stages[stage];
+        if (s.count < 1) { return -1.0; }
+        return s.sumNs / 1000.0 / s.count;
+    }
+
+    QString CFsdReplay::getStatisticsAsText(const QString &separator) const
+    {
+        QString stats = QStringLiteral("messages: %1 fan-out: %2 speed: %3 msg/s: %4").
+                        arg(m_sentMessages).arg(m_fanOut).
+                        arg(this->isAsFastAsPossible() ? QStringLiteral("max") : QString::number(m_speedFactor)).
+                        arg(this->getMessagesPerSecond(), 0, 'f', 1);
+
+        QMutexLocker l(&m_mutexStatistics);
+        if (m_parsedMessages > 0)
+        {
+            stats += separator % QStringLiteral("parser: %1us/msg").arg(m_parseTimeNs / 1000.0 / m_parsedMessages, 0, 'f', 2);
+        }
+
+        for (int i = 0; i < StageCount; ++i)
+        {
+            const StageStatistics &s = m_stages[i];
+            if (s.count < 1) { continue; }
+            stats += separator % stageToString(static_cast<Stage>(i)) %
+                     QStringLiteral(": %1 avg %2us min %3us max %4us").arg(s.count).
+                     arg(s.sumNs / 1000.0 / s.count, 0, 'f', 1).
+                     arg(s.minNs / 1000.0, 0, 'f', 1).
+                     arg(s.maxNs / 1000.0, 0, 'f', 1);
+        }
+        return stats;
+    }
+
+    void CFsdReplay::clearStatistics()
+    {
+        QMutexLocker l(&m_mutexStatistics);
+        m_inFlight.clear();
+        for (StageStatistics &s : m_stages) { s = StageStatistics(); }
+        m_parseTimeNs = 0;
+        m_parsedMessages = 0;
+    }
+
+    const QString &CFsdReplay::stageToString(Stage stage)
+    {
+        static const QString parsed("parsed");
+        static const QString stored("stored");
+        static const QString interpolated("interpolated");
+        static const QString unknown("unknown");
+
+        switch (stage)
+        {
+        case StageParsed:       return parsed;
+        case StageStored:       return stored;
+        case StageInterpolated: return interpolated;
+        default: break;
+        }
+        return unknown;
+    }
+
+    QString CFsdReplay::fanOutCallsign(const QString &callsign, int copy)
+    {
+        if (copy < 1) { return callsign; }
+        return callsign % u'R' % QString::number(copy, 36).toUpper();
+    }
+
+    void CFsdReplay::StageStatistics::add(qint64 ns)
+    {
+        count++;
+        sumNs += ns;
+        if (minNs < 0 || ns < minNs) { minNs = ns; }
+        if (ns > maxNs) { maxNs = ns; }
+    }
+
+    void CFsdReplay::replayDueMessages()
+    {
+        if (!m_running) { return; }
+        if (!m_client) { this->finish(); return; }
+
+        // as fast as possible the client gets the next chunk only when it has parsed the previous ones,
+        // otherwise the queue grows and the rate measured is the injection rate
+        const bool clientBusy = m_dispatchedChunks - m_parsedChunks >= (this->isAsFastAsPossible() ? MaxChunksInFlight : std::numeric_limits<int>::max());
+        const int count = m_messages.size();
+        if (m_nextMessage >= count || clientBusy)
+        {
+            if (m_nextMessage >= count && m_parsedChunks >= m_dispatchedChunks) { this->finish(); }
+            return;
+        }
+
+        const qint64 dueMs = this->isAsFastAsPossible() ?
+                             std::numeric_limits<qint64>::max() :
+                             static_cast<qint64>(m_clock.elapsed() * m_speedFactor);
+
+        QStringList lines;
+        int chunk = 0;
+        while (m_nextMessage < count && m_messages[m_nextMessage].offsetMs <= dueMs)
+        {
+            const ReplayMessage &message = m_messages[m_nextMessage++];
+            for (int copy = 0; copy < m_fanOut; ++copy)
+            {
+                lines.push_back(copy < 1 ? message.line : this->fanOutLine(message.line, copy));
+            }
+            if (this->isAsFastAsPossible() && ++chunk >= MaxMessagesPerChunk) { break; } // give the event loop a chance
+        }
+
+        if (!lines.isEmpty())
+        {
+            m_sentMessages += lines.size();
+            m_dispatchedChunks++;
+            this->dispatchToClient(lines);
+        }
+    }
+
+    void CFsdReplay::dispatchToClient(const QStringList &lines)
+    {
+        const qint64 injectedNs = m_clock.nsecsElapsed();
+        if (m_client->thread() == QThread::currentThread())
+        {
+            this->parseInClient(lines, injectedNs);
+            return;
+        }
+
+        QPointer<CFsdReplay> myself(this);
+        QMetaObject::invokeMethod(m_client, [ = ]
+        {
+            if (myself) { myself->parseInClient(lines, injectedNs); }
+        }, Qt::QueuedConnection);
+    }
+
+    void CFsdReplay::parseInClient(const QStringList &lines, qint64 injectedNs)
+    {
+        if (!m_client) { return; }
+        const qint64 startNs = m_clock.nsecsElapsed();
+        m_currentInjectedNs = injectedNs;
+        for (const QString &line : lines) { m_client->parseMessage(line); }
+        m_currentInjectedNs = -1;
+        const qint64 parseNs = m_clock.nsecsElapsed() - startNs;
+
+        {
+            QMutexLocker l(&m_mutexStatistics);
+            m_parseTimeNs += parseNs;
+            m_parsedMessages += lines.size();
+        }
+        m_parsedChunks++;
+    }
+
+    void CFsdReplay::onParsed(const CAircraftSituation &situation)
+    {
+        if (m_currentInjectedNs < 0) { return; } // not injected by us
+        const qint64 now = m_clock.nsecsElapsed();
+
+        QMutexLocker l(&m_mutexStatistics);
+        m_stages[StageParsed].add(now - m_currentInjectedNs);
+        if (!m_provider) { return; } // no later stages
+
+        QVector<InFlight> &inFlight = m_inFlight[situation.getCallsign().asString()];
+        inFlight.push_back({ situation.getMSecsSinceEpoch(), m_currentInjectedNs });
+        if (inFlight.size() > MaxInFlightPerCallsign) { inFlight.removeFirst(); }
+    }
+
+    void CFsdReplay::onStage(const CAircraftSituation &situation, Stage stage)
+    {
+        const qint64 now = m_clock.isValid() ? m_clock.nsecsElapsed() : -1;
+        if (now < 0) { return; }
+
+        QMutexLocker l(&m_mutexStatistics);
+        const auto it = m_inFlight.find(situation.getCallsign().asString());
+        if (it == m_inFlight.end()) { return; } // not injected by us
+
+        // the very situation parsed from the line, not just the last line of the callsign
+        QVector<InFlight> &inFlight = it.value();
+        const qint64 situationMs = situation.getMSecsSinceEpoch();
+        const auto match = std::find_if(inFlight.begin(), inFlight.end(), [situationMs](const InFlight & f) { return f.situationMs == situationMs; });
+        if (match == inFlight.end()) { return; }
+        m_stages[stage].add(now - match->injectedNs);
+
+        // done with the last stage, older ones did not make it through the pipeline
+        const Stage lastStage = m_measureInterpolation ? StageInterpolated : StageStored;
+        if (stage == lastStage) { inFlight.erase(inFlight.begin(), match + 1); }
+    }
+
+    void CFsdReplay::onStored(const CAircraftSituation &situation)
+    {
+        this->onStage(situation, StageStored);
+        if (!m_measureInterpolation || !m_provider) { return; }
+
+        // as a simulator driver, which interpolates the stored situations on its next update
+        const CCallsign callsign = situation.getCallsign();
+        std::unique_ptr<CInterpolatorSpline> &interpolator = m_interpolators[callsign.asString()];
+        if (!interpolator) { interpolator = std::make_unique<CInterpolatorSpline>(callsign, nullptr, nullptr, m_provider); }
+        const CInterpolationAndRenderingSetupPerCallsign setup(callsign, CInterpolationAndRenderingSetupGlobal());
+        const CInterpolationResult result = interpolator->getInterpolation(QDateTime::currentMSecsSinceEpoch(), setup);
+        if (result.getInterpolationStatus().hasValidSituation()) { this->onStage(situation, StageInterpolated); }
+    }
+
+    QString CFsdReplay::fanOutLine(const QString &line, int copy) const
+    {
+        QStringList tokens = line.split(':');
+        for (int i = 0; i < tokens.size(); ++i)
+        {
+            QString &token = tokens[i];
+            if (m_pilotCallsigns.contains(token))
+            {
+                token = fanOutCallsign(token, copy);
+                continue;
+            }
+
+            // 1st token contains the command, e.g. "^DLH123" or "#TMDLH123"
+            if (i > 0) { continue; }
+            for (int p = 1; p <= 3 && p < token.length(); ++p)
+            {
+                const QString cs = token.mid(p);
+                if (!m_pilotCallsigns.contains(cs)) { continue; }
+                token = token.left(p) % fanOutCallsign(cs, copy);
+                break;
+            }
+        }
+        return tokens.join(':');
+    }
+
+    QString CFsdReplay::positionPacketSender(const QString &line)
+    {
+        // @N:DLH123:..., ^DLH123:..., #SLDLH123:..., #STDLH123:...
+        if (line.startsWith('@'))
+        {
+            const int s = line.indexOf(':');
+            const int e = s < 0 ? -1 : line.indexOf(':', s + 1);
+            return e < 0 ? QString() : line.mid(s + 1, e - s - 1);
+        }
+
+        int prefix = 0;
+        if (line.startsWith('^')) { prefix = 1; }
+        else if (line.startsWith(QLatin1String("#SL")) || line.startsWith(QLatin1String("#ST"))) { prefix = 3; }
+        if (prefix < 1) { return {}; }
+
+        const int e = line.indexOf(':');
+        return e <= prefix ? QString() : line.mid(prefix, e - prefix);
+    }
+
+    void CFsdReplay::finish()
+    {
+        m_timer.stop();
+        m_runElapsedMs = m_clock.elapsed();
+        m_running = false;
+        CLogMessage(this).info(u"FSD replay: %1") << this->getStatisticsAsText(", ");
+        emit this->finished(m_sentMessages, m_runElapsedMs);
+    }
+} // ns
@@ -0,0 +1,232 @@
+/* Copyright (C) 2020
+ * swift project community / contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_FSD_FSDREPLAY_H
+#define BLACKCORE_FSD_FSDREPLAY_H
+
+#include "blackcore/blackcoreexport.h"
+#include "blackmisc/aviation/callsign.h"
+
+#include <QObject>
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <QMutex>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QPointer>
+#include <QList>
+#include <QMetaObject>
+#include <atomic>
+#include <map>
+#include <memory>
+
+namespace BlackMisc::Aviation { class CAircraftSituation; }
+namespace BlackMisc::Simulation
+{
+    class IRemoteAircraftProvider;
+    class CInterpolatorSpline;
+}
+namespace BlackCore::Fsd
+{
+    class CFSDClient;
+
+    //! Replays recorded FSD traffic into a CFSDClient, e.g. for offline load tests of the airspace pipeline
+    //! \remark Capture files are the raw FSD message logs written by CFSDClient ("hh:mm:ss.zzz FSD Recv=>..."),
+    //!         only received messages are replayed. Plain FSD lines without timestamp are accepted as well.
+    //! \remark The client is driven directly via its parser, no socket or server connection is needed
+    class BLACKCORE_EXPORT CFsdReplay : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        //! Measured pipeline stages
+        enum Stage
+        {
+            StageParsed,       //!< client has parsed the packet and emitted the situation
+            StageStored,       //!< situation has been stored in the remote aircraft provider
+            StageInterpolated, //!< stored situation has been interpolated, see CFsdReplay::setMeasureInterpolation
+            StageCount         //!< number of stages
+        };
+
+        //! Categories
+        static const QStringList &getLogCategories();
+
+        //! Ctor
+        CFsdReplay(CFSDClient *client, QObject *parent = nullptr);
+
+        //! Dtor
+        virtual ~CFsdReplay() override;
+
+        //! Load a capture file
+        //! \return number of replayable messages, -1 if the file cannot be read
+        int loadFromFile(const QString &fileName);
+
+        //! Load capture lines
+        //! \return number of replayable messages
+        int loadFromLines(const QStringList &lines);
+
+        //! Number of loaded messages (without fan-out)
+        int getMessageCount() const { return m_messages.size(); }
+
+        //! Recorded duration in ms
+        qint64 getRecordedDurationMs() const { return m_messages.isEmpty() ? 0 : m_messages.back().offsetMs; }
+
+        //! Pilot callsigns found in the capture
+        const QSet<QString> &getRecordedPilotCallsigns() const { return m_pilotCallsigns; }
+
+        //! Replay speed, 1 is real time, N is N times faster, 0 (or less) means as fast as possible
+        //! @{
+        void setSpeedFactor(double factor) { m_speedFactor = factor; }
+        double getSpeedFactor() const { return m_speedFactor; }
+        bool isAsFastAsPossible() const { return m_speedFactor <= 0.0; }
+        //! @}
+
+        //! Synthetic fan-out, each recorded pilot is replayed as N pilots with derived callsigns
+        //! @{
+        void setFanOut(int copies) { m_fanOut = qMax(1, copies); }
+        int getFanOut() const { return m_fanOut; }
+        //! @}
+
+        //! Also measure when situations are stored in the given provider
+        //! \remark normally the provider the CAirspaceMonitor stores into
+        void measureStoredSituations(BlackMisc::Simulation::IRemoteAircraftProvider *provider);
+
+        //! Interpolate each stored situation as a simulator driver would and measure it as StageInterpolated
+        //! \remark requires measureStoredSituations
+        //! @{
+        void setMeasureInterpolation(bool measure) { m_measureInterpolation = measure; }
+        bool isMeasuringInterpolation() const { return m_measureInterpolation; }
+        //! @}
+
+        //! Start/stop the replay
+        //! @{
+        bool start();
+        void stop();
+        bool isRunning() const { return m_running; }
+        //! @}
+
+        //! Number of messages sent to the client so far
+        int getSentMessageCount() const { return m_sentMessages; }
+
+        //! Throughput in messages parsed by the client per second for the current/last run
+        //! \remark as fast as possible only a few chunks are queued to the client, so this is the parser throughput
+        double getMessagesPerSecond() const;
+
+        //! Average latency from injection to the given stage in microseconds, -1 if not measured
+        //! \threadsafe
+        double getAverageLatencyUs(Stage stage) const;
+
+        //! Statistics as text
+        //! \threadsafe
+        QString getStatisticsAsText(const QString &separator = "\n") const;
+
+        //! Reset the statistics
+        //! \threadsafe
+        void clearStatistics();
+
+        //! Name of stage
+        static const QString &stageToString(Stage stage);
+
+        //! Derived callsign for fan-out copy
+        static QString fanOutCallsign(const QString &callsign, int copy);
+
+    signals:
+        //! Replay has finished
+        void finished(int sentMessages, qint64 elapsedMs);
+
+    private:
+        //! One recorded message
+        struct ReplayMessage
+        {
+            qint64  offsetMs = 0;    //!< offset to 1st message
+            QString line;            //!< raw FSD line
+            QString pilotCallsign;   //!< sender if this is a position packet, otherwise empty
+        };
+
+        //! Situation parsed from an injected line, waiting for the later stages
+        struct InFlight
+        {
+            qint64 situationMs = 0; //!< timestamp of the situation, identifies it in the later stages
+            qint64 injectedNs = 0;  //!< injection time of its line
+        };
+
+        //! Latency of a stage
+        struct StageStatistics
+        {
+            qint64 count = 0;
+            qint64 sumNs = 0;
+            qint64 minNs = -1;
+            qint64 maxNs = -1;
+            void add(qint64 ns);
+        };
+
+        //! Timer has fired
+        void replayDueMessages();
+
+        //! Send the lines to the client, in the client's thread
+        void dispatchToClient(const QStringList &lines);
+
+        //! Parse the lines in the client
+        void parseInClient(const QStringList &lines, qint64 injectedNs);
+
+        //! The client has parsed a situation, in the client's thread
+        void onParsed(const BlackMisc::Aviation::CAircraftSituation &situation);
+
+        //! A parsed situation passed a later stage
+        void onStage(const BlackMisc::Aviation::CAircraftSituation &situation, Stage stage);
+
+        //! A situation has been stored in the provider
+        void onStored(const BlackMisc::Aviation::CAircraftSituation &situation);
+
+        //! Fan-out line for copy
+        QString fanOutLine(const QString &line, int copy) const;
+
+        //! Pilot callsign of a position packet, empty if no position packet
+        static QString positionPacketSender(const QString &line);
+
+        //! Finished run
+        void finish();
+
+        QPointer<CFSDClient> m_client;
+        QVector<ReplayMessage> m_messages;
+        QSet<QString> m_pilotCallsigns;
+        QTimer m_timer { this };
+        QElapsedTimer m_clock;
+        QList<QMetaObject::Connection> m_providerConnections;
+        BlackMisc::Simulation::IRemoteAircraftProvider *m_provider = nullptr;
+        std::map<QString, std::unique_ptr<BlackMisc::Simulation::CInterpolatorSpline>> m_interpolators; //!< per callsign
+        bool m_measureInterpolation = false;
+        double m_speedFactor = 1.0;
+        int m_fanOut = 1;
+        int m_nextMessage = 0;
+        int m_sentMessages = 0;
+        int m_dispatchedChunks = 0;              //!< chunks sent to the client
+        std::atomic_int m_parsedChunks { 0 };    //!< chunks the client has parsed
+        qint64 m_currentInjectedNs = -1;         //!< injection time of the lines being parsed, client's thread only
+        qint64 m_runElapsedMs = 0;
+        bool m_running = false;
+
+        mutable QMutex m_mutexStatistics;
+        QHash<QString, QVector<InFlight>> m_inFlight; //!< callsign, parsed situations in the order parsed
+        StageStatistics m_stages[StageCount];
+        qint64 m_parseTimeNs = 0;                 //!< time spent in the client parser
+        qint64 m_parsedMessages = 0;
+
+        static constexpr int ReplayIntervalMs = 2;     //!< timer interval when replaying with timing
+        static constexpr int MaxMessagesPerChunk = 500; //!< as fast as possible, messages per event loop cycle
+        static constexpr int MaxChunksInFlight = 2;     //!< as fast as possible, chunks queued to the client
+        static constexpr int MaxInFlightPerCallsign = 100; //!< situations never stored are dropped
+    };
+} // ns
+
+#endif // guard
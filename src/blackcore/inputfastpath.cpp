@@ -0,0 +1,124 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/inputfastpath.h"
+#include "blackmisc/range.h"
+
+#include <QMutexLocker>
+#include <algorithm>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Input;
+
+namespace BlackCore
+{
+    int CInputFastPath::bind(const QString &action, const std::function<void(bool)> &function)
+    {
+        QMutexLocker lock(&m_mutex);
+        FastPathInfo info;
+        info.m_index = m_nextIndex++;
+        info.m_action = action;
+        info.m_function = function;
+        m_bindings.push_back(info);
+        this->updateCombinations();
+        return info.m_index;
+    }
+
+    void CInputFastPath::unbind(int index)
+    {
+        QMutexLocker lock(&m_mutex);
+        auto it = std::find_if(m_bindings.begin(), m_bindings.end(), [index](const FastPathInfo & info) { return info.m_index == index; });
+        if (it == m_bindings.end()) { return; }
+        const QString action = it->m_action;
+        m_bindings.erase(it);
+        this->updateCombinations();
+        const bool stillBound = std::any_of(m_bindings.cbegin(), m_bindings.cend(), [&action](const FastPathInfo & info) { return info.m_action == action; });
+        if (!stillBound) { m_activeActions.remove(action); }
+    }
+
+    bool CInputFastPath::hasBindings() const
+    {
+        QMutexLocker lock(&m_mutex);
+        return !m_bindings.isEmpty();
+    }
+
+    void CInputFastPath::setConfiguredActions(const QHash<CHotkeyCombination, QString> &configuredActions)
+    {
+        QMutexLocker lock(&m_mutex);
+        m_configuredActions = configuredActions;
+        this->updateCombinations();
+    }
+
+    void CInputFastPath::processKeyCombination(const CHotkeyCombination &combination)
+    {
+        // same merging as in CInputManager, but with its own state as this can run in another thread
+        QMutexLocker lock(&m_mutex);
+        if (m_combinations.isEmpty() || m_suspended) { m_lastCombination.setKeyboardKeys(combination.getKeyboardKeys()); return; }
+        CHotkeyCombination copy(combination);
+        copy.setJoystickButtons(m_lastCombination.getJoystickButtons());
+        this->processCombination(copy);
+    }
+
+    void CInputFastPath::processButtonCombination(const CHotkeyCombination &combination)
+    {
+        QMutexLocker lock(&m_mutex);
+        if (m_combinations.isEmpty() || m_suspended) { m_lastCombination.setJoystickButtons(combination.getJoystickButtons()); return; }
+        CHotkeyCombination copy(combination);
+        copy.setKeyboardKeys(m_lastCombination.getKeyboardKeys());
+        this->processCombination(copy);
+    }
+
+    void CInputFastPath::suspend()
+    {
+        QMutexLocker lock(&m_mutex);
+        m_suspended = true;
+    }
+
+    void CInputFastPath::resume(const QSet<QString> &activeActions)
+    {
+        // the regular processing ignored the combinations while capturing, so continue from its state
+        QMutexLocker lock(&m_mutex);
+        m_suspended = false;
+        m_activeActions.clear();
+        for (const auto &pair : std::as_const(m_combinations))
+        {
+            if (activeActions.contains(pair.second)) { m_activeActions.insert(pair.second); }
+        }
+    }
+
+    void CInputFastPath::updateCombinations()
+    {
+        m_combinations.clear();
+        for (const auto [combination, action] : makePairsRange(std::as_const(m_configuredActions)))
+        {
+            const bool bound = std::any_of(m_bindings.cbegin(), m_bindings.cend(), [&action = action](const FastPathInfo & info) { return info.m_action == action; });
+            if (bound) { m_combinations.push_back({ combination, action }); }
+        }
+    }
+
+    void CInputFastPath::processCombination(const CHotkeyCombination &combination)
+    {
+        m_lastCombination = combination;
+
+        QSet<QString> newActiveActions;
+        for (const auto &pair : std::as_const(m_combinations))
+        {
+            if (pair.first.isSubsetOf(combination)) { newActiveActions.insert(pair.second); }
+        }
+        if (newActiveActions == m_activeActions) { return; }
+
+        const QSet<QString> pressedActions  = newActiveActions - m_activeActions;
+        const QSet<QString> releasedActions = m_activeActions - newActiveActions;
+        m_activeActions = newActiveActions;
+        for (const FastPathInfo &info : std::as_const(m_bindings))
+        {
+            if (pressedActions.contains(info.m_action)) { info.m_function(true); }
+            else if (releasedActions.contains(info.m_action)) { info.m_function(false); }
+        }
+    }
+} // ns
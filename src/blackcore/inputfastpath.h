@@ -0,0 +1,95 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_INPUTFASTPATH_H
+#define BLACKCORE_INPUTFASTPATH_H
+
+#include "blackcore/blackcoreexport.h"
+#include "blackmisc/input/hotkeycombination.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QSet>
+#include <QString>
+#include <QVector>
+#include <functional>
+
+namespace BlackCore
+{
+    /*!
+     * Calls preregistered functions for latency critical hotkey actions (i.e. PTT)
+     * directly in the thread of the input device, before the combination is queued
+     * for the regular processing in CInputManager.
+     * \remark functions are called with an internal lock held, so they must be short
+     *         and must not call back into this object. After unbind returns the function
+     *         is not called anymore.
+     */
+    class BLACKCORE_EXPORT CInputFastPath
+    {
+    public:
+        //! Bind a function to an action
+        //! \threadsafe
+        int bind(const QString &action, const std::function<void(bool)> &function);
+
+        //! Unbind
+        //! \threadsafe
+        void unbind(int index);
+
+        //! Any function bound?
+        //! \threadsafe
+        bool hasBindings() const;
+
+        //! Configured combinations and their actions, only those of bound actions are used
+        //! \threadsafe
+        void setConfiguredActions(const QHash<BlackMisc::Input::CHotkeyCombination, QString> &configuredActions);
+
+        //! Keyboard keys changed
+        //! \threadsafe
+        void processKeyCombination(const BlackMisc::Input::CHotkeyCombination &combination);
+
+        //! Joystick buttons changed
+        //! \threadsafe
+        void processButtonCombination(const BlackMisc::Input::CHotkeyCombination &combination);
+
+        //! Suspend while a hotkey is captured, combinations are only tracked
+        //! \threadsafe
+        void suspend();
+
+        //! Resume with the actions active in the regular processing
+        //! \threadsafe
+        void resume(const QSet<QString> &activeActions);
+
+    private:
+        //! Bound function
+        struct FastPathInfo
+        {
+            int m_index = 0;
+            QString m_action;
+            std::function<void(bool)> m_function;
+        };
+
+        //! Combinations of bound actions, lock must be held
+        void updateCombinations();
+
+        //! Find pressed and released actions and call the functions, lock must be held
+        void processCombination(const BlackMisc::Input::CHotkeyCombination &combination);
+
+        mutable QMutex m_mutex;
+        int m_nextIndex = 0;
+        QVector<FastPathInfo> m_bindings;
+        QHash<BlackMisc::Input::CHotkeyCombination, QString> m_configuredActions;
+        QVector<QPair<BlackMisc::Input::CHotkeyCombination, QString>> m_combinations; //!< only bound actions
+        QSet<QString> m_activeActions;
+        bool m_suspended = false;
+        BlackMisc::Input::CHotkeyCombination m_lastCombination;
+    };
+} // ns
+
+#endif // guard
@@ -71,6 +71,7 @@ namespace BlackCore
 
             m_configuredActions.insert(combination, actionHotkey.getAction());
         }
+        m_fastPath.setConfiguredActions(m_configuredActions);
     }
 
     void CInputManager::processKeyCombinationChanged(const CHotkeyCombination &combination)
@@ -94,6 +95,7 @@ namespace BlackCore
     void CInputManager::startCapture()
     {
         m_captureActive = true;
+        m_fastPath.suspend(); // no PTT while recording a hotkey
         m_capturedCombination = {};
         m_combinationBeforeCapture = m_lastCombination;
     }
@@ -101,8 +103,8 @@ namespace BlackCore
     void CInputManager::callFunctionsBy(const QString &action, bool isKeyDown, bool shouldEmit)
     {
         if (action.isEmpty()) { return; }
-        if (m_actionRelayingEnabled && shouldEmit) { emit remoteActionFromLocal(action, isKeyDown); }
 
+        // local functions first, relaying to the core must not delay them
         for (const auto &boundAction : std::as_const(m_boundActions))
         {
             if (boundAction.m_action == action)
@@ -110,6 +112,7 @@ namespace BlackCore
                 boundAction.m_function(isKeyDown);
             }
         }
+        if (m_actionRelayingEnabled && shouldEmit) { emit remoteActionFromLocal(action, isKeyDown); }
     }
 
     void CInputManager::triggerKey(const CHotkeyCombination &combination, bool isPressed)
@@ -122,10 +125,26 @@ namespace BlackCore
         m_lastCombination = combination;
     }
 
+    void CInputManager::injectKeyCombination(const CHotkeyCombination &combination)
+    {
+        m_fastPath.processKeyCombination(combination);
+        QMetaObject::invokeMethod(this, [ = ] { this->processKeyCombinationChanged(combination); }, Qt::QueuedConnection);
+    }
+
     void CInputManager::createDevices()
     {
         m_keyboard = IKeyboard::create(this);
         m_joystick = IJoystick::create(this);
+
+        // fast path directly in the device thread, before the queued regular processing
+        connect(m_keyboard.get(), &IKeyboard::keyCombinationChanged, m_keyboard.get(), [this](const CHotkeyCombination &combination)
+        {
+            m_fastPath.processKeyCombination(combination);
+        }, Qt::DirectConnection);
+        connect(m_joystick.get(), &IJoystick::buttonCombinationChanged, m_joystick.get(), [this](const CHotkeyCombination &combination)
+        {
+            m_fastPath.processButtonCombination(combination);
+        }, Qt::DirectConnection);
         connect(m_keyboard.get(), &IKeyboard::keyCombinationChanged,    this, &CInputManager::processKeyCombinationChanged,    Qt::QueuedConnection);
         connect(m_joystick.get(), &IJoystick::buttonCombinationChanged, this, &CInputManager::processButtonCombinationChanged, Qt::QueuedConnection);
     }
@@ -168,6 +187,7 @@ namespace BlackCore
             {
                 emit combinationSelectionFinished(m_capturedCombination);
                 m_captureActive = false;
+                m_fastPath.resume(m_activeActions);
             }
             else
             {
@@ -13,6 +13,7 @@
 
 #include "blackcore/blackcoreexport.h"
 #include "blackcore/application/applicationsettings.h"
+#include "blackcore/inputfastpath.h"
 #include "blackinput/joystick.h"
 #include "blackinput/keyboard.h"
 #include "blackmisc/input/hotkeycombination.h"
@@ -67,6 +68,19 @@ namespace BlackCore
         //! Unbind a slot
         void unbind(int index);
 
+        //! Bind a function called directly in the input device thread, without event loop hops
+        //! \remark for latency critical actions like PTT, the function must be threadsafe and short
+        //! \remark bound slots of the action are still called in addition
+        //! \threadsafe
+        int bindFastPath(const QString &action, const std::function<void(bool)> &function) { return m_fastPath.bind(action, function); }
+
+        //! Unbind a fast path function, it is not called anymore once this returns
+        //! \threadsafe
+        void unbindFastPath(int index) { m_fastPath.unbind(index); }
+
+        //! Inject a key combination as if reported by the keyboard, i.e. for testing
+        void injectKeyCombination(const BlackMisc::Input::CHotkeyCombination &combination);
+
         //! Select a key combination as hotkey. This method returns immediatly.
         //! Listen for signals combinationSelectionChanged and combinationSelectionFinished
         //! to retrieve the user input.
@@ -107,6 +121,7 @@ namespace BlackCore
         void combinationSelectionChanged(const BlackMisc::Input::CHotkeyCombination &combination);
 
         //! Combination selection has finished
+        //! \remark emitted before the fast path is resumed, so receivers can reset fast path state
         void combinationSelectionFinished(const BlackMisc::Input::CHotkeyCombination &combination);
 
         //! New hotkey action is registered
@@ -137,6 +152,7 @@ namespace BlackCore
 
         std::unique_ptr<BlackInput::IKeyboard> m_keyboard; //!< keyboard
         std::unique_ptr<BlackInput::IJoystick> m_joystick; //!< joystick
+        CInputFastPath m_fastPath; //!< latency critical actions
 
         QMap<QString, BlackMisc::CIcons::IconIndex> m_availableActions;
         QHash<BlackMisc::Input::CHotkeyCombination, QString> m_configuredActions;
@@ -0,0 +1,201 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/matchingscriptenginepool.h"
+#include "blackmisc/fileutils.h"
+
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QHash>
+#include <QJSEngine>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+#include <QThread>
+#include <QThreadStorage>
+#include <QWaitCondition>
+#include <limits>
+
+using namespace BlackMisc;
+
+namespace BlackCore
+{
+    namespace
+    {
+        //! Script file content as read last time
+        struct ScriptFile
+        {
+            QString source;          //!< file content
+            QDateTime lastModified;  //!< file timestamp when read
+            qint64 size = -1;        //!< file size when read
+        };
+
+        //! Engine of one thread with its compiled scripts
+        struct ThreadEngine
+        {
+            QJSEngine engine;                  //!< the engine
+            QHash<QString, QJSValue> functions; //!< script source -> compiled function
+        };
+
+        //! Interrupts engines whose script runs longer than their deadline
+        class CScriptWatchdog : public QThread
+        {
+        public:
+            //! Dtor
+            virtual ~CScriptWatchdog() override
+            {
+                {
+                    QMutexLocker l(&m_mutex);
+                    m_stop = true;
+                    m_changed.wakeAll();
+                }
+                this->wait();
+            }
+
+            //! Watch engine for timeoutMs
+            void arm(QJSEngine *engine, int timeoutMs)
+            {
+                QMutexLocker l(&m_mutex);
+                if (!this->isRunning()) { this->start(); }
+                m_deadlines.insert(engine, QDateTime::currentMSecsSinceEpoch() + timeoutMs);
+                m_fired.remove(engine);
+                m_changed.wakeAll();
+            }
+
+            //! Stop watching the engine, true if it was interrupted
+            //! \remark after this call the engine is not interrupted anymore by the watchdog
+            bool disarm(QJSEngine *engine)
+            {
+                QMutexLocker l(&m_mutex);
+                m_deadlines.remove(engine);
+                return m_fired.remove(engine) > 0;
+            }
+
+        protected:
+            //! \copydoc QThread::run
+            virtual void run() override
+            {
+                QMutexLocker l(&m_mutex);
+                while (!m_stop)
+                {
+                    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+                    qint64 next = std::numeric_limits<qint64>::max();
+                    for (auto it = m_deadlines.begin(); it != m_deadlines.end();)
+                    {
+                        if (it.value() <= now)
+                        {
+                            it.key()->setInterrupted(true);
+                            m_fired.insert(it.key());
+                            it = m_deadlines.erase(it);
+                            continue;
+                        }
+                        next = qMin(next, it.value());
+                        ++it;
+                    }
+
+                    if (m_deadlines.isEmpty()) { m_changed.wait(&m_mutex); }
+                    else { m_changed.wait(&m_mutex, static_cast<unsigned long>(next - now)); }
+                }
+            }
+
+        private:
+            QMutex m_mutex;
+            QWaitCondition m_changed;
+            QHash<QJSEngine *, qint64> m_deadlines; //!< engine -> deadline in ms since epoch
+            QSet<QJSEngine *> m_fired;              //!< engines interrupted, not yet disarmed
+            bool m_stop = false;
+        };
+
+        CScriptWatchdog &watchdog()
+        {
+            static CScriptWatchdog w;
+            return w;
+        }
+
+        ThreadEngine &threadEngine()
+        {
+            static QThreadStorage<ThreadEngine *> engines;
+            if (!engines.hasLocalData()) { engines.setLocalData(new ThreadEngine()); }
+            return *engines.localData();
+        }
+    }
+
+    std::atomic_int CMatchingScriptEnginePool::s_timeoutMs { CMatchingScriptEnginePool::DefaultTimeoutMs };
+
+    QString CMatchingScriptEnginePool::scriptSource(const QString &fileName)
+    {
+        if (fileName.isEmpty()) { return QString(); }
+        static QMutex mutex;
+        static QHash<QString, ScriptFile> files;
+
+        const QFileInfo fi(fileName);
+        if (!fi.exists()) { return QString(); }
+        const QDateTime lastModified = fi.lastModified();
+        const qint64 size = fi.size();
+
+        QMutexLocker l(&mutex);
+        const auto it = files.constFind(fileName);
+        if (it != files.cend() && it->lastModified == lastModified && it->size == size) { return it->source; }
+
+        ScriptFile file;
+        file.source = CFileUtils::readFileToString(fileName);
+        file.lastModified = lastModified;
+        file.size = size;
+        files.insert(fileName, file);
+        return file.source;
+    }
+
+    CMatchingScriptEnginePool::RunResult CMatchingScriptEnginePool::run(const QString &js, const QString &logFileName, const GlobalObjects &globalObjects)
+    {
+        RunResult result;
+        if (js.isEmpty()) { return result; }
+
+        ThreadEngine &te = threadEngine();
+        QJSValue function = te.functions.value(js);
+        if (function.isUndefined())
+        {
+            function = te.engine.evaluate(js, logFileName);
+            if (function.isError())
+            {
+                result.value = function;
+                result.compileError = true;
+                return result;
+            }
+            if (te.functions.size() >= MaxCompiledScripts) { te.functions.clear(); }
+            te.functions.insert(js, function);
+        }
+
+        QJSValue global = te.engine.globalObject();
+        for (const auto &object : globalObjects)
+        {
+            // objects are owned by the caller and live longer than the engine uses them,
+            // the engine must never garbage collect them
+            QJSEngine::setObjectOwnership(object.second, QJSEngine::CppOwnership);
+            global.setProperty(object.first, te.engine.newQObject(object.second));
+        }
+
+        const int timeoutMs = s_timeoutMs;
+        if (timeoutMs > 0) { watchdog().arm(&te.engine, timeoutMs); }
+
+        QElapsedTimer time;
+        time.start();
+        result.value = function.call();
+        result.elapsedMs = time.elapsed();
+
+        if (timeoutMs > 0)
+        {
+            result.timedOut = watchdog().disarm(&te.engine);
+            te.engine.setInterrupted(false);
+        }
+
+        // no dangling objects in the engine after the call
+        for (const auto &object : globalObjects) { global.deleteProperty(object.first); }
+        return result;
+    }
+} // namespace
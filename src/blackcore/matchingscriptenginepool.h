@@ -0,0 +1,79 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_MATCHINGSCRIPTENGINEPOOL_H
+#define BLACKCORE_MATCHINGSCRIPTENGINEPOOL_H
+
+#include "blackcore/blackcoreexport.h"
+
+#include <QJSValue>
+#include <QList>
+#include <QObject>
+#include <QPair>
+#include <QString>
+#include <atomic>
+
+class QJSEngine;
+
+namespace BlackCore
+{
+    /*!
+     * Matching scripts compiled once and run in one JS engine per thread.
+     *
+     * - script files are read once and re-read when they change on disk (hot reload)
+     * - each thread owns a QJSEngine, compiled script functions are kept per engine and reused
+     * - a watchdog interrupts scripts running longer than the timeout
+     * \remark QJSEngine objects can only be used in the thread which created them, hence one engine per thread
+     */
+    class BLACKCORE_EXPORT CMatchingScriptEnginePool
+    {
+    public:
+        //! Result of a script run
+        struct RunResult
+        {
+            QJSValue value;           //!< return value of the script function
+            qint64 elapsedMs = 0;     //!< time spent in the script
+            bool timedOut = false;    //!< interrupted by the watchdog
+            bool compileError = false; //!< script could not be compiled, value is the error
+        };
+
+        //! Global objects passed to the script, name and object
+        using GlobalObjects = QList<QPair<QString, QObject *>>;
+
+        //! Source of a script file, read only if the file has changed since it was read last time
+        //! \threadsafe
+        static QString scriptSource(const QString &fileName);
+
+        //! Compile (if not yet done in this thread) and call the script function
+        //! \remark the script evaluates to a function which is called without arguments
+        //! \remark the objects are only accessed during the call, ownership stays with the caller
+        //! \threadsafe
+        static RunResult run(const QString &js, const QString &logFileName, const GlobalObjects &globalObjects);
+
+        //! Timeout for a script call in ms
+        //! \threadsafe
+        static int getTimeoutMs() { return s_timeoutMs; }
+
+        //! Set timeout for a script call in ms, <= 0 disables the timeout
+        //! \threadsafe
+        static void setTimeoutMs(int timeoutMs) { s_timeoutMs = timeoutMs; }
+
+        //! Default timeout in ms
+        static constexpr int DefaultTimeoutMs = 500;
+
+        //! Max. number of compiled scripts kept per engine
+        static constexpr int MaxCompiledScripts = 8;
+
+    private:
+        static std::atomic_int s_timeoutMs; //!< timeout for all engines
+    };
+} // namespace
+
+#endif // guard
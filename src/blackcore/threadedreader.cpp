@@ -100,19 +100,29 @@ namespace BlackCore
         return m_urlReadLog;
     }
 
-    bool CThreadedReader::didContentChange(const QString &content, int startPosition)
+    bool CThreadedReader::didContentChange(const QString &content, int startPosition, const QUrl &url)
     {
-        uint oldHash = 0;
-        {
-            QReadLocker rl(&m_lock);
-            oldHash = m_contentHash;
-        }
-        uint newHash = qHash(startPosition < 0 ? content : content.mid(startPosition));
-        if (oldHash == newHash) { return false; }
-        {
-            QWriteLocker wl(&m_lock);
-            m_contentHash = newHash;
-        }
+        return this->didContentHashChange(qHash(startPosition < 0 ? content : content.mid(startPosition)), url);
+    }
+
+    bool CThreadedReader::didContentChange(const QByteArray &content, const QUrl &url)
+    {
+        return this->didContentHashChange(qHash(content), url);
+    }
+
+    bool CThreadedReader::isUnchangedCachedReply(const QNetworkReply *nwReply) const
+    {
+        if (!CNetworkUtils::isFromHttpCache(nwReply)) { return false; }
+        QReadLocker rl(&m_lock);
+        return m_contentHash != 0 && !m_contentUrl.isEmpty() && m_contentUrl == nwReply->url();
+    }
+
+    bool CThreadedReader::didContentHashChange(uint newHash, const QUrl &url)
+    {
+        QWriteLocker wl(&m_lock);
+        m_contentUrl = url;
+        if (m_contentHash == newHash) { return false; }
+        m_contentHash = newHash;
         return true;
     }
 
@@ -17,10 +17,12 @@
 #include "blackmisc/logcategories.h"
 #include "blackmisc/worker.h"
 
+#include <QByteArray>
 #include <QDateTime>
 #include <QObject>
 #include <QReadWriteLock>
 #include <QString>
+#include <QUrl>
 #include <QtGlobal>
 #include <QPair>
 #include <atomic>
@@ -116,8 +118,20 @@ namespace BlackCore
         void threadAssertCheck() const;
 
         //! Stores new content hash and returns if content changed (based on hash value
+        //! \param url the content was read from, for isUnchangedCachedReply
         //! \threadsafe
-        bool didContentChange(const QString &content, int startPosition = -1);
+        bool didContentChange(const QString &content, int startPosition = -1, const QUrl &url = {});
+
+        //! Stores new content hash and returns if content changed, for raw data not converted to a string
+        //! \param url the content was read from, for isUnchangedCachedReply
+        //! \threadsafe
+        bool didContentChange(const QByteArray &content, const QUrl &url = {});
+
+        //! Reply is the "304 not modified" answer served from the HTTP cache and the last content was read from the same URL,
+        //! so parsing can be skipped without reading the body
+        //! \remark after switching to another URL the reply is read, as the cached content can differ from the last content
+        //! \threadsafe
+        bool isUnchangedCachedReply(const QNetworkReply *nwReply) const;
 
         //! Set initial and periodic times
         void setInitialAndPeriodicTime(int initialTime, int periodicTime);
@@ -148,12 +162,17 @@ namespace BlackCore
         //! Trigger doWorkImpl
         void doWork();
 
+        //! Stores new content hash and its URL, returns if changed
+        //! \threadsafe
+        bool didContentHashChange(uint newHash, const QUrl &url);
+
         static constexpr int OutdatedPendingCallMs = 30 * 1000; //!< when is a call considered "outdated"
 
         int               m_initialTime = -1;         //!< Initial start delay
         int               m_periodicTime = -1;        //!< Periodic time after which the task is repeated
         QDateTime         m_updateTimestamp;          //!< when file/resource was read
         uint              m_contentHash = 0;          //!< has of the content given
+        QUrl              m_contentUrl;               //!< URL of the content given, if known
         std::atomic_bool  m_markedAsFailed { false }; //!< marker if reading failed
         bool              m_unitTest { false };       //!< mark as unit test
         BlackMisc::Network::CUrlLogList m_urlReadLog; //!< URL based reading can be logged
@@ -63,16 +63,20 @@ namespace BlackCore::Vatsim
         this->reloadSettings();
     }
 
-    CSimulatedAircraftList CVatsimDataFileReader::getAircraft() const
+    CVatsimDataFileSnapshot::ConstPtr CVatsimDataFileReader::getSnapshot() const
     {
         QReadLocker rl(&m_lock);
-        return m_aircraft;
+        return m_snapshot;
+    }
+
+    CSimulatedAircraftList CVatsimDataFileReader::getAircraft() const
+    {
+        return this->getSnapshot()->getAircraft();
     }
 
     CAtcStationList CVatsimDataFileReader::getAtcStations() const
     {
-        QReadLocker rl(&m_lock);
-        return m_atcStations;
+        return this->getSnapshot()->getAtcStations();
     }
 
     CAtcStationList CVatsimDataFileReader::getAtcStationsForCallsign(const CCallsign &callsign) const
@@ -83,7 +87,7 @@ namespace BlackCore::Vatsim
 
     CAtcStationList CVatsimDataFileReader::getAtcStationsForCallsigns(const CCallsignSet &callsigns) const
     {
-        return this->getAtcStations().findByCallsigns(callsigns);
+        return this->getSnapshot()->getAtcStationsForCallsigns(callsigns);
     }
 
     CServerList CVatsimDataFileReader::getVoiceServers() const
@@ -98,7 +102,7 @@ namespace BlackCore::Vatsim
 
     CUserList CVatsimDataFileReader::getPilotsForCallsigns(const CCallsignSet &callsigns) const
     {
-        return this->getAircraft().findByCallsigns(callsigns).transform(Predicates::MemberTransform(&CSimulatedAircraft::getPilot));
+        return this->getSnapshot()->getAircraftForCallsigns(callsigns).transform(Predicates::MemberTransform(&CSimulatedAircraft::getPilot));
     }
 
     CUserList CVatsimDataFileReader::getPilotsForCallsign(const CCallsign &callsign) const
@@ -109,33 +113,31 @@ namespace BlackCore::Vatsim
 
     CAirlineIcaoCode CVatsimDataFileReader::getAirlineIcaoCode(const CCallsign &callsign) const
     {
-        const CSimulatedAircraft aircraft = this->getAircraft().findFirstByCallsign(callsign);
-        return aircraft.getAirlineIcaoCode();
+        return this->getSnapshot()->getAircraftForCallsign(callsign).getAirlineIcaoCode();
     }
 
     CAircraftIcaoCode CVatsimDataFileReader::getAircraftIcaoCode(const CCallsign &callsign) const
     {
-        const CSimulatedAircraft aircraft = this->getAircraft().findFirstByCallsign(callsign);
-        return aircraft.getAircraftIcaoCode();
+        return this->getSnapshot()->getAircraftForCallsign(callsign).getAircraftIcaoCode();
     }
 
     CVoiceCapabilities CVatsimDataFileReader::getVoiceCapabilityForCallsign(const CCallsign &callsign) const
     {
         if (callsign.isEmpty()) { return CVoiceCapabilities(); }
-        QReadLocker rl(&m_lock);
-        return m_flightPlanRemarks.value(callsign).getVoiceCapabilities();
+        return this->getSnapshot()->getFlightPlanRemarksForCallsign(callsign).getVoiceCapabilities();
     }
 
     CFlightPlanRemarks CVatsimDataFileReader::getFlightPlanRemarksForCallsign(const CCallsign &callsign) const
     {
         if (callsign.isEmpty()) { return QString(); }
-        QReadLocker rl(&m_lock);
-        return m_flightPlanRemarks.value(callsign);
+        return this->getSnapshot()->getFlightPlanRemarksForCallsign(callsign);
     }
 
     void CVatsimDataFileReader::updateWithVatsimDataFileData(CSimulatedAircraft &aircraftToBeUdpated) const
     {
-        this->getAircraft().updateWithVatsimDataFileData(aircraftToBeUdpated);
+        const CSimulatedAircraft aircraft = this->getSnapshot()->getAircraftForCallsign(aircraftToBeUdpated.getCallsign());
+        if (!aircraft.hasCallsign()) { return; }
+        CSimulatedAircraftList({ aircraft }).updateWithVatsimDataFileData(aircraftToBeUdpated);
     }
 
     CUserList CVatsimDataFileReader::getControllersForCallsign(const CCallsign &callsign) const
@@ -146,7 +148,7 @@ namespace BlackCore::Vatsim
 
     CUserList CVatsimDataFileReader::getControllersForCallsigns(const CCallsignSet &callsigns) const
     {
-        return this->getAtcStations().findByCallsigns(callsigns).transform(Predicates::MemberTransform(&CAtcStation::getController));
+        return this->getSnapshot()->getAtcStationsForCallsigns(callsigns).transform(Predicates::MemberTransform(&CAtcStation::getController));
     }
 
     CUserList CVatsimDataFileReader::getUsersForCallsign(const CCallsign &callsign) const
@@ -221,23 +223,30 @@ namespace BlackCore::Vatsim
 
         if (nwReply->error() == QNetworkReply::NoError)
         {
-            const QString dataFileData = nwReply->readAll();
+            if (this->isUnchangedCachedReply(nwReplyPtr))
+            {
+                CLogMessage(this).info(u"VATSIM file '%1' not modified, skipped") << urlString;
+                return;
+            }
+
+            // parsed straight from the UTF-8 bytes, no QString round trip
+            const QByteArray dataFileData = nwReply->readAll();
             nwReply->close(); // close asap
 
             if (dataFileData.isEmpty()) { return; }
-            if (!this->didContentChange(dataFileData)) // Quick check by hash
+            if (!this->didContentChange(dataFileData, url)) // Quick check by hash
             {
                 CLogMessage(this).info(u"VATSIM file '%1' has same content, skipped") << urlString;
                 return;
             }
-            auto jsonDoc = QJsonDocument::fromJson(dataFileData.toUtf8());
+            auto jsonDoc = QJsonDocument::fromJson(dataFileData);
             if (jsonDoc.isEmpty()) { return; }
 
             // build on local vars for thread safety
             CServerList                         fsdServers;
             CAtcStationList                     atcStations;
             CSimulatedAircraftList              aircraft;
-            QMap<CCallsign, CFlightPlanRemarks> flightPlanRemarksMap;
+            QHash<CCallsign, CFlightPlanRemarks> flightPlanRemarksMap;
             auto updateTimestampFromFile = QDateTime::fromString(jsonDoc["general"]["update_timestamp"].toString(), Qt::ISODateWithMs);
 
             const bool alreadyRead = (updateTimestampFromFile == this->getUpdateTimestamp());
@@ -289,13 +298,16 @@ namespace BlackCore::Vatsim
             // Setup for VATSIM servers and sorting for comparison
             fsdServers.sortBy(&CServer::getName, &CServer::getDescription);
 
+            // indexes and diff are built outside the lock, only this thread replaces the snapshot
+            const CVatsimDataFileSnapshot::ConstPtr previous = this->getSnapshot();
+            const CVatsimDataFileSnapshot::ConstPtr snapshot(new CVatsimDataFileSnapshot(aircraft, atcStations, flightPlanRemarksMap, updateTimestampFromFile, previous.data()));
+            CLogMessage(this).debug(u"VATSIM data file changes: %1") << snapshot->getDiff().toQString();
+
             // this part needs to be synchronized
             {
                 QWriteLocker wl(&m_lock);
                 this->setUpdateTimestamp(updateTimestampFromFile);
-                m_aircraft = aircraft;
-                m_atcStations = atcStations;
-                m_flightPlanRemarks = flightPlanRemarksMap;
+                m_snapshot = snapshot;
             }
 
             // update cache itself is thread safe
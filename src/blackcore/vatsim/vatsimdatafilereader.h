@@ -13,6 +13,7 @@
 
 #include "blackcore/blackcoreexport.h"
 #include "blackcore/data/vatsimsetup.h"
+#include "blackcore/vatsim/vatsimdatafilesnapshot.h"
 #include "blackmisc/aviation/aircrafticaocode.h"
 #include "blackmisc/aviation/airlineicaocode.h"
 #include "blackmisc/aviation/atcstationlist.h"
@@ -27,7 +28,6 @@
 #include "blackmisc/datacache.h"
 #include "blackcore/threadedreader.h"
 
-#include <QMap>
 #include <QObject>
 #include <QString>
 #include <QStringList>
@@ -49,6 +49,11 @@ namespace BlackCore::Vatsim
         //! Constructor
         explicit CVatsimDataFileReader(QObject *owner);
 
+        //! Current data file, including the diff to the previous one
+        //! \remark never null, empty before the first read
+        //! \threadsafe
+        CVatsimDataFileSnapshot::ConstPtr getSnapshot() const;
+
         //! Get aircraft
         //! \threadsafe
         BlackMisc::Simulation::CSimulatedAircraftList getAircraft() const;
@@ -144,11 +149,9 @@ namespace BlackCore::Vatsim
             SectionGeneral
         };
 
-        BlackMisc::Aviation::CAtcStationList m_atcStations;
-        BlackMisc::Simulation::CSimulatedAircraftList m_aircraft;
+        CVatsimDataFileSnapshot::ConstPtr m_snapshot { new CVatsimDataFileSnapshot() }; //!< current data file, replaced as a whole
         BlackMisc::CData<BlackCore::Data::TVatsimSetup> m_lastGoodSetup { this };
         BlackMisc::CSettingReadOnly<BlackCore::Vatsim::TVatsimDataFile> m_settings { this, &CVatsimDataFileReader::reloadSettings };
-        QMap<BlackMisc::Aviation::CCallsign, BlackMisc::Aviation::CFlightPlanRemarks> m_flightPlanRemarks; //!< cache for flight plan remarks
 
         //! Data have been read, parse VATSIM file
         void parseVatsimFile(QNetworkReply *nwReply);
@@ -0,0 +1,158 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackcore/vatsim/vatsimdatafilesnapshot.h"
+
+#include <QVector>
+#include <algorithm>
+#include <utility>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+
+namespace BlackCore::Vatsim
+{
+    bool CVatsimDataFileDiff::isEmpty() const
+    {
+        return addedPilots.isEmpty() && removedPilots.isEmpty() && changedPilots.isEmpty() &&
+               addedControllers.isEmpty() && removedControllers.isEmpty() && changedControllers.isEmpty();
+    }
+
+    CCallsignSet CVatsimDataFileDiff::getAddedOrChangedPilots() const
+    {
+        CCallsignSet callsigns(addedPilots);
+        callsigns.push_back(changedPilots);
+        return callsigns;
+    }
+
+    CCallsignSet CVatsimDataFileDiff::getAddedOrChangedControllers() const
+    {
+        CCallsignSet callsigns(addedControllers);
+        callsigns.push_back(changedControllers);
+        return callsigns;
+    }
+
+    QString CVatsimDataFileDiff::toQString() const
+    {
+        static const QString s("pilots +%1 -%2 ~%3, controllers +%4 -%5 ~%6");
+        return s.arg(addedPilots.size()).arg(removedPilots.size()).arg(changedPilots.size()).
+               arg(addedControllers.size()).arg(removedControllers.size()).arg(changedControllers.size());
+    }
+
+    CVatsimDataFileSnapshot::CVatsimDataFileSnapshot(const CSimulatedAircraftList &aircraft, const CAtcStationList &atcStations,
+            const QHash<CCallsign, CFlightPlanRemarks> &flightPlanRemarks, const QDateTime &updateTimestamp,
+            const CVatsimDataFileSnapshot *previous) :
+        m_aircraft(aircraft), m_atcStations(atcStations), m_flightPlanRemarks(flightPlanRemarks), m_updateTimestamp(updateTimestamp)
+    {
+        m_aircraftIndex.reserve(m_aircraft.size());
+        for (int i = 0; i < m_aircraft.size(); i++)
+        {
+            const CCallsign &callsign = std::as_const(m_aircraft)[i].getCallsign();
+            if (!m_aircraftIndex.contains(callsign)) { m_aircraftIndex.insert(callsign, i); }
+        }
+
+        QHash<CCallsign, int> firstAtcStation;
+        firstAtcStation.reserve(m_atcStations.size());
+        m_atcStationIndex.reserve(m_atcStations.size());
+        for (int i = 0; i < m_atcStations.size(); i++)
+        {
+            const CCallsign &callsign = std::as_const(m_atcStations)[i].getCallsign();
+            m_atcStationIndex.insert(callsign, i);
+            if (!firstAtcStation.contains(callsign)) { firstAtcStation.insert(callsign, i); }
+        }
+
+        if (!previous) { return; }
+        m_previousUpdateTimestamp = previous->getUpdateTimestamp();
+
+        // pilots, positions change all the time and are not considered
+        for (auto it = m_aircraftIndex.cbegin(); it != m_aircraftIndex.cend(); ++it)
+        {
+            const auto previousIt = previous->m_aircraftIndex.constFind(it.key());
+            if (previousIt == previous->m_aircraftIndex.cend())
+            {
+                m_diff.addedPilots.insert(it.key());
+                continue;
+            }
+            const CSimulatedAircraft &current = std::as_const(m_aircraft)[it.value()];
+            const CSimulatedAircraft &old = previous->m_aircraft[previousIt.value()];
+            const bool changed =
+                current.getPilot() != old.getPilot() ||
+                current.getAircraftIcaoCode() != old.getAircraftIcaoCode() ||
+                current.getAirlineIcaoCode() != old.getAirlineIcaoCode() ||
+                current.getTransponder() != old.getTransponder() ||
+                this->getFlightPlanRemarksForCallsign(it.key()) != previous->getFlightPlanRemarksForCallsign(it.key());
+            if (changed) { m_diff.changedPilots.insert(it.key()); }
+        }
+        for (auto it = previous->m_aircraftIndex.cbegin(); it != previous->m_aircraftIndex.cend(); ++it)
+        {
+            if (!m_aircraftIndex.contains(it.key())) { m_diff.removedPilots.insert(it.key()); }
+        }
+
+        // controllers, compared by their first entry
+        QHash<CCallsign, int> previousFirstAtcStation;
+        for (int i = previous->m_atcStations.size() - 1; i >= 0; i--)
+        {
+            previousFirstAtcStation.insert(previous->m_atcStations[i].getCallsign(), i);
+        }
+        for (auto it = firstAtcStation.cbegin(); it != firstAtcStation.cend(); ++it)
+        {
+            const auto previousIt = previousFirstAtcStation.constFind(it.key());
+            if (previousIt == previousFirstAtcStation.cend())
+            {
+                m_diff.addedControllers.insert(it.key());
+            }
+            else if (std::as_const(m_atcStations)[it.value()] != previous->m_atcStations[previousIt.value()])
+            {
+                m_diff.changedControllers.insert(it.key());
+            }
+        }
+        for (auto it = previousFirstAtcStation.cbegin(); it != previousFirstAtcStation.cend(); ++it)
+        {
+            if (!firstAtcStation.contains(it.key())) { m_diff.removedControllers.insert(it.key()); }
+        }
+    }
+
+    CSimulatedAircraft CVatsimDataFileSnapshot::getAircraftForCallsign(const CCallsign &callsign) const
+    {
+        const int i = m_aircraftIndex.value(callsign, -1);
+        return i < 0 ? CSimulatedAircraft() : m_aircraft[i];
+    }
+
+    CSimulatedAircraftList CVatsimDataFileSnapshot::getAircraftForCallsigns(const CCallsignSet &callsigns) const
+    {
+        QVector<int> indexes;
+        for (const CCallsign &callsign : callsigns)
+        {
+            const int i = m_aircraftIndex.value(callsign, -1);
+            if (i >= 0) { indexes.push_back(i); }
+        }
+        std::sort(indexes.begin(), indexes.end()); // file order
+
+        CSimulatedAircraftList aircraft;
+        for (int i : std::as_const(indexes)) { aircraft.push_back(m_aircraft[i]); }
+        return aircraft;
+    }
+
+    CAtcStationList CVatsimDataFileSnapshot::getAtcStationsForCallsigns(const CCallsignSet &callsigns) const
+    {
+        QVector<int> indexes;
+        for (const CCallsign &callsign : callsigns)
+        {
+            for (auto it = m_atcStationIndex.constFind(callsign); it != m_atcStationIndex.cend() && it.key() == callsign; ++it)
+            {
+                indexes.push_back(it.value());
+            }
+        }
+        std::sort(indexes.begin(), indexes.end());
+
+        CAtcStationList stations;
+        for (int i : std::as_const(indexes)) { stations.push_back(m_atcStations[i]); }
+        return stations;
+    }
+} // ns
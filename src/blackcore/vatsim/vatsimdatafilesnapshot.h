@@ -0,0 +1,107 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKCORE_VATSIM_VATSIMDATAFILESNAPSHOT_H
+#define BLACKCORE_VATSIM_VATSIMDATAFILESNAPSHOT_H
+
+#include "blackcore/blackcoreexport.h"
+#include "blackmisc/aviation/atcstationlist.h"
+#include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/aviation/flightplan.h"
+#include "blackmisc/simulation/simulatedaircraftlist.h"
+
+#include <QDateTime>
+#include <QHash>
+#include <QSharedPointer>
+
+namespace BlackCore::Vatsim
+{
+    //! Changes between two VATSIM data files
+    struct BLACKCORE_EXPORT CVatsimDataFileDiff
+    {
+        BlackMisc::Aviation::CCallsignSet addedPilots;        //!< pilots not in the previous file
+        BlackMisc::Aviation::CCallsignSet removedPilots;      //!< pilots no longer in the file
+        BlackMisc::Aviation::CCallsignSet changedPilots;      //!< pilot, ICAO codes, transponder or flight plan remarks changed, positions are ignored
+        BlackMisc::Aviation::CCallsignSet addedControllers;   //!< controllers not in the previous file
+        BlackMisc::Aviation::CCallsignSet removedControllers; //!< controllers no longer in the file
+        BlackMisc::Aviation::CCallsignSet changedControllers; //!< controllers with any changed value
+
+        //! Any change?
+        bool isEmpty() const;
+
+        //! Added or changed pilots
+        BlackMisc::Aviation::CCallsignSet getAddedOrChangedPilots() const;
+
+        //! Added or changed controllers
+        BlackMisc::Aviation::CCallsignSet getAddedOrChangedControllers() const;
+
+        //! Short info like "pilots +3 -1 ~5, controllers +0 -0 ~1"
+        QString toQString() const;
+    };
+
+    //! Immutable content of one VATSIM data file, indexed by callsign
+    //! \remark shared between threads as CVatsimDataFileSnapshot::ConstPtr, never modified after construction
+    class BLACKCORE_EXPORT CVatsimDataFileSnapshot
+    {
+    public:
+        //! Shared pointer
+        using ConstPtr = QSharedPointer<const CVatsimDataFileSnapshot>;
+
+        //! Empty snapshot
+        CVatsimDataFileSnapshot() = default;
+
+        //! Snapshot, builds the indexes and the diff to the previous snapshot
+        CVatsimDataFileSnapshot(const BlackMisc::Simulation::CSimulatedAircraftList &aircraft,
+                                const BlackMisc::Aviation::CAtcStationList &atcStations,
+                                const QHash<BlackMisc::Aviation::CCallsign, BlackMisc::Aviation::CFlightPlanRemarks> &flightPlanRemarks,
+                                const QDateTime &updateTimestamp,
+                                const CVatsimDataFileSnapshot *previous = nullptr);
+
+        //! All aircraft
+        const BlackMisc::Simulation::CSimulatedAircraftList &getAircraft() const { return m_aircraft; }
+
+        //! All ATC stations
+        const BlackMisc::Aviation::CAtcStationList &getAtcStations() const { return m_atcStations; }
+
+        //! Aircraft for callsign, first entry in the file
+        BlackMisc::Simulation::CSimulatedAircraft getAircraftForCallsign(const BlackMisc::Aviation::CCallsign &callsign) const;
+
+        //! Aircraft for callsigns
+        //! \remark pilot callsigns are unique on the network, one aircraft per callsign
+        BlackMisc::Simulation::CSimulatedAircraftList getAircraftForCallsigns(const BlackMisc::Aviation::CCallsignSet &callsigns) const;
+
+        //! ATC stations for callsigns
+        BlackMisc::Aviation::CAtcStationList getAtcStationsForCallsigns(const BlackMisc::Aviation::CCallsignSet &callsigns) const;
+
+        //! Flight plan remarks for callsign
+        BlackMisc::Aviation::CFlightPlanRemarks getFlightPlanRemarksForCallsign(const BlackMisc::Aviation::CCallsign &callsign) const { return m_flightPlanRemarks.value(callsign); }
+
+        //! Timestamp of the data file
+        const QDateTime &getUpdateTimestamp() const { return m_updateTimestamp; }
+
+        //! Timestamp of the snapshot the diff refers to, null if there was none
+        const QDateTime &getPreviousUpdateTimestamp() const { return m_previousUpdateTimestamp; }
+
+        //! Changes compared to the previous snapshot
+        const CVatsimDataFileDiff &getDiff() const { return m_diff; }
+
+    private:
+        BlackMisc::Simulation::CSimulatedAircraftList m_aircraft;
+        BlackMisc::Aviation::CAtcStationList m_atcStations;
+        QHash<BlackMisc::Aviation::CCallsign, BlackMisc::Aviation::CFlightPlanRemarks> m_flightPlanRemarks;
+        QHash<BlackMisc::Aviation::CCallsign, int> m_aircraftIndex;           //!< callsign -> first index in m_aircraft
+        QMultiHash<BlackMisc::Aviation::CCallsign, int> m_atcStationIndex;    //!< callsign -> indexes in m_atcStations
+        QDateTime m_updateTimestamp;
+        QDateTime m_previousUpdateTimestamp;
+        CVatsimDataFileDiff m_diff;
+    };
+} // ns
+
+#endif // guard
@@ -22,6 +22,7 @@
 #include <QScopedPointer>
 #include <QScopedPointerDeleteLater>
 #include <QString>
+#include <QStringList>
 #include <QTextStream>
 #include <QTimer>
 #include <QUrl>
@@ -62,7 +63,7 @@ namespace BlackCore::Vatsim
     CMetar CVatsimMetarReader::getMetarForAirport(const CAirportIcaoCode &icao) const
     {
         QReadLocker l(&m_lock);
-        return m_metars.getMetarForAirport(icao);
+        return m_metarsByAirport.value(icao.asString());
     }
 
     int CVatsimMetarReader::getMetarsCount() const
@@ -112,6 +113,12 @@ namespace BlackCore::Vatsim
 
         if (nwReply->error() == QNetworkReply::NoError)
         {
+            if (this->isUnchangedCachedReply(nwReplyPtr))
+            {
+                CLogMessage(this).info(u"METAR file from '%1' not modified, skipped") << metarUrl;
+                return;
+            }
+
             QString metarData = nwReply->readAll();
             nwReply->close(); // close asap
 
@@ -120,36 +127,59 @@ namespace BlackCore::Vatsim
                 CLogMessage(this).warning(u"No METAR data from '%1', skipped") << metarUrl;
                 return;
             }
-            if (!this->didContentChange(metarData)) // Quick check by hash
+            if (!this->didContentChange(metarData, -1, url)) // Quick check by hash
             {
                 CLogMessage(this).info(u"METAR file from '%1' has same content, skipped") << metarUrl;
                 return;
             }
 
-            CMetarList metars;
-            int invalidLines = 0;
+            QStringList lines;
             QTextStream lineReader(&metarData);
             while (!lineReader.atEnd())
             {
-                if (!this->doWorkCheck()) { return; }
                 const QString line = lineReader.readLine();
                 // some check for obvious errors
                 if (line.contains("<html")) { continue; }
-                const CMetar metar = m_metarDecoder.decode(line);
-                if (metar != CMetar())
+                lines.push_back(line);
+            }
+
+            // only decode lines not already decoded in the last read
+            QStringList changedLines;
+            for (const QString &line : std::as_const(lines))
+            {
+                if (!m_decodedLines.contains(line)) { changedLines.push_back(line); }
+            }
+            if (!this->doWorkCheck()) { return; }
+            const QVector<CMetar> changedMetars = m_metarDecoder.decode(changedLines);
+            if (!this->doWorkCheck()) { return; }
+
+            QHash<QString, CMetar> decodedLines;
+            decodedLines.reserve(lines.size());
+            for (int i = 0; i < changedLines.size(); i++) { decodedLines.insert(changedLines.at(i), changedMetars.at(i)); }
+
+            CMetarList metars;
+            int invalidLines = 0;
+            for (const QString &line : std::as_const(lines))
+            {
+                auto it = decodedLines.constFind(line);
+                if (it == decodedLines.constEnd()) { it = decodedLines.insert(line, m_decodedLines.value(line)); }
+                if (*it != CMetar())
                 {
-                    metars.push_back(metar);
+                    metars.push_back(*it);
                 }
                 else
                 {
                     invalidLines++;
                 }
             }
+            m_decodedLines = decodedLines; // drops lines no longer in the data file
+            const QHash<QString, CMetar> metarsByAirport = metars.getMetarsByAirport();
 
-            CLogMessage(this).info(u"METARs: %1 Metars (invalid %2) from '%3'") << metars.size() << invalidLines << metarUrl;
+            CLogMessage(this).info(u"METARs: %1 Metars (invalid %2, decoded %3) from '%4'") << metars.size() << invalidLines << changedLines.size() << metarUrl;
             {
                 QWriteLocker l(&m_lock);
                 m_metars = metars;
+                m_metarsByAirport = metarsByAirport;
             }
 
             emit metarsRead(metars);
@@ -20,7 +20,9 @@
 #include "blackmisc/aviation/airporticaocode.h"
 #include "blackcore/threadedreader.h"
 
+#include <QHash>
 #include <QObject>
+#include <QString>
 
 class QNetworkReply;
 
@@ -79,6 +81,8 @@ namespace BlackCore::Vatsim
     private:
         BlackMisc::Weather::CMetarDecoder m_metarDecoder;
         BlackMisc::Weather::CMetarList    m_metars;
+        QHash<QString, BlackMisc::Weather::CMetar> m_metarsByAirport; //!< index of m_metars by ICAO code
+        QHash<QString, BlackMisc::Weather::CMetar> m_decodedLines;    //!< raw line of the last read -> decoded METAR, CMetar() for invalid lines, reader thread only
         BlackMisc::CSettingReadOnly<BlackCore::Vatsim::TVatsimMetars> m_settings { this, &CVatsimMetarReader::reloadSettings };
     };
 } // ns
@@ -676,6 +676,12 @@ namespace BlackCore
         return false;
     }
 
+    QStringList CWebDataServices::getModelStringsStartingWith(const QString &prefix, int maxNumber) const
+    {
+        if (m_modelDataReader) { return m_modelDataReader->getModelStringsStartingWith(prefix, maxNumber); }
+        return QStringList();
+    }
+
     CAircraftModel CWebDataServices::getModelForDbKey(int dbKey) const
     {
         if (m_modelDataReader) { return m_modelDataReader->getModelForDbKey(dbKey); }
@@ -825,9 +831,8 @@ namespace BlackCore
 
     CAirlineIcaoCode CWebDataServices::findBestMatchByCallsign(const CCallsign &callsign) const
     {
-        if (callsign.isEmpty()) { return CAirlineIcaoCode(); }
-        const CAirlineIcaoCodeList icaos(this->getAirlineIcaoCodes());
-        return icaos.findBestMatchByCallsign(callsign);
+        if (callsign.isEmpty() || !m_icaoDataReader) { return CAirlineIcaoCode(); }
+        return m_icaoDataReader->getIcaoCodeLookup()->findBestAirlineMatchByCallsign(callsign);
     }
 
     CAirlineIcaoCode CWebDataServices::getAirlineIcaoCodeForDbKey(int key) const
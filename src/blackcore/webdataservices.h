@@ -245,6 +245,10 @@ namespace BlackCore
         //! \threadsafe
         bool containsModelString(const QString &modelString) const;
 
+        //! Model strings starting with prefix (case insensitive)
+        //! \threadsafe
+        QStringList getModelStringsStartingWith(const QString &prefix, int maxNumber = -1) const;
+
         //! Model for key if any
         //! \threadsafe
         BlackMisc::Simulation::CAircraftModel getModelForDbKey(int dbKey) const;
@@ -31,32 +31,30 @@ namespace BlackGui::Models
     CAircraftIcaoCodeList CAircraftIcaoFilter::filter(const CAircraftIcaoCodeList &inContainer) const
     {
         if (!this->isValid()) { return inContainer; }
-        CAircraftIcaoCodeList outContainer;
-        const bool filterCombinedCode = !m_combinedType.isEmpty() && !m_combinedType.contains('-') && CAircraftIcaoCode::isValidCombinedType(m_combinedType);
-
-        for (const CAircraftIcaoCode &icao : inContainer)
+        if (m_id >= 0)
         {
-            if (m_id >= 0)
+            // search only for id
+            for (const CAircraftIcaoCode &icao : inContainer)
             {
-                // search only for id
-                if (icao.isLoadedFromDb() && icao.getDbKey() == m_id)
-                {
-                    outContainer.push_back(icao);
-                    break;
-                }
-                continue;
+                if (icao.isLoadedFromDb() && icao.getDbKey() == m_id) { return CAircraftIcaoCodeList({ icao }); }
             }
+            return {};
+        }
+
+        const bool filterCombinedCode = !m_combinedType.isEmpty() && !m_combinedType.contains('-') && CAircraftIcaoCode::isValidCombinedType(m_combinedType);
+        return this->filterByPredicate(inContainer, [this, filterCombinedCode](const CAircraftIcaoCode &icao)
+        {
             if (!m_designator.isEmpty())
             {
-                if (!this->stringMatchesFilterExpression(icao.getDesignator(), m_designator)) { continue; }
+                if (!this->stringMatchesFilterExpression(icao.getDesignator(), m_designator)) { return false; }
             }
             if (!m_family.isEmpty())
             {
-                if (!this->stringMatchesFilterExpression(icao.getFamily(), m_family)) { continue; }
+                if (!this->stringMatchesFilterExpression(icao.getFamily(), m_family)) { return false; }
             }
             if (!m_manufacturer.isEmpty())
             {
-                if (!this->stringMatchesFilterExpression(icao.getManufacturer(), m_manufacturer)) { continue; }
+                if (!this->stringMatchesFilterExpression(icao.getManufacturer(), m_manufacturer)) { return false; }
             }
             if (!m_description.isEmpty())
             {
@@ -64,14 +62,24 @@ namespace BlackGui::Models
                     !this->stringMatchesFilterExpression(icao.getModelDescription(), m_description) &&
                     !this->stringMatchesFilterExpression(icao.getModelSwiftDescription(), m_description) &&
                     !this->stringMatchesFilterExpression(icao.getModelIataDescription(), m_description);
-                if (ignore) { continue; }
+                if (ignore) { return false; }
             }
             if (filterCombinedCode)
             {
-                if (icao.getCombinedType() != m_combinedType) { continue; }
+                if (icao.getCombinedType() != m_combinedType) { return false; }
             }
-            outContainer.push_back(icao);
-        }
-        return outContainer;
+            return true;
+        });
+    }
+
+    bool CAircraftIcaoFilter::isRefinementOf(const IModelFilter<CAircraftIcaoCodeList> &other) const
+    {
+        const CAircraftIcaoFilter *previous = dynamic_cast<const CAircraftIcaoFilter *>(&other);
+        if (!previous || !previous->isValid()) { return false; }
+        if (m_id != previous->m_id || m_combinedType != previous->m_combinedType) { return false; }
+        return isRefinedFilterExpression(m_designator, previous->m_designator) &&
+               isRefinedFilterExpression(m_family, previous->m_family) &&
+               isRefinedFilterExpression(m_manufacturer, previous->m_manufacturer) &&
+               isRefinedFilterExpression(m_description, previous->m_description);
     }
 } // namespace
@@ -35,6 +35,9 @@ namespace BlackGui::Models
         //! \copydoc IModelFilter::filter
         virtual BlackMisc::Aviation::CAircraftIcaoCodeList filter(const BlackMisc::Aviation::CAircraftIcaoCodeList &inContainer) const override;
 
+        //! \copydoc IModelFilter::isRefinementOf
+        virtual bool isRefinementOf(const IModelFilter<BlackMisc::Aviation::CAircraftIcaoCodeList> &other) const override;
+
     private:
         int m_id = -1;
         QString m_designator;
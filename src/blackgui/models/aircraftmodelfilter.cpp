@@ -42,116 +42,133 @@ namespace BlackGui::Models
     CAircraftModelList CAircraftModelFilter::filter(const CAircraftModelList &inContainer) const
     {
         if (!this->isEnabled()) { return inContainer; }
-        CAircraftModelList outContainer;
-        for (const CAircraftModel &model : inContainer)
+        if (m_id >= 0)
         {
-            if (m_id >= 0)
+            // search only for id
+            for (const CAircraftModel &model : inContainer)
             {
-                // search only for id
-                if (model.isLoadedFromDb() && model.getDbKey() == m_id)
-                {
-                    outContainer.push_back(model);
-                    break;
-                }
-                continue;
+                if (model.isLoadedFromDb() && model.getDbKey() == m_id) { return CAircraftModelList({ model }); }
             }
+            return {};
+        }
+        return this->filterByPredicate(inContainer, [this](const CAircraftModel &model) { return this->matches(model); });
+    }
 
-            if (!m_simulatorInfo.isAllSimulators())
-            {
-                if (!m_simulatorInfo.matchesAny(model.getSimulator())) { continue; }
-            }
+    bool CAircraftModelFilter::matches(const CAircraftModel &model) const
+    {
+        if (!m_simulatorInfo.isAllSimulators())
+        {
+            if (!m_simulatorInfo.matchesAny(model.getSimulator())) { return false; }
+        }
 
-            if (!m_modelKey.isEmpty())
-            {
-                if (!this->stringMatchesFilterExpression(model.getModelString(), m_modelKey)) { continue; }
-            }
+        if (!m_modelKey.isEmpty())
+        {
+            if (!this->stringMatchesFilterExpression(model.getModelString(), m_modelKey)) { return false; }
+        }
 
-            if (m_military != Qt::PartiallyChecked)
+        if (m_military != Qt::PartiallyChecked)
+        {
+            if (m_military == Qt::Checked)
             {
-                if (m_military == Qt::Checked)
-                {
-                    // military only
-                    if (!model.isMilitary()) { continue; }
-                }
-                else if (m_military == Qt::Unchecked)
-                {
-                    // civilian only
-                    if (model.isMilitary()) { continue; }
-                }
+                // military only
+                if (!model.isMilitary()) { return false; }
             }
-
-            if (m_colorLiveries != Qt::PartiallyChecked)
+            else if (m_military == Qt::Unchecked)
             {
-                if (m_colorLiveries == Qt::Checked)
-                {
-                    // only color liveries
-                    if (!model.getLivery().isColorLivery()) { continue; }
-                }
-                else if (m_colorLiveries == Qt::Unchecked)
-                {
-                    // Only airline liveries
-                    if (model.getLivery().isColorLivery()) { continue; }
-                }
+                // civilian only
+                if (model.isMilitary()) { return false; }
             }
+        }
 
-            if (!m_description.isEmpty())
+        if (m_colorLiveries != Qt::PartiallyChecked)
+        {
+            if (m_colorLiveries == Qt::Checked)
             {
-                if (!this->stringMatchesFilterExpression(model.getDescription(), m_description)) { continue; }
+                // only color liveries
+                if (!model.getLivery().isColorLivery()) { return false; }
             }
-
-            if (m_modelMode != CAircraftModel::All && m_modelMode != CAircraftModel::Undefined)
+            else if (m_colorLiveries == Qt::Unchecked)
             {
-                if (!model.matchesMode(m_modelMode)) { continue; }
+                // Only airline liveries
+                if (model.getLivery().isColorLivery()) { return false; }
             }
+        }
 
-            if (m_dbKeyFilter != BlackMisc::Db::All && m_dbKeyFilter != BlackMisc::Db::Undefined)
-            {
-                if (!model.matchesDbKeyState(m_dbKeyFilter)) { continue; }
-            }
+        if (!m_description.isEmpty())
+        {
+            if (!this->stringMatchesFilterExpression(model.getDescription(), m_description)) { return false; }
+        }
 
-            if (!m_fileName.isEmpty())
-            {
-                if (!this->stringMatchesFilterExpression(model.getFileName(), m_fileName)) { continue; }
-            }
+        if (m_modelMode != CAircraftModel::All && m_modelMode != CAircraftModel::Undefined)
+        {
+            if (!model.matchesMode(m_modelMode)) { return false; }
+        }
 
-            if (!m_aircraftIcao.isEmpty())
-            {
-                if (!this->stringMatchesFilterExpression(model.getAircraftIcaoCodeDesignator(), m_aircraftIcao)) { continue; }
-            }
+        if (m_dbKeyFilter != BlackMisc::Db::All && m_dbKeyFilter != BlackMisc::Db::Undefined)
+        {
+            if (!model.matchesDbKeyState(m_dbKeyFilter)) { return false; }
+        }
 
-            if (!m_aircraftManufacturer.isEmpty())
-            {
-                if (!this->stringMatchesFilterExpression(model.getAircraftIcaoCode().getManufacturer(), m_aircraftManufacturer)) { continue; }
-            }
+        if (!m_fileName.isEmpty())
+        {
+            if (!this->stringMatchesFilterExpression(model.getFileName(), m_fileName)) { return false; }
+        }
 
-            if (!m_airlineIcao.isEmpty())
-            {
-                if (!this->stringMatchesFilterExpression(model.getAirlineIcaoCodeDesignator(), m_airlineIcao)) { continue; }
-            }
+        if (!m_aircraftIcao.isEmpty())
+        {
+            if (!this->stringMatchesFilterExpression(model.getAircraftIcaoCodeDesignator(), m_aircraftIcao)) { return false; }
+        }
 
-            if (!m_airlineName.isEmpty())
-            {
-                if (!this->stringMatchesFilterExpression(model.getAirlineIcaoCode().getName(), m_airlineName)) { continue; }
-            }
+        if (!m_aircraftManufacturer.isEmpty())
+        {
+            if (!this->stringMatchesFilterExpression(model.getAircraftIcaoCode().getManufacturer(), m_aircraftManufacturer)) { return false; }
+        }
 
-            if (!m_liveryCode.isEmpty())
-            {
-                if (!this->stringMatchesFilterExpression(model.getLivery().getCombinedCode(), m_liveryCode)) { continue; }
-            }
+        if (!m_airlineIcao.isEmpty())
+        {
+            if (!this->stringMatchesFilterExpression(model.getAirlineIcaoCodeDesignator(), m_airlineIcao)) { return false; }
+        }
 
-            if (m_distributor.hasValidDbKey())
-            {
-                if (!model.getDistributor().matchesKeyOrAlias(m_distributor)) { continue; }
-            }
+        if (!m_airlineName.isEmpty())
+        {
+            if (!this->stringMatchesFilterExpression(model.getAirlineIcaoCode().getName(), m_airlineName)) { return false; }
+        }
 
-            if (!m_combinedType.isEmpty())
-            {
-                if (!model.getAircraftIcaoCode().matchesCombinedType(m_combinedType)) { continue; }
-            }
+        if (!m_liveryCode.isEmpty())
+        {
+            if (!this->stringMatchesFilterExpression(model.getLivery().getCombinedCode(), m_liveryCode)) { return false; }
+        }
 
-            outContainer.push_back(model);
+        if (m_distributor.hasValidDbKey())
+        {
+            if (!model.getDistributor().matchesKeyOrAlias(m_distributor)) { return false; }
         }
-        return outContainer;
+
+        if (!m_combinedType.isEmpty())
+        {
+            if (!model.getAircraftIcaoCode().matchesCombinedType(m_combinedType)) { return false; }
+        }
+
+        return true;
+    }
+
+    bool CAircraftModelFilter::isRefinementOf(const IModelFilter<CAircraftModelList> &other) const
+    {
+        const CAircraftModelFilter *previous = dynamic_cast<const CAircraftModelFilter *>(&other);
+        if (!previous || !previous->isEnabled()) { return false; }
+        if (m_id != previous->m_id || m_modelMode != previous->m_modelMode || m_dbKeyFilter != previous->m_dbKeyFilter ||
+                m_military != previous->m_military || m_colorLiveries != previous->m_colorLiveries ||
+                m_combinedType != previous->m_combinedType || m_simulatorInfo != previous->m_simulatorInfo ||
+                m_distributor != previous->m_distributor) { return false; }
+
+        return isRefinedFilterExpression(m_modelKey, previous->m_modelKey) &&
+               isRefinedFilterExpression(m_description, previous->m_description) &&
+               isRefinedFilterExpression(m_fileName, previous->m_fileName) &&
+               isRefinedFilterExpression(m_aircraftIcao, previous->m_aircraftIcao) &&
+               isRefinedFilterExpression(m_aircraftManufacturer, previous->m_aircraftManufacturer) &&
+               isRefinedFilterExpression(m_airlineIcao, previous->m_airlineIcao) &&
+               isRefinedFilterExpression(m_airlineName, previous->m_airlineName) &&
+               isRefinedFilterExpression(m_liveryCode, previous->m_liveryCode);
     }
 
     bool CAircraftModelFilter::valid() const
@@ -44,7 +44,14 @@ namespace BlackGui::Models
         //! \copydoc IModelFilter::filter
         virtual BlackMisc::Simulation::CAircraftModelList filter(const BlackMisc::Simulation::CAircraftModelList &inContainer) const override;
 
+        //! \copydoc IModelFilter::isRefinementOf
+        virtual bool isRefinementOf(const IModelFilter<BlackMisc::Simulation::CAircraftModelList> &other) const override;
+
     private:
+        //! Model matches this filter, the id is not checked
+        //! \threadsafe
+        bool matches(const BlackMisc::Simulation::CAircraftModel &model) const;
+
         int m_id = -1;
         QString m_modelKey;
         QString m_description;
@@ -11,6 +11,7 @@
 
 #include "blackgui/models/listmodelbase.h"
 #include "blackgui/models/allmodelcontainers.h"
+#include "blackgui/models/modelsortkey.h"
 #include "blackgui/guiutility.h"
 #include "blackmisc/variant.h"
 #include "blackmisc/worker.h"
@@ -260,7 +261,8 @@ namespace BlackGui::Models
     void CListModelBase<T, UseCompare>::removeFilter()
     {
         if (!this->hasFilter()) { return; }
-        m_filter.reset(nullptr);
+        m_filter->cancel(); // stops a running filter task
+        m_filter.reset();
         this->beginResetModel();
         this->updateFilteredContainer();
         this->endResetModel();
@@ -283,9 +285,26 @@ namespace BlackGui::Models
         }
         if (filter->isValid())
         {
+            // a refined filter only needs to check the objects the current filter kept
+            const bool refine = this->hasFilter() && !m_filterPending && filter->isRefinementOf(*m_filter);
+            if (m_filter) { m_filter->cancel(); } // stops a running filter task
             m_filter = std::move(filter);
+            if (m_container.size() >= IModelFilter<ContainerType>::ParallelFilterThreshold)
+            {
+                this->updateFilteredContainerAsync(refine, selection);
+                return;
+            }
+
             this->beginResetModel();
-            this->updateFilteredContainer();
+            if (refine)
+            {
+                m_filterGeneration++;
+                m_containerFiltered = m_filter->filter(m_containerFiltered);
+            }
+            else
+            {
+                this->updateFilteredContainer();
+            }
             this->endResetModel();
             this->emitModelDataChanged();
         }
@@ -438,6 +457,8 @@ namespace BlackGui::Models
         beginResetModel();
         m_container.clear();
         m_containerFiltered.clear();
+        m_filterGeneration++; // drop results of running filter tasks
+        m_filterPending = false;
         endResetModel();
         this->emitModelDataChanged();
     }
@@ -451,6 +472,8 @@ namespace BlackGui::Models
     template <typename T, bool UseCompare>
     void CListModelBase<T, UseCompare>::updateFilteredContainer()
     {
+        m_filterGeneration++; // results of running filter tasks are outdated now
+        m_filterPending = false;
         if (this->hasFilter())
         {
             m_containerFiltered = m_filter->filter(m_container);
@@ -461,6 +484,32 @@ namespace BlackGui::Models
         }
     }
 
+    template <typename T, bool UseCompare>
+    void CListModelBase<T, UseCompare>::updateFilteredContainerAsync(bool refine, const ContainerType &selection)
+    {
+        if (m_modelDestroyed || !this->hasFilter()) { return; }
+        const quint64 generation = ++m_filterGeneration;
+        m_filterPending = true;
+
+        const std::shared_ptr<const IModelFilter<ContainerType>> filter = m_filter;
+        const ContainerType container = refine ? m_containerFiltered : m_container;
+        CWorker *worker = CWorker::fromTask(this, "ModelFilter", [filter, container]()
+        {
+            return filter->filter(container);
+        });
+        worker->thenWithResult<ContainerType>(this, [this, generation, filter, selection](const ContainerType & filtered)
+        {
+            // a newer filter or container is used, or the filter was cancelled and the result is incomplete
+            if (m_modelDestroyed || generation != m_filterGeneration || filter->isCancelled()) { return; }
+            m_filterPending = false;
+            this->beginResetModel();
+            m_containerFiltered = filtered;
+            this->endResetModel();
+            this->emitModelDataChanged();
+            if (m_selectionModel && !selection.isEmpty()) { m_selectionModel->selectObjects(selection); }
+        });
+    }
+
     template <typename T, bool UseCompare>
     void CListModelBase<T, UseCompare>::emitModelDataChanged()
     {
@@ -555,15 +604,14 @@ namespace BlackGui::Models
             return container;    // at release build do nothing
         }
 
-        // sort the values
-        const auto tieBreakersCopy = m_sortTieBreakers; //! \todo workaround T579 still not thread-safe, but less likely to crash
-        const std::integral_constant<bool, UseCompare> marker {};
-        const auto p = [ = ](const ObjectType & a, const ObjectType & b) -> bool
-        {
-            return Private::compareForModelSort<ObjectType>(a, b, order, propertyIndex, tieBreakersCopy, marker);
-        };
+        // sort the row indexes, column first, then the tie breakers
+        CPropertyIndexList indexes = m_sortTieBreakers; //! \todo workaround T579 still not thread-safe, but less likely to crash
+        indexes.push_front(propertyIndex);
+        const QVector<int> rows = Private::sortRowsForModel(container, order, indexes, std::integral_constant<bool, UseCompare>());
 
-        return container.sorted(p);
+        ContainerType sorted;
+        for (int row : rows) { sorted.push_back(container[row]); }
+        return sorted;
     }
 
     template <typename T, bool UseCompare>
@@ -176,46 +176,21 @@ namespace BlackGui::Models
         //! Update filtered container
         void updateFilteredContainer();
 
+        //! Filter on a background thread, results of outdated filters or containers are dropped
+        //! \param refine filter the filtered container instead of the whole container
+        //! \param selection objects to be selected again
+        void updateFilteredContainerAsync(bool refine, const ContainerType &selection);
+
         //! Model changed
         void emitModelDataChanged();
 
         ContainerType m_container;         //!< used container
         ContainerType m_containerFiltered; //!< cache for filtered container data
-        std::unique_ptr<IModelFilter<ContainerType> > m_filter;     //!< used filter
+        std::shared_ptr<IModelFilter<ContainerType> > m_filter;     //!< used filter, shared with a running filter task
+        quint64 m_filterGeneration = 0;    //!< incremented whenever the filtered container is updated, detects outdated filter tasks
+        bool m_filterPending = false;      //!< a filter task is running, the filtered container does not match the filter yet
         ISelectionModel<ContainerType> *m_selectionModel = nullptr; //!< selection model
     };
-
-    namespace Private
-    {
-        //! Sort with compare function
-        template<class ObjectType>
-        bool compareForModelSort(const ObjectType &a, const ObjectType &b, Qt::SortOrder order, const BlackMisc::CPropertyIndex &index, const BlackMisc::CPropertyIndexList &tieBreakers, std::true_type)
-        {
-            const int c = a.comparePropertyByIndex(index, b);
-            if (c == 0)
-            {
-                if (!tieBreakers.isEmpty())
-                {
-                    return compareForModelSort<ObjectType>(a, b, order, tieBreakers.front(), tieBreakers.copyFrontRemoved(), std::true_type());
-                }
-                return false;
-            }
-            return (order == Qt::AscendingOrder) ? (c < 0) : (c > 0);
-        }
-
-        //! Sort without compare function
-        template <typename ObjectType>
-        bool compareForModelSort(const ObjectType &a, const ObjectType &b, Qt::SortOrder order, const BlackMisc::CPropertyIndex &index, const BlackMisc::CPropertyIndexList &tieBreakers, std::false_type)
-        {
-            const BlackMisc::CVariant aQv = a.propertyByIndex(index);
-            const BlackMisc::CVariant bQv = b.propertyByIndex(index);
-            if (!tieBreakers.isEmpty() && aQv == bQv)
-            {
-                return compareForModelSort<ObjectType>(a, b, order, tieBreakers.front(), tieBreakers.copyFrontRemoved(), std::false_type());
-            }
-            return (order == Qt::AscendingOrder) ? (aQv < bQv) : (bQv < aQv);
-        }
-    } // namespace
 } // namespace
 
 #endif // guard
@@ -63,6 +63,34 @@ namespace BlackGui::Models
         return false;
     }
 
+    template<class ContainerType>
+    bool IModelFilter<ContainerType>::isRefinedFilterExpression(const QString &filter, const QString &previousFilter)
+    {
+        const QString f = filter.trimmed();
+        const QString p = previousFilter.trimmed();
+        if (p.isEmpty() || f == p) { return true; }
+        if (f.isEmpty()) { return false; }
+
+        // same forms as in stringMatchesFilterExpression, a wildcard in the middle is never refined
+        const auto isMiddleWildcard = [](const QString &e)
+        {
+            return e.length() > 2 && e.mid(1, e.length() - 2).contains('*');
+        };
+        if (isMiddleWildcard(f) || isMiddleWildcard(p)) { return false; }
+
+        const QString fNoWildcard = QString(f).remove('*');
+        const QString pNoWildcard = QString(p).remove('*');
+        const bool fStartsWith = !f.startsWith('*') && f.endsWith('*');
+        const bool fEndsWith = f.startsWith('*') && !f.endsWith('*');
+        const bool fExact = !f.contains('*');
+
+        // matched values contain the filter without wildcards in all forms
+        if (p.startsWith('*') && p.endsWith('*')) { return fNoWildcard.contains(pNoWildcard); }
+        if (p.endsWith('*')) { return (fExact || fStartsWith) && fNoWildcard.startsWith(pNoWildcard); }
+        if (p.startsWith('*')) { return (fExact || fEndsWith) && fNoWildcard.endsWith(pNoWildcard); }
+        return false; // exact match of a different value
+    }
+
     template<class ContainerType>
     QString IModelFilter<ContainerType>::stripWildcard(const QString &value) const
     {
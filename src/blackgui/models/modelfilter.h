@@ -27,11 +27,15 @@
 #include "blackmisc/simulation/distributorlist.h"
 #include "blackmisc/simulation/simulatedaircraftlist.h"
 #include "blackmisc/statusmessagelist.h"
+#include "blackmisc/threadutils.h"
 #include "blackmisc/variant.h"
 
 #include <QString>
+#include <QVector>
 #include <Qt>
+#include <atomic>
 #include <memory>
+#include <vector>
 
 namespace BlackGui::Models
 {
@@ -60,6 +64,25 @@ namespace BlackGui::Models
         //! Return an implementation-specific value object representing the filter
         virtual BlackMisc::CVariant getAsValueObject() const { return {}; }
 
+        //! Does this filter only remove objects which the other filter keeps?
+        //! Then the result of the other filter can be filtered instead of the whole container.
+        virtual bool isRefinementOf(const IModelFilter<ContainerType> &other) const { Q_UNUSED(other) return false; }
+
+        //! Stop filtering, the result of a running or later filter call is incomplete
+        //! \threadsafe
+        void cancel() { m_cancelled = true; }
+
+        //! Cancelled?
+        //! \threadsafe
+        bool isCancelled() const { return m_cancelled; }
+
+        //! Containers with that many objects are filtered on several threads
+        static constexpr int ParallelFilterThreshold = 5000;
+
+        //! Does a wildcard filter expression only match values which the previous expression matches as well?
+        //! \remark e.g. "A32*" refines "A3*", "*BUS*" refines "*BU*", an empty previous expression is refined by all
+        static bool isRefinedFilterExpression(const QString &filter, const QString &previousFilter);
+
     protected:
         //! Standard string search supporting wildcard at begin and end: "*xyz", "abc*"
         bool stringMatchesFilterExpression(const QString &value, const QString &filter, Qt::CaseSensitivity cs = Qt::CaseInsensitive) const;
@@ -67,10 +90,42 @@ namespace BlackGui::Models
         //! Remove the * wildcards
         QString stripWildcard(const QString &value) const;
 
+        //! Objects for which the predicate returns true, in their order.
+        //! Large containers are split into chunks which are filtered in the thread pool.
+        //! \remark the predicate is called concurrently and must only read shared data
+        template <class Predicate>
+        ContainerType filterByPredicate(const ContainerType &container, Predicate p) const
+        {
+            const int size = container.size();
+            const auto filterChunk = [this, &container, &p](int first, int last)
+            {
+                ContainerType found;
+                for (int i = first; i < last; ++i)
+                {
+                    if (i % 1024 == 0 && this->isCancelled()) { break; }
+                    if (p(container[i])) { found.push_back(container[i]); }
+                }
+                return found;
+            };
+
+            if (size < ParallelFilterThreshold) { return filterChunk(0, size); }
+
+            const QVector<int> bounds = BlackMisc::CThreadUtils::chunkBounds(size, ParallelFilterThreshold / 2);
+            std::vector<ContainerType> chunkResults(static_cast<size_t>(bounds.size() - 1));
+            BlackMisc::CThreadUtils::forEachChunk(bounds, [&](int chunk, int first, int last)
+            {
+                chunkResults[static_cast<size_t>(chunk)] = filterChunk(first, last);
+            });
+            ContainerType filtered;
+            for (const ContainerType &chunkResult : chunkResults) { filtered.push_back(chunkResult); }
+            return filtered;
+        }
+
         bool m_valid = false;  //!< is filter valid?
 
     private:
         bool m_enabled = true; //!< is filter enabled?
+        std::atomic_bool m_cancelled { false }; //!< filtering cancelled, a newer filter is used
     };
 
     //! Model filter interface for those who can generate such a filter (e.g. a widget or dialog)
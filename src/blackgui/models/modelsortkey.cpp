@@ -0,0 +1,76 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackgui/models/modelsortkey.h"
+
+using namespace BlackMisc;
+
+namespace BlackGui::Models
+{
+    namespace
+    {
+        //! The hidden friend of CVariant, not visible from within CModelSortKey::compare
+        int compareVariants(const CVariant &a, const CVariant &b)
+        {
+            return compare(a, b);
+        }
+    }
+
+    CModelSortKey::CModelSortKey(const QVariant &value) : m_userType(value.userType())
+    {
+        switch (m_userType)
+        {
+        case QMetaType::Bool:
+        case QMetaType::Char:
+        case QMetaType::SChar:
+        case QMetaType::UChar:
+        case QMetaType::Short:
+        case QMetaType::UShort:
+        case QMetaType::Int:
+        case QMetaType::UInt:
+        case QMetaType::Long:
+        case QMetaType::LongLong:
+            m_kind = Integer;
+            m_integer = value.toLongLong();
+            break;
+        case QMetaType::Float:
+        case QMetaType::Double:
+            m_kind = Floating;
+            m_floating = value.toDouble();
+            break;
+        case QMetaType::QString:
+            m_kind = String;
+            m_string = value.toString();
+            break;
+        default:
+            // value objects, unsigned 64bit values, date times ...
+            m_kind = Other;
+            m_variant = CVariant(value);
+            break;
+        }
+    }
+
+    int CModelSortKey::compare(const CModelSortKey &other) const
+    {
+        // like CVariant, different types are ordered by type
+        if (m_userType != other.m_userType) { return m_userType < other.m_userType ? -1 : 1; }
+        switch (m_kind)
+        {
+        case Integer: return m_integer < other.m_integer ? -1 : (m_integer > other.m_integer ? 1 : 0);
+        case Floating: return m_floating < other.m_floating ? -1 : (m_floating > other.m_floating ? 1 : 0);
+        case String:
+            {
+                // natural order for the user, case only decides between otherwise equal strings
+                const int c = m_string.compare(other.m_string, Qt::CaseInsensitive);
+                return c != 0 ? c : m_string.compare(other.m_string);
+            }
+        case Other: break;
+        }
+        return compareVariants(m_variant, other.m_variant);
+    }
+} // namespace
@@ -0,0 +1,147 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKGUI_MODELS_MODELSORTKEY_H
+#define BLACKGUI_MODELS_MODELSORTKEY_H
+
+#include "blackgui/blackguiexport.h"
+#include "blackmisc/propertyindexlist.h"
+#include "blackmisc/threadutils.h"
+#include "blackmisc/variant.h"
+
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <algorithm>
+#include <numeric>
+
+namespace BlackGui::Models
+{
+    /*!
+     * Value of one property of one row, extracted once before sorting.
+     * Numbers and strings are compared as such, all other values as CVariant.
+     * The order is the same as comparing the CVariants of the property values.
+     */
+    class BLACKGUI_EXPORT CModelSortKey
+    {
+    public:
+        //! Default constructor
+        CModelSortKey() {}
+
+        //! Key of a property value
+        explicit CModelSortKey(const QVariant &value);
+
+        //! Compare, <0 if this is smaller
+        int compare(const CModelSortKey &other) const;
+
+    private:
+        //! How the key is compared
+        enum Kind
+        {
+            Integer,
+            Floating,
+            String,
+            Other
+        };
+
+        int m_userType = QMetaType::UnknownType;
+        Kind m_kind = Other;
+        qint64 m_integer = 0;
+        double m_floating = 0.0;
+        QString m_string;
+        BlackMisc::CVariant m_variant;
+    };
+
+    namespace Private
+    {
+        //! Rows from which on the row indices are sorted by several threads
+        constexpr int ParallelSortThreshold = 10000;
+
+        //! Row indices 0..size-1 sorted by cmp.
+        //! Large ranges are split into chunks which are sorted in the thread pool and merged afterwards.
+        //! \remark cmp is called concurrently and must only read shared data
+        template <class Cmp>
+        QVector<int> sortRows(int size, Cmp cmp)
+        {
+            QVector<int> rows(size);
+            std::iota(rows.begin(), rows.end(), 0);
+            if (size < ParallelSortThreshold)
+            {
+                std::sort(rows.begin(), rows.end(), cmp);
+                return rows;
+            }
+
+            const QVector<int> bounds = BlackMisc::CThreadUtils::chunkBounds(size, ParallelSortThreshold / 2);
+            const int chunks = bounds.size() - 1;
+            int *data = rows.data(); // detach once, not in the threads
+            BlackMisc::CThreadUtils::forEachChunk(bounds, [data, &cmp](int, int first, int last)
+            {
+                std::sort(data + first, data + last, cmp);
+            });
+
+            // merge neighbouring chunks until one is left
+            for (int width = 1; width < chunks; width *= 2)
+            {
+                for (int c = 0; c + width < chunks; c += 2 * width)
+                {
+                    const int last = bounds[std::min(c + 2 * width, chunks)];
+                    std::inplace_merge(data + bounds[c], data + bounds[c + width], data + last, cmp);
+                }
+            }
+            return rows;
+        }
+
+        //! Row order of a container sorted by the given property indexes, the first index is the column,
+        //! the others are the tie breakers. Objects compare themselves via comparePropertyByIndex.
+        template <class ContainerType>
+        QVector<int> sortRowsForModel(const ContainerType &container, Qt::SortOrder order, const BlackMisc::CPropertyIndexList &indexes, std::true_type)
+        {
+            const bool ascending = order == Qt::AscendingOrder;
+            return sortRows(container.size(), [&](int a, int b)
+            {
+                for (const BlackMisc::CPropertyIndex &index : indexes)
+                {
+                    const int c = container[a].comparePropertyByIndex(index, container[b]);
+                    if (c != 0) { return ascending ? c < 0 : c > 0; }
+                }
+                return a < b; // keeps equal rows in their order
+            });
+        }
+
+        //! Row order of a container sorted by the given property indexes, the first index is the column,
+        //! the others are the tie breakers. The property values are extracted once per row.
+        template <class ContainerType>
+        QVector<int> sortRowsForModel(const ContainerType &container, Qt::SortOrder order, const BlackMisc::CPropertyIndexList &indexes, std::false_type)
+        {
+            const int size = container.size();
+            const int keysPerRow = indexes.size();
+            QVector<CModelSortKey> keys;
+            keys.reserve(size * keysPerRow);
+            for (const auto &object : container)
+            {
+                for (const BlackMisc::CPropertyIndex &index : indexes) { keys.push_back(CModelSortKey(object.propertyByIndex(index))); }
+            }
+
+            const bool ascending = order == Qt::AscendingOrder;
+            const QVector<CModelSortKey> &constKeys = keys; // no detach checks in the sorting threads
+            return sortRows(size, [&](int a, int b)
+            {
+                for (int k = 0; k < keysPerRow; ++k)
+                {
+                    const int c = constKeys[a * keysPerRow + k].compare(constKeys[b * keysPerRow + k]);
+                    if (c != 0) { return ascending ? c < 0 : c > 0; }
+                }
+                return a < b; // keeps equal rows in their order
+            });
+        }
+    } // namespace
+} // namespace
+
+#endif // guard
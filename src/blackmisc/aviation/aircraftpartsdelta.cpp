@@ -0,0 +1,294 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/aviation/aircraftpartsdelta.h"
+#include "blackmisc/aviation/aircraftengine.h"
+#include "blackmisc/aviation/aircraftenginelist.h"
+#include "blackmisc/aviation/aircraftlights.h"
+#include "blackmisc/json.h"
+
+#include <QJsonValue>
+#include <QLatin1String>
+#include <array>
+
+namespace BlackMisc::Aviation
+{
+    namespace
+    {
+        //! Attribute names as in the JSON of CAircraftParts and CAircraftLights
+        //! @{
+        constexpr QLatin1String gearDownName("gear_down");
+        constexpr QLatin1String flapsName("flaps_pct");
+        constexpr QLatin1String spoilersName("spoilers_out");
+        constexpr QLatin1String onGroundName("on_ground");
+        constexpr QLatin1String lightsName("lights");
+        constexpr QLatin1String enginesName("engines");
+        constexpr QLatin1String engineOnName("on");
+        //! @}
+
+        //! Light flag and JSON name
+        struct LightName
+        {
+            CAircraftPartsDelta::Light light;
+            QLatin1String name;
+        };
+
+        //! All lights transmitted
+        constexpr std::array<LightName, 6> lightNames
+        {{
+            { CAircraftPartsDelta::StrobeLight,  QLatin1String("strobe_on") },
+            { CAircraftPartsDelta::LandingLight, QLatin1String("landing_on") },
+            { CAircraftPartsDelta::TaxiLight,    QLatin1String("taxi_on") },
+            { CAircraftPartsDelta::BeaconLight,  QLatin1String("beacon_on") },
+            { CAircraftPartsDelta::NavLight,     QLatin1String("nav_on") },
+            { CAircraftPartsDelta::LogoLight,    QLatin1String("logo_on") }
+        }};
+
+        //! Light on?
+        bool isLightOn(const CAircraftLights &lights, CAircraftPartsDelta::Light light)
+        {
+            switch (light)
+            {
+            case CAircraftPartsDelta::StrobeLight:  return lights.isStrobeOn();
+            case CAircraftPartsDelta::LandingLight: return lights.isLandingOn();
+            case CAircraftPartsDelta::TaxiLight:    return lights.isTaxiOn();
+            case CAircraftPartsDelta::BeaconLight:  return lights.isBeaconOn();
+            case CAircraftPartsDelta::NavLight:     return lights.isNavOn();
+            case CAircraftPartsDelta::LogoLight:    return lights.isLogoOn();
+            default: break;
+            }
+            return false;
+        }
+
+        //! Set light
+        void setLightOn(CAircraftLights &lights, CAircraftPartsDelta::Light light, bool on)
+        {
+            switch (light)
+            {
+            case CAircraftPartsDelta::StrobeLight:  lights.setStrobeOn(on); break;
+            case CAircraftPartsDelta::LandingLight: lights.setLandingOn(on); break;
+            case CAircraftPartsDelta::TaxiLight:    lights.setTaxiOn(on); break;
+            case CAircraftPartsDelta::BeaconLight:  lights.setBeaconOn(on); break;
+            case CAircraftPartsDelta::NavLight:     lights.setNavOn(on); break;
+            case CAircraftPartsDelta::LogoLight:    lights.setLogoOn(on); break;
+            default: break;
+            }
+        }
+
+        //! Is a known light name?
+        bool isLightName(const QString &name)
+        {
+            for (const LightName &ln : lightNames) { if (name == ln.name) { return true; } }
+            return false;
+        }
+
+        //! Is a known top level name?
+        bool isPartsName(const QString &name)
+        {
+            return name == gearDownName || name == flapsName || name == spoilersName || name == onGroundName ||
+                   name == lightsName || name == enginesName || name == CAircraftParts::attributeNameIsFullJson();
+        }
+    }
+
+    CAircraftPartsDelta CAircraftPartsDelta::fromJson(const QJsonObject &config)
+    {
+        // lookups by QLatin1String, keys only iterated if there are unknown attributes
+        CAircraftPartsDelta delta;
+        delta.m_attributesCount = config.size();
+        int known = 0;
+
+        const QJsonValue isFull = config.value(CAircraftParts::attributeNameIsFullJson());
+        if (!isFull.isUndefined()) { delta.m_isFull = isFull.toBool(); known++; }
+
+        const QJsonValue gearDown = config.value(gearDownName);
+        if (!gearDown.isUndefined()) { delta.m_gearDown = gearDown.toBool(); delta.m_attributes |= GearDown; known++; }
+
+        const QJsonValue flaps = config.value(flapsName);
+        if (!flaps.isUndefined()) { delta.m_flapsPercent = flaps.toInt(); delta.m_attributes |= FlapsPercent; known++; }
+
+        const QJsonValue spoilers = config.value(spoilersName);
+        if (!spoilers.isUndefined()) { delta.m_spoilersOut = spoilers.toBool(); delta.m_attributes |= SpoilersOut; known++; }
+
+        const QJsonValue onGround = config.value(onGroundName);
+        if (!onGround.isUndefined()) { delta.m_onGround = onGround.toBool(); delta.m_attributes |= OnGround; known++; }
+
+        const QJsonValue lightsValue = config.value(lightsName);
+        if (!lightsValue.isUndefined())
+        {
+            known++;
+            const QJsonObject lights = lightsValue.toObject();
+            int knownLights = 0;
+            for (const LightName &ln : lightNames)
+            {
+                const QJsonValue on = lights.value(ln.name);
+                if (on.isUndefined()) { continue; }
+                delta.m_lights |= ln.light;
+                if (on.toBool()) { delta.m_lightsOn |= ln.light; }
+                knownLights++;
+            }
+            if (delta.m_lights != NoLight) { delta.m_attributes |= Lights; }
+            if (knownLights < lights.size())
+            {
+                QJsonObject unknownLights;
+                for (auto it = lights.begin(); it != lights.end(); ++it)
+                {
+                    if (!isLightName(it.key())) { unknownLights.insert(it.key(), it.value()); }
+                }
+                delta.m_unknownAttributes.insert(lightsName, unknownLights);
+            }
+        }
+
+        const QJsonValue enginesValue = config.value(enginesName);
+        if (!enginesValue.isUndefined())
+        {
+            known++;
+            const QJsonObject engines = enginesValue.toObject();
+            QJsonObject unknownEngines;
+            for (auto it = engines.begin(); it != engines.end(); ++it)
+            {
+                bool ok = false;
+                const int number = it.key().toInt(&ok);
+                const QJsonValue on = it.value().toObject().value(engineOnName);
+                if (!ok || number < 1 || number > MaxEngines || on.isUndefined())
+                {
+                    unknownEngines.insert(it.key(), it.value());
+                    continue;
+                }
+                const quint32 bit = 1u << (number - 1);
+                delta.m_engines |= bit;
+                if (on.toBool()) { delta.m_enginesOn |= bit; }
+            }
+            if (delta.m_engines != 0) { delta.m_attributes |= Engines; }
+            if (!unknownEngines.isEmpty()) { delta.m_unknownAttributes.insert(enginesName, unknownEngines); }
+        }
+
+        if (known < config.size())
+        {
+            for (auto it = config.begin(); it != config.end(); ++it)
+            {
+                if (!isPartsName(it.key())) { delta.m_unknownAttributes.insert(it.key(), it.value()); }
+            }
+        }
+        return delta;
+    }
+
+    CAircraftPartsDelta CAircraftPartsDelta::fromParts(const CAircraftParts &parts, bool isFull)
+    {
+        CAircraftPartsDelta delta;
+        delta.m_isFull = isFull;
+        delta.m_gearDown = parts.isGearDown();
+        delta.m_flapsPercent = parts.getFlapsPercent();
+        delta.m_spoilersOut = parts.isSpoilersOut();
+        delta.m_onGround = parts.isOnGround();
+        delta.m_attributes = GearDown | FlapsPercent | SpoilersOut | OnGround | Lights;
+        delta.m_attributesCount = CAircraftParts::attributesCountFullJson;
+
+        const CAircraftLights lights = parts.getLights();
+        for (const LightName &ln : lightNames)
+        {
+            delta.m_lights |= ln.light;
+            if (isLightOn(lights, ln.light)) { delta.m_lightsOn |= ln.light; }
+        }
+
+        QJsonObject unknownEngines;
+        for (const CAircraftEngine &engine : parts.getEngines())
+        {
+            const int number = engine.getNumber();
+            if (number < 1 || number > MaxEngines)
+            {
+                unknownEngines.insert(QString::number(number), engine.toJson());
+                continue;
+            }
+            const quint32 bit = 1u << (number - 1);
+            delta.m_engines |= bit;
+            if (engine.isOn()) { delta.m_enginesOn |= bit; }
+        }
+        if (delta.m_engines != 0) { delta.m_attributes |= Engines; }
+        if (!unknownEngines.isEmpty()) { delta.m_unknownAttributes.insert(enginesName, unknownEngines); }
+        return delta;
+    }
+
+    void CAircraftPartsDelta::applyTo(CAircraftParts &parts) const
+    {
+        if (m_attributes & GearDown)     { parts.setGearDown(m_gearDown); }
+        if (m_attributes & FlapsPercent) { parts.setFlapsPercent(m_flapsPercent); }
+        if (m_attributes & SpoilersOut)  { parts.setSpoilersOut(m_spoilersOut); }
+        if (m_attributes & OnGround)     { parts.setOnGround(m_onGround); }
+
+        if (m_attributes & Lights)
+        {
+            CAircraftLights &lights = parts.lights();
+            for (const LightName &ln : lightNames)
+            {
+                if (m_lights & ln.light) { setLightOn(lights, ln.light, m_lightsOn & ln.light); }
+            }
+        }
+
+        if (m_attributes & Engines)
+        {
+            // like merging the JSON objects: contained engines are set, missing engines added
+            CAircraftEngineList &engines = parts.engines();
+            quint32 missing = m_engines;
+            for (CAircraftEngine &engine : engines)
+            {
+                const int number = engine.getNumber();
+                if (number < 1 || number > MaxEngines) { continue; }
+                const quint32 bit = 1u << (number - 1);
+                if (!(missing & bit)) { continue; }
+                engine.setOn(m_enginesOn & bit);
+                missing &= ~bit;
+            }
+            if (missing != 0)
+            {
+                for (int number = 1; number <= MaxEngines; ++number)
+                {
+                    const quint32 bit = 1u << (number - 1);
+                    if (missing & bit) { engines.push_back(CAircraftEngine(number, m_enginesOn & bit)); }
+                }
+                engines.sortBy(&CAircraftEngine::getNumber);
+            }
+        }
+    }
+
+    CAircraftParts CAircraftPartsDelta::toParts(const CAircraftParts &previousParts) const
+    {
+        CAircraftParts parts = m_isFull ? CAircraftParts() : previousParts;
+        this->applyTo(parts);
+        return parts;
+    }
+
+    QJsonObject CAircraftPartsDelta::toJson() const
+    {
+        QJsonObject json;
+        json.insert(CAircraftParts::attributeNameIsFullJson(), m_isFull);
+        if (m_attributes & GearDown)     { json.insert(gearDownName, m_gearDown); }
+        if (m_attributes & FlapsPercent) { json.insert(flapsName, m_flapsPercent); }
+        if (m_attributes & SpoilersOut)  { json.insert(spoilersName, m_spoilersOut); }
+        if (m_attributes & OnGround)     { json.insert(onGroundName, m_onGround); }
+        if (m_attributes & Lights)
+        {
+            QJsonObject lights;
+            for (const LightName &ln : lightNames)
+            {
+                if (m_lights & ln.light) { lights.insert(ln.name, static_cast<bool>(m_lightsOn & ln.light)); }
+            }
+            json.insert(lightsName, lights);
+        }
+        if (m_attributes & Engines)
+        {
+            QJsonObject engines;
+            for (int number = 1; number <= MaxEngines; ++number)
+            {
+                const quint32 bit = 1u << (number - 1);
+                if (m_engines & bit) { engines.insert(QString::number(number), QJsonObject { { engineOnName, static_cast<bool>(m_enginesOn & bit) } }); }
+            }
+            json.insert(enginesName, engines);
+        }
+        return m_unknownAttributes.isEmpty() ? json : Json::applyIncrementalObject(json, m_unknownAttributes);
+    }
+} // namespace
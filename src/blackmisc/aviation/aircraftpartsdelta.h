@@ -0,0 +1,110 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_AVIATION_AIRCRAFTPARTSDELTA_H
+#define BLACKMISC_AVIATION_AIRCRAFTPARTSDELTA_H
+
+#include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QJsonObject>
+#include <QMetaType>
+#include <QString>
+
+namespace BlackMisc::Aviation
+{
+    /*!
+     * Typed form of an FSD aircraft config packet ("config" object), full or incremental.
+     * Only the attributes contained in the packet are set and applied, so incremental packets
+     * can be merged into the latest parts without converting those to JSON.
+     * \remark attributes not known to CAircraftParts are kept as JSON, but not applied
+     */
+    class BLACKMISC_EXPORT CAircraftPartsDelta
+    {
+    public:
+        //! Attributes contained in the packet
+        enum Attribute
+        {
+            NoAttribute  = 0,
+            GearDown     = 1 << 0,
+            FlapsPercent = 1 << 1,
+            SpoilersOut  = 1 << 2,
+            OnGround     = 1 << 3,
+            Lights       = 1 << 4,
+            Engines      = 1 << 5
+        };
+
+        //! Lights contained in the packet
+        enum Light
+        {
+            NoLight      = 0,
+            StrobeLight  = 1 << 0,
+            LandingLight = 1 << 1,
+            TaxiLight    = 1 << 2,
+            BeaconLight  = 1 << 3,
+            NavLight     = 1 << 4,
+            LogoLight    = 1 << 5
+        };
+
+        //! Engines 1..MaxEngines can be set, others are kept as unknown attributes
+        static constexpr int MaxEngines = 32;
+
+        //! Default constructor, empty incremental delta
+        CAircraftPartsDelta() {}
+
+        //! From the "config" object of the packet
+        static CAircraftPartsDelta fromJson(const QJsonObject &config);
+
+        //! All values of the parts, as if sent as full or incremental packet
+        static CAircraftPartsDelta fromParts(const CAircraftParts &parts, bool isFull);
+
+        //! Full data, i.e. not relative to the previous parts?
+        bool isFull() const { return m_isFull; }
+
+        //! Is attribute contained?
+        bool hasAttribute(Attribute attribute) const { return m_attributes & attribute; }
+
+        //! Nothing contained, not even unknown attributes?
+        bool isEmpty() const { return m_attributes == NoAttribute && m_unknownAttributes.isEmpty(); }
+
+        //! Number of top level attributes in the packet, including the full data flag and unknown attributes
+        int getAttributesCount() const { return m_attributesCount; }
+
+        //! Attributes not known to CAircraftParts, JSON of the same structure as the packet
+        const QJsonObject &getUnknownAttributes() const { return m_unknownAttributes; }
+
+        //! Apply the contained attributes to the parts
+        void applyTo(CAircraftParts &parts) const;
+
+        //! Apply to the previous parts, or to default parts if this is full data
+        CAircraftParts toParts(const CAircraftParts &previousParts = {}) const;
+
+        //! As JSON, as received
+        QJsonObject toJson() const;
+
+    private:
+        bool m_isFull = false;
+        bool m_gearDown = false;
+        bool m_spoilersOut = false;
+        bool m_onGround = false;
+        int m_flapsPercent = 0;
+        int m_attributes = NoAttribute;
+        int m_attributesCount = 0;
+        int m_lights = NoLight;   //!< lights contained
+        int m_lightsOn = NoLight; //!< lights on, if contained
+        quint32 m_engines = 0;    //!< bit n-1 for engine n contained
+        quint32 m_enginesOn = 0;  //!< bit n-1 for engine n on, if contained
+        QJsonObject m_unknownAttributes;
+    };
+} // namespace
+
+Q_DECLARE_METATYPE(BlackMisc::Aviation::CAircraftPartsDelta)
+
+#endif // guard
@@ -24,6 +24,7 @@
 #include "blackmisc/pq/angle.h"
 #include "blackmisc/pq/length.h"
 #include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/staticquantity.h"
 #include "blackmisc/pq/time.h"
 #include "blackmisc/propertyindexref.h"
 #include "blackmisc/timestampbased.h"
@@ -432,6 +433,16 @@ namespace BlackMisc
             //! Set ground speed
             void setGroundSpeed(const PhysicalQuantities::CSpeed &groundspeed) { m_groundSpeed = groundspeed; }
 
+            //! Pitch, bank, heading, ground speed and CG normalized to compile time units
+            //! \remark for interpolation, arithmetic on the results needs no runtime unit conversion
+            //! @{
+            PhysicalQuantities::CStaticAngle getPitchStatic() const { return PhysicalQuantities::CStaticAngle(m_pitch); }
+            PhysicalQuantities::CStaticAngle getBankStatic() const { return PhysicalQuantities::CStaticAngle(m_bank); }
+            PhysicalQuantities::CStaticAngle getHeadingStatic() const { return PhysicalQuantities::CStaticAngle(m_heading); }
+            PhysicalQuantities::CStaticSpeed getGroundSpeedStatic() const { return PhysicalQuantities::CStaticSpeed(m_groundSpeed); }
+            PhysicalQuantities::CStaticLength getCGStatic() const { return PhysicalQuantities::CStaticLength(m_cg); }
+            //! @}
+
             //! Is moving? Means ground speed > epsilon
             bool isMoving() const;
 
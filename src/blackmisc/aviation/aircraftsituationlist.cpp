@@ -73,10 +73,10 @@ namespace BlackMisc::Aviation
     int CAircraftSituationList::extrapolateGroundFlag()
     {
         if (this->isEmpty()) { return 0; }
-        CAircraftSituationList withInfo = this->findByInboundGroundInformation(true);
-        withInfo.sortLatestFirst();
-        if (withInfo.isEmpty()) { return 0; }
-        const CAircraftSituation latest = withInfo.front();
+        const auto withInfo = this->filteredView(&CAircraftSituation::hasInboundGroundDetails, true);
+        const auto latestWithInfo = std::max_element(withInfo.begin(), withInfo.end(), [](const CAircraftSituation & a, const CAircraftSituation & b) { return a.getMSecsSinceEpoch() < b.getMSecsSinceEpoch(); });
+        if (latestWithInfo == withInfo.end()) { return 0; }
+        const CAircraftSituation latest = *latestWithInfo; // copy, the situations are modified below
 
         int c = 0;
         for (CAircraftSituation &situation : *this)
@@ -556,8 +556,11 @@ namespace BlackMisc::Aviation
     {
         if (this->size() < minValues) { return CElevationPlane::null(); } // no change to succeed
 
-        const CAircraftSituationList sorted = this->findWithGeodeticMSLHeight().findWithinRange(reference, range).sortedByEuclideanDistanceSquared(reference);
-        if (sorted.size() < minValues) { return CElevationPlane::null(); }
+        const auto inRange = this->filteredView([&](const CAircraftSituation & situation)
+        {
+            return situation.hasMSLGeodeticHeight() && calculateGreatCircleDistance(situation, reference) <= range;
+        });
+        if (inRange.size() < minValues) { return CElevationPlane::null(); }
         QList<double> valuesInFt;
         for (const CAircraftSituation &situation : *this)
         {
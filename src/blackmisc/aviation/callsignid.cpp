@@ -0,0 +1,148 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/aviation/callsignid.h"
+
+#include <QReadWriteLock>
+#include <QVector>
+
+namespace BlackMisc::Aviation
+{
+    namespace
+    {
+        //! Bits of the ID for the slot, the others count the reuses of the slot
+        constexpr int SlotBits = 20;
+        constexpr int SlotMask = (1 << SlotBits) - 1;
+        constexpr int GenerationMask = 0x7ff;
+
+        //! Interned callsign
+        struct CallsignEntry
+        {
+            QString callsign;   //!< normalized callsign string
+            bool used = false;  //!< false if the slot is free
+            int generation = 0; //!< incremented when the slot is freed, so released IDs are not valid for the next callsign
+            int references = 0; //!< containers using the ID
+        };
+
+        //! The process wide table
+        struct CallsignTable
+        {
+            QReadWriteLock lock;
+            QHash<QString, int> ids;         //!< normalized callsign string -> ID
+            QVector<CallsignEntry> entries;  //!< slot -> callsign
+            QVector<int> freeSlots;          //!< slots of released IDs
+
+            //! Entry for a valid ID, otherwise nullptr
+            CallsignEntry *entry(int id)
+            {
+                const int slot = id & SlotMask;
+                if (id < 0 || slot >= entries.size()) { return nullptr; }
+                CallsignEntry &e = entries[slot];
+                return (!e.used || e.generation != (id >> SlotBits)) ? nullptr : &e;
+            }
+
+            //! ID of the callsign string, interned if not yet known
+            //! \pre write locked
+            int intern(const QString &key)
+            {
+                const auto it = ids.constFind(key);
+                if (it != ids.constEnd()) { return it.value(); }
+
+                int slot = entries.size();
+                if (freeSlots.isEmpty()) { entries.push_back(CallsignEntry()); }
+                else { slot = freeSlots.takeLast(); }
+                CallsignEntry &e = entries[slot];
+                e.callsign = key;
+                e.used = true;
+                e.references = 0;
+                const int id = (e.generation << SlotBits) | slot;
+                ids.insert(key, id);
+                return id;
+            }
+        };
+
+        CallsignTable &callsignTable()
+        {
+            static CallsignTable table;
+            return table;
+        }
+    }
+
+    int CCallsignIds::intern(const CCallsign &callsign)
+    {
+        const QString &key = callsign.asString();
+        CallsignTable &table = callsignTable();
+        {
+            QReadLocker l(&table.lock);
+            const auto it = table.ids.constFind(key);
+            if (it != table.ids.constEnd()) { return it.value(); }
+        }
+
+        QWriteLocker l(&table.lock);
+        return table.intern(key); // maybe inserted meanwhile
+    }
+
+    int CCallsignIds::find(const CCallsign &callsign)
+    {
+        CallsignTable &table = callsignTable();
+        QReadLocker l(&table.lock);
+        return table.ids.value(callsign.asString(), InvalidId);
+    }
+
+    CCallsign CCallsignIds::callsign(int id)
+    {
+        CallsignTable &table = callsignTable();
+        QReadLocker l(&table.lock);
+        const CallsignEntry *e = table.entry(id);
+        return e ? CCallsign(e->callsign) : CCallsign();
+    }
+
+    int CCallsignIds::count()
+    {
+        CallsignTable &table = callsignTable();
+        QReadLocker l(&table.lock);
+        return table.ids.size();
+    }
+
+    int CCallsignIds::addReference(const CCallsign &callsign)
+    {
+        CallsignTable &table = callsignTable();
+        QWriteLocker l(&table.lock);
+        const int id = table.intern(callsign.asString());
+        table.entries[id & SlotMask].references++;
+        return id;
+    }
+
+    void CCallsignIds::addReferences(const QList<int> &ids)
+    {
+        CallsignTable &table = callsignTable();
+        QWriteLocker l(&table.lock);
+        for (int id : ids)
+        {
+            CallsignEntry *e = table.entry(id);
+            Q_ASSERT_X(e, Q_FUNC_INFO, "ID not referenced");
+            if (e) { e->references++; }
+        }
+    }
+
+    void CCallsignIds::releaseReferences(const QList<int> &ids)
+    {
+        CallsignTable &table = callsignTable();
+        QWriteLocker l(&table.lock);
+        for (int id : ids)
+        {
+            CallsignEntry *e = table.entry(id);
+            if (!e || --e->references > 0) { continue; }
+            table.ids.remove(e->callsign);
+            e->callsign.clear();
+            e->used = false;
+            e->generation = (e->generation + 1) & GenerationMask;
+            table.freeSlots.push_back(id & SlotMask);
+        }
+    }
+} // namespace
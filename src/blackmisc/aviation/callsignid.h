@@ -0,0 +1,244 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_AVIATION_CALLSIGNID_H
+#define BLACKMISC_AVIATION_CALLSIGNID_H
+
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QHash>
+#include <QList>
+#include <QString>
+
+namespace BlackMisc::Aviation
+{
+    //! Process wide interning table handing out compact integer IDs for callsigns
+    //! \remark Callsigns are case insensitive, only the normalized callsign string is interned
+    //! \remark IDs are reference counted by CCallsignIdHash, an ID is released with its last reference.
+    //!          A released ID is not handed out again for another callsign.
+    class BLACKMISC_EXPORT CCallsignIds
+    {
+    public:
+        //! Invalid ID
+        static constexpr int InvalidId = -1;
+
+        //! ID of the callsign, interns the callsign if not yet known
+        //! \remark an ID interned without reference is kept until referenced and released
+        //! \threadsafe
+        static int intern(const CCallsign &callsign);
+
+        //! ID of an already interned callsign, otherwise CCallsignIds::InvalidId
+        //! \threadsafe
+        static int find(const CCallsign &callsign);
+
+        //! Callsign for ID, empty callsign if unknown or released
+        //! \remark only the callsign string, without telephony designator
+        //! \threadsafe
+        static CCallsign callsign(int id);
+
+        //! Number of interned callsigns
+        //! \threadsafe
+        static int count();
+
+        //! Interns the callsign and adds a reference
+        //! \threadsafe
+        static int addReference(const CCallsign &callsign);
+
+        //! Add a reference to IDs still referenced
+        //! \threadsafe
+        static void addReferences(const QList<int> &ids);
+
+        //! Release references, an ID without references is removed
+        //! \threadsafe
+        //! @{
+        static void releaseReference(int id) { releaseReferences({ id }); }
+        static void releaseReferences(const QList<int> &ids);
+        //! @}
+
+        //! Not instantiable
+        CCallsignIds() = delete;
+    };
+
+    //! Hash container keyed by interned callsign IDs
+    //! \remark Interface like QHash<CCallsign, T>, but hashing and comparing only an int instead of the callsign string.
+    //!         Meant for the per callsign containers touched on every network packet: resolve the ID once by
+    //!         CCallsignIds::find and use the ID based functions for all containers.
+    //! \remark Every contained ID is referenced, so IDs of removed callsigns are released
+    template <class T>
+    class CCallsignIdHash
+    {
+    public:
+        //! Iterators
+        //! @{
+        using iterator = typename QHash<int, T>::iterator;
+        using const_iterator = typename QHash<int, T>::const_iterator;
+        //! @}
+
+        //! Constructor
+        CCallsignIdHash() {}
+
+        //! Copy constructor
+        CCallsignIdHash(const CCallsignIdHash &other) : m_hash(other.m_hash) { CCallsignIds::addReferences(m_hash.keys()); }
+
+        //! Move constructor
+        CCallsignIdHash(CCallsignIdHash &&other) noexcept { m_hash.swap(other.m_hash); }
+
+        //! Copy assignment
+        CCallsignIdHash &operator =(const CCallsignIdHash &other)
+        {
+            if (this == &other) { return *this; }
+            CCallsignIds::addReferences(other.m_hash.keys());
+            this->clear();
+            m_hash = other.m_hash;
+            return *this;
+        }
+
+        //! Move assignment
+        CCallsignIdHash &operator =(CCallsignIdHash &&other) noexcept
+        {
+            if (this == &other) { return *this; }
+            this->clear();
+            m_hash.swap(other.m_hash);
+            return *this;
+        }
+
+        //! Destructor, releases the IDs
+        ~CCallsignIdHash() { this->clear(); }
+
+        //! Value for callsign, inserts a default value if not existing
+        T &operator [](const CCallsign &callsign)
+        {
+            const iterator it = this->find(callsign);
+            return it != m_hash.end() ? *it : *m_hash.insert(CCallsignIds::addReference(callsign), T());
+        }
+
+        //! Value for callsign, default value if not existing
+        const T operator [](const CCallsign &callsign) const { return this->value(callsign); }
+
+        //! Value for callsign or default
+        T value(const CCallsign &callsign, const T &defaultValue = T()) const
+        {
+            const int id = CCallsignIds::find(callsign);
+            return id == CCallsignIds::InvalidId ? defaultValue : m_hash.value(id, defaultValue);
+        }
+
+        //! Value for ID or default
+        T value(int id, const T &defaultValue = T()) const { return m_hash.value(id, defaultValue); }
+
+        //! Value for the ID of the callsign, inserts a default value if not existing
+        //! \param id of the callsign from CCallsignIds::find or CCallsignIds::InvalidId, set if the callsign is interned here
+        //! \param callsign interned and referenced if not yet contained
+        T &valueRef(int &id, const CCallsign &callsign)
+        {
+            if (id != CCallsignIds::InvalidId)
+            {
+                const iterator it = m_hash.find(id);
+                if (it != m_hash.end()) { return *it; }
+            }
+            id = CCallsignIds::addReference(callsign);
+            return *m_hash.insert(id, T());
+        }
+
+        //! Find by ID
+        //! @{
+        iterator find(int id) { return m_hash.find(id); }
+        const_iterator constFind(int id) const { return m_hash.constFind(id); }
+        //! @}
+
+        //! Find by callsign
+        //! @{
+        iterator find(const CCallsign &callsign)
+        {
+            const int id = CCallsignIds::find(callsign);
+            return id == CCallsignIds::InvalidId ? m_hash.end() : m_hash.find(id);
+        }
+        const_iterator constFind(const CCallsign &callsign) const
+        {
+            const int id = CCallsignIds::find(callsign);
+            return id == CCallsignIds::InvalidId ? m_hash.constEnd() : m_hash.constFind(id);
+        }
+        //! @}
+
+        //! Contains callsign?
+        bool contains(const CCallsign &callsign) const
+        {
+            const int id = CCallsignIds::find(callsign);
+            return id != CCallsignIds::InvalidId && m_hash.contains(id);
+        }
+
+        //! Contains ID?
+        bool contains(int id) const { return m_hash.contains(id); }
+
+        //! Insert or replace
+        iterator insert(const CCallsign &callsign, const T &value)
+        {
+            iterator it = this->find(callsign);
+            if (it == m_hash.end()) { return m_hash.insert(CCallsignIds::addReference(callsign), value); }
+            *it = value;
+            return it;
+        }
+
+        //! Remove callsign
+        int remove(const CCallsign &callsign) { return this->remove(CCallsignIds::find(callsign)); }
+
+        //! Remove ID
+        int remove(int id)
+        {
+            if (id == CCallsignIds::InvalidId || m_hash.remove(id) < 1) { return 0; }
+            CCallsignIds::releaseReference(id);
+            return 1;
+        }
+
+        //! All callsigns
+        //! \remark only the callsign strings, without telephony designator
+        QList<CCallsign> keys() const
+        {
+            QList<CCallsign> callsigns;
+            callsigns.reserve(m_hash.size());
+            for (auto it = m_hash.cbegin(); it != m_hash.cend(); ++it) { callsigns.push_back(CCallsignIds::callsign(it.key())); }
+            return callsigns;
+        }
+
+        //! All IDs
+        QList<int> ids() const { return m_hash.keys(); }
+
+        //! All values
+        QList<T> values() const { return m_hash.values(); }
+
+        //! Size and clear
+        //! @{
+        int size() const { return m_hash.size(); }
+        bool isEmpty() const { return m_hash.isEmpty(); }
+        void clear()
+        {
+            if (m_hash.isEmpty()) { return; }
+            CCallsignIds::releaseReferences(m_hash.keys());
+            m_hash.clear();
+        }
+        //! @}
+
+        //! Iterate over the values
+        //! @{
+        iterator begin() { return m_hash.begin(); }
+        iterator end() { return m_hash.end(); }
+        const_iterator begin() const { return m_hash.cbegin(); }
+        const_iterator end() const { return m_hash.cend(); }
+        const_iterator cbegin() const { return m_hash.cbegin(); }
+        const_iterator cend() const { return m_hash.cend(); }
+        const_iterator constEnd() const { return m_hash.constEnd(); }
+        //! @}
+
+    private:
+        QHash<int, T> m_hash;
+    };
+} // namespace
+
+#endif // guard
@@ -0,0 +1,191 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/aviation/icaocodelookup.h"
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+namespace BlackMisc::Aviation
+{
+    namespace
+    {
+        //! Add index to the list for key, only once
+        template <class Key>
+        void addIndex(QHash<Key, QVector<int>> &hash, const Key &key, int index)
+        {
+            QVector<int> &indexes = hash[key];
+            if (indexes.isEmpty() || indexes.constLast() != index) { indexes.push_back(index); }
+        }
+    }
+
+    CIcaoCodeLookup::CIcaoCodeLookup(const CAircraftIcaoCodeList &aircraftIcaos, const CAirlineIcaoCodeList &airlineIcaos) :
+        m_aircraftIcaos(aircraftIcaos), m_airlineIcaos(airlineIcaos)
+    {
+        // aircraft
+        for (int i = 0; i < m_aircraftIcaos.size(); i++)
+        {
+            const CAircraftIcaoCode &code = std::as_const(m_aircraftIcaos)[i];
+            if (code.hasValidDbKey() && !m_aircraftByKey.contains(code.getDbKey())) { m_aircraftByKey.insert(code.getDbKey(), i); }
+            if (code.hasIataCode()) { addIndex(m_aircraftByIata, code.getIataCode(), i); }
+            if (code.hasFamily()) { addIndex(m_aircraftByFamily, code.getFamily(), i); }
+
+            const QString &designator = code.getDesignator();
+            if (designator.isEmpty()) { continue; }
+            addIndex(m_aircraftByDesignator, designator, i);
+
+            const auto best = m_aircraftByDesignatorAndRank.constFind(designator);
+            if (best == m_aircraftByDesignatorAndRank.cend())
+            {
+                m_aircraftByDesignatorAndRank.insert(designator, i);
+            }
+            else
+            {
+                const CAircraftIcaoCode &bestCode = std::as_const(m_aircraftIcaos)[best.value()];
+                if (std::make_tuple(code.getRank(), code.getDbKey()) < std::make_tuple(bestCode.getRank(), bestCode.getDbKey()))
+                {
+                    m_aircraftByDesignatorAndRank.insert(designator, i);
+                }
+            }
+        }
+
+        // airlines
+        for (int i = 0; i < m_airlineIcaos.size(); i++)
+        {
+            const CAirlineIcaoCode &code = std::as_const(m_airlineIcaos)[i];
+            if (code.hasValidDbKey() && !m_airlineByKey.contains(code.getDbKey())) { m_airlineByKey.insert(code.getDbKey(), i); }
+            if (!code.getDesignator().isEmpty())
+            {
+                addIndex(m_airlineByDesignator, code.getDesignator().toUpper(), i);
+                addIndex(m_airlineByVDesignator, code.getVDesignator().toUpper(), i);
+            }
+            if (code.hasIataCode()) { addIndex(m_airlineByIata, code.getIataCode().toUpper(), i); }
+
+            const QString telephony = code.getTelephonyDesignator().toUpper();
+            if (!telephony.isEmpty()) { addIndex(m_airlineByTelephony, telephony, i); }
+        }
+    }
+
+    CAircraftIcaoCode CIcaoCodeLookup::findAircraftByKey(int key) const
+    {
+        const int i = m_aircraftByKey.value(key, -1);
+        return i < 0 ? CAircraftIcaoCode() : m_aircraftIcaos[i];
+    }
+
+    CAircraftIcaoCodeList CIcaoCodeLookup::findAircraftByDesignator(const QString &designator) const
+    {
+        if (designator.length() < CAircraftIcaoCode::DesignatorMinLength) { return CAircraftIcaoCodeList(); }
+        return this->aircraftForIndexes(m_aircraftByDesignator.value(designator.trimmed().toUpper()));
+    }
+
+    CAircraftIcaoCode CIcaoCodeLookup::findFirstAircraftByDesignatorAndRank(const QString &designator) const
+    {
+        if (!CAircraftIcaoCode::isValidDesignator(designator)) { return CAircraftIcaoCode(); }
+        const int i = m_aircraftByDesignatorAndRank.value(designator.trimmed().toUpper(), -1);
+        return i < 0 ? CAircraftIcaoCode() : m_aircraftIcaos[i];
+    }
+
+    CAircraftIcaoCodeList CIcaoCodeLookup::findAircraftByIataCode(const QString &iata) const
+    {
+        if (iata.isEmpty()) { return CAircraftIcaoCodeList(); }
+        return this->aircraftForIndexes(m_aircraftByIata.value(iata.trimmed().toUpper()));
+    }
+
+    CAircraftIcaoCodeList CIcaoCodeLookup::findAircraftByFamily(const QString &family) const
+    {
+        if (family.isEmpty()) { return CAircraftIcaoCodeList(); }
+        return this->aircraftForIndexes(m_aircraftByFamily.value(family.trimmed().toUpper()));
+    }
+
+    bool CIcaoCodeLookup::containsAircraftDesignator(const QString &designator) const
+    {
+        if (designator.isEmpty()) { return false; }
+        return m_aircraftByDesignator.contains(designator);
+    }
+
+    CAirlineIcaoCode CIcaoCodeLookup::findAirlineByKey(int key) const
+    {
+        const int i = m_airlineByKey.value(key, -1);
+        return i < 0 ? CAirlineIcaoCode() : m_airlineIcaos[i];
+    }
+
+    CAirlineIcaoCodeList CIcaoCodeLookup::findAirlinesByDesignator(const QString &designator) const
+    {
+        if (!CAirlineIcaoCode::isValidAirlineDesignator(designator)) { return CAirlineIcaoCodeList(); }
+        return this->airlinesForIndexes(m_airlineByDesignator.value(designator.trimmed().toUpper()));
+    }
+
+    CAirlineIcaoCodeList CIcaoCodeLookup::findAirlinesByVDesignator(const QString &designator) const
+    {
+        if (!CAirlineIcaoCode::isValidAirlineDesignator(designator)) { return CAirlineIcaoCodeList(); }
+        return this->airlinesForIndexes(m_airlineByVDesignator.value(designator.trimmed().toUpper()));
+    }
+
+    CAirlineIcaoCode CIcaoCodeLookup::findAirlineByUniqueVDesignatorOrDefault(const QString &designator, bool preferOperatingAirlines) const
+    {
+        CAirlineIcaoCodeList codes = this->findAirlinesByVDesignator(designator);
+        if (codes.size() > 1 && preferOperatingAirlines)
+        {
+            codes.removeIf(&CAirlineIcaoCode::isOperating, false);
+        }
+        return codes.size() == 1 ? codes.front() : CAirlineIcaoCode();
+    }
+
+    CAirlineIcaoCodeList CIcaoCodeLookup::findAirlinesByIataCode(const QString &iata) const
+    {
+        if (!CAirlineIcaoCode::isValidIataCode(iata)) { return CAirlineIcaoCodeList(); }
+        return this->airlinesForIndexes(m_airlineByIata.value(iata.trimmed().toUpper()));
+    }
+
+    CAirlineIcaoCode CIcaoCodeLookup::findAirlineByUniqueIataCodeOrDefault(const QString &iata) const
+    {
+        const CAirlineIcaoCodeList codes = this->findAirlinesByIataCode(iata);
+        return codes.size() == 1 ? codes.front() : CAirlineIcaoCode();
+    }
+
+    CAirlineIcaoCodeList CIcaoCodeLookup::findAirlinesByTelephonyDesignator(const QString &candidate) const
+    {
+        if (candidate.isEmpty()) { return CAirlineIcaoCodeList(); }
+        return this->airlinesForIndexes(m_airlineByTelephony.value(candidate.trimmed().toUpper()));
+    }
+
+    CAirlineIcaoCode CIcaoCodeLookup::findBestAirlineMatchByCallsign(const CCallsign &callsign) const
+    {
+        if (m_airlineIcaos.isEmpty() || callsign.isEmpty()) { return CAirlineIcaoCode(); }
+        const QString airline = callsign.getAirlinePrefix().toUpper();
+        if (airline.isEmpty()) { return CAirlineIcaoCode(); }
+        const QHash<QString, QVector<int>> &index = airline.length() == 3 ? m_airlineByDesignator : m_airlineByVDesignator;
+        const auto it = index.constFind(airline);
+        return it == index.cend() ? CAirlineIcaoCode() : m_airlineIcaos[it->constFirst()];
+    }
+
+    bool CIcaoCodeLookup::containsAirlineVDesignator(const QString &vDesignator) const
+    {
+        if (vDesignator.isEmpty()) { return false; }
+        return vDesignator.length() < 4 ?
+               m_airlineByDesignator.contains(vDesignator.toUpper()) :
+               m_airlineByVDesignator.contains(vDesignator.toUpper());
+    }
+
+    CAircraftIcaoCodeList CIcaoCodeLookup::aircraftForIndexes(QVector<int> indexes) const
+    {
+        std::sort(indexes.begin(), indexes.end());
+        CAircraftIcaoCodeList codes;
+        for (int i : std::as_const(indexes)) { codes.push_back(m_aircraftIcaos[i]); }
+        return codes;
+    }
+
+    CAirlineIcaoCodeList CIcaoCodeLookup::airlinesForIndexes(QVector<int> indexes) const
+    {
+        std::sort(indexes.begin(), indexes.end());
+        CAirlineIcaoCodeList codes;
+        for (int i : std::as_const(indexes)) { codes.push_back(m_airlineIcaos[i]); }
+        return codes;
+    }
+} // ns
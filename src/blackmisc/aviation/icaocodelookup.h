@@ -0,0 +1,133 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_AVIATION_ICAOCODELOOKUP_H
+#define BLACKMISC_AVIATION_ICAOCODELOOKUP_H
+
+#include "blackmisc/aviation/aircrafticaocodelist.h"
+#include "blackmisc/aviation/airlineicaocodelist.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QHash>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+namespace BlackMisc::Aviation
+{
+    /*!
+     * Immutable lookup of aircraft and airline ICAO codes, indexed once when built.
+     *
+     * Counterpart of the CAircraftIcaoCodeList / CAirlineIcaoCodeList findBy functions for the full DB sets,
+     * results are in the same order as the corresponding list functions return them.
+     * Exact lookups only, all use hashes.
+     * \remark shared between threads as CIcaoCodeLookup::ConstPtr, never modified after construction
+     */
+    class BLACKMISC_EXPORT CIcaoCodeLookup
+    {
+    public:
+        //! Shared pointer
+        using ConstPtr = QSharedPointer<const CIcaoCodeLookup>;
+
+        //! Empty lookup
+        CIcaoCodeLookup() = default;
+
+        //! Lookup for given codes, builds the indexes
+        CIcaoCodeLookup(const CAircraftIcaoCodeList &aircraftIcaos, const CAirlineIcaoCodeList &airlineIcaos);
+
+        //! All aircraft ICAO codes
+        const CAircraftIcaoCodeList &getAircraftIcaoCodes() const { return m_aircraftIcaos; }
+
+        //! All airline ICAO codes
+        const CAirlineIcaoCodeList &getAirlineIcaoCodes() const { return m_airlineIcaos; }
+
+        //! Aircraft by DB key
+        CAircraftIcaoCode findAircraftByKey(int key) const;
+
+        //! Aircraft by designator
+        //! \sa CAircraftIcaoCodeList::findByDesignator
+        CAircraftIcaoCodeList findAircraftByDesignator(const QString &designator) const;
+
+        //! Aircraft with designator and best rank
+        //! \sa CAircraftIcaoCodeList::findFirstByDesignatorAndRank
+        CAircraftIcaoCode findFirstAircraftByDesignatorAndRank(const QString &designator) const;
+
+        //! Aircraft by IATA code
+        //! \sa CAircraftIcaoCodeList::findByIataCode
+        CAircraftIcaoCodeList findAircraftByIataCode(const QString &iata) const;
+
+        //! Aircraft by family
+        //! \sa CAircraftIcaoCodeList::findByFamily
+        CAircraftIcaoCodeList findAircraftByFamily(const QString &family) const;
+
+        //! Contains aircraft designator?
+        bool containsAircraftDesignator(const QString &designator) const;
+
+        //! Airline by DB key
+        CAirlineIcaoCode findAirlineByKey(int key) const;
+
+        //! Airlines by designator
+        //! \sa CAirlineIcaoCodeList::findByDesignator
+        CAirlineIcaoCodeList findAirlinesByDesignator(const QString &designator) const;
+
+        //! Airlines by v-designator
+        //! \sa CAirlineIcaoCodeList::findByVDesignator
+        CAirlineIcaoCodeList findAirlinesByVDesignator(const QString &designator) const;
+
+        //! Airline by unique v-designator
+        //! \sa CAirlineIcaoCodeList::findByUniqueVDesignatorOrDefault
+        CAirlineIcaoCode findAirlineByUniqueVDesignatorOrDefault(const QString &designator, bool preferOperatingAirlines) const;
+
+        //! Airlines by IATA code
+        //! \sa CAirlineIcaoCodeList::findByIataCode
+        CAirlineIcaoCodeList findAirlinesByIataCode(const QString &iata) const;
+
+        //! Airline by unique IATA code
+        //! \sa CAirlineIcaoCodeList::findByUniqueIataCodeOrDefault
+        CAirlineIcaoCode findAirlineByUniqueIataCodeOrDefault(const QString &iata) const;
+
+        //! Airlines by telephony designator
+        //! \sa CAirlineIcaoCodeList::findByTelephonyDesignator
+        CAirlineIcaoCodeList findAirlinesByTelephonyDesignator(const QString &candidate) const;
+
+        //! Airline for callsign
+        //! \sa CAirlineIcaoCodeList::findBestMatchByCallsign
+        CAirlineIcaoCode findBestAirlineMatchByCallsign(const CCallsign &callsign) const;
+
+        //! Contains airline v-designator?
+        //! \sa CAirlineIcaoCodeList::containsVDesignator
+        bool containsAirlineVDesignator(const QString &vDesignator) const;
+
+    private:
+        //! Codes for indexes, in list order
+        //! @{
+        CAircraftIcaoCodeList aircraftForIndexes(QVector<int> indexes) const;
+        CAirlineIcaoCodeList airlinesForIndexes(QVector<int> indexes) const;
+        //! @}
+
+        CAircraftIcaoCodeList m_aircraftIcaos;
+        CAirlineIcaoCodeList m_airlineIcaos;
+
+        QHash<int, int> m_aircraftByKey;                           //!< DB key -> index
+        QHash<QString, QVector<int>> m_aircraftByDesignator;       //!< designator -> indexes
+        QHash<QString, int> m_aircraftByDesignatorAndRank;         //!< designator -> index with best rank
+        QHash<QString, QVector<int>> m_aircraftByIata;             //!< IATA code -> indexes
+        QHash<QString, QVector<int>> m_aircraftByFamily;           //!< family -> indexes
+
+        QHash<int, int> m_airlineByKey;                            //!< DB key -> index
+        QHash<QString, QVector<int>> m_airlineByDesignator;        //!< upper case designator -> indexes
+        QHash<QString, QVector<int>> m_airlineByVDesignator;       //!< upper case v-designator -> indexes
+        QHash<QString, QVector<int>> m_airlineByIata;              //!< upper case IATA code -> indexes
+        QHash<QString, QVector<int>> m_airlineByTelephony;         //!< upper case telephony designator -> indexes
+    };
+} // ns
+
+#endif // guard
@@ -41,6 +41,7 @@
 #include "blackmisc/aviation/aircraftenginelist.h"
 #include "blackmisc/aviation/aircraftlights.h"
 #include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/aviation/aircraftpartsdelta.h"
 #include "blackmisc/aviation/aircraftpartslist.h"
 #include "blackmisc/aviation/livery.h"
 #include "blackmisc/aviation/liverylist.h"
@@ -60,6 +61,7 @@ namespace BlackMisc
             CAircraftLights::registerMetadata();
             CAircraftParts::registerMetadata();
             CAircraftPartsList::registerMetadata();
+            qRegisterMetaType<CAircraftPartsDelta>(); // no value object, only used in queued signals
             CAircraftSituation::registerMetadata();
             CAircraftSituationChange::registerMetadata();
             CAircraftSituationList::registerMetadata();
@@ -1,6 +1,6 @@
 load(common_pre)
 
-QT       += network dbus xml multimedia
+QT       += network dbus xml multimedia concurrent
 
 TARGET = blackmisc
 TEMPLATE = lib
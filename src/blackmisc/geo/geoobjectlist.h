@@ -150,53 +150,43 @@ namespace BlackMisc::Geo
         //! Remove inside range
         int removeInsideRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range)
         {
-            const int size = this->container().size();
-            const CONTAINER copy = this->container().findOutsideRange(coordinate, range);
-            const int d = size - copy.size();
-            if (d > 0) { *this = copy; }
-            return d;
+            return this->container().removeIf([&](const OBJ & geoObj)
+            {
+                return calculateGreatCircleDistance(geoObj, coordinate) <= range;
+            });
         }
 
         //! Remove outside range
         int removeOutsideRange(const ICoordinateGeodetic &coordinate, const PhysicalQuantities::CLength &range)
         {
-            const int size = this->container().size();
-            const CONTAINER copy = this->container().findWithinRange(coordinate, range);
-            const int d = size - copy.size();
-            if (d > 0) { *this = copy; }
-            return d;
+            return this->container().removeIf([&](const OBJ & geoObj)
+            {
+                return calculateGreatCircleDistance(geoObj, coordinate) > range;
+            });
         }
 
         //! Remove if there is no geodetic height
         int removeWithoutGeodeticHeight()
         {
-            const int size = this->container().size();
-            const CONTAINER copy = this->findWithGeodeticMSLHeight();
-            const int d = size - copy.size();
-            if (d > 0) { *this = copy; }
-            return d;
+            return this->container().removeIf(&OBJ::hasMSLGeodeticHeight, false);
         }
 
         //! Find 0..n objects closest to the given coordinate.
         CONTAINER findClosest(int number, const ICoordinateGeodetic &coordinate) const
         {
-            CONTAINER closest = this->container().partiallySorted(number, [&](const OBJ & a, const OBJ & b)
+            return this->container().smallestByProjection(number, [&](const OBJ & geoObj)
             {
-                return calculateEuclideanDistanceSquared(a, coordinate) < calculateEuclideanDistanceSquared(b, coordinate);
+                return calculateEuclideanDistanceSquared(geoObj, coordinate);
             });
-            closest.truncate(number);
-            return closest;
         }
 
         //! Find 0..n objects farthest to the given coordinate.
         CONTAINER findFarthest(int number, const ICoordinateGeodetic &coordinate) const
         {
-            CONTAINER farthest = this->container().partiallySorted(number, [&](const OBJ & a, const OBJ & b)
+            return this->container().smallestByProjection(number, [&](const OBJ & geoObj)
             {
-                return calculateEuclideanDistanceSquared(a, coordinate) > calculateEuclideanDistanceSquared(b, coordinate);
+                return -calculateEuclideanDistanceSquared(geoObj, coordinate);
             });
-            farthest.truncate(number);
-            return farthest;
         }
 
         //! Find closest within range to the given coordinate
@@ -220,9 +210,9 @@ namespace BlackMisc::Geo
         //! Sort by distance
         void sortByEuclideanDistanceSquared(const ICoordinateGeodetic &coordinate)
         {
-            this->container().sort([&](const OBJ & a, const OBJ & b)
+            this->container().sortByProjection([&](const OBJ & geoObj)
             {
-                return calculateEuclideanDistanceSquared(a, coordinate) < calculateEuclideanDistanceSquared(b, coordinate);
+                return calculateEuclideanDistanceSquared(geoObj, coordinate);
             });
         }
 
@@ -0,0 +1,291 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/latencytrace.h"
+#include "blackmisc/seqlockringbuffer.h"
+#include "blackmisc/lockfree.h"
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+#include <QThread>
+#include <QVector>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+namespace BlackMisc
+{
+    namespace
+    {
+        //! One recorded span
+        struct TraceEvent
+        {
+            qint64 startNs = 0;
+            qint64 durationNs = 0;
+            char callsign[12] = {};
+            quint8 stage = 0;
+        };
+        static_assert(std::is_trivially_copyable_v<TraceEvent>, "Events are copied while they may be written");
+
+        //! Spans and histograms of one thread
+        struct TraceBuffer
+        {
+            CSeqLockRingBuffer<TraceEvent, CLatencyTrace::EventsPerThread> events;
+            std::atomic<quint32> histogram[CLatencyTrace::StageCount][CLatencyTrace::BucketCount] {};
+            std::atomic<qint64> sumNs[CLatencyTrace::StageCount] {};
+            std::atomic<qint64> maxNs[CLatencyTrace::StageCount] {};
+            quint64 tid = 0;
+            QString threadName;
+        };
+
+        //! Sampled callsigns
+        struct SampleConfig
+        {
+            QSet<QString> callsigns; //!< empty means all
+        };
+
+        LockFree<SampleConfig> &sampleConfig()
+        {
+            static LockFree<SampleConfig> config;
+            return config;
+        }
+
+        //! All buffers, only locked when a thread records its first span and when reading
+        QMutex &buffersMutex()
+        {
+            static QMutex mutex;
+            return mutex;
+        }
+
+        QVector<std::shared_ptr<TraceBuffer>> &buffers()
+        {
+            static QVector<std::shared_ptr<TraceBuffer>> b;
+            return b;
+        }
+
+        thread_local std::shared_ptr<TraceBuffer> t_buffer;
+
+        TraceBuffer &threadBuffer()
+        {
+            if (t_buffer) { return *t_buffer; }
+            t_buffer = std::make_shared<TraceBuffer>();
+            t_buffer->tid = reinterpret_cast<quintptr>(QThread::currentThreadId());
+            const QThread *thread = QThread::currentThread();
+            t_buffer->threadName = thread && !thread->objectName().isEmpty() ? thread->objectName() :
+                                   (thread && QCoreApplication::instance() && thread == QCoreApplication::instance()->thread()) ? QStringLiteral("main") :
+                                   QStringLiteral("thread %1").arg(t_buffer->tid);
+            QMutexLocker l(&buffersMutex());
+            buffers().push_back(t_buffer);
+            return *t_buffer;
+        }
+
+        QVector<std::shared_ptr<TraceBuffer>> allBuffers()
+        {
+            QMutexLocker l(&buffersMutex());
+            return buffers();
+        }
+
+        int bucketOf(qint64 durationNs)
+        {
+            qint64 us = durationNs / 1000;
+            int bucket = 0;
+            while (us > 0 && bucket < CLatencyTrace::BucketCount - 1) { us >>= 1; ++bucket; }
+            return bucket;
+        }
+
+        //! Upper bound of bucket in us
+        qint64 bucketUpperUs(int bucket)
+        {
+            return qint64(1) << bucket;
+        }
+    }
+
+    std::atomic_bool CLatencyTrace::s_enabled { false };
+
+    void CLatencyTrace::setEnabled(bool enabled)
+    {
+        if (enabled) { nowNs(); } // start the clock
+        s_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void CLatencyTrace::setSampledCallsigns(const QStringList &callsigns)
+    {
+        SampleConfig config;
+        for (const QString &cs : callsigns)
+        {
+            const QString c = cs.trimmed().toUpper();
+            if (!c.isEmpty()) { config.callsigns.insert(c); }
+        }
+        sampleConfig().uniqueWrite() = config;
+    }
+
+    QStringList CLatencyTrace::getSampledCallsigns()
+    {
+        QStringList callsigns = sampleConfig().read()->callsigns.values();
+        callsigns.sort();
+        return callsigns;
+    }
+
+    bool CLatencyTrace::isSampled(const QString &callsign)
+    {
+        if (callsign.isEmpty()) { return true; }
+        const auto config = sampleConfig().read();
+        return config->callsigns.isEmpty() || config->callsigns.contains(callsign.toUpper());
+    }
+
+    qint64 CLatencyTrace::nowNs()
+    {
+        static const QElapsedTimer clock = []
+        {
+            QElapsedTimer t;
+            t.start();
+            return t;
+        }();
+        return clock.nsecsElapsed();
+    }
+
+    void CLatencyTrace::record(Stage stage, const QString &callsign, qint64 startNs, qint64 endNs)
+    {
+        if (stage < 0 || stage >= StageCount) { return; }
+        TraceBuffer &buffer = threadBuffer();
+
+        TraceEvent event;
+        event.startNs = startNs;
+        event.durationNs = qMax(Q_INT64_C(0), endNs - startNs);
+        event.stage = static_cast<quint8>(stage);
+        const QByteArray cs = callsign.toLatin1();
+        std::memcpy(event.callsign, cs.constData(), static_cast<size_t>(qMin(cs.size(), static_cast<int>(sizeof(event.callsign)) - 1)));
+        buffer.events.push(event);
+
+        // only this thread writes its histogram, the readers only need the values to be atomic
+        buffer.histogram[stage][bucketOf(event.durationNs)].fetch_add(1, std::memory_order_relaxed);
+        buffer.sumNs[stage].fetch_add(event.durationNs, std::memory_order_relaxed);
+        if (event.durationNs > buffer.maxNs[stage].load(std::memory_order_relaxed)) { buffer.maxNs[stage].store(event.durationNs, std::memory_order_relaxed); }
+    }
+
+    void CLatencyTrace::reset()
+    {
+        QMutexLocker l(&buffersMutex());
+        auto &all = buffers();
+
+        // buffers of finished threads are only referenced here
+        all.erase(std::remove_if(all.begin(), all.end(), [](const std::shared_ptr<TraceBuffer> &b) { return b.use_count() < 2; }), all.end());
+        for (const std::shared_ptr<TraceBuffer> &buffer : std::as_const(all))
+        {
+            buffer->events.clear();
+            for (int s = 0; s < StageCount; ++s)
+            {
+                for (auto &bucket : buffer->histogram[s]) { bucket.store(0, std::memory_order_relaxed); }
+                buffer->sumNs[s].store(0, std::memory_order_relaxed);
+                buffer->maxNs[s].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    QString CLatencyTrace::getHistogramsAsText(const QString &separator)
+    {
+        const QVector<std::shared_ptr<TraceBuffer>> all = allBuffers();
+        QStringList lines;
+        for (int s = 0; s < StageCount; ++s)
+        {
+            quint32 buckets[BucketCount] = {};
+            quint64 count = 0;
+            qint64 sumNs = 0;
+            qint64 maxNs = 0;
+            for (const std::shared_ptr<TraceBuffer> &buffer : all)
+            {
+                for (int b = 0; b < BucketCount; ++b)
+                {
+                    const quint32 n = buffer->histogram[s][b].load(std::memory_order_relaxed);
+                    buckets[b] += n;
+                    count += n;
+                }
+                sumNs += buffer->sumNs[s].load(std::memory_order_relaxed);
+                maxNs = qMax(maxNs, buffer->maxNs[s].load(std::memory_order_relaxed));
+            }
+            if (count < 1) { continue; }
+
+            // percentiles are the upper bounds of the buckets
+            const auto percentileUs = [&](double p)
+            {
+                const quint64 rank = static_cast<quint64>(p * count + 0.5);
+                quint64 cumulated = 0;
+                for (int b = 0; b < BucketCount; ++b)
+                {
+                    cumulated += buckets[b];
+                    if (cumulated >= rank) { return bucketUpperUs(b); }
+                }
+                return bucketUpperUs(BucketCount - 1);
+            };
+
+            lines << QStringLiteral("%1: n=%2 avg=%3us p50<%4us p90<%5us p99<%6us max=%7us").arg(
+                         stageName(static_cast<Stage>(s))).arg(count).arg(sumNs / 1000.0 / count, 0, 'f', 1).arg(
+                         percentileUs(0.5)).arg(percentileUs(0.9)).arg(percentileUs(0.99)).arg(maxNs / 1000.0, 0, 'f', 1);
+        }
+        if (lines.isEmpty()) { return QStringLiteral("No latency trace spans"); }
+        return lines.join(separator);
+    }
+
+    QByteArray CLatencyTrace::toChromeTraceJson()
+    {
+        const QVector<std::shared_ptr<TraceBuffer>> all = allBuffers();
+        const qint64 pid = QCoreApplication::applicationPid();
+        QJsonArray traceEvents;
+        for (const std::shared_ptr<TraceBuffer> &buffer : all)
+        {
+            const QVector<TraceEvent> events = buffer->events.toVector();
+            if (events.isEmpty()) { continue; }
+            const qint64 tid = static_cast<qint64>(buffer->tid);
+            traceEvents.append(QJsonObject
+            {
+                { "name", "thread_name" }, { "ph", "M" }, { "pid", pid }, { "tid", tid },
+                { "args", QJsonObject {{ "name", buffer->threadName }} }
+            });
+            for (const TraceEvent &event : events)
+            {
+                QJsonObject json
+                {
+                    { "name", stageName(static_cast<Stage>(event.stage)) }, { "cat", "swift" }, { "ph", "X" },
+                    { "ts", event.startNs / 1000.0 }, { "dur", event.durationNs / 1000.0 }, { "pid", pid }, { "tid", tid }
+                };
+                if (event.callsign[0]) { json.insert("args", QJsonObject {{ "callsign", QString::fromLatin1(event.callsign) }}); }
+                traceEvents.append(json);
+            }
+        }
+        const QJsonObject trace { { "traceEvents", traceEvents }, { "displayTimeUnit", "ms" } };
+        return QJsonDocument(trace).toJson(QJsonDocument::Compact);
+    }
+
+    bool CLatencyTrace::writeChromeTraceFile(const QString &fileName)
+    {
+        QFile file(fileName);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) { return false; }
+        const QByteArray json = toChromeTraceJson();
+        return file.write(json) == json.size();
+    }
+
+    const QString &CLatencyTrace::stageName(Stage stage)
+    {
+        static const QString names[] =
+        {
+            "fsd read", "fsd queue", "fsd parse", "airspace monitor", "store situation",
+            "elevation lookup", "interpolation", "simulator send"
+        };
+        static_assert(sizeof(names) / sizeof(names[0]) == StageCount, "Missing stage name");
+        static const QString unknown("unknown");
+        return (stage >= 0 && stage < StageCount) ? names[stage] : unknown;
+    }
+} // ns
@@ -0,0 +1,139 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_LATENCYTRACE_H
+#define BLACKMISC_LATENCYTRACE_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QString>
+#include <QStringList>
+#include <QtGlobal>
+#include <atomic>
+
+namespace BlackMisc
+{
+    /*!
+     * Latency tracing of the stages between receiving a network packet and sending the interpolated aircraft to the simulator.
+     *
+     * - spans (CLatencySpan) are recorded with a monotonic clock into lock-free buffers, one per thread
+     * - spans with a callsign are only recorded for the sampled callsigns
+     * - exported as Chrome/Perfetto trace JSON (chrome://tracing, ui.perfetto.dev) and as histograms per stage
+     * \remark when disabled a span costs one relaxed atomic load
+     */
+    class BLACKMISC_EXPORT CLatencyTrace
+    {
+    public:
+        //! Pipeline stages
+        enum Stage
+        {
+            FsdRead,          //!< reading lines from the FSD socket
+            FsdQueue,         //!< line waiting to be parsed
+            FsdParse,         //!< parsing and dispatching a line
+            AirspaceMonitor,  //!< airspace monitor handling a situation
+            StoreSituation,   //!< storing the situation in the remote aircraft provider
+            ElevationLookup,  //!< finding a ground elevation for a new situation
+            Interpolation,    //!< interpolating situation and parts
+            SimulatorSend,    //!< driver sending to the simulator
+            StageCount        //!< number of stages
+        };
+
+        //! Number of histogram buckets, bucket n counts durations < 2^n us
+        static constexpr int BucketCount = 24;
+
+        //! Events kept per thread
+        static constexpr int EventsPerThread = 4096;
+
+        //! Tracing enabled?
+        //! \threadsafe
+        static bool isEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+        //! Enable/disable tracing
+        //! \threadsafe
+        static void setEnabled(bool enabled);
+
+        //! Trace only those callsigns, empty means all callsigns
+        //! \threadsafe
+        static void setSampledCallsigns(const QStringList &callsigns);
+
+        //! Sampled callsigns, empty means all callsigns
+        //! \threadsafe
+        static QStringList getSampledCallsigns();
+
+        //! Is the callsign traced, spans without callsign are always traced
+        //! \threadsafe
+        static bool isSampled(const QString &callsign);
+
+        //! Monotonic time in ns
+        //! \threadsafe
+        static qint64 nowNs();
+
+        //! Record a span of the current thread
+        //! \threadsafe
+        static void record(Stage stage, const QString &callsign, qint64 startNs, qint64 endNs);
+
+        //! Remove all recorded spans and histograms
+        //! \threadsafe
+        static void reset();
+
+        //! Histograms per stage as text
+        //! \threadsafe
+        static QString getHistogramsAsText(const QString &separator = "\n");
+
+        //! Recorded spans as Chrome/Perfetto trace JSON
+        //! \threadsafe
+        static QByteArray toChromeTraceJson();
+
+        //! Write the Chrome/Perfetto trace JSON file
+        //! \threadsafe
+        static bool writeChromeTraceFile(const QString &fileName);
+
+        //! Name of the stage
+        static const QString &stageName(Stage stage);
+
+    private:
+        static std::atomic_bool s_enabled; //!< tracing enabled
+    };
+
+    /*!
+     * Records the time from construction to destruction as latency trace span
+     */
+    class CLatencySpan
+    {
+    public:
+        //! Start the span, callsign can be empty
+        CLatencySpan(CLatencyTrace::Stage stage, const QString &callsign = {}) : m_stage(stage)
+        {
+            if (!CLatencyTrace::isEnabled() || !CLatencyTrace::isSampled(callsign)) { return; }
+            m_callsign = callsign;
+            m_startNs = CLatencyTrace::nowNs();
+        }
+
+        //! End the span
+        ~CLatencySpan()
+        {
+            if (m_startNs < 0) { return; }
+            CLatencyTrace::record(m_stage, m_callsign, m_startNs, CLatencyTrace::nowNs());
+        }
+
+        //! Not copyable
+        //! @{
+        CLatencySpan(const CLatencySpan &) = delete;
+        CLatencySpan &operator =(const CLatencySpan &) = delete;
+        //! @}
+
+    private:
+        CLatencyTrace::Stage m_stage;
+        qint64 m_startNs = -1;
+        QString m_callsign;
+    };
+} // ns
+
+#endif // guard
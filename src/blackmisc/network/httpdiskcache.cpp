@@ -0,0 +1,60 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/network/httpdiskcache.h"
+
+#include <QDateTime>
+
+namespace BlackMisc::Network
+{
+    CHttpDiskCache::CHttpDiskCache(const QString &cacheDirectory, qint64 maximumCacheSize, QObject *parent) : QNetworkDiskCache(parent)
+    {
+        this->setCacheDirectory(cacheDirectory);
+        this->setMaximumCacheSize(maximumCacheSize);
+    }
+
+    QIODevice *CHttpDiskCache::prepare(const QNetworkCacheMetaData &metaData)
+    {
+        // without a validator the response could never be confirmed as unchanged
+        if (!hasValidator(metaData)) { return nullptr; }
+        return QNetworkDiskCache::prepare(alwaysRevalidate(metaData));
+    }
+
+    void CHttpDiskCache::updateMetaData(const QNetworkCacheMetaData &metaData)
+    {
+        // called with the merged headers after a "304 not modified"
+        QNetworkDiskCache::updateMetaData(alwaysRevalidate(metaData));
+    }
+
+    bool CHttpDiskCache::hasValidator(const QNetworkCacheMetaData &metaData)
+    {
+        if (metaData.lastModified().isValid()) { return true; }
+        for (const QNetworkCacheMetaData::RawHeader &header : metaData.rawHeaders())
+        {
+            if (header.first.compare("etag", Qt::CaseInsensitive) == 0 && !header.second.isEmpty()) { return true; }
+        }
+        return false;
+    }
+
+    QNetworkCacheMetaData CHttpDiskCache::alwaysRevalidate(const QNetworkCacheMetaData &metaData)
+    {
+        // "no-cache" means the stored response must be validated with the server before it is used
+        QNetworkCacheMetaData::RawHeaderList headers;
+        for (const QNetworkCacheMetaData::RawHeader &header : metaData.rawHeaders())
+        {
+            if (header.first.compare("cache-control", Qt::CaseInsensitive) == 0) { continue; }
+            headers.push_back(header);
+        }
+        headers.push_back({ QByteArrayLiteral("Cache-Control"), QByteArrayLiteral("no-cache") });
+
+        QNetworkCacheMetaData revalidate(metaData);
+        revalidate.setRawHeaders(headers);
+        revalidate.setExpirationDate(QDateTime::fromMSecsSinceEpoch(0, Qt::UTC));
+        return revalidate;
+    }
+} // ns
@@ -0,0 +1,59 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_NETWORK_HTTPDISKCACHE_H
+#define BLACKMISC_NETWORK_HTTPDISKCACHE_H
+
+#include "blackmisc/blackmiscexport.h"
+
+#include <QNetworkCacheMetaData>
+#include <QNetworkDiskCache>
+#include <QObject>
+#include <QString>
+
+namespace BlackMisc::Network
+{
+    /*!
+     * On-disk HTTP response cache for the application's QNetworkAccessManager.
+     *
+     * Only responses with an ETag or a Last-Modified header are stored. A stored response is
+     * never used without asking the server, each request is sent with If-None-Match / If-Modified-Since
+     * and the stored response is only used when the server answers "304 not modified".
+     * So data files changing within seconds are never outdated, but unchanged files are not transferred again.
+     * \remark gzip and deflate transfer encodings are requested and decoded by QNetworkAccessManager
+     *         as long as no Accept-Encoding header is set explicitly
+     * \sa CNetworkUtils::isFromHttpCache
+     */
+    class BLACKMISC_EXPORT CHttpDiskCache : public QNetworkDiskCache
+    {
+        Q_OBJECT
+
+    public:
+        //! Default size limit of all stored responses
+        static constexpr qint64 DefaultMaximumCacheSize = 128 * 1024 * 1024;
+
+        //! Constructor
+        CHttpDiskCache(const QString &cacheDirectory, qint64 maximumCacheSize = DefaultMaximumCacheSize, QObject *parent = nullptr);
+
+        //! \name QNetworkDiskCache overrides
+        //! @{
+        virtual QIODevice *prepare(const QNetworkCacheMetaData &metaData) override;
+        virtual void updateMetaData(const QNetworkCacheMetaData &metaData) override;
+        //! @}
+
+        //! Has the response a validator, i.e. ETag or Last-Modified?
+        static bool hasValidator(const QNetworkCacheMetaData &metaData);
+
+        //! Meta data which force a conditional request before the stored response is used
+        static QNetworkCacheMetaData alwaysRevalidate(const QNetworkCacheMetaData &metaData);
+    };
+} // ns
+
+#endif // guard
@@ -296,6 +296,12 @@ namespace BlackMisc::Network
         return code == 301 || code == 302 || code == 303 || code == 307;
     }
 
+    bool CNetworkUtils::isFromHttpCache(const QNetworkReply *nwReply)
+    {
+        if (!nwReply) { return false; }
+        return nwReply->attribute(QNetworkRequest::SourceIsFromCacheAttribute).toBool();
+    }
+
     QUrl CNetworkUtils::getHttpRedirectUrl(QNetworkReply *nwReply)
     {
         if (!nwReply) { return QUrl(); }
@@ -127,6 +127,9 @@ namespace BlackMisc::Network
         //! Get the redirect URL if any
         static QUrl getHttpRedirectUrl(QNetworkReply *nwReply);
 
+        //! Reply served from the HTTP cache, the server answered "304 not modified"
+        static bool isFromHttpCache(const QNetworkReply *nwReply);
+
         //! Remove the HTML formatting from a PHP error message
         static QString removeHtmlPartsFromPhpErrorMessage(const QString &errorMessage);
 
@@ -50,6 +50,7 @@ namespace BlackMisc::Network
         case IndexUrl: return this->m_url.propertyByIndex(index.copyFrontRemoved());
         case IndexResponseTimestamp: return QVariant::fromValue(this->getResponseTimestamp());
         case IndexResponseTime: return QVariant::fromValue(m_responseTimeMs);
+        case IndexFromCache: return QVariant::fromValue(m_fromCache);
         default: return CValueObject::propertyByIndex(index);
         }
     }
@@ -66,6 +67,7 @@ namespace BlackMisc::Network
         case IndexSuccess: m_success = variant.toBool(); break;
         case IndexUrl: m_url.setPropertyByIndex(index.copyFrontRemoved(), variant); break;
         case IndexResponseTime: this->setResponseTimestampToNow(); break; // a bit unusual
+        case IndexFromCache: m_fromCache = variant.toBool(); break;
         default: CValueObject::setPropertyByIndex(index, variant); break;
         }
     }
@@ -73,8 +75,8 @@ namespace BlackMisc::Network
     QString CUrlLog::convertToQString(bool i18n) const
     {
         Q_UNUSED(i18n);
-        static const QString s("Id: %1, success: %2 response: %3ms, started: %4 ended: %5");
-        return s.arg(m_id).arg(boolToYesNo(m_success)).arg(m_responseTimeMs).arg(this->getMSecsSinceEpoch()).arg(m_responseTimeMSecsSinceEpoch);
+        static const QString s("Id: %1, success: %2 response: %3ms, started: %4 ended: %5 from cache: %6");
+        return s.arg(m_id).arg(boolToYesNo(m_success)).arg(m_responseTimeMs).arg(this->getMSecsSinceEpoch()).arg(m_responseTimeMSecsSinceEpoch).arg(boolToYesNo(m_fromCache));
     }
 
     const char *CUrlLog::propertyNameId()
@@ -37,7 +37,8 @@ namespace BlackMisc::Network
             IndexSuccess,
             IndexUrl,
             IndexResponseTimestamp,
-            IndexResponseTime
+            IndexResponseTime,
+            IndexFromCache
         };
 
         //! Constructor, setting created to now and getting a valid id
@@ -70,6 +71,12 @@ namespace BlackMisc::Network
         //! Set success
         void setSuccess(bool s) { m_success = s; }
 
+        //! Response served from the HTTP cache, i.e. not modified on the server
+        bool isFromCache() const { return m_fromCache; }
+
+        //! Set served from the HTTP cache
+        void setFromCache(bool fromCache) { m_fromCache = fromCache; }
+
         //! \copydoc BlackMisc::Mixin::Index::propertyByIndex
         QVariant propertyByIndex(BlackMisc::CPropertyIndexRef index) const;
 
@@ -86,6 +93,7 @@ namespace BlackMisc::Network
         int    m_id = -1;
         CUrl   m_url;
         bool   m_success = false;
+        bool   m_fromCache = false;
         qint64 m_responseTimeMSecsSinceEpoch = -1;
         qint64 m_responseTimeMs = -1;
 
@@ -98,6 +106,7 @@ namespace BlackMisc::Network
             BLACK_METAMEMBER(id),
             BLACK_METAMEMBER(url),
             BLACK_METAMEMBER(success),
+            BLACK_METAMEMBER(fromCache),
             BLACK_METAMEMBER(responseTimeMSecsSinceEpoch),
             BLACK_METAMEMBER(responseTimeMs)
         );
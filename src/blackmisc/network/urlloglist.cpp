@@ -7,6 +7,12 @@
  */
 
 #include "blackmisc/network/urlloglist.h"
+#include "blackmisc/network/networkutils.h"
+
+#include <QMap>
+#include <QPair>
+#include <QStringList>
+#include <algorithm>
 
 BLACK_DEFINE_SEQUENCE_MIXINS(BlackMisc::Network, CUrlLog, CUrlLogList)
 
@@ -80,7 +86,7 @@ namespace BlackMisc::Network
         return this->findFirstByOrDefault(&CUrlLog::getId, id);
     }
 
-    bool CUrlLogList::markAsReceived(int id, bool success)
+    bool CUrlLogList::markAsReceived(int id, bool success, bool fromCache)
     {
         for (CUrlLog &rl : *this)
         {
@@ -88,6 +94,7 @@ namespace BlackMisc::Network
             {
                 rl.setResponseTimestampToNow();
                 rl.setSuccess(success);
+                rl.setFromCache(fromCache);
                 return true;
             }
         }
@@ -99,7 +106,7 @@ namespace BlackMisc::Network
         Q_ASSERT_X(nwReply, Q_FUNC_INFO, "missing reply");
         bool ok;
         const int id = nwReply->property(CUrlLog::propertyNameId()).toInt(&ok);
-        return (ok && id >= 0) ? this->markAsReceived(id, success) : false;
+        return (ok && id >= 0) ? this->markAsReceived(id, success, CNetworkUtils::isFromHttpCache(nwReply)) : false;
     }
 
     bool CUrlLogList::containsId(int id) const
@@ -144,10 +151,36 @@ namespace BlackMisc::Network
         return sum / c;
     }
 
+    int CUrlLogList::sizeFromCache() const
+    {
+        return static_cast<int>(std::count_if(this->cbegin(), this->cend(), [](const CUrlLog &rl) { return !rl.isPending() && rl.isFromCache(); }));
+    }
+
+    QString CUrlLogList::getCacheHitRatesPerUrl(const QString &separator) const
+    {
+        QMap<QString, QPair<int, int>> hitsAndCalls; // sorted by URL
+        for (const CUrlLog &rl : *this)
+        {
+            if (rl.isPending()) { continue; }
+            QPair<int, int> &hc = hitsAndCalls[rl.getUrl().getFullUrl(false)];
+            if (rl.isFromCache()) { hc.first++; }
+            hc.second++;
+        }
+        if (hitsAndCalls.isEmpty()) { return QStringLiteral("No data"); }
+
+        static const QString s("%1: %2/%3 from cache (%4%)");
+        QStringList lines;
+        for (auto it = hitsAndCalls.cbegin(); it != hitsAndCalls.cend(); ++it)
+        {
+            lines << s.arg(it.key()).arg(it.value().first).arg(it.value().second).arg(100 * it.value().first / it.value().second);
+        }
+        return lines.join(separator);
+    }
+
     QString CUrlLogList::getSummary() const
     {
-        static const QString s("Entries: %1, pending: %2, errors: %3, min: %4ms avg: %5ms max: %6ms");
+        static const QString s("Entries: %1, pending: %2, errors: %3, from cache: %4, min: %5ms avg: %6ms max: %7ms");
         if (this->isEmpty()) return QStringLiteral("No data");
-        return s.arg(this->size()).arg(this->sizePending()).arg(this->sizeErrors()).arg(this->getMinResponseTime()).arg(this->getAverageResponseTime()).arg(this->getMaxResponseTime());
+        return s.arg(this->size()).arg(this->sizePending()).arg(this->sizeErrors()).arg(this->sizeFromCache()).arg(this->getMinResponseTime()).arg(this->getAverageResponseTime()).arg(this->getMaxResponseTime());
     }
 } // namespace
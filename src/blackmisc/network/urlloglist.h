@@ -69,9 +69,9 @@ namespace BlackMisc::Network
         CUrlLog findByIdOrDefault(int id) const;
 
         //! Mark as received
-        bool markAsReceived(int id, bool success);
+        bool markAsReceived(int id, bool success, bool fromCache = false);
 
-        //! Mark as received
+        //! Mark as received, served from the HTTP cache or not is taken from the reply
         bool markAsReceived(const QNetworkReply *nwReply, bool success);
 
         //! Contains the id?
@@ -86,6 +86,12 @@ namespace BlackMisc::Network
         //! Average response time
         qint64 getAverageResponseTime() const;
 
+        //! Completed calls served from the HTTP cache
+        int sizeFromCache() const;
+
+        //! Per URL (without query) how many completed calls were served from the HTTP cache, one line per URL
+        QString getCacheHitRatesPerUrl(const QString &separator = "\n") const;
+
         //! Summary
         QString getSummary() const;
     };
@@ -0,0 +1,222 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_PQ_STATICQUANTITY_H
+#define BLACKMISC_PQ_STATICQUANTITY_H
+
+#include "blackmisc/pq/acceleration.h"
+#include "blackmisc/pq/angle.h"
+#include "blackmisc/pq/frequency.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/mass.h"
+#include "blackmisc/pq/pressure.h"
+#include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/time.h"
+
+#include <ratio>
+#include <type_traits>
+#include <utility>
+
+namespace BlackMisc::PhysicalQuantities
+{
+    /*!
+     * Physical quantity with the unit fixed at compile time, meant for internal computations in hot paths.
+     *
+     * The value is always stored in the default unit of the corresponding runtime quantity PQ
+     * (e.g. m for CLength, deg for CAngle), so arithmetic and comparisons are plain double operations.
+     * Units are the compile time tags in StaticUnits, their factors are folded by the compiler.
+     * \remark Only linear units, there is no static counterpart for CTemperature
+     * \remark Null runtime quantities map to 0, as CPhysicalQuantity::value(unit) does
+     */
+    template <class PQ>
+    class CStaticQuantity
+    {
+    public:
+        //! Runtime quantity
+        using RuntimeQuantity = PQ;
+
+        //! Runtime unit
+        using RuntimeUnit = std::decay_t<decltype(std::declval<PQ>().getUnit())>;
+
+        //! Default constructor, 0
+        constexpr CStaticQuantity() = default;
+
+        //! From runtime quantity, one unit conversion
+        explicit CStaticQuantity(const PQ &quantity) : m_value(quantity.value(defaultUnit())) {}
+
+        //! From value in default unit
+        static constexpr CStaticQuantity fromDefaultUnit(double value) { return CStaticQuantity(value, 0); }
+
+        //! From value in unit U
+        template <class U>
+        static constexpr CStaticQuantity from(double value)
+        {
+            static_assert(std::is_same_v<typename U::Quantity, PQ>, "Unit of other quantity");
+            return CStaticQuantity(value * U::factor, 0);
+        }
+
+        //! Value in default unit
+        constexpr double value() const { return m_value; }
+
+        //! Value in unit U
+        template <class U>
+        constexpr double value() const
+        {
+            static_assert(std::is_same_v<typename U::Quantity, PQ>, "Unit of other quantity");
+            return m_value / U::factor;
+        }
+
+        //! To runtime quantity in default unit
+        PQ toRuntime() const { return PQ(m_value, defaultUnit()); }
+
+        //! To runtime quantity in given unit, one unit conversion
+        //! \remark null unit results in the default unit
+        PQ toRuntime(const RuntimeUnit &unit) const
+        {
+            if (unit.isNull()) { return this->toRuntime(); }
+            return PQ(unit.convertFrom(m_value, defaultUnit()), unit);
+        }
+
+        //! Default unit of the runtime quantity
+        static const RuntimeUnit &defaultUnit()
+        {
+            static const RuntimeUnit u = RuntimeUnit::defaultUnit();
+            return u;
+        }
+
+        //! Arithmetic
+        //! @{
+        constexpr CStaticQuantity operator -() const { return CStaticQuantity(-m_value, 0); }
+        constexpr CStaticQuantity &operator +=(CStaticQuantity other) { m_value += other.m_value; return *this; }
+        constexpr CStaticQuantity &operator -=(CStaticQuantity other) { m_value -= other.m_value; return *this; }
+        constexpr CStaticQuantity &operator *=(double factor) { m_value *= factor; return *this; }
+        constexpr CStaticQuantity &operator /=(double divisor) { m_value /= divisor; return *this; }
+        friend constexpr CStaticQuantity operator +(CStaticQuantity a, CStaticQuantity b) { return CStaticQuantity(a.m_value + b.m_value, 0); }
+        friend constexpr CStaticQuantity operator -(CStaticQuantity a, CStaticQuantity b) { return CStaticQuantity(a.m_value - b.m_value, 0); }
+        friend constexpr CStaticQuantity operator *(CStaticQuantity a, double f) { return CStaticQuantity(a.m_value * f, 0); }
+        friend constexpr CStaticQuantity operator *(double f, CStaticQuantity a) { return CStaticQuantity(a.m_value * f, 0); }
+        friend constexpr CStaticQuantity operator /(CStaticQuantity a, double d) { return CStaticQuantity(a.m_value / d, 0); }
+        friend constexpr double operator /(CStaticQuantity a, CStaticQuantity b) { return a.m_value / b.m_value; }
+        //! @}
+
+        //! Comparison
+        //! @{
+        friend constexpr bool operator ==(CStaticQuantity a, CStaticQuantity b) { return a.m_value == b.m_value; }
+        friend constexpr bool operator !=(CStaticQuantity a, CStaticQuantity b) { return a.m_value != b.m_value; }
+        friend constexpr bool operator <(CStaticQuantity a, CStaticQuantity b) { return a.m_value < b.m_value; }
+        friend constexpr bool operator <=(CStaticQuantity a, CStaticQuantity b) { return a.m_value <= b.m_value; }
+        friend constexpr bool operator >(CStaticQuantity a, CStaticQuantity b) { return a.m_value > b.m_value; }
+        friend constexpr bool operator >=(CStaticQuantity a, CStaticQuantity b) { return a.m_value >= b.m_value; }
+        //! @}
+
+        //! Absolute value
+        constexpr CStaticQuantity abs() const { return CStaticQuantity(m_value < 0 ? -m_value : m_value, 0); }
+
+        //! Linear interpolation between a and b, fraction 0..1
+        static constexpr CStaticQuantity interpolate(CStaticQuantity a, CStaticQuantity b, double fraction)
+        {
+            return CStaticQuantity(a.m_value + (b.m_value - a.m_value) * fraction, 0);
+        }
+
+    private:
+        constexpr CStaticQuantity(double value, int) : m_value(value) {}
+
+        double m_value = 0.0; //!< value in default unit
+    };
+
+    //! Static quantities
+    //! @{
+    using CStaticLength = CStaticQuantity<CLength>;
+    using CStaticAngle = CStaticQuantity<CAngle>;
+    using CStaticSpeed = CStaticQuantity<CSpeed>;
+    using CStaticTime = CStaticQuantity<CTime>;
+    using CStaticFrequency = CStaticQuantity<CFrequency>;
+    using CStaticPressure = CStaticQuantity<CPressure>;
+    using CStaticMass = CStaticQuantity<CMass>;
+    using CStaticAcceleration = CStaticQuantity<CAcceleration>;
+    //! @}
+
+    //! Compile time units for CStaticQuantity, factor converts to the default unit of the runtime unit class
+    namespace StaticUnits
+    {
+        //! Unit tag
+        template <class PQ, class Ratio>
+        struct Unit
+        {
+            using Quantity = PQ;                                                          //!< quantity
+            static constexpr double factor = static_cast<double>(Ratio::num) / Ratio::den; //!< to default unit
+        };
+
+        //! Length units
+        //! @{
+        using m   = Unit<CLength, std::ratio<1>>;
+        using km  = Unit<CLength, std::kilo>;
+        using ft  = Unit<CLength, std::ratio<3048, 10000>>;
+        using NM  = Unit<CLength, std::ratio<1852>>;
+        using mi  = Unit<CLength, std::ratio<1609344, 1000>>;
+        //! @}
+
+        //! Angle units
+        //! \remark rad not representable as std::ratio, 180/pi with double precision
+        //! @{
+        using deg = Unit<CAngle, std::ratio<1>>;
+        struct rad
+        {
+            using Quantity = CAngle;                            //!< quantity
+            static constexpr double factor = 57.295779513082321; //!< to default unit
+        };
+        //! @}
+
+        //! Speed units
+        //! @{
+        using m_s    = Unit<CSpeed, std::ratio<1>>;
+        using kts    = Unit<CSpeed, std::ratio<1852, 3600>>;
+        using km_h   = Unit<CSpeed, std::ratio<1000, 3600>>;
+        using ft_s   = Unit<CSpeed, std::ratio<3048, 10000>>;
+        using ft_min = Unit<CSpeed, std::ratio<3048, 600000>>;
+        //! @}
+
+        //! Time units
+        //! @{
+        using s   = Unit<CTime, std::ratio<1>>;
+        using ms  = Unit<CTime, std::milli>;
+        using min = Unit<CTime, std::ratio<60>>;
+        using h   = Unit<CTime, std::ratio<3600>>;
+        //! @}
+
+        //! Frequency units
+        //! @{
+        using Hz  = Unit<CFrequency, std::ratio<1>>;
+        using kHz = Unit<CFrequency, std::kilo>;
+        using MHz = Unit<CFrequency, std::mega>;
+        //! @}
+
+        //! Pressure units
+        //! @{
+        using hPa  = Unit<CPressure, std::ratio<1>>;
+        using mbar = Unit<CPressure, std::ratio<1>>;
+        using inHg = Unit<CPressure, std::ratio<3386389, 100000>>;
+        //! @}
+
+        //! Mass units
+        //! @{
+        using kg = Unit<CMass, std::ratio<1>>;
+        using lb = Unit<CMass, std::ratio<45359237, 100000000>>;
+        //! @}
+
+        //! Acceleration units
+        //! @{
+        using m_s2  = Unit<CAcceleration, std::ratio<1>>;
+        using ft_s2 = Unit<CAcceleration, std::ratio<3048, 10000>>;
+        //! @}
+    } // ns
+} // ns
+
+#endif // guard
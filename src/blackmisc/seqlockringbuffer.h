@@ -0,0 +1,122 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_SEQLOCKRINGBUFFER_H
+#define BLACKMISC_SEQLOCKRINGBUFFER_H
+
+#include <QVector>
+#include <QtGlobal>
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+
+namespace BlackMisc
+{
+    /*!
+     * Fixed size ring buffer of records, one writer and any number of readers, no locks.
+     *
+     * The writer overwrites the oldest records. Readers copy records and afterwards discard the
+     * ones the writer might have overwritten while copying (sequence lock), so readers never block the writer.
+     * Records are addressed by their running index, so readers can continue where they stopped.
+     * \remark concurrent writers are detected, the record of the second writer is dropped
+     */
+    template <typename T, int Capacity>
+    class CSeqLockRingBuffer
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Records are copied while they may be written");
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+    public:
+        //! Add record, overwrites the oldest record if full
+        //! \return false if dropped because another thread was writing at the same time
+        //! \threadsafe
+        bool push(const T &record)
+        {
+            if (m_writing.test_and_set(std::memory_order_acquire)) { m_dropped.fetch_add(1, std::memory_order_relaxed); return false; }
+            const quint64 w = m_written.load(std::memory_order_relaxed);
+            m_slots[w % Capacity] = record;
+            m_written.store(w + 1, std::memory_order_release);
+            m_writing.clear(std::memory_order_release);
+            return true;
+        }
+
+        //! Number of records ever written
+        //! \threadsafe
+        quint64 written() const { return m_written.load(std::memory_order_acquire); }
+
+        //! Number of records dropped because of concurrent writers
+        //! \threadsafe
+        quint64 dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+        //! Append all available records with running index >= from to records
+        //! \return index to continue with, records before it are either copied or lost
+        //! \threadsafe
+        quint64 copyFrom(quint64 from, QVector<T> &records) const
+        {
+            const quint64 w1 = m_written.load(std::memory_order_acquire);
+            const quint64 first = std::max({ from, m_floor.load(std::memory_order_relaxed), oldestIndex(w1) });
+            if (first >= w1) { return std::max(from, w1); }
+
+            const int start = records.size();
+            records.resize(start + static_cast<int>(w1 - first));
+            for (quint64 i = first; i < w1; ++i) { records[start + static_cast<int>(i - first)] = m_slots[i % Capacity]; }
+
+            // records overwritten while copying are discarded,
+            // the record at w2 may be being written, so it overlaps one slot more
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const quint64 w2 = m_written.load(std::memory_order_relaxed);
+            const quint64 valid = oldestIndex(w2 + 1);
+            if (valid > first) { records.remove(start, static_cast<int>(std::min(valid, w1) - first)); }
+            return w1;
+        }
+
+        //! All available records, oldest first
+        //! \threadsafe
+        QVector<T> toVector() const
+        {
+            QVector<T> records;
+            this->copyFrom(0, records);
+            return records;
+        }
+
+        //! Latest record
+        //! \return false if there is none
+        //! \threadsafe
+        bool latest(T &record) const
+        {
+            const quint64 w = m_written.load(std::memory_order_acquire);
+            if (w < 1 || w <= m_floor.load(std::memory_order_relaxed)) { return false; }
+            QVector<T> records;
+            this->copyFrom(w - 1, records);
+            if (records.isEmpty()) { return false; }
+            record = records.back();
+            return true;
+        }
+
+        //! Records written so far are no longer available for readers
+        //! \threadsafe
+        void clear() { m_floor.store(m_written.load(std::memory_order_acquire), std::memory_order_relaxed); }
+
+        //! Capacity
+        static constexpr int capacity() { return Capacity; }
+
+    private:
+        //! Oldest index still in the buffer after the given number of records has been written
+        static quint64 oldestIndex(quint64 written) { return written > static_cast<quint64>(Capacity) ? written - Capacity : 0; }
+
+        T m_slots[Capacity] {};
+        std::atomic<quint64> m_written { 0 }; //!< records written, running index of the next record
+        std::atomic<quint64> m_floor { 0 };   //!< records before this index are cleared
+        std::atomic<quint64> m_dropped { 0 }; //!< records dropped, concurrent writers
+        std::atomic_flag m_writing = ATOMIC_FLAG_INIT; //!< writer active
+    };
+} // ns
+
+#endif // guard
@@ -22,6 +22,7 @@
 #include <utility>
 #include <initializer_list>
 #include <functional>
+#include <numeric>
 
 //! \cond
 #define BLACK_TEMPLATE_SEQUENCE_MIXINS(NS, T, List, Extern)             \
@@ -67,11 +68,16 @@ namespace BlackMisc
 {
     namespace Private
     {
-        //! \private Decouple finding from value type.
-        BLACKMISC_EXPORT BLACK_NO_INLINE QVector<int> findIndices(int size, const std::function<bool(int)> &predicate);
-
-        //! \private Decouple sorting from value type.
-        BLACKMISC_EXPORT BLACK_NO_INLINE QVector<int> sortIndices(int size, const std::function<bool(int, int)> &cmp);
+        //! \private Indices 0..size-1 sorted by comparing them with cmp, only the first n are sorted if n < size.
+        template <class Cmp>
+        QVector<int> sortIndices(int size, int n, Cmp cmp)
+        {
+            QVector<int> result(size);
+            std::iota(result.begin(), result.end(), 0);
+            if (n < size) { std::partial_sort(result.begin(), result.begin() + n, result.end(), cmp); }
+            else          { std::sort(result.begin(), result.end(), cmp); }
+            return result;
+        }
     }
 
     /*!
@@ -324,13 +330,26 @@ namespace BlackMisc
         CSequence findBy(Predicate p) const
         {
             QVector<T> found;
-            for (int i : Private::findIndices(size(), [&p, this](int i) { return p((*this)[i]); }))
-            {
-                found.push_back((*this)[i]);
-            }
+            std::copy_if(cbegin(), cend(), std::back_inserter(found), p);
             return found;
         }
 
+        //! Elements for which a given predicate returns true, without copying them.
+        //! \remark the view is only valid as long as this sequence is not modified
+        template <class Predicate>
+        auto filteredView(Predicate p) const
+        {
+            return makeRange(Iterators::makeConditionalIterator(cbegin(), cend(), p), cend());
+        }
+
+        //! Elements matching some particular key/value pair(s), without copying them.
+        //! \remark the view is only valid as long as this sequence is not modified
+        template <class K0, class V0, class... KeysValues>
+        auto filteredView(K0 k0, V0 v0, KeysValues... keysValues) const
+        {
+            return filteredView(BlackMisc::Predicates::MemberEqual(k0, v0, keysValues...));
+        }
+
         //! Modify by applying a value map to each element for which a given predicate returns true.
         //! \return The number of elements modified.
         template <class Predicate, class VariantMap>
@@ -483,15 +502,11 @@ namespace BlackMisc
         }
 
         //! In-place sort by a given comparator predicate.
+        //! \remark indices are sorted and each element is moved once, so fat elements are cheap to sort
         template <class Predicate> void sort(Predicate p)
         {
-            QVector<T> temp;
-            temp.reserve(size());
-            for (int i : Private::sortIndices(size(), [&p, this](int a, int b) { return p((*this)[a], (*this)[b]); }))
-            {
-                temp.push_back(std::move((*this)[i]));
-            }
-            m_impl = std::move(temp);
+            const QVector<T> &elements = m_impl;
+            this->permute(Private::sortIndices(size(), size(), [&p, &elements](int a, int b) { return p(elements[a], elements[b]); }));
         }
 
         //! In-place sort by some particular key(s).
@@ -520,6 +535,36 @@ namespace BlackMisc
             return sorted(BlackMisc::Predicates::MemberLess(key1, keys...));
         }
 
+        //! In-place sort by the key a projection returns for each element, smallest key first.
+        //! \remark the projection is called once per element, not per comparison, use it for expensive keys like distances
+        template <class Projection> void sortByProjection(Projection proj)
+        {
+            const auto keys = projectedKeys(proj);
+            this->permute(Private::sortIndices(size(), size(), [&keys](int a, int b) { return keys[a] < keys[b]; }));
+        }
+
+        //! In-place move the n elements with the smallest projected keys to the beginning and sort them.
+        //! \remark the projection is called once per element
+        template <class Projection> void partiallySortByProjection(size_type n, Projection proj)
+        {
+            const auto keys = projectedKeys(proj);
+            this->permute(Private::sortIndices(size(), std::max(0, std::min(n, size())), [&keys](int a, int b) { return keys[a] < keys[b]; }));
+        }
+
+        //! The n elements with the smallest projected keys, sorted.
+        //! \remark the projection is called once per element and only the n elements are copied
+        template <class Projection>
+        CSequence smallestByProjection(size_type n, Projection proj) const
+        {
+            n = std::max(0, std::min(n, size()));
+            const auto keys = projectedKeys(proj);
+            const QVector<int> indices = Private::sortIndices(size(), n, [&keys](int a, int b) { return keys[a] < keys[b]; });
+            QVector<T> result;
+            result.reserve(n);
+            for (int i = 0; i < n; ++i) { result.push_back(m_impl[indices[i]]); }
+            return result;
+        }
+
         //! In-place move the smallest n elements to the beginning and sort them.
         template <class Predicate> void partiallySort(size_type n, Predicate p)
         {
@@ -615,6 +660,25 @@ namespace BlackMisc
         void unmarshalFromDataStream(QDataStream &stream) { stream >> m_impl; }
 
     private:
+        //! Rearrange the elements, indices[i] is the old index of the new element i, elements are moved
+        void permute(const QVector<int> &indices)
+        {
+            QVector<T> temp;
+            temp.reserve(size());
+            for (int i : indices) { temp.push_back(std::move(m_impl[i])); }
+            m_impl = std::move(temp);
+        }
+
+        //! Key of each element
+        template <class Projection>
+        auto projectedKeys(Projection proj) const
+        {
+            QVector<std::decay_t<decltype(std::invoke(proj, std::declval<const T &>()))>> keys;
+            keys.reserve(size());
+            for (const T &element : m_impl) { keys.push_back(std::invoke(proj, element)); }
+            return keys;
+        }
+
         QVector<T> m_impl;
     };
 } //namespace BlackMisc
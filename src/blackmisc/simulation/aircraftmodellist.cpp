@@ -7,6 +7,7 @@
  */
 
 #include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/simulation/modelstringdictionary.h"
 #include "blackmisc/network/networkutils.h"
 #include "blackmisc/aviation/callsign.h"
 #include "blackmisc/math/mathutils.h"
@@ -25,6 +26,7 @@
 #include <QJsonValue>
 #include <QList>
 #include <QMultiMap>
+#include <QSet>
 #include <QFileInfo>
 #include <QDir>
 #include <tuple>
@@ -39,6 +41,24 @@ BLACK_DEFINE_SEQUENCE_MIXINS(BlackMisc::Simulation, CAircraftModel, CAircraftMod
 
 namespace BlackMisc::Simulation
 {
+    namespace
+    {
+        //! Key for a model string set, case folded like CModelStringDictionary if case insensitive
+        QString modelStringKey(const QString &modelString, Qt::CaseSensitivity sensitivity)
+        {
+            return sensitivity == Qt::CaseSensitive ? modelString : CModelStringDictionary::foldModelString(modelString);
+        }
+
+        //! Set of model string keys
+        QSet<QString> modelStringSet(const QStringList &modelStrings, Qt::CaseSensitivity sensitivity)
+        {
+            QSet<QString> strings;
+            strings.reserve(modelStrings.size());
+            for (const QString &modelString : modelStrings) { strings.insert(modelStringKey(modelString, sensitivity)); }
+            return strings;
+        }
+    }
+
     CAircraftModelList::CAircraftModelList() { }
 
     CAircraftModelList::CAircraftModelList(const CSequence<CAircraftModel> &other) :
@@ -291,7 +311,7 @@ namespace BlackMisc::Simulation
         const QString f(family.toUpper().trimmed());
         return this->findBy([ & ](const CAircraftModel & model)
         {
-            const CAircraftIcaoCode icao(model.getAircraftIcaoCode());
+            const CAircraftIcaoCode &icao = model.getAircraftIcaoCode();
             if (!icao.hasFamily()) { return false; }
             return icao.getFamily() == f;
         });
@@ -304,7 +324,7 @@ namespace BlackMisc::Simulation
         return this->findBy([ & ](const CAircraftModel & model)
         {
             if (!model.getLivery().isColorLivery()) { return false; }
-            const CAircraftIcaoCode icao(model.getAircraftIcaoCode());
+            const CAircraftIcaoCode &icao = model.getAircraftIcaoCode();
             if (!icao.hasFamily()) { return false; }
             return icao.getFamily() == f;
         });
@@ -338,7 +358,7 @@ namespace BlackMisc::Simulation
         if (combinedType.length() != 3) { return CAircraftModelList(); }
         return this->findBy([ & ](const CAircraftModel & model)
         {
-            const CAircraftIcaoCode icao(model.getAircraftIcaoCode());
+            const CAircraftIcaoCode &icao = model.getAircraftIcaoCode();
             return icao.matchesCombinedType(cc);
         });
     }
@@ -350,7 +370,7 @@ namespace BlackMisc::Simulation
         const QString wtcUc(wtc.toUpper().trimmed());
         return this->findBy([ & ](const CAircraftModel & model)
         {
-            const CAircraftIcaoCode icao(model.getAircraftIcaoCode());
+            const CAircraftIcaoCode &icao = model.getAircraftIcaoCode();
             return icao.getWtc() == wtcUc;
         });
     }
@@ -693,7 +713,7 @@ namespace BlackMisc::Simulation
         if (aircraftIcaoCode.hasFamily()) { return aircraftIcaoCode.getFamily(); }
         for (const CAircraftModel &model : (*this))
         {
-            const CAircraftIcaoCode icao(model.getAircraftIcaoCode());
+            const CAircraftIcaoCode &icao = model.getAircraftIcaoCode();
             if (!icao.hasFamily()) continue;
             if (icao.matchesDesignator(aircraftIcaoCode.getDesignator()))
             {
@@ -1029,19 +1049,14 @@ namespace BlackMisc::Simulation
 
     CAircraftModelList CAircraftModelList::findByModelStrings(const QStringList &modelStrings, Qt::CaseSensitivity sensitivity) const
     {
-        return this->findBy([ & ](const CAircraftModel & model)
-        {
-            return modelStrings.contains(model.getModelString(), sensitivity);
-        });
+        const QSet<QString> strings = modelStringSet(modelStrings, sensitivity);
+        return this->findBy([ & ](const CAircraftModel & model) { return strings.contains(modelStringKey(model.getModelString(), sensitivity)); });
     }
 
     CAircraftModelList CAircraftModelList::findByNotInModelStrings(const QStringList &modelStrings, Qt::CaseSensitivity sensitivity) const
     {
-        return this->findBy([&](const CAircraftModel & model)
-        {
-            const bool c = modelStrings.contains(model.getModelString(), sensitivity);
-            return !c;
-        });
+        const QSet<QString> strings = modelStringSet(modelStrings, sensitivity);
+        return this->findBy([ & ](const CAircraftModel & model) { return !strings.contains(modelStringKey(model.getModelString(), sensitivity)); });
     }
 
     QStringList CAircraftModelList::getModelStringList(bool sort) const
@@ -21,7 +21,13 @@
 #include "blackmisc/stringutils.h"
 #include "blackconfig/buildconfig.h"
 #include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QPointer>
 #include <QStringBuilder>
+#include <algorithm>
 
 using namespace BlackConfig;
 using namespace BlackMisc;
@@ -37,6 +43,10 @@ namespace BlackMisc::Simulation
         QObject(parent)
     {
         this->setObjectName("CInterpolationLogger");
+        m_dumpTimer.setObjectName(this->objectName() + ":dumpTimer");
+        m_dumpTimer.setInterval(DumpIntervalMs);
+        connect(&m_dumpTimer, &QTimer::timeout, this, &CInterpolationLogger::dumpInBackground);
+        m_dumpTimer.start();
     }
 
     const QStringList &CInterpolationLogger::getLogCategories()
@@ -47,21 +57,13 @@ namespace BlackMisc::Simulation
 
     CWorker *CInterpolationLogger::writeLogInBackground(bool clearLog)
     {
-        QList<SituationLog> situations;
-        QList<PartsLog> parts;
-        {
-            QReadLocker l(&m_lockSituations);
-            situations = m_situationLogs;
-        }
-        {
-            QReadLocker l(&m_lockParts);
-            parts = m_partsLogs;
-        }
-
+        const int maxSituations = m_maxSituations;
         QPointer<CInterpolationLogger> myself(this);
-        CWorker *worker = CWorker::fromTask(this, "WriteInterpolationLog", [situations, parts, myself, clearLog]()
+        CWorker *worker = CWorker::fromTask(this, "WriteInterpolationLog", [myself, clearLog, maxSituations]()
         {
-            const CStatusMessageList msg = CInterpolationLogger::writeLogFiles(situations, parts);
+            if (!myself) { return; }
+            myself->dumpRecords();
+            const CStatusMessageList msg = CInterpolationLogger::writeLogFilesFromDumps(myself->getDumpFiles(), maxSituations);
             CLogMessage::preformatted(msg);
 
             if (clearLog && myself) { myself->clearLog(); }
@@ -159,116 +161,267 @@ namespace BlackMisc::Simulation
 
     void CInterpolationLogger::logInterpolation(const SituationLog &log)
     {
-        QWriteLocker l(&m_lockSituations);
-        m_situationLogs.push_back(log);
-        if (m_situationLogs.size() > m_maxSituations)
+        CallsignLogs *logs = this->logsForCallsign(log.callsign);
+        logs->situations.push(SituationLogRecord::fromLog(log));
+        if (logs->lockLast.tryLock())
         {
-            m_situationLogs.removeFirst();
+            // only the latest log is needed, skipped if a reader holds the lock
+            logs->lastSituation = log;
+            logs->lockLast.unlock();
         }
+        m_lastSituationLogs.store(logs, std::memory_order_relaxed);
+        m_newRecords.store(true, std::memory_order_relaxed);
     }
 
     void CInterpolationLogger::logParts(const PartsLog &log)
     {
-        QWriteLocker l(&m_lockParts);
-        m_partsLogs.push_back(log);
+        CallsignLogs *logs = this->logsForCallsign(log.callsign);
+        logs->parts.push(PartsLogRecord::fromLog(log));
+        if (logs->lockLast.tryLock())
+        {
+            logs->lastParts = log;
+            logs->lockLast.unlock();
+        }
+        m_lastPartsLogs.store(logs, std::memory_order_relaxed);
+        m_newRecords.store(true, std::memory_order_relaxed);
     }
 
     void CInterpolationLogger::setMaxSituations(int max)
     {
-        QReadLocker l(&m_lockSituations);
         m_maxSituations = max;
     }
 
     QList<SituationLog> CInterpolationLogger::getSituationsLog() const
     {
-        QReadLocker l(&m_lockSituations);
-        return m_situationLogs;
+        QVector<SituationLogRecord> records;
+        for (const QSharedPointer<CallsignLogs> &logs : this->allLogs()) { logs->situations.copyFrom(0, records); }
+        std::stable_sort(records.begin(), records.end(), [](const SituationLogRecord & a, const SituationLogRecord & b) { return a.tsCurrent < b.tsCurrent; });
+
+        QList<SituationLog> situationLogs;
+        situationLogs.reserve(records.size());
+        for (const SituationLogRecord &record : std::as_const(records)) { situationLogs.push_back(record.toLog()); }
+        return situationLogs;
     }
 
     QList<PartsLog> CInterpolationLogger::getPartsLog() const
     {
-        QReadLocker l(&m_lockParts);
-        return m_partsLogs;
+        QVector<PartsLogRecord> records;
+        for (const QSharedPointer<CallsignLogs> &logs : this->allLogs()) { logs->parts.copyFrom(0, records); }
+        std::stable_sort(records.begin(), records.end(), [](const PartsLogRecord & a, const PartsLogRecord & b) { return a.tsCurrent < b.tsCurrent; });
+
+        QList<PartsLog> partsLogs;
+        partsLogs.reserve(records.size());
+        for (const PartsLogRecord &record : std::as_const(records)) { partsLogs.push_back(record.toLog()); }
+        return partsLogs;
     }
 
     QList<SituationLog> CInterpolationLogger::getSituationsLog(const CCallsign &cs) const
     {
-        const QList<SituationLog> copy(this->getSituationsLog());
-        QList<SituationLog> logs;
-        for (const SituationLog &log : copy)
-        {
-            if (log.callsign != cs) { continue; }
-            logs.push_back(log);
-        }
-        return logs;
+        QList<SituationLog> situationLogs;
+        const CallsignLogs *logs = this->findLogs(cs);
+        if (!logs) { return situationLogs; }
+        const QVector<SituationLogRecord> records = logs->situations.toVector();
+        situationLogs.reserve(records.size());
+        for (const SituationLogRecord &record : records) { situationLogs.push_back(record.toLog()); }
+        return situationLogs;
     }
 
     QList<PartsLog> CInterpolationLogger::getPartsLog(const CCallsign &cs) const
     {
-        const QList<PartsLog> copy(this->getPartsLog());
-        QList<PartsLog> logs;
-        for (const PartsLog &log : copy)
-        {
-            if (log.callsign != cs) { continue; }
-            logs.push_back(log);
-        }
-        return logs;
+        QList<PartsLog> partsLogs;
+        const CallsignLogs *logs = this->findLogs(cs);
+        if (!logs) { return partsLogs; }
+        const QVector<PartsLogRecord> records = logs->parts.toVector();
+        partsLogs.reserve(records.size());
+        for (const PartsLogRecord &record : records) { partsLogs.push_back(record.toLog()); }
+        return partsLogs;
     }
 
     SituationLog CInterpolationLogger::getLastSituationLog() const
     {
-        QReadLocker l(&m_lockSituations);
-        if (m_situationLogs.isEmpty()) { return SituationLog(); }
-        return m_situationLogs.last();
+        const CallsignLogs *logs = m_lastSituationLogs.load(std::memory_order_relaxed);
+        if (!logs) { return SituationLog(); }
+        QMutexLocker l(&logs->lockLast);
+        return logs->lastSituation;
     }
 
     SituationLog CInterpolationLogger::getLastSituationLog(const CCallsign &cs) const
     {
-        const QList<SituationLog> copy(this->getSituationsLog(cs));
-        if (copy.isEmpty()) { return SituationLog(); }
-        return copy.last();
+        const CallsignLogs *logs = this->findLogs(cs);
+        if (!logs) { return SituationLog(); }
+        QMutexLocker l(&logs->lockLast);
+        return logs->lastSituation;
     }
 
     CAircraftSituation CInterpolationLogger::getLastSituation() const
     {
-        QReadLocker l(&m_lockSituations);
-        if (m_situationLogs.isEmpty()) { return CAircraftSituation(); }
-        return m_situationLogs.last().situationCurrent;
+        return this->getLastSituationLog().situationCurrent;
     }
 
     CAircraftSituation CInterpolationLogger::getLastSituation(const CCallsign &cs) const
     {
-        const QList<SituationLog> copy(this->getSituationsLog(cs));
-        if (copy.isEmpty()) { return CAircraftSituation(); }
-        return copy.last().situationCurrent;
+        return this->getLastSituationLog(cs).situationCurrent;
     }
 
     CAircraftParts CInterpolationLogger::getLastParts() const
     {
-        QReadLocker l(&m_lockParts);
-        if (m_partsLogs.isEmpty()) { return CAircraftParts(); }
-        return m_partsLogs.last().parts;
+        return this->getLastPartsLog().parts;
     }
 
     CAircraftParts CInterpolationLogger::getLastParts(const CCallsign &cs) const
     {
-        const QList<PartsLog> copy(this->getPartsLog(cs));
-        if (copy.isEmpty()) { return CAircraftParts(); }
-        return copy.last().parts;
+        return this->getLastPartsLog(cs).parts;
     }
 
     PartsLog CInterpolationLogger::getLastPartsLog() const
     {
-        QReadLocker l(&m_lockParts);
-        if (m_partsLogs.isEmpty()) { return PartsLog(); }
-        return m_partsLogs.last();
+        const CallsignLogs *logs = m_lastPartsLogs.load(std::memory_order_relaxed);
+        if (!logs) { return PartsLog(); }
+        QMutexLocker l(&logs->lockLast);
+        return logs->lastParts;
     }
 
     PartsLog CInterpolationLogger::getLastPartsLog(const CCallsign &cs) const
     {
-        const QList<PartsLog> copy(this->getPartsLog(cs));
-        if (copy.isEmpty()) { return PartsLog(); }
-        return copy.last();
+        const CallsignLogs *logs = this->findLogs(cs);
+        if (!logs) { return PartsLog(); }
+        QMutexLocker l(&logs->lockLast);
+        return logs->lastParts;
+    }
+
+    bool CInterpolationLogger::dumpRecords()
+    {
+        QMutexLocker ld(&m_lockDump);
+        QVector<SituationLogRecord> situations;
+        QVector<PartsLogRecord> parts;
+        for (const QSharedPointer<CallsignLogs> &logs : this->allLogs())
+        {
+            logs->situationsDumped = logs->situations.copyFrom(logs->situationsDumped, situations);
+            logs->partsDumped = logs->parts.copyFrom(logs->partsDumped, parts);
+        }
+        if (situations.isEmpty() && parts.isEmpty()) { return true; }
+
+        if (m_dumpFile.isEmpty())
+        {
+            CInterpolationLogger::removeOldDumpFiles();
+            const QString ts = QDateTime::currentDateTimeUtc().toString("yyyyMMddhhmmss");
+            m_dumpFile = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1_interpolation.dump").arg(ts));
+            m_previousDumpFile = CFileUtils::appendFilePaths(CSwiftDirectories::logDirectory(), QStringLiteral("%1_interpolation_previous.dump").arg(ts));
+        }
+
+        QFile file(m_dumpFile);
+        bool ok = file.open(QIODevice::WriteOnly | QIODevice::Append);
+        if (ok && file.size() == 0) { ok = CInterpolationLogDump::writeHeader(file); }
+        ok = ok && CInterpolationLogDump::writeSituations(file, situations);
+        ok = ok && CInterpolationLogDump::writePartsRecords(file, parts);
+        const qint64 size = file.size();
+        file.close();
+        if (!ok)
+        {
+            CLogMessage(this).warning(u"Failed to write interpolation log dump '%1'") << m_dumpFile;
+            return false;
+        }
+
+        if (size > MaxDumpFileBytes)
+        {
+            // start a new file, keep the current one as previous file
+            QFile::remove(m_previousDumpFile);
+            QFile::rename(m_dumpFile, m_previousDumpFile);
+        }
+        return true;
+    }
+
+    QStringList CInterpolationLogger::getDumpFiles() const
+    {
+        QMutexLocker ld(&m_lockDump);
+        QStringList files;
+        if (QFileInfo::exists(m_previousDumpFile)) { files.push_back(m_previousDumpFile); }
+        if (QFileInfo::exists(m_dumpFile)) { files.push_back(m_dumpFile); }
+        return files;
+    }
+
+    CStatusMessageList CInterpolationLogger::writeLogFilesFromDumps(const QStringList &dumpFiles, int maxSituations)
+    {
+        CStatusMessageList msgs;
+        QVector<SituationLogRecord> situationRecords;
+        QVector<PartsLogRecord> partsRecords;
+        for (const QString &dumpFile : dumpFiles)
+        {
+            QFile file(dumpFile);
+            if (!file.open(QIODevice::ReadOnly) || !CInterpolationLogDump::read(file, situationRecords, partsRecords))
+            {
+                msgs.push_back(CStatusMessage(static_cast<CInterpolationLogger *>(nullptr)).warning(u"Cannot read interpolation log dump '%1'") << dumpFile);
+            }
+        }
+
+        // records are dumped per callsign, the logs are ordered by time
+        std::stable_sort(situationRecords.begin(), situationRecords.end(), [](const SituationLogRecord & a, const SituationLogRecord & b) { return a.tsCurrent < b.tsCurrent; });
+        std::stable_sort(partsRecords.begin(), partsRecords.end(), [](const PartsLogRecord & a, const PartsLogRecord & b) { return a.tsCurrent < b.tsCurrent; });
+        const int first = maxSituations < 0 ? 0 : qMax(0, situationRecords.size() - maxSituations);
+
+        QList<SituationLog> situations;
+        situations.reserve(situationRecords.size() - first);
+        for (int i = first; i < situationRecords.size(); i++) { situations.push_back(situationRecords[i].toLog()); }
+
+        QList<PartsLog> parts;
+        parts.reserve(partsRecords.size());
+        for (const PartsLogRecord &record : std::as_const(partsRecords)) { parts.push_back(record.toLog()); }
+
+        msgs.push_back(CInterpolationLogger::writeLogFiles(situations, parts));
+        return msgs;
+    }
+
+    CInterpolationLogger::CallsignLogs *CInterpolationLogger::logsForCallsign(const CCallsign &cs)
+    {
+        {
+            QReadLocker l(&m_lockLogs);
+            const auto it = m_logs.constFind(cs);
+            if (it != m_logs.cend()) { return it->data(); }
+        }
+
+        QWriteLocker l(&m_lockLogs);
+        QSharedPointer<CallsignLogs> &logs = m_logs[cs];
+        if (!logs) { logs = QSharedPointer<CallsignLogs>::create(); }
+        return logs.data();
+    }
+
+    const CInterpolationLogger::CallsignLogs *CInterpolationLogger::findLogs(const CCallsign &cs) const
+    {
+        QReadLocker l(&m_lockLogs);
+        return m_logs.value(cs).data();
+    }
+
+    QList<QSharedPointer<CInterpolationLogger::CallsignLogs>> CInterpolationLogger::allLogs() const
+    {
+        QReadLocker l(&m_lockLogs);
+        return m_logs.values();
+    }
+
+    void CInterpolationLogger::removeOldDumpFiles()
+    {
+        // file names start with the session timestamp, newest first
+        QDir dir(CSwiftDirectories::logDirectory(), QStringLiteral("*_interpolation*.dump"), QDir::Name | QDir::Reversed, QDir::Files);
+        QStringList sessions;
+        for (const QString &fileName : dir.entryList())
+        {
+            const QString session = fileName.section('_', 0, 0);
+            if (!sessions.contains(session)) { sessions.push_back(session); }
+            if (sessions.size() >= KeptDumpSessions) { dir.remove(fileName); }
+        }
+    }
+
+    void CInterpolationLogger::dumpInBackground()
+    {
+        if (!m_newRecords.exchange(false)) { return; }
+        if (m_dumping.exchange(true)) { m_newRecords = true; return; } // still running, next time
+
+        QPointer<CInterpolationLogger> myself(this);
+        CWorker::fromTask(this, "DumpInterpolationLog", [myself]()
+        {
+            if (!myself) { return; }
+            myself->dumpRecords();
+            myself->m_dumping = false;
+        });
     }
 
     const QString &CInterpolationLogger::filePatternInterpolationLog()
@@ -484,8 +637,26 @@ namespace BlackMisc::Simulation
 
     void CInterpolationLogger::clearLog()
     {
-        { QWriteLocker l(&m_lockSituations); m_situationLogs.clear(); }
-        { QWriteLocker l(&m_lockParts); m_partsLogs.clear(); }
+        QMutexLocker ld(&m_lockDump);
+        for (const QSharedPointer<CallsignLogs> &logs : this->allLogs())
+        {
+            logs->situations.clear();
+            logs->parts.clear();
+            logs->situationsDumped = logs->situations.written();
+            logs->partsDumped = logs->parts.written();
+
+            QMutexLocker l(&logs->lockLast);
+            logs->lastSituation = SituationLog();
+            logs->lastParts = PartsLog();
+        }
+
+        if (!m_dumpFile.isEmpty())
+        {
+            QFile::remove(m_dumpFile);
+            QFile::remove(m_previousDumpFile);
+            m_dumpFile.clear();
+            m_previousDumpFile.clear();
+        }
     }
 
     QString CInterpolationLogger::msSinceEpochToTime(qint64 ms)
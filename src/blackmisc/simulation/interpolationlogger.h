@@ -11,16 +11,24 @@
 #ifndef BLACKMISC_SIMULATION_INTERPOLATIONLOGGER_H
 #define BLACKMISC_SIMULATION_INTERPOLATIONLOGGER_H
 
+#include "blackmisc/simulation/interpolationlogrecord.h"
 #include "blackmisc/simulation/interpolationrenderingsetup.h"
 #include "blackmisc/simulation/remoteaircraftprovider.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/aircraftpartslist.h"
 #include "blackmisc/aviation/aircraftsituationchange.h"
 #include "blackmisc/logcategories.h"
+#include "blackmisc/seqlockringbuffer.h"
 
+#include <QHash>
+#include <QMutex>
 #include <QObject>
+#include <QReadWriteLock>
+#include <QSharedPointer>
 #include <QStringList>
+#include <QTimer>
 #include <QtGlobal>
+#include <atomic>
 
 namespace BlackMisc
 {
@@ -95,7 +103,13 @@ namespace BlackMisc
             QString toQString(const QString &separator = {" "}) const;
         };
 
-        //! Record internal state of interpolator for debugging
+        /*!
+         * Record internal state of interpolator for debugging
+         *
+         * - logs are kept as compact records in a ring buffer per callsign, logging does not block on readers
+         * - records are streamed to a binary dump file in background, the dump is converted to HTML/KML when the log is written
+         * - the latest complete log per callsign is kept for displaying it
+         */
         class BLACKMISC_EXPORT CInterpolationLogger : public QObject
         {
             Q_OBJECT
@@ -111,6 +125,7 @@ namespace BlackMisc
             CWorker *writeLogInBackground(bool clearLog);
 
             //! Clear log file
+            //! \threadsafe
             void clearLog();
 
             //! Latest log files: 0: Interpolation / 1: Parts
@@ -129,22 +144,23 @@ namespace BlackMisc
             //! \threadsafe
             void logParts(const PartsLog &log);
 
-            //! Max.situations logged
+            //! Max.situations written to the log files, the latest situations of all callsigns
+            //! \threadsafe
             void setMaxSituations(int max);
 
-            //! All situation logs
+            //! All situation logs still in memory
             //! \threadsafe
             QList<SituationLog> getSituationsLog() const;
 
-            //! All parts logs
+            //! All parts logs still in memory
             //! \threadsafe
             QList<PartsLog> getPartsLog() const;
 
-            //! All situation logs for callsign
+            //! All situation logs for callsign still in memory
             //! \threadsafe
             QList<SituationLog> getSituationsLog(const Aviation::CCallsign &cs) const;
 
-            //! All parts logs for callsign
+            //! All parts logs for callsign still in memory
             //! \threadsafe
             QList<PartsLog> getPartsLog(const Aviation::CCallsign &cs) const;
 
@@ -180,6 +196,19 @@ namespace BlackMisc
             //! \threadsafe
             PartsLog getLastPartsLog(const Aviation::CCallsign &cs) const;
 
+            //! Stream records not yet dumped to the dump file
+            //! \remark normally done by a timer in background
+            //! \threadsafe
+            bool dumpRecords();
+
+            //! Dump files written so far, oldest first
+            //! \threadsafe
+            QStringList getDumpFiles() const;
+
+            //! Convert dump files to the HTML/KML log files
+            //! \remark maxSituations < 0 means all situations
+            static CStatusMessageList writeLogFilesFromDumps(const QStringList &dumpFiles, int maxSituations);
+
             //! File pattern for interpolation log
             static const QString &filePatternInterpolationLog();
 
@@ -198,7 +227,50 @@ namespace BlackMisc
             //! Create readable time
             static QString msSinceEpochToTime(qint64 t1, qint64 t2, qint64 t3 = -1);
 
+            //! Situation records kept in memory per callsign
+            static constexpr int SituationRingCapacity = 1024;
+
+            //! Parts records kept in memory per callsign
+            static constexpr int PartsRingCapacity = 256;
+
+            //! Interval for streaming records to the dump file
+            static constexpr int DumpIntervalMs = 5000;
+
+            //! Dump file size when a new file is started, only the current and the previous file are kept
+            static constexpr qint64 MaxDumpFileBytes = 64 * 1024 * 1024;
+
+            //! Dump files of that many sessions are kept in the log directory, including the current one
+            static constexpr int KeptDumpSessions = 3;
+
         private:
+            //! Logs of one callsign
+            struct CallsignLogs
+            {
+                CSeqLockRingBuffer<SituationLogRecord, SituationRingCapacity> situations; //!< situation records
+                CSeqLockRingBuffer<PartsLogRecord, PartsRingCapacity> parts; //!< parts records
+                quint64 situationsDumped = 0; //!< next situation record to be dumped, guarded by m_lockDump
+                quint64 partsDumped = 0;      //!< next parts record to be dumped, guarded by m_lockDump
+                mutable QMutex lockLast;      //!< lock last logs, writers only try to lock
+                SituationLog lastSituation;   //!< last complete situation log
+                PartsLog lastParts;           //!< last complete parts log
+            };
+
+            //! Logs for callsign, created if not existing
+            //! \remark logs are never deleted, so the pointer stays valid
+            CallsignLogs *logsForCallsign(const Aviation::CCallsign &cs);
+
+            //! Logs for callsign or nullptr
+            const CallsignLogs *findLogs(const Aviation::CCallsign &cs) const;
+
+            //! All callsign logs
+            QList<QSharedPointer<CallsignLogs>> allLogs() const;
+
+            //! Stream records in background if there are new ones
+            void dumpInBackground();
+
+            //! Remove the dump files of older sessions, only the newest KeptDumpSessions - 1 are kept
+            static void removeOldDumpFiles();
+
             //! Get log as HTML table
             static QString getHtmlInterpolationLog(const QList<SituationLog> &logs);
 
@@ -220,11 +292,17 @@ namespace BlackMisc
             //! Status of file operation
             static CStatusMessage logStatusFileWriting(bool success, const QString &fileName);
 
-            mutable QReadWriteLock m_lockSituations; //!< lock logging situations
-            mutable QReadWriteLock m_lockParts;      //!< lock logging parts
-            int m_maxSituations = 2500;              //!< max.number of situations
-            QList<PartsLog> m_partsLogs;             //!< logs of parts
-            QList<SituationLog> m_situationLogs;     //!< logs of interpolation
+            mutable QReadWriteLock m_lockLogs;   //!< lock m_logs, only written when a callsign is logged first time
+            QHash<Aviation::CCallsign, QSharedPointer<CallsignLogs>> m_logs; //!< logs per callsign
+            std::atomic<CallsignLogs *> m_lastSituationLogs { nullptr }; //!< logs of the callsign logged last
+            std::atomic<CallsignLogs *> m_lastPartsLogs { nullptr };     //!< logs of the callsign logged last
+            std::atomic_int m_maxSituations { 2500 }; //!< max.number of situations written to the log files
+            std::atomic_bool m_newRecords { false };  //!< records logged since last dump
+            std::atomic_bool m_dumping { false };     //!< dump running in background
+            mutable QMutex m_lockDump;           //!< lock dump files and dumped indexes
+            QString m_dumpFile;                  //!< current dump file, guarded by m_lockDump
+            QString m_previousDumpFile;          //!< previous dump file, guarded by m_lockDump
+            QTimer m_dumpTimer;                  //!< triggers streaming records to the dump file
         };
     } // namespace
 } // namespace
@@ -0,0 +1,342 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/simulation/interpolationlogrecord.h"
+#include "blackmisc/simulation/interpolationlogger.h"
+#include "blackmisc/aviation/heading.h"
+#include "blackmisc/geo/elevationplane.h"
+#include "blackmisc/pq/angle.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/units.h"
+
+#include <QByteArray>
+#include <QIODevice>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMisc::Simulation
+{
+    namespace
+    {
+        //! Copy string truncated and 0 terminated
+        template <int N> void toChars(char (&dest)[N], const QString &string)
+        {
+            const QByteArray latin1 = string.toLatin1();
+            const int n = qMin(latin1.size(), N - 1);
+            std::memcpy(dest, latin1.constData(), static_cast<size_t>(n));
+            dest[n] = 0;
+        }
+
+        //! String from 0 terminated chars
+        template <int N> QString fromChars(const char (&src)[N])
+        {
+            return QString::fromLatin1(src, static_cast<int>(qstrnlen(src, N)));
+        }
+
+        //! Value or NaN if null
+        template <class PQ, class MU> double valueOrNaN(const PQ &pq, const MU &unit)
+        {
+            return pq.isNull() ? std::numeric_limits<double>::quiet_NaN() : pq.value(unit);
+        }
+
+        //! Quantity or null if NaN
+        template <class PQ, class MU> PQ quantityOrNull(double value, const MU &unit)
+        {
+            return std::isnan(value) ? PQ::null() : PQ(value, unit);
+        }
+
+        //! Header of a dump
+        struct DumpHeader
+        {
+            char magic[8];              //!< magic
+            quint32 version;            //!< CInterpolationLogDump::Version
+            quint32 byteOrder;          //!< detects other byte order
+            quint32 situationRecordSize; //!< sizeof(SituationLogRecord)
+            quint32 partsRecordSize;    //!< sizeof(PartsLogRecord)
+        };
+
+        //! Header of this build
+        DumpHeader thisBuildHeader()
+        {
+            DumpHeader h;
+            std::memcpy(h.magic, "SWIFTILD", sizeof(h.magic));
+            h.version = CInterpolationLogDump::Version;
+            h.byteOrder = 0x01020304;
+            h.situationRecordSize = sizeof(SituationLogRecord);
+            h.partsRecordSize = sizeof(PartsLogRecord);
+            return h;
+        }
+    }
+
+    CompactSituation CompactSituation::fromSituation(const CAircraftSituation &situation)
+    {
+        static const CAngleUnit deg = CAngleUnit::deg();
+        static const CLengthUnit ft = CLengthUnit::ft();
+
+        CompactSituation c;
+        c.msSinceEpoch = situation.getMSecsSinceEpoch();
+        c.timeOffsetMs = situation.getTimeOffsetMs();
+        c.isNull = situation.isNull();
+        if (c.isNull) { return c; }
+
+        c.latDeg = situation.latitude().value(deg);
+        c.lngDeg = situation.longitude().value(deg);
+        c.altitudeFt = situation.getAltitude().value(ft);
+        c.hasElevation = situation.hasGroundElevation();
+        if (c.hasElevation)
+        {
+            const CElevationPlane &plane = situation.getGroundElevationPlane();
+            c.elvLatDeg = plane.latitude().value(deg);
+            c.elvLngDeg = plane.longitude().value(deg);
+            c.elvFt = plane.getAltitude().value(ft);
+            c.elvRadiusM = valueOrNaN(plane.getRadius(), CLengthUnit::m());
+            c.elvInfo = static_cast<qint8>(situation.getGroundElevationInfo());
+        }
+        c.pitchDeg = valueOrNaN(situation.getPitch(), deg);
+        c.bankDeg = valueOrNaN(situation.getBank(), deg);
+        c.headingDeg = valueOrNaN(situation.getHeading(), deg);
+        c.groundSpeedKts = valueOrNaN(situation.getGroundSpeed(), CSpeedUnit::kts());
+        c.cgFt = valueOrNaN(situation.getCG(), ft);
+        c.onGroundFactor = situation.getOnGroundFactor();
+        c.onGround = static_cast<qint8>(situation.getOnGround());
+        c.onGroundDetails = static_cast<qint8>(situation.getOnGroundDetails());
+        return c;
+    }
+
+    CAircraftSituation CompactSituation::toSituation(const CCallsign &callsign) const
+    {
+        static const CAngleUnit deg = CAngleUnit::deg();
+        static const CLengthUnit ft = CLengthUnit::ft();
+
+        CAircraftSituation situation(callsign);
+        situation.setMSecsSinceEpoch(msSinceEpoch);
+        situation.setTimeOffsetMs(timeOffsetMs);
+        if (isNull) { return situation; }
+
+        situation.setPosition(CCoordinateGeodetic(latDeg, lngDeg, altitudeFt));
+        if (hasElevation)
+        {
+            const CElevationPlane plane(elvLatDeg, elvLngDeg, elvFt, quantityOrNull<CLength>(elvRadiusM, CLengthUnit::m()));
+            situation.setGroundElevation(plane, static_cast<CAircraftSituation::GndElevationInfo>(elvInfo));
+        }
+        situation.setPitch(quantityOrNull<CAngle>(pitchDeg, deg));
+        situation.setBank(quantityOrNull<CAngle>(bankDeg, deg));
+        situation.setHeading(std::isnan(headingDeg) ? CHeading(CAngle::null(), CHeading::True) : CHeading(headingDeg, CHeading::True, deg));
+        situation.setGroundSpeed(quantityOrNull<CSpeed>(groundSpeedKts, CSpeedUnit::kts()));
+        situation.setCG(quantityOrNull<CLength>(cgFt, ft));
+        situation.setOnGround(static_cast<CAircraftSituation::IsOnGround>(onGround), static_cast<CAircraftSituation::OnGroundDetails>(onGroundDetails));
+        situation.setOnGroundFactor(onGroundFactor);
+        return situation;
+    }
+
+    CompactParts CompactParts::fromParts(const CAircraftParts &parts)
+    {
+        CompactParts c;
+        c.msSinceEpoch = parts.getMSecsSinceEpoch();
+        c.timeOffsetMs = parts.getTimeOffsetMs();
+        c.flapsPercent = parts.getFlapsPercent();
+        c.partsDetails = static_cast<qint32>(parts.getPartsDetails());
+        c.gearDown = parts.isGearDown();
+        c.spoilersOut = parts.isSpoilersOut();
+        c.onGround = parts.isOnGround();
+
+        const CAircraftLights lights = parts.getLights();
+        if (lights.isNull())          { c.lights |= LightsNull; }
+        if (lights.isStrobeOn())      { c.lights |= Strobe; }
+        if (lights.isLandingOn())     { c.lights |= Landing; }
+        if (lights.isTaxiOn())        { c.lights |= Taxi; }
+        if (lights.isBeaconOn())      { c.lights |= Beacon; }
+        if (lights.isNavOn())         { c.lights |= Nav; }
+        if (lights.isLogoOn())        { c.lights |= Logo; }
+        if (lights.isRecognitionOn()) { c.lights |= Recognition; }
+        if (lights.isCabinOn())       { c.lights |= Cabin; }
+
+        const int engines = qMin(parts.getEnginesCount(), 32);
+        c.engineCount = static_cast<quint8>(engines);
+        for (int e = 0; e < engines; e++)
+        {
+            if (parts.isEngineOn(e + 1)) { c.enginesOn |= (1u << e); }
+        }
+        return c;
+    }
+
+    CAircraftParts CompactParts::toParts() const
+    {
+        CAircraftParts parts(flapsPercent);
+        parts.setMSecsSinceEpoch(msSinceEpoch);
+        parts.setTimeOffsetMs(timeOffsetMs);
+        parts.setPartsDetails(static_cast<CAircraftParts::PartsDetails>(partsDetails));
+        parts.setGearDown(gearDown);
+        parts.setSpoilersOut(spoilersOut);
+        parts.setOnGround(onGround);
+
+        CAircraftLights l(lights & Strobe, lights & Landing, lights & Taxi, lights & Beacon, lights & Nav, lights & Logo, lights & Recognition, lights & Cabin);
+        l.setNull(lights & LightsNull);
+        parts.setLights(l);
+
+        CAircraftEngineList engines;
+        engines.initEngines(engineCount, false);
+        for (int e = 0; e < engineCount; e++)
+        {
+            if (enginesOn & (1u << e)) { engines.setEngineOn(e + 1, true); }
+        }
+        parts.setEngines(engines);
+        return parts;
+    }
+
+    SituationLogRecord SituationLogRecord::fromLog(const SituationLog &log)
+    {
+        static const CLengthUnit ft = CLengthUnit::ft();
+
+        SituationLogRecord r;
+        toChars(r.callsign, log.callsign.asString());
+        r.tsCurrent = log.tsCurrent;
+        r.tsInterpolated = log.tsInterpolated;
+        r.groundFactor = log.groundFactor;
+        r.simTimeFraction = log.simTimeFraction;
+        r.deltaSampleTimesMs = log.deltaSampleTimesMs;
+        r.cgAboveGroundFt = valueOrNaN(log.cgAboveGround, ft);
+        r.sceneryOffsetFt = valueOrNaN(log.sceneryOffset, ft);
+        r.noNetworkSituations = log.noNetworkSituations;
+        r.noInvalidSituations = log.noInvalidSituations;
+        r.interpolator = log.interpolator.toLatin1();
+        r.useParts = log.useParts;
+        r.vtolAircraft = log.vtolAircraft;
+        r.interpolantRecalc = log.interpolantRecalc;
+        toChars(r.altCorrection, log.altCorrection);
+        toChars(r.elevationInfo, log.elevationInfo);
+
+        // latest situations, latest at end
+        const int n = qMin(log.interpolationSituations.sizeInt(), 3);
+        const int skip = log.interpolationSituations.sizeInt() - n;
+        r.noInterpolationSituations = n;
+        for (int i = 0; i < n; i++)
+        {
+            r.interpolationSituations[i] = CompactSituation::fromSituation(log.interpolationSituations[skip + i]);
+        }
+        r.situationCurrent = CompactSituation::fromSituation(log.situationCurrent);
+        r.parts = CompactParts::fromParts(log.parts);
+        return r;
+    }
+
+    SituationLog SituationLogRecord::toLog() const
+    {
+        static const CLengthUnit ft = CLengthUnit::ft();
+
+        SituationLog log;
+        log.callsign = CCallsign(fromChars(callsign));
+        log.tsCurrent = tsCurrent;
+        log.tsInterpolated = tsInterpolated;
+        log.groundFactor = groundFactor;
+        log.simTimeFraction = simTimeFraction;
+        log.deltaSampleTimesMs = deltaSampleTimesMs;
+        log.cgAboveGround = quantityOrNull<CLength>(cgAboveGroundFt, ft);
+        log.sceneryOffset = quantityOrNull<CLength>(sceneryOffsetFt, ft);
+        log.noNetworkSituations = noNetworkSituations;
+        log.noInvalidSituations = noInvalidSituations;
+        log.interpolator = QChar::fromLatin1(interpolator);
+        log.useParts = useParts;
+        log.vtolAircraft = vtolAircraft;
+        log.interpolantRecalc = interpolantRecalc;
+        log.altCorrection = fromChars(altCorrection);
+        log.elevationInfo = fromChars(elevationInfo);
+        for (int i = 0; i < qMin(noInterpolationSituations, 3); i++)
+        {
+            log.interpolationSituations.push_back(interpolationSituations[i].toSituation(log.callsign));
+        }
+        log.situationCurrent = situationCurrent.toSituation(log.callsign);
+        log.parts = parts.toParts();
+        return log;
+    }
+
+    PartsLogRecord PartsLogRecord::fromLog(const PartsLog &log)
+    {
+        PartsLogRecord r;
+        toChars(r.callsign, log.callsign.asString());
+        r.tsCurrent = log.tsCurrent;
+        r.noNetworkParts = log.noNetworkParts;
+        r.empty = log.empty;
+        r.parts = CompactParts::fromParts(log.parts);
+        return r;
+    }
+
+    PartsLog PartsLogRecord::toLog() const
+    {
+        PartsLog log;
+        log.callsign = CCallsign(fromChars(callsign));
+        log.tsCurrent = tsCurrent;
+        log.noNetworkParts = noNetworkParts;
+        log.empty = empty;
+        log.parts = parts.toParts();
+        return log;
+    }
+
+    bool CInterpolationLogDump::writeHeader(QIODevice &device)
+    {
+        const DumpHeader h = thisBuildHeader();
+        return device.write(reinterpret_cast<const char *>(&h), sizeof(h)) == static_cast<qint64>(sizeof(h));
+    }
+
+    bool CInterpolationLogDump::writeSituations(QIODevice &device, const QVector<SituationLogRecord> &records)
+    {
+        return writeBlock(device, SituationBlock, reinterpret_cast<const char *>(records.constData()), records.size(), sizeof(SituationLogRecord));
+    }
+
+    bool CInterpolationLogDump::writePartsRecords(QIODevice &device, const QVector<PartsLogRecord> &records)
+    {
+        return writeBlock(device, PartsBlock, reinterpret_cast<const char *>(records.constData()), records.size(), sizeof(PartsLogRecord));
+    }
+
+    bool CInterpolationLogDump::read(QIODevice &device, QVector<SituationLogRecord> &situations, QVector<PartsLogRecord> &parts)
+    {
+        DumpHeader h;
+        if (device.read(reinterpret_cast<char *>(&h), sizeof(h)) != static_cast<qint64>(sizeof(h))) { return false; }
+        const DumpHeader expected = thisBuildHeader();
+        if (std::memcmp(&h, &expected, sizeof(h)) != 0) { return false; }
+
+        quint32 block[2]; // type, count
+        while (device.read(reinterpret_cast<char *>(block), sizeof(block)) == static_cast<qint64>(sizeof(block)))
+        {
+            const int count = static_cast<int>(block[1]);
+            if (block[0] == SituationBlock)
+            {
+                const int start = situations.size();
+                situations.resize(start + count);
+                const qint64 bytes = static_cast<qint64>(count) * static_cast<qint64>(sizeof(SituationLogRecord));
+                if (device.read(reinterpret_cast<char *>(situations.data() + start), bytes) != bytes) { situations.resize(start); break; }
+            }
+            else if (block[0] == PartsBlock)
+            {
+                const int start = parts.size();
+                parts.resize(start + count);
+                const qint64 bytes = static_cast<qint64>(count) * static_cast<qint64>(sizeof(PartsLogRecord));
+                if (device.read(reinterpret_cast<char *>(parts.data() + start), bytes) != bytes) { parts.resize(start); break; }
+            }
+            else
+            {
+                break; // corrupt, keep what has been read
+            }
+        }
+        return true;
+    }
+
+    bool CInterpolationLogDump::writeBlock(QIODevice &device, BlockType type, const char *data, int count, int recordSize)
+    {
+        if (count < 1) { return true; }
+        const quint32 block[2] = { type, static_cast<quint32>(count) };
+        if (device.write(reinterpret_cast<const char *>(block), sizeof(block)) != static_cast<qint64>(sizeof(block))) { return false; }
+        const qint64 bytes = static_cast<qint64>(count) * recordSize;
+        return device.write(data, bytes) == bytes;
+    }
+} // ns
@@ -0,0 +1,183 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_INTERPOLATIONLOGRECORD_H
+#define BLACKMISC_SIMULATION_INTERPOLATIONLOGRECORD_H
+
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QVector>
+#include <QtGlobal>
+#include <type_traits>
+
+class QIODevice;
+
+namespace BlackMisc::Simulation
+{
+    struct SituationLog;
+    struct PartsLog;
+
+    //! Situation as plain values, null values are NaN
+    //! \remark lossy, only the values shown in the interpolation logs are kept
+    struct BLACKMISC_EXPORT CompactSituation
+    {
+        qint64 msSinceEpoch = -1;      //!< timestamp
+        qint64 timeOffsetMs = 0;       //!< time offset
+        double latDeg = 0;             //!< latitude
+        double lngDeg = 0;             //!< longitude
+        double altitudeFt = 0;         //!< altitude MSL
+        double elvLatDeg = 0;          //!< ground elevation plane latitude
+        double elvLngDeg = 0;          //!< ground elevation plane longitude
+        double elvFt = 0;              //!< ground elevation
+        double elvRadiusM = 0;         //!< ground elevation plane radius
+        double pitchDeg = 0;           //!< pitch
+        double bankDeg = 0;            //!< bank
+        double headingDeg = 0;         //!< true heading
+        double groundSpeedKts = 0;     //!< ground speed
+        double cgFt = 0;               //!< center of gravity
+        double onGroundFactor = -1;    //!< ground factor
+        qint8 onGround = 0;            //!< Aviation::CAircraftSituation::IsOnGround
+        qint8 onGroundDetails = 0;     //!< Aviation::CAircraftSituation::OnGroundDetails
+        qint8 elvInfo = 0;             //!< Aviation::CAircraftSituation::GndElevationInfo
+        bool hasElevation = false;     //!< ground elevation plane set
+        bool isNull = true;            //!< null situation
+
+        //! From situation
+        static CompactSituation fromSituation(const Aviation::CAircraftSituation &situation);
+
+        //! To situation
+        Aviation::CAircraftSituation toSituation(const Aviation::CCallsign &callsign) const;
+    };
+
+    //! Parts as plain values
+    struct BLACKMISC_EXPORT CompactParts
+    {
+        qint64 msSinceEpoch = -1;      //!< timestamp
+        qint64 timeOffsetMs = 0;       //!< time offset
+        qint32 flapsPercent = -1;      //!< flaps
+        qint32 partsDetails = 0;       //!< Aviation::CAircraftParts::PartsDetails
+        quint32 enginesOn = 0;         //!< bit n set: engine n+1 on
+        quint16 lights = 0;            //!< light bits, see LightBits
+        quint8 engineCount = 0;        //!< number of engines, max. 32
+        bool gearDown = false;         //!< gear down
+        bool spoilersOut = false;      //!< spoilers out
+        bool onGround = false;         //!< on ground
+
+        //! Light bits
+        enum LightBits
+        {
+            Strobe = 1 << 0, Landing = 1 << 1, Taxi = 1 << 2, Beacon = 1 << 3,
+            Nav = 1 << 4, Logo = 1 << 5, Recognition = 1 << 6, Cabin = 1 << 7,
+            LightsNull = 1 << 8
+        };
+
+        //! From parts
+        static CompactParts fromParts(const Aviation::CAircraftParts &parts);
+
+        //! To parts
+        Aviation::CAircraftParts toParts() const;
+    };
+
+    //! Compact SituationLog, fixed size and trivially copyable
+    //! \remark used setup and situation change are not kept, strings are truncated
+    struct BLACKMISC_EXPORT SituationLogRecord
+    {
+        char callsign[16] = {};        //!< callsign, Latin-1, 0 terminated
+        qint64 tsCurrent = -1;         //!< SituationLog::tsCurrent
+        qint64 tsInterpolated = -1;    //!< SituationLog::tsInterpolated
+        double groundFactor = -1;      //!< SituationLog::groundFactor
+        double simTimeFraction = -1;   //!< SituationLog::simTimeFraction
+        double deltaSampleTimesMs = -1; //!< SituationLog::deltaSampleTimesMs
+        double cgAboveGroundFt = 0;    //!< SituationLog::cgAboveGround, NaN if null
+        double sceneryOffsetFt = 0;    //!< SituationLog::sceneryOffset, NaN if null
+        qint32 noNetworkSituations = 0; //!< SituationLog::noNetworkSituations
+        qint32 noInvalidSituations = 0; //!< SituationLog::noInvalidSituations
+        qint32 noInterpolationSituations = 0; //!< used entries of interpolationSituations
+        char interpolator = 0;         //!< SituationLog::interpolator
+        bool useParts = false;         //!< SituationLog::useParts
+        bool vtolAircraft = false;     //!< SituationLog::vtolAircraft
+        bool interpolantRecalc = false; //!< SituationLog::interpolantRecalc
+        char altCorrection[24] = {};   //!< SituationLog::altCorrection, truncated
+        char elevationInfo[48] = {};   //!< SituationLog::elevationInfo, truncated
+        CompactSituation interpolationSituations[3]; //!< latest 3 interpolation situations, latest at end
+        CompactSituation situationCurrent; //!< SituationLog::situationCurrent
+        CompactParts parts;            //!< SituationLog::parts
+
+        //! From log
+        static SituationLogRecord fromLog(const SituationLog &log);
+
+        //! To log
+        SituationLog toLog() const;
+    };
+
+    //! Compact PartsLog, fixed size and trivially copyable
+    struct BLACKMISC_EXPORT PartsLogRecord
+    {
+        char callsign[16] = {};        //!< callsign, Latin-1, 0 terminated
+        qint64 tsCurrent = -1;         //!< PartsLog::tsCurrent
+        qint32 noNetworkParts = 0;     //!< PartsLog::noNetworkParts
+        bool empty = false;            //!< PartsLog::empty
+        CompactParts parts;            //!< PartsLog::parts
+
+        //! From log
+        static PartsLogRecord fromLog(const PartsLog &log);
+
+        //! To log
+        PartsLog toLog() const;
+    };
+
+    //! \cond PRIVATE
+    static_assert(std::is_trivially_copyable_v<SituationLogRecord>, "Records are copied as raw memory");
+    static_assert(std::is_trivially_copyable_v<PartsLogRecord>, "Records are copied as raw memory");
+    //! \endcond
+
+    /*!
+     * Binary dump of interpolation log records
+     *
+     * A header followed by blocks of records, each block is the record type, the number of records and the raw records.
+     * Records are written in native byte order and layout, a dump is meant to be read by the same build which wrote it,
+     * the header detects dumps of other builds.
+     */
+    class BLACKMISC_EXPORT CInterpolationLogDump
+    {
+    public:
+        //! Block types
+        enum BlockType : quint32
+        {
+            SituationBlock = 1,
+            PartsBlock = 2
+        };
+
+        //! Dump version
+        static constexpr quint32 Version = 1;
+
+        //! Write header, needed once at the beginning of the dump
+        static bool writeHeader(QIODevice &device);
+
+        //! Append situation records
+        static bool writeSituations(QIODevice &device, const QVector<SituationLogRecord> &records);
+
+        //! Append parts records
+        static bool writePartsRecords(QIODevice &device, const QVector<PartsLogRecord> &records);
+
+        //! Read all records, records are appended
+        //! \remark a truncated last block (i.e. written while reading) is ignored
+        //! \return false if the header is missing or from another build
+        static bool read(QIODevice &device, QVector<SituationLogRecord> &situations, QVector<PartsLogRecord> &parts);
+
+    private:
+        //! Append block
+        static bool writeBlock(QIODevice &device, BlockType type, const char *data, int count, int recordSize);
+    };
+} // ns
+
+#endif // guard
@@ -20,6 +20,7 @@
 #include "blackmisc/pq/speed.h"
 #include "blackmisc/pq/units.h"
 #include "blackmisc/pq/length.h"
+#include "blackmisc/latencytrace.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/verify.h"
 #include "blackmisc/stringutils.h"
@@ -220,6 +221,7 @@ namespace BlackMisc::Simulation
     template<typename Derived>
     CInterpolationResult CInterpolator<Derived>::getInterpolation(qint64 currentTimeSinceEpoc, const CInterpolationAndRenderingSetupPerCallsign &setup, int aircraftNumber)
     {
+        const CLatencySpan span(CLatencyTrace::Interpolation, m_callsign.asString());
         CInterpolationResult result;
         do
         {
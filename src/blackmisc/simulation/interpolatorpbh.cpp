@@ -17,14 +17,14 @@ using namespace BlackMisc::PhysicalQuantities;
 
 namespace BlackMisc::Simulation
 {
-    CAngle CInterpolatorPbh::interpolateAngle(const CAngle &begin, const CAngle &end, double timeFraction0to1)
+    CStaticAngle CInterpolatorPbh::interpolateAngle(CStaticAngle begin, CStaticAngle end, double timeFraction0to1)
     {
         // determine the right direction (to left, to right) we interpolate towards to
         //  -30 ->   30 =>    60 (via 0)
         //   30 ->  -30 =>   -60 (via 0)
         //  170 -> -170 =>  -340 (via 180)
         // -170 ->  170 =>   340 (via 180)
-        double deltaDeg = (end - begin).value(CAngleUnit::deg());
+        double deltaDeg = (end - begin).value<StaticUnits::deg>();
         if (deltaDeg > 180.0) { deltaDeg -= 360; }
         else if (deltaDeg < -180.0) { deltaDeg += 360; }
 
@@ -34,42 +34,60 @@ namespace BlackMisc::Simulation
         }
 
         //! make sure to not end up we extrapolation
-        if (timeFraction0to1 >= 1.0) { return begin + CAngle(deltaDeg, CAngleUnit::deg()); }
+        if (timeFraction0to1 >= 1.0) { return begin + CStaticAngle::from<StaticUnits::deg>(deltaDeg); }
         if (timeFraction0to1 <= 0.0) { return begin; }
-        return begin + CAngle(timeFraction0to1 * deltaDeg, CAngleUnit::deg());
+        return begin + CStaticAngle::from<StaticUnits::deg>(timeFraction0to1 * deltaDeg);
     }
 
     CHeading CInterpolatorPbh::getHeading() const
     {
         // HINT: VTOL aircraft can change pitch/bank without changing position, planes cannot
         // Interpolate heading: HDG = (HdgB - HdgA) * t + HdgA
-        const CHeading headingBegin = m_oldSituation.getHeading();
-        const CHeading headingEnd   = m_newSituation.getHeading();
+        const CHeading &headingBegin = m_oldSituation.getHeading();
+        const CHeading &headingEnd   = m_newSituation.getHeading();
 
         if (CBuildConfig::isLocalDeveloperDebugBuild())
         {
             BLACK_VERIFY_X(headingBegin.getReferenceNorth() == headingEnd.getReferenceNorth(), Q_FUNC_INFO, "Need same reference");
         }
-        return CHeading(interpolateAngle(headingBegin, headingEnd, m_simulationTimeFraction), headingEnd.getReferenceNorth());
+        return CHeading(this->getHeadingStatic().toRuntime(headingBegin.getUnit()), headingEnd.getReferenceNorth());
     }
 
     CAngle CInterpolatorPbh::getPitch() const
     {
-        // Interpolate Pitch: Pitch = (PitchB - PitchA) * t + PitchA
-        return interpolateAngle(m_oldSituation.getPitch(), m_newSituation.getPitch(), m_simulationTimeFraction);
+        return this->getPitchStatic().toRuntime(m_oldSituation.getPitch().getUnit());
     }
 
     CAngle CInterpolatorPbh::getBank() const
     {
-        // Interpolate bank: Bank = (BankB - BankA) * t + BankA
-        return interpolateAngle(m_oldSituation.getBank(), m_newSituation.getBank(), m_simulationTimeFraction);
+        return this->getBankStatic().toRuntime(m_oldSituation.getBank().getUnit());
     }
 
     CSpeed CInterpolatorPbh::getGroundSpeed() const
     {
-        return (m_newSituation.getGroundSpeed() - m_oldSituation.getGroundSpeed())
-                * m_simulationTimeFraction
-                + m_oldSituation.getGroundSpeed();
+        return this->getGroundSpeedStatic().toRuntime(m_oldSituation.getGroundSpeed().getUnit());
+    }
+
+    CStaticAngle CInterpolatorPbh::getHeadingStatic() const
+    {
+        return interpolateAngle(m_oldSituation.getHeadingStatic(), m_newSituation.getHeadingStatic(), m_simulationTimeFraction);
+    }
+
+    CStaticAngle CInterpolatorPbh::getPitchStatic() const
+    {
+        // Interpolate Pitch: Pitch = (PitchB - PitchA) * t + PitchA
+        return interpolateAngle(m_oldSituation.getPitchStatic(), m_newSituation.getPitchStatic(), m_simulationTimeFraction);
+    }
+
+    CStaticAngle CInterpolatorPbh::getBankStatic() const
+    {
+        // Interpolate bank: Bank = (BankB - BankA) * t + BankA
+        return interpolateAngle(m_oldSituation.getBankStatic(), m_newSituation.getBankStatic(), m_simulationTimeFraction);
+    }
+
+    CStaticSpeed CInterpolatorPbh::getGroundSpeedStatic() const
+    {
+        return CStaticSpeed::interpolate(m_oldSituation.getGroundSpeedStatic(), m_newSituation.getGroundSpeedStatic(), m_simulationTimeFraction);
     }
 
     void CInterpolatorPbh::setSituations(const CAircraftSituation &older, const CAircraftSituation &newer)
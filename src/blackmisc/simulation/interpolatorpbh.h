@@ -15,6 +15,7 @@
 #include "blackmisc/aviation/heading.h"
 #include "blackmisc/pq/angle.h"
 #include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/staticquantity.h"
 #include "blackmisc/blackmiscexport.h"
 
 namespace BlackMisc::Simulation
@@ -40,6 +41,14 @@ namespace BlackMisc::Simulation
         const Aviation::CAircraftSituation &getNewSituation() const { return m_newSituation; }
         //! @}
 
+        //! Getter without runtime unit conversion, values in default units
+        //! @{
+        PhysicalQuantities::CStaticAngle getHeadingStatic() const;
+        PhysicalQuantities::CStaticAngle getPitchStatic() const;
+        PhysicalQuantities::CStaticAngle getBankStatic() const;
+        PhysicalQuantities::CStaticSpeed getGroundSpeedStatic() const;
+        //! @}
+
         //! Set situations
         //! \remark mostly needed for UNIT tests
         void setSituations(const Aviation::CAircraftSituation &older, const Aviation::CAircraftSituation &newer);
@@ -49,7 +58,7 @@ namespace BlackMisc::Simulation
 
     private:
         //! Interpolate angle
-        static PhysicalQuantities::CAngle interpolateAngle(const PhysicalQuantities::CAngle &begin, const PhysicalQuantities::CAngle &end, double timeFraction0to1);
+        static PhysicalQuantities::CStaticAngle interpolateAngle(PhysicalQuantities::CStaticAngle begin, PhysicalQuantities::CStaticAngle end, double timeFraction0to1);
 
         double m_simulationTimeFraction = 0.0;
         Aviation::CAircraftSituation m_oldSituation;
@@ -0,0 +1,299 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blackmisc/simulation/modelstringdictionary.h"
+
+#include <QtGlobal>
+
+namespace BlackMisc::Simulation
+{
+    CModelStringDictionary::CModelStringDictionary(const CAircraftModelList &models)
+    {
+        m_entries.reserve(models.size());
+        this->insert(models);
+    }
+
+    CModelStringDictionary::CModelStringDictionary(const QStringList &modelStrings)
+    {
+        m_entries.reserve(modelStrings.size());
+        for (const QString &modelString : modelStrings) { this->insert(modelString); }
+    }
+
+    void CModelStringDictionary::insert(const CAircraftModel &model)
+    {
+        if (!model.hasModelString()) { return; }
+        this->entryForModelString(model.getModelString()).models.push_back(model);
+    }
+
+    void CModelStringDictionary::insert(const CAircraftModelList &models)
+    {
+        for (const CAircraftModel &model : models) { this->insert(model); }
+    }
+
+    void CModelStringDictionary::insert(const QString &modelString)
+    {
+        if (modelString.isEmpty()) { return; }
+        this->entryForModelString(modelString);
+    }
+
+    bool CModelStringDictionary::removeModelString(const QString &modelString)
+    {
+        const QString key = foldModelString(modelString);
+        if (!m_entries.contains(key)) { return false; }
+        this->removeKey(key);
+        return true;
+    }
+
+    int CModelStringDictionary::removeModelStrings(const CAircraftModelList &models)
+    {
+        int c = 0;
+        for (const CAircraftModel &model : models)
+        {
+            if (this->removeModelString(model.getModelString())) { c++; }
+        }
+        return c;
+    }
+
+    bool CModelStringDictionary::removeModel(const CAircraftModel &model)
+    {
+        const QString key = foldModelString(model.getModelString());
+        const auto it = m_entries.find(key);
+        if (it == m_entries.end()) { return false; }
+        if (!model.hasValidDbKey())
+        {
+            this->removeKey(key);
+            return true;
+        }
+
+        const int dbKey = model.getDbKey();
+        const int r = it->models.removeIf([dbKey](const CAircraftModel & m) { return m.hasValidDbKey() && m.getDbKey() == dbKey; });
+        if (it->models.isEmpty()) { this->removeKey(key); }
+        return r > 0;
+    }
+
+    bool CModelStringDictionary::contains(const QString &modelString) const
+    {
+        if (modelString.isEmpty()) { return false; }
+        return m_entries.contains(foldModelString(modelString));
+    }
+
+    bool CModelStringDictionary::containsPrefix(const QString &prefix) const
+    {
+        if (this->isEmpty()) { return false; }
+        QString nodeKey;
+        return this->trieFindPrefix(foldModelString(prefix), nodeKey) >= 0;
+    }
+
+    CAircraftModel CModelStringDictionary::findFirstByModelStringOrDefault(const QString &modelString) const
+    {
+        if (modelString.isEmpty()) { return CAircraftModel(); }
+        const auto it = m_entries.constFind(foldModelString(modelString));
+        if (it == m_entries.cend() || it->models.isEmpty()) { return CAircraftModel(); }
+        return it->models.front();
+    }
+
+    CAircraftModelList CModelStringDictionary::findByModelString(const QString &modelString) const
+    {
+        if (modelString.isEmpty()) { return CAircraftModelList(); }
+        return m_entries.value(foldModelString(modelString)).models;
+    }
+
+    QStringList CModelStringDictionary::findModelStringsStartingWith(const QString &prefix, int maxNumber) const
+    {
+        QStringList modelStrings;
+        if (this->isEmpty() || maxNumber == 0) { return modelStrings; }
+
+        QString nodeKey;
+        const int node = this->trieFindPrefix(foldModelString(prefix), nodeKey);
+        if (node < 0) { return modelStrings; }
+
+        QStringList keys;
+        this->trieCollect(node, nodeKey, keys, maxNumber);
+        modelStrings.reserve(keys.size());
+        for (const QString &key : std::as_const(keys)) { modelStrings.push_back(m_entries.value(key).modelString); }
+        return modelStrings;
+    }
+
+    CAircraftModelList CModelStringDictionary::findModelsStartingWith(const QString &prefix) const
+    {
+        CAircraftModelList models;
+        if (this->isEmpty()) { return models; }
+
+        QString nodeKey;
+        const int node = this->trieFindPrefix(foldModelString(prefix), nodeKey);
+        if (node < 0) { return models; }
+
+        QStringList keys;
+        this->trieCollect(node, nodeKey, keys, -1);
+        for (const QString &key : std::as_const(keys)) { models.push_back(m_entries.value(key).models); }
+        return models;
+    }
+
+    void CModelStringDictionary::clear()
+    {
+        m_entries.clear();
+        m_trie = { TrieNode() };
+        m_freeTrieNodes.clear();
+    }
+
+    CModelStringDictionary::Entry &CModelStringDictionary::entryForModelString(const QString &modelString)
+    {
+        const QString key = foldModelString(modelString);
+        auto it = m_entries.find(key);
+        if (it == m_entries.end())
+        {
+            Entry entry;
+            entry.modelString = modelString;
+            it = m_entries.insert(key, entry);
+            this->trieInsert(key);
+        }
+        return it.value();
+    }
+
+    void CModelStringDictionary::removeKey(const QString &key)
+    {
+        m_entries.remove(key);
+        this->trieRemove(key);
+    }
+
+    void CModelStringDictionary::trieInsert(const QString &key)
+    {
+        int node = 0;
+        int pos = 0;
+        while (pos < key.length())
+        {
+            const QChar c = key.at(pos);
+            const int child = m_trie[node].children.value(c, -1);
+            if (child < 0)
+            {
+                const int leaf = this->newTrieNode(key.mid(pos), true);
+                m_trie[node].children.insert(c, leaf);
+                return;
+            }
+
+            const QString label = m_trie[child].label;
+            const int common = commonPrefixLength(label, key, pos);
+            if (common < label.length())
+            {
+                // split the edge, the common part becomes a new node
+                const int split = this->newTrieNode(label.left(common), false);
+                m_trie[child].label = label.mid(common);
+                m_trie[split].children.insert(label.at(common), child);
+                m_trie[node].children.insert(c, split);
+                node = split;
+            }
+            else
+            {
+                node = child;
+            }
+            pos += common;
+        }
+        m_trie[node].isKey = true;
+    }
+
+    void CModelStringDictionary::trieRemove(const QString &key)
+    {
+        int parent = -1;
+        int node = 0;
+        int pos = 0;
+        while (pos < key.length())
+        {
+            const int child = m_trie[node].children.value(key.at(pos), -1);
+            if (child < 0) { return; }
+            const int labelLength = m_trie[child].label.length();
+            if (commonPrefixLength(m_trie[child].label, key, pos) < labelLength) { return; }
+            pos += labelLength;
+            parent = node;
+            node = child;
+        }
+
+        TrieNode &n = m_trie[node];
+        if (!n.isKey) { return; }
+        n.isKey = false;
+        if (node == 0) { return; }
+
+        if (n.children.isEmpty())
+        {
+            m_trie[parent].children.remove(n.label.at(0));
+            n = TrieNode();
+            m_freeTrieNodes.push_back(node);
+            if (parent != 0 && !m_trie[parent].isKey && m_trie[parent].children.size() == 1) { this->mergeWithOnlyChild(parent); }
+        }
+        else if (n.children.size() == 1)
+        {
+            this->mergeWithOnlyChild(node);
+        }
+    }
+
+    int CModelStringDictionary::trieFindPrefix(const QString &prefix, QString &nodeKey) const
+    {
+        int node = 0;
+        int pos = 0;
+        nodeKey.clear();
+        while (pos < prefix.length())
+        {
+            const int child = m_trie[node].children.value(prefix.at(pos), -1);
+            if (child < 0) { return -1; }
+            const QString &label = m_trie[child].label;
+            const int common = commonPrefixLength(label, prefix, pos);
+            nodeKey += label;
+            if (pos + common == prefix.length()) { return child; } // prefix ends within or at the end of the label
+            if (common < label.length()) { return -1; }
+            pos += common;
+            node = child;
+        }
+        return node;
+    }
+
+    void CModelStringDictionary::trieCollect(int node, const QString &nodeKey, QStringList &keys, int maxNumber) const
+    {
+        if (maxNumber >= 0 && keys.size() >= maxNumber) { return; }
+        const TrieNode &n = m_trie[node];
+        if (n.isKey) { keys.push_back(nodeKey); }
+        for (auto it = n.children.cbegin(); it != n.children.cend(); ++it)
+        {
+            this->trieCollect(it.value(), nodeKey + m_trie[it.value()].label, keys, maxNumber);
+        }
+    }
+
+    int CModelStringDictionary::newTrieNode(const QString &label, bool isKey)
+    {
+        TrieNode n;
+        n.label = label;
+        n.isKey = isKey;
+        if (!m_freeTrieNodes.isEmpty())
+        {
+            const int node = m_freeTrieNodes.takeLast();
+            m_trie[node] = n;
+            return node;
+        }
+        m_trie.push_back(n);
+        return m_trie.size() - 1;
+    }
+
+    void CModelStringDictionary::mergeWithOnlyChild(int node)
+    {
+        Q_ASSERT_X(m_trie[node].children.size() == 1, Q_FUNC_INFO, "Need exactly one child");
+        const int child = m_trie[node].children.first();
+        TrieNode &n = m_trie[node];
+        TrieNode &c = m_trie[child];
+        n.label += c.label;
+        n.isKey = c.isKey;
+        n.children = c.children;
+        c = TrieNode();
+        m_freeTrieNodes.push_back(child);
+    }
+
+    int CModelStringDictionary::commonPrefixLength(const QString &label, const QString &key, int pos)
+    {
+        const int max = qMin(label.length(), key.length() - pos);
+        int i = 0;
+        while (i < max && label.at(i) == key.at(pos + i)) { i++; }
+        return i;
+    }
+} // ns
@@ -0,0 +1,143 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_MODELSTRINGDICTIONARY_H
+#define BLACKMISC_SIMULATION_MODELSTRINGDICTIONARY_H
+
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/blackmiscexport.h"
+
+#include <QHash>
+#include <QMap>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+namespace BlackMisc::Simulation
+{
+    /*!
+     * Case insensitive dictionary of model strings, optionally with the models for each string.
+     *
+     * Counterpart of the CAircraftModelList model string functions with Qt::CaseInsensitive,
+     * strings are compared case folded like CAircraftModel::matchesModelString.
+     * - exact and set membership lookups use a hash, O(length of the string)
+     * - prefix lookups use a compressed trie, O(length of the prefix + number of results)
+     * - models and strings can be added and removed one by one, no rebuild required
+     * \remark not threadsafe, owners guard it by their own locks
+     */
+    class BLACKMISC_EXPORT CModelStringDictionary
+    {
+    public:
+        //! Empty dictionary
+        CModelStringDictionary() = default;
+
+        //! Dictionary of the models
+        explicit CModelStringDictionary(const CAircraftModelList &models);
+
+        //! Dictionary of model strings only, no models
+        explicit CModelStringDictionary(const QStringList &modelStrings);
+
+        //! Add model, models with the same model string are kept in the order they are added
+        //! \remark models without model string are ignored
+        void insert(const CAircraftModel &model);
+
+        //! Add models
+        void insert(const CAircraftModelList &models);
+
+        //! Add model string without model
+        void insert(const QString &modelString);
+
+        //! Remove model string and all its models
+        bool removeModelString(const QString &modelString);
+
+        //! Remove the model strings of the given models and all models with those strings
+        //! \sa CAircraftModelList::removeModelsWithString
+        int removeModelStrings(const CAircraftModelList &models);
+
+        //! Remove the model with the same DB key, or all models with its model string if it has no DB key
+        //! \remark the model string is removed once no models are left for it
+        bool removeModel(const CAircraftModel &model);
+
+        //! Contains model string?
+        bool contains(const QString &modelString) const;
+
+        //! Any model string starting with prefix?
+        bool containsPrefix(const QString &prefix) const;
+
+        //! First model added for model string
+        //! \sa CAircraftModelList::findFirstByModelStringOrDefault
+        CAircraftModel findFirstByModelStringOrDefault(const QString &modelString) const;
+
+        //! All models for model string
+        //! \sa CAircraftModelList::findByModelString
+        CAircraftModelList findByModelString(const QString &modelString) const;
+
+        //! Model strings starting with prefix, ordered by their case folded value
+        //! \remark maxNumber < 0 means all
+        QStringList findModelStringsStartingWith(const QString &prefix, int maxNumber = -1) const;
+
+        //! Models with model string starting with prefix, ordered by their case folded model string
+        //! \sa CAircraftModelList::findModelsStartingWith
+        CAircraftModelList findModelsStartingWith(const QString &prefix) const;
+
+        //! Number of distinct model strings
+        int size() const { return m_entries.size(); }
+
+        //! Empty?
+        bool isEmpty() const { return m_entries.isEmpty(); }
+
+        //! Remove all
+        void clear();
+
+        //! Key used for the model string
+        static QString foldModelString(const QString &modelString) { return modelString.toCaseFolded(); }
+
+    private:
+        //! Model string and its models
+        struct Entry
+        {
+            QString modelString;       //!< model string as first added
+            CAircraftModelList models; //!< models in the order they were added
+        };
+
+        //! Node of the compressed trie, the root has an empty label
+        struct TrieNode
+        {
+            QString label;             //!< case folded edge label from the parent
+            QMap<QChar, int> children; //!< first character of the child label -> node
+            bool isKey = false;        //!< path to this node is a model string
+        };
+
+        //! Entry for the model string, created with the model string as given if not existing
+        Entry &entryForModelString(const QString &modelString);
+
+        //! Remove entry and its trie key
+        void removeKey(const QString &key);
+
+        //! Trie functions, keys are case folded
+        //! @{
+        void trieInsert(const QString &key);
+        void trieRemove(const QString &key);
+        int trieFindPrefix(const QString &prefix, QString &nodeKey) const;
+        void trieCollect(int node, const QString &nodeKey, QStringList &keys, int maxNumber) const;
+        int newTrieNode(const QString &label, bool isKey);
+        void mergeWithOnlyChild(int node);
+        //! @}
+
+        //! Number of equal characters of label and key starting at pos
+        static int commonPrefixLength(const QString &label, const QString &key, int pos);
+
+        QHash<QString, Entry> m_entries;            //!< case folded model string -> entry
+        QVector<TrieNode> m_trie { TrieNode() };    //!< nodes, root at 0
+        QVector<int> m_freeTrieNodes;               //!< unused nodes in m_trie
+    };
+} // ns
+
+#endif // guard
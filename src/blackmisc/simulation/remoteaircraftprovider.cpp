@@ -8,12 +8,17 @@
 
 #include "blackmisc/simulation/remoteaircraftprovider.h"
 #include "blackmisc/simulation/matchingutils.h"
+#include "blackmisc/latencytrace.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/json.h"
 #include "blackmisc/verify.h"
 #include "blackmisc/stringutils.h"
+#include "blackmisc/threadutils.h"
 #include "blackconfig/buildconfig.h"
 
+#include <QMetaMethod>
+#include <QPointer>
+
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::PhysicalQuantities;
 using namespace BlackMisc::Geo;
@@ -38,7 +43,10 @@ namespace BlackMisc::Simulation
         QObject(parent),
         IRemoteAircraftProvider(),
         CIdentifiable(this)
-    { }
+    {
+        m_coalescingTimer.setObjectName(this->objectName().append(":m_coalescingTimer"));
+        connect(&m_coalescingTimer, &QTimer::timeout, this, &CRemoteAircraftProvider::emitCoalescedSituations);
+    }
 
     CSimulatedAircraftList CRemoteAircraftProvider::getAircraftInRange() const
     {
@@ -50,16 +58,15 @@ namespace BlackMisc::Simulation
 
     CCallsignSet CRemoteAircraftProvider::getAircraftInRangeCallsigns() const
     {
-        QReadLocker l(&m_lockAircraft);
-        const QList<CCallsign> callsigns = m_aircraftInRange.keys();
-        l.unlock();
-        return CCallsignSet(callsigns);
+        // the callsigns of the aircraft, the keys are only the callsign strings
+        return this->getAircraftInRange().getCallsigns();
     }
 
     CSimulatedAircraft CRemoteAircraftProvider::getAircraftInRangeForCallsign(const CCallsign &callsign) const
     {
-        const CSimulatedAircraft aircraft = this->getAircraftInRange().findFirstByCallsign(callsign);
-        return aircraft;
+        const int id = CCallsignIds::find(callsign);
+        QReadLocker l(&m_lockAircraft);
+        return m_aircraftInRange.value(id);
     }
 
     CAircraftModel CRemoteAircraftProvider::getAircraftInRangeModelForCallsign(const CCallsign &callsign) const
@@ -71,9 +78,10 @@ namespace BlackMisc::Simulation
     CAircraftSituationList CRemoteAircraftProvider::remoteAircraftSituations(const CCallsign &callsign) const
     {
         static const CAircraftSituationList empty;
+        const int id = CCallsignIds::find(callsign);
         QReadLocker l(&m_lockSituations);
-        if (!m_situationsByCallsign.contains(callsign)) { return empty; }
-        return m_situationsByCallsign[callsign];
+        const auto it = m_situationsByCallsign.constFind(id);
+        return it == m_situationsByCallsign.constEnd() ? empty : *it;
     }
 
     CAircraftSituation CRemoteAircraftProvider::remoteAircraftSituation(const CCallsign &callsign, int index) const
@@ -107,24 +115,27 @@ namespace BlackMisc::Simulation
 
     int CRemoteAircraftProvider::remoteAircraftSituationsCount(const CCallsign &callsign) const
     {
+        const int id = CCallsignIds::find(callsign);
         QReadLocker l(&m_lockSituations);
-        if (!m_situationsByCallsign.contains(callsign)) { return -1; }
-        return m_situationsByCallsign[callsign].size();
+        const auto it = m_situationsByCallsign.constFind(id);
+        return it == m_situationsByCallsign.constEnd() ? -1 : it->size();
     }
 
     CAircraftPartsList CRemoteAircraftProvider::remoteAircraftParts(const CCallsign &callsign) const
     {
         static const CAircraftPartsList empty;
+        const int id = CCallsignIds::find(callsign);
         QReadLocker l(&m_lockParts);
-        if (!m_partsByCallsign.contains(callsign)) { return empty; }
-        return m_partsByCallsign[callsign];
+        const auto it = m_partsByCallsign.constFind(id);
+        return it == m_partsByCallsign.constEnd() ? empty : *it;
     }
 
     int CRemoteAircraftProvider::remoteAircraftPartsCount(const CCallsign &callsign) const
     {
+        const int id = CCallsignIds::find(callsign);
         QReadLocker l(&m_lockParts);
-        if (!m_partsByCallsign.contains(callsign)) { return -1; }
-        return m_partsByCallsign[callsign].size();
+        const auto it = m_partsByCallsign.constFind(id);
+        return it == m_partsByCallsign.constEnd() ? -1 : it->size();
     }
 
     bool CRemoteAircraftProvider::isRemoteAircraftSupportingParts(const CCallsign &callsign) const
@@ -147,14 +158,17 @@ namespace BlackMisc::Simulation
 
     CAircraftSituationChangeList CRemoteAircraftProvider::remoteAircraftSituationChanges(const CCallsign &callsign) const
     {
+        const int id = CCallsignIds::find(callsign);
         QReadLocker l(&m_lockChanges);
-        return m_changesByCallsign[callsign];
+        return m_changesByCallsign.value(id);
     }
 
     int CRemoteAircraftProvider::remoteAircraftSituationChangesCount(const CCallsign &callsign) const
     {
+        const int id = CCallsignIds::find(callsign);
         QReadLocker l(&m_lockChanges);
-        return m_changesByCallsign[callsign].size();
+        const auto it = m_changesByCallsign.constFind(id);
+        return it == m_changesByCallsign.constEnd() ? 0 : it->size();
     }
 
     int CRemoteAircraftProvider::getAircraftInRangeCount() const
@@ -184,6 +198,10 @@ namespace BlackMisc::Simulation
             m_situationsLastModified.clear();
             m_testOffset.clear();
         }
+        {
+            QWriteLocker l(&m_lockCoalesced);
+            m_coalescedSituations.clear();
+        }
         {
             QWriteLocker l(&m_lockChanges);
             m_changesByCallsign.clear();
@@ -211,12 +229,14 @@ namespace BlackMisc::Simulation
 
     bool CRemoteAircraftProvider::addNewAircraftInRange(const CSimulatedAircraft &aircraft)
     {
-        if (this->isAircraftInRange(aircraft.getCallsign())) { return false; }
+        const CCallsign cs = aircraft.getCallsign();
+        int id = CCallsignIds::find(cs);
 
         // store
         {
             QWriteLocker l(&m_lockAircraft);
-            m_aircraftInRange.insert(aircraft.getCallsign(), aircraft);
+            if (m_aircraftInRange.contains(id)) { return false; }
+            m_aircraftInRange.valueRef(id, cs) = aircraft;
         }
         emit this->addedAircraft(aircraft);
         emit this->changedAircraftInRange();
@@ -226,11 +246,13 @@ namespace BlackMisc::Simulation
     int CRemoteAircraftProvider::updateAircraftInRange(const CCallsign &callsign, const CPropertyIndexVariantMap &vm, bool skipEqualValues)
     {
         Q_ASSERT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Missing callsign");
+        const int id = CCallsignIds::find(callsign);
         int c = 0;
         {
             QWriteLocker l(&m_lockAircraft);
-            if (!m_aircraftInRange.contains(callsign)) { return 0; }
-            c = m_aircraftInRange[callsign].apply(vm, skipEqualValues).size();
+            const auto it = m_aircraftInRange.find(id);
+            if (it == m_aircraftInRange.end()) { return 0; }
+            c = it->apply(vm, skipEqualValues).size();
         }
         if (c > 0)
         {
@@ -242,10 +264,12 @@ namespace BlackMisc::Simulation
     bool CRemoteAircraftProvider::updateAircraftInRangeDistanceBearing(const CCallsign &callsign, const CAircraftSituation &situation, const CLength &distance, const CAngle &bearing)
     {
         Q_ASSERT_X(!callsign.isEmpty(), Q_FUNC_INFO, "Missing callsign");
+        const int id = CCallsignIds::find(callsign);
         {
             QWriteLocker l(&m_lockAircraft);
-            if (!m_aircraftInRange.contains(callsign)) { return false; }
-            CSimulatedAircraft &aircraft =  m_aircraftInRange[callsign];
+            const auto it = m_aircraftInRange.find(id);
+            if (it == m_aircraftInRange.end()) { return false; }
+            CSimulatedAircraft &aircraft = *it;
             aircraft.setSituation(situation);
             if (!bearing.isNull())  { aircraft.setRelativeBearing(bearing); }
             if (!distance.isNull()) { aircraft.setRelativeDistance(distance); }
@@ -257,6 +281,10 @@ namespace BlackMisc::Simulation
     {
         const CCallsign cs = situation.getCallsign();
         if (cs.isEmpty()) { return situation; }
+        const CLatencySpan span(CLatencyTrace::StoreSituation, cs.asString());
+
+        // resolved once, all containers below are keyed by the same ID
+        int id = CCallsignIds::find(cs);
 
         // testing
         if (CBuildConfig::isLocalDeveloperDebugBuild())
@@ -269,10 +297,17 @@ namespace BlackMisc::Simulation
         CAircraftSituation situationCorrected(allowTestAltitudeOffset ? this->addTestAltitudeOffsetToSituation(situation) : situation);
 
         // CG, model
-        const CAircraftModel aircraftModel = this->getAircraftInRangeModelForCallsign(cs);
+        CAircraftModel aircraftModel;
+        {
+            QReadLocker l(&m_lockAircraft);
+            const auto aircraft = m_aircraftInRange.constFind(id);
+            if (aircraft != m_aircraftInRange.constEnd()) { aircraftModel = aircraft->getModel(); }
+        }
         if (situation.hasCG() && aircraftModel.getCG() != situation.getCG())
         {
-            this->updateCG(cs, situation.getCG());
+            QWriteLocker l(&m_lockAircraft);
+            const auto aircraft = m_aircraftInRange.find(id);
+            if (aircraft != m_aircraftInRange.end()) { aircraft->setCG(situation.getCG()); }
         }
 
         // list from new to old
@@ -281,8 +316,8 @@ namespace BlackMisc::Simulation
             const qint64 now = QDateTime::currentMSecsSinceEpoch();
             QWriteLocker lock(&m_lockSituations);
             m_situationsAdded++;
-            m_situationsLastModified[cs] = now;
-            CAircraftSituationList &newSituationsList = m_situationsByCallsign[cs];
+            CAircraftSituationList &newSituationsList = m_situationsByCallsign.valueRef(id, cs);
+            m_situationsLastModified.valueRef(id, cs) = now;
             newSituationsList.setAdjustedSortHint(CAircraftSituationList::AdjustedTimestampLatestFirst);
             const int situations = newSituationsList.size();
             if (situations < 1)
@@ -306,7 +341,7 @@ namespace BlackMisc::Simulation
                     newSituationsList.setOnGroundDetails(situation.getOnGroundDetails());
                 }
             }
-            m_latestSituationByCallsign[cs] = situationCorrected;
+            m_latestSituationByCallsign.valueRef(id, cs) = situationCorrected;
 
             // check sort order
             if (CBuildConfig::isLocalDeveloperDebugBuild())
@@ -324,14 +359,14 @@ namespace BlackMisc::Simulation
                 // guess GND
                 simpleChange.guessOnGround(newSituationsList.front(), aircraftModel);
             }
-            updatedSituations = m_situationsByCallsign[cs];
+            updatedSituations = newSituationsList;
 
         } // lock
 
         // calculate change AFTER gnd. was guessed
         Q_ASSERT_X(!updatedSituations.isEmpty(), Q_FUNC_INFO, "Missing situations");
         const CAircraftSituationChange change(updatedSituations, situationCorrected.getCG(), aircraftModel.isVtol(), true, true);
-        this->storeChange(change);
+        this->storeChange(change, id);
 
         if (change.hasSceneryDeviation())
         {
@@ -339,13 +374,29 @@ namespace BlackMisc::Simulation
             situationCorrected.setSceneryOffset(offset);
 
             QWriteLocker lock(&m_lockSituations);
-            m_latestSituationByCallsign[cs].setSceneryOffset(offset);
-            m_situationsByCallsign[cs].front().setSceneryOffset(offset);
+            const auto latest = m_latestSituationByCallsign.find(id);
+            if (latest != m_latestSituationByCallsign.end()) { latest->setSceneryOffset(offset); }
+            const auto situations = m_situationsByCallsign.find(id);
+            if (situations != m_situationsByCallsign.end() && !situations->isEmpty()) { situations->front().setSceneryOffset(offset); }
         }
 
         // situation has been added
         emit this->addedAircraftSituation(situationCorrected);
 
+        // only the latest one per tick for the batch consumers
+        if (m_coalescing)
+        {
+            QWriteLocker lock(&m_lockCoalesced);
+            m_coalescedSituations.valueRef(id, cs) = situationCorrected;
+            m_coalescedSituationsIn++;
+        }
+        else
+        {
+            CAircraftSituationList single;
+            single.push_back(situationCorrected);
+            emit this->addedAircraftSituationsCoalesced(single);
+        }
+
         // bye
         return situationCorrected;
     }
@@ -355,14 +406,17 @@ namespace BlackMisc::Simulation
         BLACK_VERIFY_X(!callsign.isEmpty(), Q_FUNC_INFO, "empty callsign");
         if (callsign.isEmpty()) { return; }
 
+        // resolved once, all containers below are keyed by the same ID
+        int id = CCallsignIds::find(callsign);
+
         // list sorted from new to old
         const qint64 ts = QDateTime::currentMSecsSinceEpoch();
         CAircraftPartsList correctiveParts;
         {
             QWriteLocker lock(&m_lockParts);
             m_partsAdded++;
-            m_partsLastModified[callsign] = ts;
-            CAircraftPartsList &partsList = m_partsByCallsign[callsign];
+            CAircraftPartsList &partsList = m_partsByCallsign.valueRef(id, callsign);
+            m_partsLastModified.valueRef(id, callsign) = ts;
             partsList.push_frontKeepLatestFirstAdjustOffset(parts, true, IRemoteAircraftProvider::MaxPartsPerCallsign);
             partsList.setAdjustedSortHint(CAircraftPartsList::AdjustedTimestampLatestFirst);
 
@@ -379,19 +433,19 @@ namespace BlackMisc::Simulation
         if (!correctiveParts.isEmpty())
         {
             QWriteLocker lock(&m_lockSituations);
-            CAircraftSituationList &situationList = m_situationsByCallsign[callsign];
-            const int c = situationList.adjustGroundFlag(parts);
-            if (c > 0) { m_situationsLastModified[callsign] = ts; }
+            const auto situationList = m_situationsByCallsign.find(id);
+            const int c = situationList == m_situationsByCallsign.end() ? 0 : situationList->adjustGroundFlag(parts);
+            if (c > 0) { m_situationsLastModified.valueRef(id, callsign) = ts; }
         }
 
         // update aircraft
         {
             QWriteLocker l(&m_lockAircraft);
-            if (m_aircraftInRange.contains(callsign))
+            const auto aircraft = m_aircraftInRange.find(id);
+            if (aircraft != m_aircraftInRange.end())
             {
-                CSimulatedAircraft &aircraft = m_aircraftInRange[callsign];
-                aircraft.setParts(parts);
-                aircraft.setPartsSynchronized(true);
+                aircraft->setParts(parts);
+                aircraft->setPartsSynchronized(true);
             }
         }
 
@@ -405,10 +459,10 @@ namespace BlackMisc::Simulation
         emit this->addedAircraftParts(callsign, parts);
     }
 
-    void CRemoteAircraftProvider::storeAircraftParts(const CCallsign &callsign, const QJsonObject &jsonObject, qint64 currentOffsetMs)
+    void CRemoteAircraftProvider::storeAircraftParts(const CCallsign &callsign, const CAircraftPartsDelta &delta, qint64 currentOffsetMs)
     {
         const CSimulatedAircraft remoteAircraft(this->getAircraftInRangeForCallsign(callsign));
-        const bool isFull  = jsonObject.value(CAircraftParts::attributeNameIsFullJson()).toBool();
+        const bool isFull  = delta.isFull();
         const bool validCs = remoteAircraft.hasValidCallsign();
         if (!validCs)
         {
@@ -420,48 +474,36 @@ namespace BlackMisc::Simulation
         if (!remoteAircraft.isPartsSynchronized() && !isFull) { return; }
 
         CAircraftParts parts;
-        try
+        if (isFull)
         {
-            if (isFull)
+            if (CBuildConfig::isLocalDeveloperDebugBuild())
             {
-                if (CBuildConfig::isLocalDeveloperDebugBuild())
+                // validation in dev.env.
+                const int  attributes = delta.getAttributesCount();
+                const bool correctCount = (attributes == CAircraftParts::attributesCountFullJson);
+                BLACK_VERIFY_X(correctCount || !CBuildConfig::isLocalDeveloperDebugBuild(), Q_FUNC_INFO, "Wrong full aircraft parts");
+                if (!correctCount)
                 {
-                    // validation in dev.env.
-                    const int  attributes = jsonObject.size();
-                    const bool correctCount = (attributes == CAircraftParts::attributesCountFullJson);
-                    BLACK_VERIFY_X(correctCount || !CBuildConfig::isLocalDeveloperDebugBuild(), Q_FUNC_INFO, "Wrong full aircraft parts");
-                    if (!correctCount)
+                    CLogMessage(this).warning(u"Wrong full parts attributes, %1 (expected %2)") << attributes << CAircraftParts::attributesCountFullJson;
+                    //! \todo KB 2020-04 ignore? make incremental?
+                    if (attributes < 3)
                     {
-                        CLogMessage(this).warning(u"Wrong full parts attributes, %1 (expected %2)") << attributes << CAircraftParts::attributesCountFullJson;
-                        //! \todo KB 2020-04 ignore? make incremental?
-                        if (attributes < 3)
-                        {
-                            // EXPERIMENTAL
-                            if (attributes < 1) { return; }
-
-                            // treat as incremental
-                            CLogMessage(this).warning(u"Treating %1 attributes as incremental") << attributes;
-                            parts = this->remoteAircraftParts(callsign).frontOrDefault(); // latest
-                            const QJsonObject config = applyIncrementalObject(parts.toJson(), jsonObject);
-                            parts.convertFromJson(config);
-                        }
+                        // EXPERIMENTAL
+                        if (attributes < 1) { return; }
+
+                        // treat as incremental
+                        CLogMessage(this).warning(u"Treating %1 attributes as incremental") << attributes;
+                        parts = this->remoteAircraftParts(callsign).frontOrDefault(); // latest
                     }
                 }
-                parts.convertFromJson(jsonObject);
-            }
-            else
-            {
-                // incremental update
-                parts = this->remoteAircraftParts(callsign).frontOrDefault(); // latest
-                const QJsonObject config = applyIncrementalObject(parts.toJson(), jsonObject);
-                parts.convertFromJson(config);
             }
+            delta.applyTo(parts);
         }
-        catch (const CJsonException &ex)
+        else
         {
-            CStatusMessage message = CStatusMessage::fromJsonException(ex, this, "Invalid parts packet");
-            message.setSeverity(CStatusMessage::SeverityDebug);
-            CLogMessage::preformatted(message);
+            // incremental update, applied directly to the latest parts
+            parts = this->remoteAircraftParts(callsign).frontOrDefault(); // latest
+            delta.applyTo(parts);
         }
 
         // make sure in any case right time and correct details
@@ -475,7 +517,7 @@ namespace BlackMisc::Simulation
         // history
         if (this->isAircraftPartsHistoryEnabled())
         {
-            const QJsonDocument doc(jsonObject);
+            const QJsonDocument doc(delta.toJson());
             const QString partsAsString = doc.toJson(QJsonDocument::Compact);
             const CStatusMessage message(this, CStatusMessage::SeverityInfo, callsign.isEmpty() ? callsign.toQString() + ": " + partsAsString.trimmed() : partsAsString.trimmed());
 
@@ -492,12 +534,12 @@ namespace BlackMisc::Simulation
         }
     }
 
-    void CRemoteAircraftProvider::storeChange(const CAircraftSituationChange &change)
+    void CRemoteAircraftProvider::storeChange(const CAircraftSituationChange &change, int &id)
     {
         // a change with the same timestamp will be replaced
         const CCallsign cs(change.getCallsign());
         QWriteLocker lock(&m_lockChanges);
-        CAircraftSituationChangeList &changeList = m_changesByCallsign[cs];
+        CAircraftSituationChangeList &changeList = m_changesByCallsign.valueRef(id, cs);
         changeList.push_frontKeepLatestAdjustedFirst(change, true, IRemoteAircraftProvider::MaxSituationsPerCallsign);
     }
 
@@ -516,9 +558,10 @@ namespace BlackMisc::Simulation
 
     bool CRemoteAircraftProvider::setAircraftEnabledFlag(const CCallsign &callsign, bool enabledForRendering)
     {
+        const int id = CCallsignIds::find(callsign);
         QWriteLocker l(&m_lockAircraft);
-        if (!m_aircraftInRange.contains(callsign)) { return false; }
-        return m_aircraftInRange[callsign].setEnabled(enabledForRendering);
+        const auto it = m_aircraftInRange.find(id);
+        return it != m_aircraftInRange.end() && it->setEnabled(enabledForRendering);
     }
 
     int CRemoteAircraftProvider::updateMultipleAircraftEnabled(const CCallsignSet &callsigns, bool enabledForRendering)
@@ -528,8 +571,8 @@ namespace BlackMisc::Simulation
         int c = 0;
         for (const CCallsign &cs : callsigns)
         {
-            if (!m_aircraftInRange.contains(cs)) { continue; }
-            if (m_aircraftInRange[cs].setEnabled(enabledForRendering)) { c++; }
+            const auto it = m_aircraftInRange.find(cs);
+            if (it != m_aircraftInRange.end() && it->setEnabled(enabledForRendering)) { c++; }
         }
         return c;
     }
@@ -552,33 +595,37 @@ namespace BlackMisc::Simulation
 
     bool CRemoteAircraftProvider::updateFastPositionEnabled(const CCallsign &callsign, bool enableFastPositonUpdates)
     {
+        const int id = CCallsignIds::find(callsign);
         QWriteLocker l(&m_lockAircraft);
-        if (!m_aircraftInRange.contains(callsign)) { return false; }
-        return m_aircraftInRange[callsign].setFastPositionUpdates(enableFastPositonUpdates);
+        const auto it = m_aircraftInRange.find(id);
+        return it != m_aircraftInRange.end() && it->setFastPositionUpdates(enableFastPositonUpdates);
     }
 
     bool CRemoteAircraftProvider::updateAircraftRendered(const CCallsign &callsign, bool rendered)
     {
+        const int id = CCallsignIds::find(callsign);
         QWriteLocker l(&m_lockAircraft);
-        if (!m_aircraftInRange.contains(callsign)) { return false; }
-        return m_aircraftInRange[callsign].setRendered(rendered);
+        const auto it = m_aircraftInRange.find(id);
+        return it != m_aircraftInRange.end() && it->setRendered(rendered);
     }
 
     int CRemoteAircraftProvider::updateMultipleAircraftRendered(const CCallsignSet &callsigns, bool rendered)
     {
         if (callsigns.isEmpty()) { return 0; }
         int c = 0;
+        QWriteLocker l(&m_lockAircraft);
         for (const CCallsign &cs : callsigns)
         {
-            if (!m_aircraftInRange.contains(cs)) { continue; }
-            if (m_aircraftInRange[cs].setRendered(rendered)) { c++; }
+            const auto it = m_aircraftInRange.find(cs);
+            if (it != m_aircraftInRange.end() && it->setRendered(rendered)) { c++; }
         }
         return c;
     }
 
     int CRemoteAircraftProvider::updateAircraftGroundElevation(const CCallsign &callsign, const CElevationPlane &elevation, CAircraftSituation::GndElevationInfo info, bool *setForOnGroundPosition)
     {
-        if (!this->isAircraftInRange(callsign)) { return 0; }
+        int id = CCallsignIds::find(callsign);
+        if (id == CCallsignIds::InvalidId || !this->isAircraftInRange(callsign)) { return 0; }
 
         // update aircraft situation
         const qint64 now = QDateTime::currentMSecsSinceEpoch();
@@ -589,29 +636,30 @@ namespace BlackMisc::Simulation
         int updated = 0;
         {
             QWriteLocker l(&m_lockSituations);
-            CAircraftSituationList &situations = m_situationsByCallsign[callsign];
-            if (situations.isEmpty()) { return 0; }
-            updated = setGroundElevationCheckedAndGuessGround(situations, elevation, info, model, &change, &setForOnGndPosition);
+            const auto situations = m_situationsByCallsign.find(id);
+            if (situations == m_situationsByCallsign.end() || situations->isEmpty()) { return 0; }
+            updated = setGroundElevationCheckedAndGuessGround(*situations, elevation, info, model, &change, &setForOnGndPosition);
             if (updated < 1) { return 0; }
-            m_situationsLastModified[callsign] = now;
-            const CAircraftSituation latestSituation = situations.front();
+            m_situationsLastModified.valueRef(id, callsign) = now;
+            const CAircraftSituation latestSituation = situations->front();
             if (info == CAircraftSituation::FromProvider && latestSituation.isOnGround())
             {
-                m_latestOnGroundProviderElevation[callsign] = latestSituation;
+                m_latestOnGroundProviderElevation.valueRef(id, callsign) = latestSituation;
             }
         }
 
         // update change
         if (!change.isNull())
         {
-            this->storeChange(change);
+            this->storeChange(change, id);
         }
 
         // aircraft updates
         QWriteLocker l(&m_lockAircraft);
-        if (m_aircraftInRange.contains(callsign))
+        const auto aircraft = m_aircraftInRange.find(id);
+        if (aircraft != m_aircraftInRange.end())
         {
-            m_aircraftInRange[callsign].setGroundElevationChecked(elevation, info);
+            aircraft->setGroundElevationChecked(elevation, info);
         }
 
         if (setForOnGroundPosition) { *setForOnGroundPosition = setForOnGndPosition; }
@@ -620,17 +668,21 @@ namespace BlackMisc::Simulation
 
     bool CRemoteAircraftProvider::updateCG(const CCallsign &callsign, const CLength &cg)
     {
+        const int id = CCallsignIds::find(callsign);
         QWriteLocker l(&m_lockAircraft);
-        if (!m_aircraftInRange.contains(callsign)) { return false; }
-        m_aircraftInRange[callsign].setCG(cg);
+        const auto it = m_aircraftInRange.find(id);
+        if (it == m_aircraftInRange.end()) { return false; }
+        it->setCG(cg);
         return true;
     }
 
     bool CRemoteAircraftProvider::updateCGAndModelString(const CCallsign &callsign, const CLength &cg, const QString &modelString)
     {
+        const int id = CCallsignIds::find(callsign);
         QWriteLocker l(&m_lockAircraft);
-        if (!m_aircraftInRange.contains(callsign)) { return false; }
-        CSimulatedAircraft &aircraft = m_aircraftInRange[callsign];
+        const auto it = m_aircraftInRange.find(id);
+        if (it == m_aircraftInRange.end()) { return false; }
+        CSimulatedAircraft &aircraft = *it;
         if (!cg.isNull()) { aircraft.setCG(cg); }
         if (!modelString.isEmpty()) { aircraft.setModelString(modelString); }
         return true;
@@ -679,11 +731,10 @@ namespace BlackMisc::Simulation
 
     void CRemoteAircraftProvider::updateMarkAllAsNotRendered()
     {
-        const CCallsignSet callsigns = this->getAircraftInRangeCallsigns();
         QWriteLocker l(&m_lockAircraft);
-        for (const CCallsign &cs : callsigns)
+        for (CSimulatedAircraft &aircraft : m_aircraftInRange)
         {
-            m_aircraftInRange[cs].setRendered(false);
+            aircraft.setRendered(false);
         }
     }
 
@@ -742,6 +793,69 @@ namespace BlackMisc::Simulation
         this->removeAllAircraft();
     }
 
+    void CRemoteAircraftProvider::setSituationsCoalescingIntervalMs(int intervalMs)
+    {
+        m_coalescingIntervalMs = qMax(0, intervalMs);
+        this->updateCoalescingTimer();
+    }
+
+    QString CRemoteAircraftProvider::getSituationsCoalescingStatistics() const
+    {
+        QReadLocker l(&m_lockCoalesced);
+        return QStringLiteral("coalescing %1ms%2: %3 situations in, %4 out in %5 batches").
+               arg(m_coalescingIntervalMs.load()).arg(m_coalescing ? QString() : QStringLiteral(" (idle)")).
+               arg(m_coalescedSituationsIn).arg(m_coalescedSituationsOut).arg(m_coalescedBatches);
+    }
+
+    void CRemoteAircraftProvider::connectNotify(const QMetaMethod &signal)
+    {
+        if (signal == QMetaMethod::fromSignal(&CRemoteAircraftProvider::addedAircraftSituationsCoalesced)) { this->updateCoalescingTimer(); }
+    }
+
+    void CRemoteAircraftProvider::disconnectNotify(const QMetaMethod &signal)
+    {
+        // invalid signal means all signals disconnected
+        if (!signal.isValid() || signal == QMetaMethod::fromSignal(&CRemoteAircraftProvider::addedAircraftSituationsCoalesced)) { this->updateCoalescingTimer(); }
+    }
+
+    void CRemoteAircraftProvider::updateCoalescingTimer()
+    {
+        if (!CThreadUtils::isInThisThread(this))
+        {
+            QPointer<CRemoteAircraftProvider> myself(this);
+            QTimer::singleShot(0, this, [ = ] { if (myself) { myself->updateCoalescingTimer(); } });
+            return;
+        }
+
+        const int intervalMs = m_coalescingIntervalMs;
+        const bool run = intervalMs > 0 && this->isSignalConnected(QMetaMethod::fromSignal(&CRemoteAircraftProvider::addedAircraftSituationsCoalesced));
+        if (!run)
+        {
+            m_coalescing = false;
+            m_coalescingTimer.stop();
+            this->emitCoalescedSituations(); // flush
+            return;
+        }
+        if (m_coalescingTimer.isActive() && m_coalescingTimer.interval() == intervalMs) { return; }
+        m_coalescingTimer.start(intervalMs);
+        m_coalescing = true;
+    }
+
+    void CRemoteAircraftProvider::emitCoalescedSituations()
+    {
+        CAircraftSituationList situations;
+        {
+            QWriteLocker l(&m_lockCoalesced);
+            if (m_coalescedSituations.isEmpty()) { return; }
+            situations.reserve(m_coalescedSituations.size());
+            for (const CAircraftSituation &situation : std::as_const(m_coalescedSituations)) { situations.push_back(situation); }
+            m_coalescedSituations.clear();
+            m_coalescedSituationsOut += situations.size();
+            m_coalescedBatches++;
+        }
+        emit this->addedAircraftSituationsCoalesced(situations);
+    }
+
     bool CRemoteAircraftProvider::hasTestAltitudeOffset(const CCallsign &callsign) const
     {
         if (callsign.isEmpty()) { return false; }
@@ -762,7 +876,8 @@ namespace BlackMisc::Simulation
         if (!globalOffset && !this->hasTestAltitudeOffset(cs)) { return situation; }
 
         QReadLocker l(&m_lockSituations);
-        const CLength os = m_testOffset.contains(cs) ? m_testOffset.value(cs) : m_testOffset.value(testAltitudeOffsetCallsign());
+        const auto it = m_testOffset.constFind(cs);
+        const CLength os = it != m_testOffset.constEnd() ? *it : m_testOffset.value(testAltitudeOffsetCallsign());
         if (os.isNull() || os.isZeroEpsilonConsidered()) { return situation; }
         return situation.withAltitudeOffset(os);
     }
@@ -871,7 +986,7 @@ namespace BlackMisc::Simulation
             return false;
         }
 
-        m_testOffset[callsign] = offset;
+        m_testOffset.insert(callsign, offset);
         return true;
     }
 
@@ -919,25 +1034,29 @@ namespace BlackMisc::Simulation
 
     bool CRemoteAircraftProvider::removeAircraft(const CCallsign &callsign)
     {
+        // the ID stays valid until the last container has released it
+        const int id = CCallsignIds::find(callsign);
         {
             QWriteLocker l1(&m_lockParts);
-            m_partsByCallsign.remove(callsign);
+            m_partsByCallsign.remove(id);
             m_aircraftWithParts.remove(callsign);
-            m_partsLastModified.remove(callsign);
+            m_partsLastModified.remove(id);
         }
         {
             QWriteLocker l2(&m_lockSituations);
-            m_situationsByCallsign.remove(callsign);
-            m_latestSituationByCallsign.remove(callsign);
-            m_latestOnGroundProviderElevation.remove(callsign);
-            m_situationsLastModified.remove(callsign);
+            m_situationsByCallsign.remove(id);
+            m_latestSituationByCallsign.remove(id);
+            m_latestOnGroundProviderElevation.remove(id);
+            m_situationsLastModified.remove(id);
         }
+        { QWriteLocker l3(&m_lockCoalesced); m_coalescedSituations.remove(id); }
         { QWriteLocker l4(&m_lockPartsHistory); m_aircraftPartsMessages.remove(callsign); }
+        { QWriteLocker l5(&m_lockChanges); m_changesByCallsign.remove(id); }
         bool removedCallsign = false;
         {
             QWriteLocker l(&m_lockAircraft);
             m_dbCGPerCallsign.remove(callsign);
-            const int c = m_aircraftInRange.remove(callsign);
+            const int c = m_aircraftInRange.remove(id);
             removedCallsign = c > 0;
         }
         return removedCallsign;
@@ -15,11 +15,13 @@
 #include "blackmisc/simulation/airspaceaircraftsnapshot.h"
 #include "blackmisc/simulation/reverselookup.h"
 #include "blackmisc/simulation/simulatedaircraftlist.h"
+#include "blackmisc/aviation/aircraftpartsdelta.h"
 #include "blackmisc/aviation/aircraftpartslist.h"
 #include "blackmisc/aviation/aircraftsituationlist.h"
 #include "blackmisc/aviation/aircraftsituationchangelist.h"
 #include "blackmisc/aviation/percallsign.h"
 #include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/aviation/callsignid.h"
 #include "blackmisc/provider.h"
 #include "blackmisc/blackmiscexport.h"
 #include "blackmisc/identifiable.h"
@@ -31,6 +33,8 @@
 #include <QJsonObject>
 #include <QtGlobal>
 #include <QReadWriteLock>
+#include <QTimer>
+#include <atomic>
 #include <functional>
 
 namespace BlackMisc
@@ -383,6 +387,18 @@ namespace BlackMisc::Simulation
         //! Clear all data
         void clear();
 
+        //! Interval of the coalesced situation batches (CRemoteAircraftProvider::addedAircraftSituationsCoalesced), 0 passes on every situation immediately
+        //! \remark the tick only runs while a batch consumer is connected
+        //! \threadsafe
+        //! @{
+        void setSituationsCoalescingIntervalMs(int intervalMs);
+        int getSituationsCoalescingIntervalMs() const { return m_coalescingIntervalMs; }
+        //! @}
+
+        //! Situations stored vs. coalesced situations emitted
+        //! \threadsafe
+        QString getSituationsCoalescingStatistics() const;
+
         // ------------------- testing ---------------
 
         //! Has test offset value?
@@ -402,8 +418,13 @@ namespace BlackMisc::Simulation
         void addedAircraftParts(const BlackMisc::Aviation::CCallsign &callsign, const BlackMisc::Aviation::CAircraftParts &parts);
 
         //! Situation added
+        //! \remark emitted for every single situation, for latency critical consumers
         void addedAircraftSituation(const BlackMisc::Aviation::CAircraftSituation &situation);
 
+        //! Situations added since the last coalescing tick, only the latest situation per callsign
+        //! \remark for consumers not needing every update (watchdog, UI), one signal per tick instead of one per packet
+        void addedAircraftSituationsCoalesced(const BlackMisc::Aviation::CAircraftSituationList &situations);
+
         //! Aircraft were changed
         void changedAircraftInRange();
 
@@ -457,7 +478,7 @@ namespace BlackMisc::Simulation
         //! \threadsafe
         //! @{
         void storeAircraftParts(const Aviation::CCallsign &callsign, const Aviation::CAircraftParts &parts, bool removeOutdated);
-        void storeAircraftParts(const Aviation::CCallsign &callsign, const QJsonObject &jsonObject, qint64 currentOffsetMs);
+        void storeAircraftParts(const Aviation::CCallsign &callsign, const Aviation::CAircraftPartsDelta &delta, qint64 currentOffsetMs);
         //! @}
 
         //! Guess situation "on ground" and update model's CG if applicable
@@ -475,33 +496,57 @@ namespace BlackMisc::Simulation
         //! \note requires a sorted list latest first
         static int setGroundElevationCheckedAndGuessGround(Aviation::CAircraftSituationList &situations, const Geo::CElevationPlane &elevationPlane, Aviation::CAircraftSituation::GndElevationInfo info, const Simulation::CAircraftModel &model, Aviation::CAircraftSituationChange *changeOut, bool *setForOnGroundPosition);
 
+    protected:
+        //! \copydoc QObject::connectNotify
+        virtual void connectNotify(const QMetaMethod &signal) override;
+
+        //! \copydoc QObject::disconnectNotify
+        virtual void disconnectNotify(const QMetaMethod &signal) override;
+
     private:
         //! Store the latest changes
         //! \remark latest first
+        //! \param id of the callsign from Aviation::CCallsignIds::find, set if the callsign was not yet interned
         //! \threadsafe
-        void storeChange(const Aviation::CAircraftSituationChange &change);
+        void storeChange(const Aviation::CAircraftSituationChange &change, int &id);
+
+        //! Emit the coalesced situations
+        void emitCoalescedSituations();
 
-        Aviation::CAircraftSituationListPerCallsign m_situationsByCallsign;        //!< situations, for performance reasons per callsign, thread safe access required
-        Aviation::CAircraftSituationPerCallsign m_latestSituationByCallsign;       //!< latest situations, for performance reasons per callsign, thread safe access required
-        Aviation::CAircraftSituationPerCallsign m_latestOnGroundProviderElevation; //!< situations on ground with elevation from provider
-        Aviation::CAircraftPartsListPerCallsign m_partsByCallsign;                 //!< parts, for performance reasons per callsign, thread safe access required
-        Aviation::CAircraftSituationChangeListPerCallsign m_changesByCallsign;     //!< changes, for performance reasons per callsign, thread safe access required (same timestamps as corresponding situations)
+        //! Run the coalescing tick if there is an interval and a batch consumer, in the thread of the provider
+        //! \threadsafe
+        void updateCoalescingTimer();
+
+        Aviation::CCallsignIdHash<Aviation::CAircraftSituationList> m_situationsByCallsign;        //!< situations, for performance reasons per callsign, thread safe access required
+        Aviation::CCallsignIdHash<Aviation::CAircraftSituation> m_latestSituationByCallsign;       //!< latest situations, for performance reasons per callsign, thread safe access required
+        Aviation::CCallsignIdHash<Aviation::CAircraftSituation> m_latestOnGroundProviderElevation; //!< situations on ground with elevation from provider
+        Aviation::CCallsignIdHash<Aviation::CAircraftPartsList> m_partsByCallsign;                 //!< parts, for performance reasons per callsign, thread safe access required
+        Aviation::CCallsignIdHash<Aviation::CAircraftSituationChangeList> m_changesByCallsign;     //!< changes, for performance reasons per callsign, thread safe access required (same timestamps as corresponding situations)
         Aviation::CCallsignSet m_aircraftWithParts;                                //!< aircraft supporting parts, thread safe access required
         int m_situationsAdded = 0; //!< total number of situations added, thread safe access required
         int m_partsAdded      = 0; //!< total number of parts added, thread safe access required
 
         ReverseLookupLogging m_enableReverseLookupMsgs = RevLogSimplifiedInfo;     //!< shall we log. information about the matching process
-        Simulation::CSimulatedAircraftPerCallsign m_aircraftInRange;      //!< aircraft, thread safe access required
+        Aviation::CCallsignIdHash<Simulation::CSimulatedAircraft> m_aircraftInRange;      //!< aircraft, thread safe access required
         Aviation::CStatusMessageListPerCallsign m_reverseLookupMessages;  //!< reverse lookup messages
         Aviation::CStatusMessageListPerCallsign m_aircraftPartsMessages;  //!< status messages for parts history
-        Aviation::CTimestampPerCallsign m_situationsLastModified;         //!< when situations last modified
-        Aviation::CTimestampPerCallsign m_partsLastModified;              //!< when parts last modified
-        Aviation::CLengthPerCallsign    m_testOffset;                     //!< offsets
+        Aviation::CCallsignIdHash<qint64> m_situationsLastModified;      //!< when situations last modified
+        Aviation::CCallsignIdHash<qint64> m_partsLastModified;           //!< when parts last modified
+        Aviation::CCallsignIdHash<PhysicalQuantities::CLength> m_testOffset; //!< offsets
         Aviation::CLengthPerCallsign    m_dbCGPerCallsign;                //!< DB CG per callsign
         QHash<QString, PhysicalQuantities::CLength> m_dbCGPerModelString; //!< DB CG per model string
 
         bool m_enableAircraftPartsHistory = true;  //!< shall we keep a history of aircraft parts
 
+        Aviation::CCallsignIdHash<Aviation::CAircraftSituation> m_coalescedSituations; //!< latest situation per callsign since last tick, thread safe access required
+        int m_coalescedSituationsIn  = 0;     //!< situations handed to coalescing, thread safe access required
+        int m_coalescedSituationsOut = 0;     //!< situations emitted in batches, thread safe access required
+        int m_coalescedBatches       = 0;     //!< batches emitted, thread safe access required
+        QTimer m_coalescingTimer { this };    //!< coalescing tick, only used in the thread of the provider
+        static constexpr int DefaultCoalescingIntervalMs = 250; //!< default coalescing tick
+        std::atomic_int  m_coalescingIntervalMs { DefaultCoalescingIntervalMs }; //!< interval of the tick, 0 for none
+        std::atomic_bool m_coalescing { false }; //!< tick is running, situations are collected for the batches
+
         // locks
         mutable QReadWriteLock m_lockSituations;   //!< lock for situations: m_situationsByCallsign
         mutable QReadWriteLock m_lockParts;        //!< lock for parts: m_partsByCallsign, m_aircraftSupportingParts
@@ -509,6 +554,7 @@ namespace BlackMisc::Simulation
         mutable QReadWriteLock m_lockAircraft;     //!< lock aircraft: m_aircraftInRange, m_dbCGPerCallsign
         mutable QReadWriteLock m_lockMessages;     //!< lock for messages
         mutable QReadWriteLock m_lockPartsHistory; //!< lock for aircraft parts
+        mutable QReadWriteLock m_lockCoalesced;    //!< lock for m_coalescedSituations
     };
 
     //! Class which can be directly used to access an \sa IRemoteAircraftProvider object
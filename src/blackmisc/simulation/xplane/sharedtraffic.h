@@ -0,0 +1,344 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKMISC_SIMULATION_XPLANE_SHAREDTRAFFIC_H
+#define BLACKMISC_SIMULATION_XPLANE_SHAREDTRAFFIC_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Strict header only shared memory transport of remote aircraft data between the X-Plane driver and XSwiftBus.
+// Header only is necessary to no require XSwiftBus to link against BlackMisc.
+// DBus stays the control channel, the memory is negotiated via the traffic interface ("openSharedTraffic").
+
+namespace BlackMisc::Simulation::XPlane::SharedTraffic
+{
+    //! Marks a valid memory block
+    constexpr std::uint32_t Magic = 0x53585442; // "BTXS"
+
+    //! Layout version, both sides must use the same
+    constexpr std::uint32_t Version = 1;
+
+    //! Default number of records per ring
+    constexpr std::uint32_t DefaultCapacity = 1024;
+
+    //! Parts of a PlaneRecord which are set
+    enum PlaneRecordFlag : std::uint32_t
+    {
+        HasPosition        = 1 << 0, //!< position and attitude
+        HasSurfaces        = 1 << 1, //!< control surfaces and lights
+        HasTransponder     = 1 << 2, //!< transponder
+        RequestsRemoteData = 1 << 3  //!< answer with a RemoteDataRecord
+    };
+
+    //! Lights in PlaneRecord::lights
+    enum LightFlag : std::uint32_t
+    {
+        LandingLight = 1 << 0, //!< landing
+        TaxiLight    = 1 << 1, //!< taxi
+        BeaconLight  = 1 << 2, //!< beacon
+        StrobeLight  = 1 << 3, //!< strobe
+        NavLight     = 1 << 4  //!< navigation
+    };
+
+    //! Transponder mode in PlaneRecord::transponderMode
+    enum TransponderMode : std::uint32_t
+    {
+        Standby = 0, //!< standby
+        ModeC   = 1, //!< mode C
+        Ident   = 2  //!< mode C and ident
+    };
+
+    //! Fixed layout update of one plane, swift to X-Plane
+    struct PlaneRecord
+    {
+        std::int32_t  planeId = -1;       //!< stable plane ID, as passed with "addPlane"
+        std::uint32_t flags = 0;          //!< PlaneRecordFlag
+        double latitudeDeg = 0.0;         //!< latitude
+        double longitudeDeg = 0.0;        //!< longitude
+        double altitudeFt = 0.0;          //!< altitude
+        double pitchDeg = 0.0;            //!< pitch
+        double rollDeg = 0.0;             //!< roll (bank)
+        double headingDeg = 0.0;          //!< heading
+        std::uint32_t onGround = 0;       //!< on ground
+        float gear = 0.0f;                //!< gear ratio
+        float flaps = 0.0f;               //!< flaps ratio
+        float spoilers = 0.0f;            //!< spoilers ratio
+        float speedBrakes = 0.0f;         //!< speed brakes ratio
+        float slats = 0.0f;               //!< slats ratio
+        float wingSweep = 0.0f;           //!< wing sweep ratio
+        float thrust = 0.0f;              //!< thrust ratio
+        float elevator = 0.0f;            //!< elevator ratio
+        float rudder = 0.0f;              //!< rudder ratio
+        float aileron = 0.0f;             //!< aileron ratio
+        std::uint32_t lights = 0;         //!< LightFlag
+        std::int32_t  lightPattern = 0;   //!< light pattern
+        std::int32_t  transponderCode = 0;   //!< transponder code
+        std::uint32_t transponderMode = 0;   //!< TransponderMode
+    };
+
+    //! Fixed layout ground elevation and offset of one plane, X-Plane to swift
+    struct RemoteDataRecord
+    {
+        std::int32_t  planeId = -1;       //!< stable plane ID
+        std::uint32_t isWater = 0;        //!< elevation is water
+        double latitudeDeg = 0.0;         //!< latitude
+        double longitudeDeg = 0.0;        //!< longitude
+        double elevationM = 0.0;          //!< ground elevation, NaN if unknown
+        double verticalOffsetM = 0.0;     //!< vertical offset (CG)
+    };
+
+    static_assert(std::is_trivially_copyable_v<PlaneRecord>, "Record is copied into shared memory");
+    static_assert(std::is_trivially_copyable_v<RemoteDataRecord>, "Record is copied into shared memory");
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Indexes are shared between processes");
+
+    //! Write and read position of one ring, on their own cache lines
+    struct RingIndexes
+    {
+        alignas(64) std::atomic<std::uint64_t> written { 0 }; //!< records written, only changed by the producer
+        alignas(64) std::atomic<std::uint64_t> read { 0 };    //!< records read, only changed by the consumer
+        std::atomic<std::uint64_t> dropped { 0 };              //!< records not written because the ring was full
+    };
+
+    //! Start of the shared memory, followed by the plane records and the remote data records
+    struct Header
+    {
+        std::uint32_t magic = Magic;                               //!< Magic
+        std::uint32_t version = Version;                           //!< Version
+        std::uint32_t capacity = 0;                                //!< records per ring
+        std::uint32_t planeRecordSize = sizeof(PlaneRecord);       //!< layout check
+        std::uint32_t remoteDataRecordSize = sizeof(RemoteDataRecord); //!< layout check
+        RingIndexes planes;                                        //!< swift to X-Plane
+        RingIndexes remoteData;                                    //!< X-Plane to swift
+    };
+
+    /*!
+     * Lock free ring with one producer and one consumer, each can be in another process.
+     * When full, new records are dropped and counted. Updates are sent every frame, so the next one
+     * replaces a dropped one and the producer never has to wait for X-Plane.
+     */
+    template <class Record>
+    class CRing
+    {
+    public:
+        //! Constructor, invalid ring
+        CRing() {}
+
+        //! Constructor
+        CRing(RingIndexes *indexes, Record *records, std::uint32_t capacity) : m_indexes(indexes), m_records(records), m_capacity(capacity) {}
+
+        //! Valid ring?
+        bool isValid() const { return m_indexes && m_records && m_capacity > 0; }
+
+        //! Append, false if the ring is full
+        //! \remark producer side only
+        bool push(const Record &record)
+        {
+            if (!this->isValid()) { return false; }
+            const std::uint64_t written = m_indexes->written.load(std::memory_order_relaxed);
+            const std::uint64_t read = m_indexes->read.load(std::memory_order_acquire);
+            if (written - read >= m_capacity)
+            {
+                m_indexes->dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            m_records[written % m_capacity] = record;
+            m_indexes->written.store(written + 1, std::memory_order_release);
+            return true;
+        }
+
+        //! Take the oldest record, false if empty
+        //! \remark consumer side only
+        bool pop(Record &record)
+        {
+            if (!this->isValid()) { return false; }
+            const std::uint64_t read = m_indexes->read.load(std::memory_order_relaxed);
+            const std::uint64_t written = m_indexes->written.load(std::memory_order_acquire);
+            if (read == written) { return false; }
+            record = m_records[read % m_capacity];
+            m_indexes->read.store(read + 1, std::memory_order_release);
+            return true;
+        }
+
+        //! Records written, but not yet read
+        std::uint64_t size() const
+        {
+            if (!this->isValid()) { return 0; }
+            return m_indexes->written.load(std::memory_order_acquire) - m_indexes->read.load(std::memory_order_acquire);
+        }
+
+        //! Records dropped because the ring was full
+        std::uint64_t dropped() const { return this->isValid() ? m_indexes->dropped.load(std::memory_order_relaxed) : 0; }
+
+    private:
+        RingIndexes *m_indexes = nullptr;
+        Record *m_records = nullptr;
+        std::uint32_t m_capacity = 0;
+    };
+
+    /*!
+     * Named shared memory with the two rings.
+     * The swift side creates (and finally removes) it, XSwiftBus opens it by the name received via DBus.
+     * \remark POSIX shared memory, only supported on Linux. Elsewhere create/open fail and DBus is used.
+     */
+    class CSharedTraffic
+    {
+    public:
+        //! Constructor
+        CSharedTraffic() {}
+
+        //! Destructor
+        ~CSharedTraffic() { this->close(); }
+
+        //! Not copyable
+        //! @{
+        CSharedTraffic(const CSharedTraffic &) = delete;
+        CSharedTraffic &operator =(const CSharedTraffic &) = delete;
+        //! @}
+
+        //! Shared memory transport available on this platform?
+        static constexpr bool isSupported()
+        {
+#ifdef __linux__
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        //! Name of the memory created by the process with the given ID
+        static std::string memoryName(long processId) { return "/swift_xplane_traffic_" + std::to_string(processId); }
+
+        //! Bytes needed for the given capacity
+        static std::size_t memorySize(std::uint32_t capacity)
+        {
+            return planeRecordsOffset() + capacity * sizeof(PlaneRecord) + capacity * sizeof(RemoteDataRecord);
+        }
+
+        //! Create the memory, replacing an outdated one with the same name
+        //! \remark swift side
+        bool create(const std::string &name, std::uint32_t capacity = DefaultCapacity)
+        {
+            this->close();
+            if (capacity < 1) { return false; }
+#ifdef __linux__
+            shm_unlink(name.c_str());
+            const int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+            if (fd < 0) { return false; }
+            const std::size_t size = memorySize(capacity);
+            if (ftruncate(fd, static_cast<off_t>(size)) != 0) { ::close(fd); shm_unlink(name.c_str()); return false; }
+            void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (memory == MAP_FAILED) { shm_unlink(name.c_str()); return false; }
+
+            Header *header = new (memory) Header();
+            header->capacity = capacity;
+            m_header = header;
+            m_size = size;
+            m_name = name;
+            m_owner = true;
+            return true;
+#else
+            (void)name;
+            return false;
+#endif
+        }
+
+        //! Open memory created by the other side, fails if the layout does not match
+        //! \remark XSwiftBus side
+        bool open(const std::string &name)
+        {
+            this->close();
+#ifdef __linux__
+            const int fd = shm_open(name.c_str(), O_RDWR, 0);
+            if (fd < 0) { return false; }
+            struct stat st {};
+            if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(Header)) { ::close(fd); return false; }
+            const std::size_t size = static_cast<std::size_t>(st.st_size);
+            void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            if (memory == MAP_FAILED) { return false; }
+
+            const Header *header = static_cast<const Header *>(memory);
+            const bool valid = header->magic == Magic && header->version == Version &&
+                               header->planeRecordSize == sizeof(PlaneRecord) && header->remoteDataRecordSize == sizeof(RemoteDataRecord) &&
+                               header->capacity > 0 && memorySize(header->capacity) <= size;
+            if (!valid) { munmap(memory, size); return false; }
+
+            m_header = static_cast<Header *>(memory);
+            m_size = size;
+            m_name = name;
+            m_owner = false;
+            return true;
+#else
+            (void)name;
+            return false;
+#endif
+        }
+
+        //! Unmap, the creating side also removes the name
+        void close()
+        {
+#ifdef __linux__
+            if (m_header) { munmap(m_header, m_size); }
+            if (m_owner && !m_name.empty()) { shm_unlink(m_name.c_str()); }
+#endif
+            m_header = nullptr;
+            m_size = 0;
+            m_name.clear();
+            m_owner = false;
+        }
+
+        //! Is open?
+        bool isOpen() const { return m_header != nullptr; }
+
+        //! Name of the memory
+        const std::string &getName() const { return m_name; }
+
+        //! Records per ring
+        std::uint32_t getCapacity() const { return m_header ? m_header->capacity : 0; }
+
+        //! Plane updates, swift to X-Plane
+        CRing<PlaneRecord> planes() const
+        {
+            if (!m_header) { return {}; }
+            return { &m_header->planes, reinterpret_cast<PlaneRecord *>(bytes() + planeRecordsOffset()), m_header->capacity };
+        }
+
+        //! Ground elevations, X-Plane to swift
+        CRing<RemoteDataRecord> remoteData() const
+        {
+            if (!m_header) { return {}; }
+            return { &m_header->remoteData, reinterpret_cast<RemoteDataRecord *>(bytes() + planeRecordsOffset() + m_header->capacity * sizeof(PlaneRecord)), m_header->capacity };
+        }
+
+    private:
+        static constexpr std::size_t planeRecordsOffset() { return (sizeof(Header) + 63) / 64 * 64; }
+        unsigned char *bytes() const { return reinterpret_cast<unsigned char *>(m_header); }
+
+        Header *m_header = nullptr;
+        std::size_t m_size = 0;
+        std::string m_name;
+        bool m_owner = false;
+    };
+} // ns
+
+#endif // guard
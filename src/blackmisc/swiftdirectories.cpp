@@ -16,6 +16,7 @@
 #include "blackconfig/buildconfig.h"
 #include <QCoreApplication>
 #include <QDir>
+#include <QFileInfo>
 #include <QUrl>
 #include <QSet>
 #include <QRegularExpression>
@@ -156,6 +157,13 @@ namespace BlackMisc
         return p;
     }
 
+    const QString &CSwiftDirectories::httpCacheDirectory()
+    {
+        // one per application, QNetworkDiskCache does not support several processes using the same directory
+        static const QString p = CFileUtils::appendFilePaths(normalizedApplicationDataDirectory(), "/httpcache/" + QFileInfo(QCoreApplication::applicationFilePath()).completeBaseName());
+        return p;
+    }
+
     QString getSwiftShareDirImpl()
     {
         QDir dir(CSwiftDirectories::binDirectory());
@@ -126,6 +126,9 @@ namespace BlackMisc
         //! \remark In BlackMisc so it can also be used from BlackMisc classes
         static const QString &logDirectory();
 
+        //! Directory for the HTTP response cache, a subdirectory per application
+        static const QString &httpCacheDirectory();
+
         //! Directory for crashpad files
         static const QString &crashpadDirectory();
 
@@ -11,7 +11,9 @@
 #include <QCoreApplication>
 #include <QObject>
 #include <QThread>
+#include <QtConcurrent/QtConcurrentMap>
 #include <QtGlobal>
+#include <numeric>
 #include <thread>
 #include <sstream>
 
@@ -35,4 +37,24 @@ namespace BlackMisc
         const QString id = QString::fromStdString(oss.str());
         return QStringLiteral("%1 (%2) prio %3").arg(id).arg(thread->objectName()).arg(thread->priority());
     }
+
+    QVector<int> CThreadUtils::chunkBounds(int size, int minChunkSize)
+    {
+        const int chunks = qBound(1, QThread::idealThreadCount(), size / qMax(1, minChunkSize));
+        QVector<int> bounds;
+        bounds.reserve(chunks + 1);
+        for (int c = 0; c <= chunks; ++c) { bounds.push_back(static_cast<int>(static_cast<qint64>(size) * c / chunks)); }
+        return bounds;
+    }
+
+    void CThreadUtils::forEachChunk(const QVector<int> &bounds, const std::function<void(int, int, int)> &task)
+    {
+        const int chunks = bounds.size() - 1;
+        if (chunks < 1) { return; }
+        if (chunks == 1) { task(0, bounds[0], bounds[1]); return; }
+
+        QVector<int> chunkIndexes(chunks);
+        std::iota(chunkIndexes.begin(), chunkIndexes.end(), 0);
+        QtConcurrent::blockingMap(chunkIndexes, [&](int chunk) { task(chunk, bounds[chunk], bounds[chunk + 1]); });
+    }
 } // ns
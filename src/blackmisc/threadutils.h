@@ -19,6 +19,7 @@
 #include <QObject>
 #include <QMetaObject>
 #include <QSharedPointer>
+#include <QVector>
 #include <functional>
 
 namespace BlackMisc
@@ -67,6 +68,15 @@ namespace BlackMisc
 
         //! Info about current thread, for debug messages
         static QString currentThreadInfo();
+
+        //! Split 0..size-1 into chunks for forEachChunk, chunk c is bounds[c]..bounds[c+1]-1
+        //! \remark one chunk per thread, but each chunk has at least minChunkSize elements
+        static QVector<int> chunkBounds(int size, int minChunkSize);
+
+        //! Call task(chunk, first, last) for all chunks in the global thread pool and the calling thread
+        //! \remark blocks until all chunks are done, with one chunk the task is called directly
+        //! \remark the task is called concurrently and must only write data of its own chunk
+        static void forEachChunk(const QVector<int> &bounds, const std::function<void(int chunk, int first, int last)> &task);
     };
 } // ns
 
@@ -73,9 +73,9 @@ namespace BlackMisc
         //! Object before timestamp or default (older)
         OBJ findObjectBeforeOrDefault(qint64 msSinceEpoch) const
         {
-            const CONTAINER before = this->findBefore(msSinceEpoch);
-            if (before.isEmpty()) { return OBJ(); }
-            return before.latestObject();
+            const auto before = this->container().filteredView([&](const OBJ & obj) { return obj.isOlderThan(msSinceEpoch); });
+            const auto latest = std::max_element(before.begin(), before.end(), [](const OBJ & a, const OBJ & b) { return a.getMSecsSinceEpoch() < b.getMSecsSinceEpoch(); });
+            return latest == before.end() ? OBJ() : *latest;
         }
 
         //! Get objects before msSinceEpoch and remove those
@@ -116,9 +116,9 @@ namespace BlackMisc
         //! List of objects after msSinceEpoch (newer)
         OBJ findObjectAfterOrDefault(qint64 msSinceEpoch) const
         {
-            const CONTAINER after = this->findAfter(msSinceEpoch);
-            if (after.isEmpty()) { return OBJ(); }
-            return after.oldestObject();
+            const auto after = this->container().filteredView([&](const OBJ & obj) { return obj.isNewerThan(msSinceEpoch); });
+            const auto oldest = std::min_element(after.begin(), after.end(), [](const OBJ & a, const OBJ & b) { return a.getMSecsSinceEpoch() < b.getMSecsSinceEpoch(); });
+            return oldest == after.end() ? OBJ() : *oldest;
         }
 
         //! Objects without valid timestamp
@@ -480,9 +480,13 @@ namespace BlackMisc
         CONTAINER getLatestAdjustedTwoObjects(bool alreadySortedLatestFirst = false) const
         {
             if (this->container().size() < 2) { return CONTAINER(); }
-            CONTAINER copy(alreadySortedLatestFirst ? this->container() : this->container().getSortedAdjustedLatestFirst());
-            copy.truncate(2);
-            return copy;
+            if (alreadySortedLatestFirst)
+            {
+                CONTAINER copy(this->container());
+                copy.truncate(2);
+                return copy;
+            }
+            return this->container().smallestByProjection(2, [](const OBJ & obj) { return -obj.getAdjustedMSecsSinceEpoch(); });
         }
 
         //! Sort by adjusted timestamp
@@ -649,9 +653,9 @@ namespace BlackMisc
         //! List of objects after msSinceEpoch (newer)
         OBJ findObjectAfterAdjustedOrDefault(qint64 msSinceEpoch) const
         {
-            const CONTAINER after = this->findAfterAdjusted(msSinceEpoch);
-            if (after.isEmpty()) { return OBJ(); }
-            return after.oldestAdjustedObject();
+            const auto after = this->container().filteredView([&](const OBJ & obj) { return obj.isNewerThanAdjusted(msSinceEpoch); });
+            const auto oldest = std::min_element(after.begin(), after.end(), [](const OBJ & a, const OBJ & b) { return a.getAdjustedMSecsSinceEpoch() < b.getAdjustedMSecsSinceEpoch(); });
+            return oldest == after.end() ? OBJ() : *oldest;
         }
 
         //! List of objects before msSinceEpoch (older)
@@ -666,9 +670,9 @@ namespace BlackMisc
         //! Object before timestamp (older)
         OBJ findObjectBeforeAdjustedOrDefault(qint64 msSinceEpoch) const
         {
-            const CONTAINER before = this->findBeforeAdjusted(msSinceEpoch);
-            if (before.isEmpty()) { return OBJ(); }
-            return before.latestAdjustedObject();
+            const auto before = this->container().filteredView([&](const OBJ & obj) { return obj.isOlderThanAdjusted(msSinceEpoch); });
+            const auto latest = std::max_element(before.begin(), before.end(), [](const OBJ & a, const OBJ & b) { return a.getAdjustedMSecsSinceEpoch() < b.getAdjustedMSecsSinceEpoch(); });
+            return latest == before.end() ? OBJ() : *latest;
         }
 
         //! Closest adjusted time difference
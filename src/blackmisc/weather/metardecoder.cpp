@@ -20,6 +20,7 @@
 #include "blackmisc/pq/time.h"
 #include "blackmisc/pq/units.h"
 #include "blackmisc/statusmessage.h"
+#include "blackmisc/threadutils.h"
 #include "blackmisc/weather/cloudlayer.h"
 #include "blackmisc/weather/metardecoder.h"
 #include "blackmisc/weather/presentweather.h"
@@ -29,6 +30,7 @@
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
 #include <QStringList>
+#include <QStringView>
 #include <QtGlobal>
 
 using namespace BlackMisc::PhysicalQuantities;
@@ -59,18 +61,97 @@ namespace BlackMisc::Weather
         virtual bool validateAndSet(const QRegularExpressionMatch &match, CMetar &metar) const = 0;
         virtual bool isMandatory() const = 0;
 
+        //! Result of the tokenizing fast path
+        enum TokenMatch
+        {
+            TokenUseRegExp, //!< undecided, use the regular expression
+            TokenNoMatch,   //!< the regular expression would not match
+            TokenInvalid,   //!< matched, but invalid data
+            TokenMatched    //!< matched and set, consumed characters to be removed
+        };
+
+        //! Hand-written tokenizer for the common groups, avoiding the regular expression
+        //! \remark Must only decide when the regular expression would decide identically, otherwise TokenUseRegExp.
+        //!         Only called for a non empty string with an ASCII leading token.
+        virtual TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const
+        {
+            Q_UNUSED(metarString)
+            Q_UNUSED(consumed)
+            Q_UNUSED(metar)
+            return TokenUseRegExp;
+        }
+
+        //! Token match from validation result
+        static TokenMatch tokenResult(bool valid) { return valid ? TokenMatched : TokenInvalid; }
+
+        //! Leading token up to the next space
+        static QStringView leadingToken(const QString &metarString, bool &spaceFollows)
+        {
+            const int space = metarString.indexOf(' ');
+            spaceFollows = space >= 0;
+            return QStringView(metarString).left(spaceFollows ? space : metarString.size());
+        }
+
+        //! Character classes, ASCII only
+        //! @{
+        static bool isDigit(QChar c) { return c >= '0' && c <= '9'; }
+        static bool isUpper(QChar c) { return c >= 'A' && c <= 'Z'; }
+        static bool isDigits(QStringView token)
+        {
+            if (token.isEmpty()) { return false; }
+            for (QChar c : token) { if (!isDigit(c)) { return false; } }
+            return true;
+        }
+        static int countDigits(QStringView string, int from)
+        {
+            int n = 0;
+            while (from + n < string.size() && isDigit(string.at(from + n))) { n++; }
+            return n;
+        }
+        static bool isAscii(QStringView token)
+        {
+            for (QChar c : token) { if (c.unicode() > 0x7f) { return false; } }
+            return true;
+        }
+        //! @}
+
     public:
         //! Parse METAR string
-        bool parse(QString &metarString, CMetar &metar)
+        //! \param fastPaths use matchToken before the regular expression
+        bool parse(QString &metarString, CMetar &metar, bool fastPaths)
         {
             bool isValid = false;
-            const QRegularExpression re(getRegExp());
-            Q_ASSERT(re.isValid());
             // Loop stop condition:
             // - Invalid data
             // - One match found and token not repeatable
             do
             {
+                // Fast path, all regular expressions need at least one character.
+                // \d and \w are Unicode aware, hence non ASCII tokens always use the regular expression
+                TokenMatch tokenMatch = TokenNoMatch;
+                int consumed = 0;
+                if (!metarString.isEmpty())
+                {
+                    bool spaceFollows = false;
+                    const bool fast = fastPaths && metarString.at(0) != ' ' && isAscii(leadingToken(metarString, spaceFollows));
+                    tokenMatch = fast ? matchToken(metarString, consumed, metar) : TokenUseRegExp;
+                }
+
+                if (tokenMatch == TokenMatched)
+                {
+                    metarString.remove(0, consumed);
+                    isValid = true;
+                    continue;
+                }
+                if (tokenMatch == TokenInvalid) { return false; }
+                if (tokenMatch == TokenNoMatch)
+                {
+                    if (!isMandatory()) { isValid = true; }
+                    break;
+                }
+
+                const QRegularExpression &re = getRegExp();
+                Q_ASSERT(re.isValid());
                 QRegularExpressionMatch match = re.match(metarString);
                 if (match.hasMatch())
                 {
@@ -123,6 +204,16 @@ namespace BlackMisc::Weather
             return true;
         }
 
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            bool spaceFollows = false;
+            const QStringView token = leadingToken(metarString, spaceFollows);
+            if (!spaceFollows || (token != QLatin1String("METAR") && token != QLatin1String("SPECI"))) { return TokenNoMatch; }
+            metar.setReportType(getReportTypeHash().value(token.toString()));
+            consumed = token.size() + 1;
+            return TokenMatched;
+        }
+
         virtual bool isMandatory() const override { return false; }
 
     private:
@@ -157,6 +248,20 @@ namespace BlackMisc::Weather
             return true;
         }
 
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            bool spaceFollows = false;
+            const QStringView token = leadingToken(metarString, spaceFollows);
+            if (!spaceFollows || token.size() != 4) { return TokenNoMatch; }
+            for (QChar c : token)
+            {
+                if (!isDigit(c) && !isUpper(c) && !(c >= 'a' && c <= 'z') && c != '_') { return TokenNoMatch; }
+            }
+            metar.setAirportIcaoCode(CAirportIcaoCode(token.toString()));
+            consumed = token.size() + 1;
+            return TokenMatched;
+        }
+
         virtual bool isMandatory() const override { return true; }
     };
 
@@ -179,7 +284,21 @@ namespace BlackMisc::Weather
             int hour   = match.captured("hour").toInt(&ok);
             int minute = match.captured("minute").toInt(&ok);
             if (!ok) return false;
+            return setDayTime(day, hour, minute, metar);
+        }
 
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            bool spaceFollows = false;
+            const QStringView token = leadingToken(metarString, spaceFollows);
+            if (!spaceFollows || token.size() != 7 || token.at(6) != 'Z' || !isDigits(token.left(6))) { return TokenNoMatch; }
+            const auto twoDigits = [&token](int i) { return (token.at(i).unicode() - '0') * 10 + (token.at(i + 1).unicode() - '0'); };
+            consumed = token.size() + 1;
+            return tokenResult(setDayTime(twoDigits(0), twoDigits(2), twoDigits(4), metar));
+        }
+
+        bool setDayTime(int day, int hour, int minute, CMetar &metar) const
+        {
             if (day < 1    || day > 31)    return false;
             if (hour < 0   || hour > 23)   return false;
             if (minute < 0 || minute > 59) return false;
@@ -210,9 +329,24 @@ namespace BlackMisc::Weather
 
         bool validateAndSet(const QRegularExpressionMatch &match, CMetar &metar) const override
         {
-            if (match.captured(1) == "AUTO") { metar.setAutomated(true); return true; }
-            else if (match.captured(1) == "NIL") { /* todo */ return true; }
-            else if (match.captured(1).size() == 3) { /* todo */ return true; }
+            return setStatus(match.capturedView(1), metar);
+        }
+
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            bool spaceFollows = false;
+            const QStringView token = leadingToken(metarString, spaceFollows);
+            if (!spaceFollows || token.isEmpty()) { return TokenNoMatch; }
+            for (QChar c : token) { if (!isUpper(c)) { return TokenNoMatch; } }
+            consumed = token.size() + 1;
+            return tokenResult(setStatus(token, metar));
+        }
+
+        bool setStatus(QStringView status, CMetar &metar) const
+        {
+            if (status == QLatin1String("AUTO")) { metar.setAutomated(true); return true; }
+            else if (status == QLatin1String("NIL")) { /* todo */ return true; }
+            else if (status.size() == 3) { /* todo */ return true; }
             else { return false; }
         }
 
@@ -244,9 +378,51 @@ namespace BlackMisc::Weather
         }
 
         bool validateAndSet(const QRegularExpressionMatch &match, CMetar &metar) const override
+        {
+            return setWind(match.captured("direction"), match.captured("speed"), match.captured("gustSpeed"), match.captured("unit"), metar);
+        }
+
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            // same backtracking result as the regular expression: digit groups must end exactly where G or the unit follows
+            const QStringView string(metarString);
+            if (!string.startsWith(QLatin1String("VRB")) && !string.startsWith(QLatin1String("///")) && countDigits(string, 0) < 3) { return TokenNoMatch; }
+            const QStringView direction = string.left(3);
+            int pos = 3;
+
+            QStringView speed;
+            const int speedDigits = countDigits(string, pos);
+            if (speedDigits == 2 || speedDigits == 3) { speed = string.mid(pos, speedDigits); }
+            else if (speedDigits == 0 && string.mid(pos).startsWith(QLatin1String("//"))) { speed = string.mid(pos, 2); }
+            else { return TokenNoMatch; }
+            pos += speed.size();
+
+            QStringView gustSpeed;
+            if (pos < string.size() && string.at(pos) == 'G')
+            {
+                const int gustDigits = countDigits(string, pos + 1);
+                if (gustDigits != 2 && gustDigits != 3) { return TokenNoMatch; }
+                gustSpeed = string.mid(pos + 1, gustDigits);
+                pos += 1 + gustDigits;
+            }
+
+            QStringView unit;
+            const QHash<QString, CSpeedUnit> &units = getWindUnitHash();
+            for (auto it = units.keyBegin(); it != units.keyEnd(); ++it)
+            {
+                if (string.mid(pos).startsWith(*it)) { unit = string.mid(pos, it->size()); break; }
+            }
+            if (unit.isEmpty()) { return TokenNoMatch; }
+            pos += unit.size();
+            if (pos < string.size() && string.at(pos) == ' ') { pos++; }
+
+            consumed = pos;
+            return tokenResult(setWind(direction.toString(), speed.toString(), gustSpeed.toString(), unit.toString(), metar));
+        }
+
+        bool setWind(const QString &directionAsString, const QString &speedAsString, const QString &gustAsString, const QString &unitAsString, CMetar &metar) const
         {
             bool ok = false;
-            QString directionAsString = match.captured("direction");
             if (directionAsString == "///") return true;
             int direction = 0;
             bool directionVariable = false;
@@ -260,18 +436,15 @@ namespace BlackMisc::Weather
                 if (!ok) return false;
             }
 
-            QString speedAsString = match.captured("speed");
             if (speedAsString == "//") return true;
             int speed = speedAsString.toInt(&ok);
             if (!ok) return false;
-            QString gustAsString = match.captured("gustSpeed");
             int gustSpeed = 0;
             if (!gustAsString.isEmpty())
             {
                 gustSpeed = gustAsString.toInt(&ok);
                 if (!ok) return false;
             }
-            QString unitAsString = match.captured("unit");
             if (!getWindUnitHash().contains(unitAsString)) return false;
 
             CWindLayer windLayer(CAltitude(0, CAltitude::AboveGround, CLengthUnit::ft()), CAngle(direction, CAngleUnit::deg()), CSpeed(speed, getWindUnitHash().value(unitAsString)),
@@ -314,9 +487,20 @@ namespace BlackMisc::Weather
 
         bool validateAndSet(const QRegularExpressionMatch &match, CMetar &metar) const override
         {
-            QString directionFromAsString = match.captured("direction_from");
-            QString directionToAsString = match.captured("direction_to");
+            return setDirections(match.captured("direction_from"), match.captured("direction_to"), metar);
+        }
 
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            bool spaceFollows = false;
+            const QStringView token = leadingToken(metarString, spaceFollows);
+            if (!spaceFollows || token.size() != 7 || token.at(3) != 'V' || !isDigits(token.left(3)) || !isDigits(token.mid(4))) { return TokenNoMatch; }
+            consumed = token.size() + 1;
+            return tokenResult(setDirections(token.left(3).toString(), token.mid(4).toString(), metar));
+        }
+
+        bool setDirections(const QString &directionFromAsString, const QString &directionToAsString, CMetar &metar) const
+        {
             int directionFrom = 0;
             int directionTo = 0;
 
@@ -376,28 +560,68 @@ namespace BlackMisc::Weather
 
         bool validateAndSet(const QRegularExpressionMatch &match, CMetar &metar) const override
         {
-            bool ok = false;
             if (!match.captured("cavok").isEmpty()) { metar.setCavok(); return true; }
             QString visibilityAsString = match.captured("visibility");
-            if (visibilityAsString == "////") return true;
+            if (!visibilityAsString.isEmpty()) { return setVisibilityMeters(visibilityAsString, metar); }
+            return setVisibilityMiles(match.captured("distance"), match.captured("numerator"), match.captured("denominator"), match.captured("unit"), metar);
+        }
 
-            double visibility = 0;
-            if (!visibilityAsString.isEmpty())
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            bool spaceFollows = false;
+            const QStringView token = leadingToken(metarString, spaceFollows);
+            if (spaceFollows)
             {
-                visibility = visibilityAsString.toDouble(&ok);
-                if (!ok) return false;
-                metar.setVisibility(CLength(visibility, CLengthUnit::m()));
-                return true;
+                consumed = token.size() + 1;
+                if (token == QLatin1String("CAVOK")) { metar.setCavok(); return TokenMatched; }
+
+                // European version, 4 digits with optional NDV and cardinal direction
+                const QStringView visibility = token.left(qMin(4, token.size()));
+                if (visibility.size() == 4 && (isDigits(visibility) || visibility == QLatin1String("////")))
+                {
+                    QStringView rest = token.mid(4);
+                    if (rest.startsWith(QLatin1String("NDV"))) { rest = rest.mid(3); }
+                    if (rest.isEmpty() || getCardinalDirections().contains(rest.toString()))
+                    {
+                        return tokenResult(setVisibilityMeters(visibility.toString(), metar));
+                    }
+                }
+
+                // US/Canada version, simple form like 10SM
+                const QStringView unit = token.right(qMin(2, token.size()));
+                const QStringView distance = token.chopped(unit.size());
+                if ((unit == QLatin1String("SM") || unit == QLatin1String("KM")) && distance.size() <= 2 && isDigits(distance))
+                {
+                    return tokenResult(setVisibilityMiles(distance.toString(), {}, {}, unit.toString(), metar));
+                }
             }
 
-            QString distanceAsString = match.captured("distance");
+            // fractions, M prefix or split groups like 1 1/2SM
+            const QChar first = metarString.at(0);
+            if (isDigit(first) || first == '/' || first == 'C' || first == 'M' || first == 'S' || first == 'K') { return TokenUseRegExp; }
+            return TokenNoMatch;
+        }
+
+        bool setVisibilityMeters(const QString &visibilityAsString, CMetar &metar) const
+        {
+            if (visibilityAsString == "////") return true;
+
+            bool ok = false;
+            const double visibility = visibilityAsString.toDouble(&ok);
+            if (!ok) return false;
+            metar.setVisibility(CLength(visibility, CLengthUnit::m()));
+            return true;
+        }
+
+        bool setVisibilityMiles(const QString &distanceAsString, const QString &numeratorAsString, const QString &denominatorAsString, const QString &unitAsString, CMetar &metar) const
+        {
+            bool ok = false;
+            double visibility = 0;
             if (!distanceAsString.isEmpty())
             {
                 visibility += distanceAsString.toDouble(&ok);
                 if (!ok) return false;
             }
-            QString numeratorAsString = match.captured("numerator");
-            QString denominatorAsString = match.captured("denominator");
             if (!numeratorAsString.isEmpty() && !denominatorAsString.isEmpty())
             {
 
@@ -410,7 +634,6 @@ namespace BlackMisc::Weather
                 visibility += (numerator / denominator);
             }
 
-            QString unitAsString = match.captured("unit");
             CLengthUnit unit = CLengthUnit::SM();
             if (unitAsString == "KM") unit = CLengthUnit::km();
 
@@ -475,6 +698,14 @@ namespace BlackMisc::Weather
             return true;
         }
 
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            Q_UNUSED(consumed)
+            Q_UNUSED(metar)
+            const bool candidate = metarString.size() > 1 && metarString.at(0) == 'R' && isDigit(metarString.at(1));
+            return candidate ? TokenUseRegExp : TokenNoMatch;
+        }
+
         virtual bool isMandatory() const override { return false; }
 
     private:
@@ -575,19 +806,53 @@ namespace BlackMisc::Weather
 
         bool validateAndSet(const QRegularExpressionMatch &match, CMetar &metar) const override
         {
-            QString intensityAsString = match.captured("intensity");
+            return setPresentWeather(match.captured("intensity"), match.captured("descriptor"), match.captured("wp1"), match.captured("wp2"), metar);
+        }
+
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            // all groups are optional and the 2 letter codes are distinct, so the whole token has to split up uniquely
+            bool spaceFollows = false;
+            const QStringView token = leadingToken(metarString, spaceFollows);
+            if (!spaceFollows) { return TokenNoMatch; }
+
+            int pos = 0;
+            QString intensity;
+            if (token.startsWith('-') || token.startsWith('+')) { intensity = token.left(1).toString(); }
+            else if (token.startsWith(QLatin1String("VC"))) { intensity = token.left(2).toString(); }
+            pos += intensity.size();
+
+            QString descriptor;
+            if (token.size() >= pos + 2 && getDescriptorHash().contains(token.mid(pos, 2).toString()))
+            {
+                descriptor = token.mid(pos, 2).toString();
+                pos += 2;
+            }
+
+            QString phenomena[4];
+            for (QString &phenomenon : phenomena)
+            {
+                if (token.size() < pos + 2 || !getWeatherPhenomenaHash().contains(token.mid(pos, 2).toString())) { break; }
+                phenomenon = token.mid(pos, 2).toString();
+                pos += 2;
+            }
+            if (pos != token.size()) { return TokenNoMatch; }
+
+            consumed = token.size() + 1;
+            return tokenResult(setPresentWeather(intensity, descriptor, phenomena[0], phenomena[1], metar));
+        }
+
+        bool setPresentWeather(const QString &intensityAsString, const QString &descriptorAsString, const QString &wp1AsString, const QString &wp2AsString, CMetar &metar) const
+        {
             CPresentWeather::Intensity itensity = CPresentWeather::Moderate;
             if (!intensityAsString.isEmpty()) { itensity = getIntensityHash().value(intensityAsString); }
 
-            QString descriptorAsString = match.captured("descriptor");
             CPresentWeather::Descriptor descriptor = CPresentWeather::None;
             if (!descriptorAsString.isEmpty()) { descriptor = getDescriptorHash().value(descriptorAsString); }
 
             int weatherPhenomena = 0;
-            QString wp1AsString = match.captured("wp1");
             if (!wp1AsString.isEmpty()) { weatherPhenomena |= getWeatherPhenomenaHash().value(wp1AsString); }
 
-            QString wp2AsString = match.captured("wp2");
             if (!wp2AsString.isEmpty()) { weatherPhenomena |= getWeatherPhenomenaHash().value(wp2AsString); }
 
             CPresentWeather presentWeather(itensity, descriptor, weatherPhenomena);
@@ -666,9 +931,33 @@ namespace BlackMisc::Weather
                 metar.removeAllClouds();
                 return true;
             }
+            return setCloudLayer(match.captured("coverage"), match.captured("base"), match.captured("cb_tcu"), metar);
+        }
+
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            bool spaceFollows = false;
+            const QStringView token = leadingToken(metarString, spaceFollows);
+            if (!spaceFollows || token.size() < 3) { return TokenNoMatch; }
+            consumed = token.size() + 1;
+
+            const QString coverage = token.left(3).toString();
+            if (token.size() == 3 && getClearSkyTokens().contains(coverage))
+            {
+                metar.removeAllClouds();
+                return TokenMatched;
+            }
+
+            if (token.size() < 6 || !getCoverage().contains(coverage)) { return TokenNoMatch; }
+            const QStringView base = token.mid(3, 3);
+            if (!isDigits(base) && base != QLatin1String("///")) { return TokenNoMatch; }
+            const QStringView extra = token.mid(6);
+            if (!extra.isEmpty() && extra != QLatin1String("CB") && extra != QLatin1String("TCU") && extra != QLatin1String("///")) { return TokenNoMatch; }
+            return tokenResult(setCloudLayer(coverage, base.toString(), extra.toString(), metar));
+        }
 
-            QString coverageAsString = match.captured("coverage");
-            QString baseAsString = match.captured("base");
+        bool setCloudLayer(const QString &coverageAsString, const QString &baseAsString, const QString &cb_tcu, CMetar &metar) const
+        {
             Q_ASSERT(!coverageAsString.isEmpty() && !baseAsString.isEmpty());
             Q_ASSERT(getCoverage().contains(coverageAsString));
             if (baseAsString == "///") return true;
@@ -681,7 +970,6 @@ namespace BlackMisc::Weather
 
             CCloudLayer cloudLayer(CAltitude(base, CAltitude::AboveGround, CLengthUnit::ft()), {}, getCoverage().value(coverageAsString));
             metar.addCloudLayer(cloudLayer);
-            QString cb_tcu = match.captured("cb_tcu");
             if (!cb_tcu.isEmpty()) { }
             return true;
         }
@@ -723,6 +1011,18 @@ namespace BlackMisc::Weather
             return true;
         }
 
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            Q_UNUSED(metar)
+            bool spaceFollows = false;
+            const QStringView token = leadingToken(metarString, spaceFollows);
+            if (!spaceFollows || token.size() != 5 || !token.startsWith(QLatin1String("VV"))) { return TokenNoMatch; }
+            const QStringView verticalVisibility = token.mid(2);
+            if (!isDigits(verticalVisibility) && verticalVisibility != QLatin1String("///")) { return TokenNoMatch; }
+            consumed = token.size() + 1;
+            return TokenMatched;
+        }
+
         virtual bool isMandatory() const override { return false; }
 
     private:
@@ -749,9 +1049,34 @@ namespace BlackMisc::Weather
 
         bool validateAndSet(const QRegularExpressionMatch &match, CMetar &metar) const override
         {
-            QString temperatureAsString = match.captured("temperature");
+            return setTemperatures(match.captured("temperature"), match.captured("dew_point"), metar);
+        }
+
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            const QStringView string(metarString);
+            const auto temperatureLength = [&string](int pos)
+            {
+                const QStringView rest = string.mid(pos);
+                if (rest.startsWith(QLatin1String("//"))) { return 2; }
+                const int sign = rest.startsWith('M') ? 1 : 0;
+                return countDigits(rest, sign) >= 2 ? sign + 2 : 0;
+            };
+
+            const int temperature = temperatureLength(0);
+            if (temperature == 0 || string.size() <= temperature || string.at(temperature) != '/') { return TokenNoMatch; }
+            const int dewPoint = temperatureLength(temperature + 1);
+            if (dewPoint == 0) { return TokenNoMatch; }
+
+            int pos = temperature + 1 + dewPoint;
+            if (pos < string.size() && string.at(pos) == ' ') { pos++; }
+            consumed = pos;
+            return tokenResult(setTemperatures(string.left(temperature).toString(), string.mid(temperature + 1, dewPoint).toString(), metar));
+        }
+
+        bool setTemperatures(QString temperatureAsString, QString dewPointAsString, CMetar &metar) const
+        {
             if (temperatureAsString.isEmpty()) return false;
-            QString dewPointAsString = match.captured("dew_point");
             if (dewPointAsString.isEmpty()) return false;
 
             if (temperatureAsString == "//" || dewPointAsString == "//") return true;
@@ -822,9 +1147,25 @@ namespace BlackMisc::Weather
 
         bool validateAndSet(const QRegularExpressionMatch &match, CMetar &metar) const override
         {
-            QString unitAsString = match.captured("unit");
-            QString pressureAsString = match.captured("pressure");
-            QString qfeAsString = match.captured("qfe");
+            return setPressure(match.captured("unit"), match.captured("pressure"), match.captured("qfe"), metar);
+        }
+
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            // the QFE alternative is not anchored and all its matches are removed, leave that to the regular expression
+            if (metarString.contains(QLatin1String("QFE "))) { return TokenUseRegExp; }
+
+            const QStringView string(metarString);
+            if (string.size() < 5 || (string.at(0) != 'Q' && string.at(0) != 'A')) { return TokenNoMatch; }
+            const QStringView pressure = string.mid(1, 4);
+            if (!isDigits(pressure) && pressure != QLatin1String("////")) { return TokenNoMatch; }
+
+            consumed = (string.size() > 5 && string.at(5) == ' ') ? 6 : 5;
+            return tokenResult(setPressure(string.left(1).toString(), pressure.toString(), {}, metar));
+        }
+
+        bool setPressure(const QString &unitAsString, const QString &pressureAsString, const QString &qfeAsString, CMetar &metar) const
+        {
             if ((unitAsString.isEmpty() || pressureAsString.isEmpty()) && qfeAsString.isEmpty()) return false;
 
             // In case no value is defined
@@ -885,6 +1226,13 @@ namespace BlackMisc::Weather
             return true;
         }
 
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            Q_UNUSED(consumed)
+            Q_UNUSED(metar)
+            return metarString.startsWith(QLatin1String("RE")) ? TokenUseRegExp : TokenNoMatch;
+        }
+
         virtual bool isMandatory() const override { return false; }
 
     private:
@@ -934,6 +1282,13 @@ namespace BlackMisc::Weather
             return true;
         }
 
+        TokenMatch matchToken(const QString &metarString, int &consumed, CMetar &metar) const override
+        {
+            Q_UNUSED(consumed)
+            Q_UNUSED(metar)
+            return metarString.startsWith(QLatin1String("WS ")) ? TokenUseRegExp : TokenNoMatch;
+        }
+
         virtual bool isMandatory() const override { return false; }
 
     private:
@@ -953,6 +1308,11 @@ namespace BlackMisc::Weather
         allocateDecoders();
     }
 
+    CMetarDecoder::CMetarDecoder(bool fastPaths) : m_fastPaths(fastPaths)
+    {
+        allocateDecoders();
+    }
+
     CMetarDecoder::~CMetarDecoder()
     { }
 
@@ -963,7 +1323,7 @@ namespace BlackMisc::Weather
 
         for (const auto &decoder : m_decoders)
         {
-            if (!decoder->parse(metarStringCopy, metar))
+            if (!decoder->parse(metarStringCopy, metar, m_fastPaths))
             {
                 const QString type = decoder->getDecoderType();
                 CLogMessage(this).debug() << "Invalid METAR:" << metarString << type;
@@ -975,6 +1335,18 @@ namespace BlackMisc::Weather
         return metar;
     }
 
+    QVector<CMetar> CMetarDecoder::decode(const QStringList &metarStrings) const
+    {
+        const int count = metarStrings.size();
+        QVector<CMetar> metars(count);
+        CMetar *results = metars.data(); // detach once, threads write distinct elements
+        CThreadUtils::forEachChunk(CThreadUtils::chunkBounds(count, MinMetarsPerThread), [&](int, int first, int last)
+        {
+            for (int i = first; i < last; i++) { results[i] = this->decode(metarStrings.at(i)); }
+        });
+        return metars;
+    }
+
     void CMetarDecoder::allocateDecoders()
     {
         m_decoders.clear();
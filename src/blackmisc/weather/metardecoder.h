@@ -16,6 +16,8 @@
 
 #include <QObject>
 #include <QString>
+#include <QStringList>
+#include <QVector>
 #include <memory>
 #include <vector>
 
@@ -32,15 +34,29 @@ namespace BlackMisc::Weather
         //! Default constructor
         CMetarDecoder();
 
+        //! Constructor
+        //! \param fastPaths decode the common groups by hand-written tokenizers, otherwise by the regular expressions only
+        explicit CMetarDecoder(bool fastPaths);
+
         //! Default destructor
         virtual ~CMetarDecoder() override;
 
         //! Decode metar
+        //! \threadsafe
         CMetar decode(const QString &metarString) const;
 
+        //! Decode many METARs, one result per string, CMetar() for invalid METARs
+        //! \remark larger inputs are decoded in parallel, the decoder parts are stateless
+        //! \threadsafe
+        QVector<CMetar> decode(const QStringList &metarStrings) const;
+
     private:
+        //! Minimum number of METARs decoded by one thread
+        static constexpr int MinMetarsPerThread = 250;
+
         void allocateDecoders();
         std::vector<std::unique_ptr<IMetarDecoderPart>> m_decoders;
+        bool m_fastPaths = true;
     };
 
 } // namespace
@@ -23,4 +23,16 @@ namespace BlackMisc::Weather
         return this->findFirstByOrDefault(&CMetar::getAirportIcaoCode, icao);
     }
 
+    QHash<QString, CMetar> CMetarList::getMetarsByAirport() const
+    {
+        QHash<QString, CMetar> index;
+        index.reserve(this->size());
+        for (const CMetar &metar : *this)
+        {
+            const QString &icao = metar.getAirportIcaoCode().asString();
+            if (!index.contains(icao)) { index.insert(icao, metar); }
+        }
+        return index;
+    }
+
 } // namespace
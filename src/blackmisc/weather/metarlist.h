@@ -18,6 +18,7 @@
 #include "blackmisc/sequence.h"
 #include "blackmisc/weather/metar.h"
 
+#include <QHash>
 #include <QMetaType>
 #include <QString>
 
@@ -42,6 +43,10 @@ namespace BlackMisc::Weather
 
         //! METAR for ICAO code
         CMetar getMetarForAirport(const Aviation::CAirportIcaoCode &icao) const;
+
+        //! METARs keyed by ICAO code string, for repeated lookups
+        //! \remark first METAR per airport, as in getMetarForAirport
+        QHash<QString, CMetar> getMetarsByAirport() const;
     };
 
 } // namespace
@@ -37,7 +37,7 @@
 namespace chunkware_simple
 {
     //! simple compressor
-    class SimpleComp : public AttRelEnvelope
+    class BLACKSOUND_EXPORT SimpleComp : public AttRelEnvelope
     {
     public:
         //! Ctor
@@ -70,6 +70,10 @@ namespace chunkware_simple
         //! process sample with stereo-linked key in
         void process(double &in1, double &in2, double keyLinked);
 
+        //! compressor runtime process of interleaved samples in place, mono if channels is 1
+        //! \remark same result as process(in1, in2) for each frame, but with the state in registers
+        void process(float *samples, int frames, int channels);
+
     private:
         // transfer function
         double threshdB_;       // threshold (dB)
@@ -82,7 +86,7 @@ namespace chunkware_simple
     };  // end SimpleComp class
 
     //! Simple compressor with RMS detection
-    class SimpleCompRms : public SimpleComp
+    class BLACKSOUND_EXPORT SimpleCompRms : public SimpleComp
     {
     public:
         //! Ctor
@@ -88,6 +88,47 @@ namespace chunkware_simple
 		in2 *= gr;
 	}
 
+	//-------------------------------------------------------------
+	INLINE void SimpleComp::process( float *samples, int frames, int channels )
+	{
+		// constant for the block, computed per sample in process( in1, in2, keyLinked )
+		const double makeUpGain = dB2lin( makeUpGain_ );
+
+		// below this key the key in dB is for sure below the threshold, so no log() needed
+		const double keyBelowThresh = dB2lin( threshdB_ ) * 0.999999;
+
+		double envdB = envdB_;
+		for ( int i = 0; i < frames; ++i, samples += channels )
+		{
+			const double in1 = samples[ 0 ];
+			const double in2 = ( channels > 1 ) ? samples[ 1 ] : 0.0;
+
+			// sidechain, same as process( in1, in2 )
+			const double keyLinked = std::max( fabs( in1 ), fabs( in2 ) ) + DC_OFFSET;
+			double overdB = 0.0;
+			if ( keyLinked >= keyBelowThresh )
+			{
+				overdB = lin2dB( keyLinked ) - threshdB_;
+				if ( overdB < 0.0 )
+					overdB = 0.0;
+			}
+
+			// attack/release
+			overdB += DC_OFFSET;
+			AttRelEnvelope::run( overdB, envdB );
+			overdB = envdB - DC_OFFSET;
+
+			// transfer function, exp( 0 ) is 1 for a fully released envelope
+			const double gr = ( overdB == 0.0 ) ? makeUpGain : dB2lin( overdB * ( ratio_ - 1.0 ) ) * makeUpGain;
+
+			// output gain
+			samples[ 0 ] = static_cast<float>( in1 * gr );
+			if ( channels > 1 )
+				samples[ 1 ] = static_cast<float>( in2 * gr );
+		}
+		envdB_ = envdB;
+	}
+
 	//-------------------------------------------------------------
 	INLINE void SimpleCompRms::process( double &in1, double &in2 )
 	{
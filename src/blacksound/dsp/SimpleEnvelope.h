@@ -45,7 +45,7 @@ namespace chunkware_simple
     static constexpr double DC_OFFSET = 1.0E-25;
 
     //! Envelope detector
-    class EnvelopeDetector
+    class BLACKSOUND_EXPORT EnvelopeDetector
     {
     public:
         //! Ctor
@@ -82,7 +82,7 @@ namespace chunkware_simple
     };  // end SimpleComp class
 
     //! attack/release envelope
-    class AttRelEnvelope
+    class BLACKSOUND_EXPORT AttRelEnvelope
     {
     public:
         //! Ctor
@@ -38,7 +38,7 @@
 namespace chunkware_simple
 {
     //! simple gate
-    class SimpleGate : public AttRelEnvelope
+    class BLACKSOUND_EXPORT SimpleGate : public AttRelEnvelope
     {
     public:
         //! Constructor
@@ -64,6 +64,10 @@ namespace chunkware_simple
         //! Process audio stereo-linked
         void process(double &in1, double &in2, double keyLinked);    // with stereo-linked key in
 
+        //! gate runtime process of interleaved samples in place, mono if channels is 1
+        //! \remark same result as process(in1, in2) for each frame, but with the state in registers
+        void process(float *samples, int frames, int channels);
+
     private:
         // transfer function
         double threshdB_;   //!< threshold (dB)
@@ -74,7 +78,7 @@ namespace chunkware_simple
     };
 
     //! Simple gate with RMS detection
-    class SimpleGateRms : public SimpleGate
+    class BLACKSOUND_EXPORT SimpleGateRms : public SimpleGate
     {
     public:
         //! Constructor
@@ -78,6 +78,32 @@ namespace chunkware_simple
 		in2 *= over;
 	}
 
+	//-------------------------------------------------------------
+	INLINE void SimpleGate::process( float *samples, int frames, int channels )
+	{
+		double env = env_;
+		for ( int i = 0; i < frames; ++i, samples += channels )
+		{
+			const double in1 = samples[ 0 ];
+			const double in2 = ( channels > 1 ) ? samples[ 1 ] : 0.0;
+
+			// sidechain and threshold, same as process( in1, in2 )
+			const double keyLinked = std::max( fabs( in1 ), fabs( in2 ) );
+			double over = double( keyLinked > thresh_ );
+
+			// attack/release
+			over += DC_OFFSET;
+			AttRelEnvelope::run( over, env );
+			over = env - DC_OFFSET;
+
+			// output gain
+			samples[ 0 ] = static_cast<float>( in1 * over );
+			if ( channels > 1 )
+				samples[ 1 ] = static_cast<float>( in2 * over );
+		}
+		env_ = env;
+	}
+
 	//-------------------------------------------------------------
 	INLINE void SimpleGateRms::process( double &in1, double &in2 )
 	{
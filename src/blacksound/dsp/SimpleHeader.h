@@ -43,4 +43,6 @@
 #include <cassert>		// for assert()
 #include <cmath>
 
+#include "blacksound/blacksoundexport.h"
+
 #endif	// end __SIMPLE_HEADER_H__
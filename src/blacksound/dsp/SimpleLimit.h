@@ -39,7 +39,7 @@
 namespace chunkware_simple
 {
     //! Simple limiter
-    class SimpleLimit
+    class BLACKSOUND_EXPORT SimpleLimit
     {
     public:
         //! Ctor
@@ -77,6 +77,10 @@ namespace chunkware_simple
         //! limiter runtime process
         void process(double &in1, double &in2);
 
+        //! limiter runtime process of interleaved samples in place, mono if channels is 1
+        //! \remark same result as process(in1, in2) for each frame, but with the state in registers
+        void process(float *samples, int frames, int channels);
+
     protected:
 
         //! Class for faster attack/release
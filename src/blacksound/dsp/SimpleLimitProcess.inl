@@ -134,6 +134,62 @@ namespace chunkware_simple
 		 */
 	}
 
+	//-------------------------------------------------------------
+	INLINE void SimpleLimit::process( float *samples, int frames, int channels )
+	{
+		// runtime state in locals for the whole block
+		unsigned int peakTimer = peakTimer_;
+		unsigned int cur = cur_;
+		double maxPeak = maxPeak_;
+		double env = env_;
+		double *outBuffer1 = outBuffer_[ 0 ].data();
+		double *outBuffer2 = outBuffer_[ 1 ].data();
+
+		for ( int i = 0; i < frames; ++i, samples += channels )
+		{
+			const double in1 = samples[ 0 ];
+			const double in2 = ( channels > 1 ) ? samples[ 1 ] : 0.0;
+
+			// sidechain and threshold, same as process( in1, in2 )
+			double keyLink = std::max( fabs( in1 ), fabs( in2 ) );
+			if ( keyLink < thresh_ )
+				keyLink = thresh_;
+
+			// max peak
+			if ( (++peakTimer >= peakHold_) || (keyLink > maxPeak) ) {
+				peakTimer = 0;
+				maxPeak = keyLink;
+			}
+
+			// attack/release
+			if ( maxPeak > env )
+				att_.run( maxPeak, env );
+			else
+				rel_.run( maxPeak, env );
+
+			// gain reduction
+			const double gR = thresh_ / env;
+
+			// delayed output, load current buffer index and advance current index
+			const unsigned int delayIndex = ( cur - peakHold_ ) & mask_;
+			const double delay1 = outBuffer1[ delayIndex ];
+			const double delay2 = outBuffer2[ delayIndex ];
+			outBuffer1[ cur ] = in1;
+			outBuffer2[ cur ] = in2;
+			++cur &= mask_;
+
+			// output gain
+			samples[ 0 ] = static_cast<float>( delay1 * gR );
+			if ( channels > 1 )
+				samples[ 1 ] = static_cast<float>( delay2 * gR );
+		}
+
+		peakTimer_ = peakTimer;
+		cur_ = cur;
+		maxPeak_ = maxPeak;
+		env_ = env;
+	}
+
 }	// end namespace chunkware_simple
 
 #endif	// end __SIMPLE_LIMIT_PROCESS_INL__
@@ -34,6 +34,29 @@ namespace BlackSound::Dsp
         return m_y1;
     }
 
+    void BiQuadFilter::transform(float *samples, int count)
+    {
+        // state in registers for the whole block
+        float x1 = m_x1;
+        float x2 = m_x2;
+        float y1 = m_y1;
+        float y2 = m_y2;
+        for (int n = 0; n < count; n++)
+        {
+            const float inSample = samples[n];
+            const double result = m_a0 * inSample + m_a1 * x1 + m_a2 * x2 - m_a3 * y1 - m_a4 * y2;
+            x2 = x1;
+            x1 = inSample;
+            y2 = y1;
+            y1 = static_cast<float>(result);
+            samples[n] = y1;
+        }
+        m_x1 = x1;
+        m_x2 = x2;
+        m_y1 = y1;
+        m_y2 = y2;
+    }
+
     void BiQuadFilter::setCoefficients(double aa0, double aa1, double aa2, double b0, double b1, double b2)
     {
         if (CBuildConfig::isLocalDeveloperDebugBuild()) { BLACK_VERIFY_X(qAbs(aa0) > 1E-06, Q_FUNC_INFO, "Div by zero?"); }
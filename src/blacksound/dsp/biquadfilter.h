@@ -16,7 +16,7 @@
 namespace BlackSound::Dsp
 {
     //! Digital biquad filter
-    class BiQuadFilter
+    class BLACKSOUND_EXPORT BiQuadFilter
     {
     public:
         //! Ctor
@@ -25,6 +25,9 @@ namespace BlackSound::Dsp
         //! Transform
         float transform(float inSample);
 
+        //! Transform count samples in place, same result as transform(float) for each sample
+        void transform(float *samples, int count);
+
         //! Set filter parameters
         //! @{
         void setCoefficients(double aa0, double aa1, double aa2, double b0, double b1, double b2);
@@ -41,6 +44,8 @@ namespace BlackSound::Dsp
         //! @}
 
     private:
+        friend class BiQuadFilterCascade;
+
         double m_a0 = 0.0;
         double m_a1 = 0.0;
         double m_a2 = 0.0;
@@ -0,0 +1,189 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "biquadfiltercascade.h"
+
+#include <QtGlobal>
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define BLACKSOUND_DSP_SSE2
+#   include <emmintrin.h>
+#endif
+
+namespace BlackSound::Dsp
+{
+    namespace
+    {
+#ifdef BLACKSOUND_DSP_SSE2
+        //! Coefficients and state of the cascade
+        struct CascadeArrays
+        {
+            const double *a0, *a1, *a2, *a3, *a4;
+            double *x1, *x2, *y1, *y2;
+        };
+
+        //! Pipeline steps first to last with all filters active, 2 filters per register
+        //! \remark same operations in the same order as BiQuadFilter::transform, so the result is bit identical
+        template <int Vectors>
+        void pipelineSse2(const CascadeArrays &arrays, int size, float *samples, int first, int last)
+        {
+            __m128d a0[Vectors], a1[Vectors], a2[Vectors], a3[Vectors], a4[Vectors];
+            __m128d x1[Vectors], x2[Vectors], y1[Vectors], y2[Vectors];
+            for (int j = 0; j < Vectors; ++j)
+            {
+                a0[j] = _mm_load_pd(arrays.a0 + 2 * j);
+                a1[j] = _mm_load_pd(arrays.a1 + 2 * j);
+                a2[j] = _mm_load_pd(arrays.a2 + 2 * j);
+                a3[j] = _mm_load_pd(arrays.a3 + 2 * j);
+                a4[j] = _mm_load_pd(arrays.a4 + 2 * j);
+                x1[j] = _mm_load_pd(arrays.x1 + 2 * j);
+                x2[j] = _mm_load_pd(arrays.x2 + 2 * j);
+                y1[j] = _mm_load_pd(arrays.y1 + 2 * j);
+                y2[j] = _mm_load_pd(arrays.y2 + 2 * j);
+            }
+
+            const int lastFilter = size - 1;
+            const int outVector  = lastFilter / 2;
+            const bool outHigh   = lastFilter % 2;
+            for (int t = first; t <= last; ++t)
+            {
+                // input of filter k is the last output of filter k - 1
+                __m128d in[Vectors];
+                in[0] = _mm_shuffle_pd(_mm_set_sd(static_cast<double>(samples[t])), y1[0], 0);
+                for (int j = 1; j < Vectors; ++j) { in[j] = _mm_shuffle_pd(y1[j - 1], y1[j], 1); }
+
+                for (int j = 0; j < Vectors; ++j)
+                {
+                    __m128d result = _mm_add_pd(_mm_mul_pd(a0[j], in[j]), _mm_mul_pd(a1[j], x1[j]));
+                    result = _mm_add_pd(result, _mm_mul_pd(a2[j], x2[j]));
+                    result = _mm_sub_pd(result, _mm_mul_pd(a3[j], y1[j]));
+                    result = _mm_sub_pd(result, _mm_mul_pd(a4[j], y2[j]));
+                    x2[j] = x1[j];
+                    x1[j] = in[j];
+                    y2[j] = y1[j];
+                    y1[j] = _mm_cvtps_pd(_mm_cvtpd_ps(result)); // float state as in BiQuadFilter
+                }
+
+                const __m128d out = outHigh ? _mm_unpackhi_pd(y1[outVector], y1[outVector]) : y1[outVector];
+                samples[t - lastFilter] = static_cast<float>(_mm_cvtsd_f64(out));
+            }
+
+            for (int j = 0; j < Vectors; ++j)
+            {
+                _mm_store_pd(arrays.x1 + 2 * j, x1[j]);
+                _mm_store_pd(arrays.x2 + 2 * j, x2[j]);
+                _mm_store_pd(arrays.y1 + 2 * j, y1[j]);
+                _mm_store_pd(arrays.y2 + 2 * j, y2[j]);
+            }
+        }
+#endif
+    } // anonymous
+
+    constexpr int BiQuadFilterCascade::MaxFilters;
+
+    BiQuadFilterCascade::BiQuadFilterCascade(const QVector<BiQuadFilter> &filters)
+    {
+        for (const BiQuadFilter &filter : filters)
+        {
+            if (!this->push_back(filter)) { break; }
+        }
+    }
+
+    bool BiQuadFilterCascade::push_back(const BiQuadFilter &filter)
+    {
+        if (m_size >= MaxFilters) { return false; }
+        const int k = m_size++;
+        m_a0[k] = filter.m_a0;
+        m_a1[k] = filter.m_a1;
+        m_a2[k] = filter.m_a2;
+        m_a3[k] = filter.m_a3;
+        m_a4[k] = filter.m_a4;
+        m_x1[k] = filter.m_x1;
+        m_x2[k] = filter.m_x2;
+        m_y1[k] = filter.m_y1;
+        m_y2[k] = filter.m_y2;
+        return true;
+    }
+
+    void BiQuadFilterCascade::clear()
+    {
+        // unused lanes are computed as well, so no stale (maybe denormal) values
+        m_size = 0;
+        for (double *values : { m_a0, m_a1, m_a2, m_a3, m_a4, m_x1, m_x2, m_y1, m_y2 })
+        {
+            std::fill(values, values + MaxFilters, 0.0);
+        }
+    }
+
+    float BiQuadFilterCascade::transform(float inSample)
+    {
+        this->transform(&inSample, 1);
+        return inSample;
+    }
+
+    void BiQuadFilterCascade::transform(float *samples, int count)
+    {
+        if (m_size < 1 || count < 1) { return; }
+
+        // sample n leaves the last filter in step n + lastFilter
+        const int lastFilter = m_size - 1;
+        const int steps = count + lastFilter;
+        const auto partialStep = [ & ](int t)
+        {
+            const int first = qMax(0, t - count + 1);
+            const int last  = qMin(lastFilter, t);
+            this->step(first, last, t < count ? samples[t] : 0.0f);
+            if (t >= lastFilter) { samples[t - lastFilter] = static_cast<float>(m_y1[lastFilter]); }
+        };
+
+        int t = 0;
+        for (; t < lastFilter; ++t) { partialStep(t); } // filling the pipeline
+        if (lastFilter < count)
+        {
+            this->transformSse2(samples, lastFilter, count - 1);
+            t = count;
+        }
+        for (; t < steps; ++t) { partialStep(t); } // draining the pipeline
+    }
+
+    void BiQuadFilterCascade::step(int first, int last, float inSample)
+    {
+        // backwards, the input of filter k is the output of filter k - 1 from the last step
+        for (int k = last; k >= first; --k)
+        {
+            const double in = k == 0 ? static_cast<double>(inSample) : m_y1[k - 1];
+            const double result = m_a0[k] * in + m_a1[k] * m_x1[k] + m_a2[k] * m_x2[k] - m_a3[k] * m_y1[k] - m_a4[k] * m_y2[k];
+            m_x2[k] = m_x1[k];
+            m_x1[k] = in;
+            m_y2[k] = m_y1[k];
+            m_y1[k] = static_cast<float>(result);
+        }
+    }
+
+    void BiQuadFilterCascade::transformSse2(float *samples, int first, int last)
+    {
+#ifdef BLACKSOUND_DSP_SSE2
+        const CascadeArrays arrays { m_a0, m_a1, m_a2, m_a3, m_a4, m_x1, m_x2, m_y1, m_y2 };
+        switch ((m_size + 1) / 2)
+        {
+        case 1:  pipelineSse2<1>(arrays, m_size, samples, first, last); return;
+        case 2:  pipelineSse2<2>(arrays, m_size, samples, first, last); return;
+        case 3:  pipelineSse2<3>(arrays, m_size, samples, first, last); return;
+        default: pipelineSse2<4>(arrays, m_size, samples, first, last); return;
+        }
+#else
+        const int lastFilter = m_size - 1;
+        for (int t = first; t <= last; ++t)
+        {
+            this->step(0, lastFilter, samples[t]);
+            samples[t - lastFilter] = static_cast<float>(m_y1[lastFilter]);
+        }
+#endif
+    }
+} // ns
@@ -0,0 +1,81 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKSOUND_DSP_BIQUADFILTERCASCADE_H
+#define BLACKSOUND_DSP_BIQUADFILTERCASCADE_H
+
+#include "blacksound/blacksoundexport.h"
+#include "blacksound/dsp/biquadfilter.h"
+
+#include <QVector>
+
+namespace BlackSound::Dsp
+{
+    /*!
+     * Chain of biquad filters, processed as a pipeline: in each step filter k transforms
+     * sample n - k, so all filters run in parallel (SSE2 if available, 2 filters per register).
+     * The result is bit identical to calling BiQuadFilter::transform of each filter in turn.
+     */
+    class BLACKSOUND_EXPORT BiQuadFilterCascade
+    {
+    public:
+        //! Max. number of filters
+        static constexpr int MaxFilters = 8;
+
+        //! Ctor
+        BiQuadFilterCascade() = default;
+
+        //! Ctor with filters, at most MaxFilters are used
+        BiQuadFilterCascade(const QVector<BiQuadFilter> &filters);
+
+        //! Append a filter with its current state
+        //! \return false if there are already MaxFilters
+        bool push_back(const BiQuadFilter &filter);
+
+        //! Number of filters
+        int size() const { return m_size; }
+
+        //! No filters?
+        bool isEmpty() const { return m_size < 1; }
+
+        //! Remove all filters
+        void clear();
+
+        //! Transform one sample through all filters
+        float transform(float inSample);
+
+        //! Transform count samples in place through all filters
+        void transform(float *samples, int count);
+
+    private:
+        //! One pipeline step of the filters first to last, inSample is the input of filter 0
+        void step(int first, int last, float inSample);
+
+        //! Pipeline steps with all filters active, steps first to last
+        void transformSse2(float *samples, int first, int last);
+
+        static_assert(MaxFilters % 2 == 0 && MaxFilters <= 8, "Pipeline uses up to 4 registers of 2 filters");
+
+        int m_size = 0;
+
+        // coefficients and state per filter, the state values are floats as in BiQuadFilter
+        alignas(16) double m_a0[MaxFilters] = {};
+        alignas(16) double m_a1[MaxFilters] = {};
+        alignas(16) double m_a2[MaxFilters] = {};
+        alignas(16) double m_a3[MaxFilters] = {};
+        alignas(16) double m_a4[MaxFilters] = {};
+        alignas(16) double m_x1[MaxFilters] = {};
+        alignas(16) double m_x2[MaxFilters] = {};
+        alignas(16) double m_y1[MaxFilters] = {};
+        alignas(16) double m_y2[MaxFilters] = {};
+    };
+} // ns
+
+#endif // guard
@@ -22,14 +22,11 @@ namespace BlackSound::SampleProvider
         const int samplesRead = m_sourceProvider->readSamples(samples, count);
         if (m_bypass) return samplesRead;
 
-        for (int n = 0; n < samplesRead; n++)
-        {
-            for (int band = 0; band < m_filters.size(); band++)
-            {
-                samples[n] = m_filters[band].transform(samples[n]);
-            }
-            samples[n] *= static_cast<float>(m_outputGain);
-        }
+        // all bands at once, block wise
+        float *data = samples.data();
+        m_filters.transform(data, samplesRead);
+        const float gain = static_cast<float>(m_outputGain);
+        for (int n = 0; n < samplesRead; n++) { data[n] *= gain; }
         return samplesRead;
     }
 
@@ -13,7 +13,7 @@
 
 #include "blacksound/blacksoundexport.h"
 #include "blacksound/sampleprovider/sampleprovider.h"
-#include "blacksound/dsp/biquadfilter.h"
+#include "blacksound/dsp/biquadfiltercascade.h"
 
 #include <QSharedPointer>
 #include <QVector>
@@ -54,7 +54,7 @@ namespace BlackSound::SampleProvider
         int    m_channels   = 1;
         bool   m_bypass     = false;
         double m_outputGain = 1.0;
-        QVector<Dsp::BiQuadFilter> m_filters;
+        Dsp::BiQuadFilterCascade m_filters;
     };
 } // ns
 
@@ -0,0 +1,239 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "blacksound/sampleprovider/parallelmixingsampleprovider.h"
+#include "blackmisc/metadatautils.h"
+
+#include <QDeadlineTimer>
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <QThread>
+#include <algorithm>
+
+using namespace BlackMisc;
+
+namespace BlackSound::SampleProvider
+{
+    //! Renders the frames of some inputs
+    class CParallelMixingSampleProvider::CRenderThread : public QThread
+    {
+    public:
+        //! Ctor
+        CRenderThread(CParallelMixingSampleProvider *mixer, const QVector<Input *> &inputs) : m_mixer(mixer), m_inputs(inputs) {}
+
+    protected:
+        //! \copydoc QThread::run
+        virtual void run() override
+        {
+            qint64 renderedFrame = -1;
+            QMutexLocker l(&m_mixer->m_mutexRequest);
+            while (!m_mixer->m_stop)
+            {
+                const qint64 frame = m_mixer->m_requestedFrame;
+                if (frame <= renderedFrame)
+                {
+                    m_mixer->m_frameRequested.wait(&m_mixer->m_mutexRequest);
+                    continue;
+                }
+
+                l.unlock();
+                for (Input *input : std::as_const(m_inputs)) { m_mixer->renderInput(*input, frame); }
+                renderedFrame = frame;
+                l.relock();
+                m_mixer->m_frameRendered.wakeAll();
+            }
+        }
+
+    private:
+        CParallelMixingSampleProvider *m_mixer = nullptr;
+        QVector<Input *> m_inputs;
+    };
+
+    constexpr int CParallelMixingSampleProvider::FrameSize;
+
+    QString CParallelMixingSampleProvider::Metrics::toQString() const
+    {
+        return QStringLiteral("frames: %1 underruns: %2 (in %3 frames) render avg/max: %4/%5us").
+               arg(frames).arg(underruns).arg(framesWithUnderrun).
+               arg(this->getAverageRenderUs(), 0, 'f', 1).arg(maxRenderUs);
+    }
+
+    CParallelMixingSampleProvider::CParallelMixingSampleProvider(RenderMode mode, QObject *parent) :
+        ISampleProvider(parent), m_mode(mode), m_mix(FrameSize, 0.0f)
+    {
+        const QString on = QStringLiteral("%1").arg(classNameShort(this));
+        this->setObjectName(on);
+    }
+
+    CParallelMixingSampleProvider::~CParallelMixingSampleProvider()
+    {
+        this->stopThreads();
+    }
+
+    bool CParallelMixingSampleProvider::addMixerInput(ISampleProvider *provider)
+    {
+        Q_ASSERT(provider);
+        if (m_started) { return false; } // inputs are fixed once started
+
+        auto input = std::make_unique<Input>();
+        input->provider = provider;
+        input->frames[0].fill(0.0f, FrameSize);
+        input->frames[1].fill(0.0f, FrameSize);
+        input->readBuffer.reserve(FrameSize);
+        m_inputs.push_back(std::move(input));
+
+        const QString on = QStringLiteral("%1 sources: %2").arg(classNameShort(this)).arg(m_inputs.size());
+        this->setObjectName(on);
+        return true;
+    }
+
+    int CParallelMixingSampleProvider::readSamples(QVector<float> &samples, qint64 count)
+    {
+        samples.resize(static_cast<int>(count));
+        int written = 0;
+        while (written < count)
+        {
+            if (m_mixPosition >= FrameSize) { this->mixNextFrame(); }
+            const int n = qMin(static_cast<int>(count) - written, FrameSize - m_mixPosition);
+            std::copy(m_mix.cbegin() + m_mixPosition, m_mix.cbegin() + m_mixPosition + n, samples.begin() + written);
+            m_mixPosition += n;
+            written += n;
+        }
+        return written;
+    }
+
+    bool CParallelMixingSampleProvider::waitForNextFrame(int timeoutMs)
+    {
+        if (m_mode == Offline || !m_started) { return true; } // rendered when needed
+
+        const qint64 frame = m_mixFrame + 1;
+        const auto isRendered = [&]
+        {
+            return std::all_of(m_inputs.cbegin(), m_inputs.cend(), [frame](const auto & input) { return input->renderedFrame.load() >= frame; });
+        };
+
+        const QDeadlineTimer deadline(timeoutMs);
+        QMutexLocker l(&m_mutexRequest);
+        while (!isRendered())
+        {
+            if (!m_frameRendered.wait(&m_mutexRequest, deadline)) { return isRendered(); }
+        }
+        return true;
+    }
+
+    CParallelMixingSampleProvider::Metrics CParallelMixingSampleProvider::getMetrics() const
+    {
+        Metrics metrics;
+        metrics.frames = m_frames;
+        metrics.inputFrames = m_inputFrames;
+        metrics.underruns = m_underruns;
+        metrics.framesWithUnderrun = m_framesWithUnderrun;
+        metrics.maxRenderUs = m_maxRenderUs;
+        metrics.sumRenderUs = m_sumRenderUs;
+        return metrics;
+    }
+
+    void CParallelMixingSampleProvider::resetMetrics()
+    {
+        m_frames = 0;
+        m_inputFrames = 0;
+        m_underruns = 0;
+        m_framesWithUnderrun = 0;
+        m_maxRenderUs = 0;
+        m_sumRenderUs = 0;
+    }
+
+    void CParallelMixingSampleProvider::renderInput(Input &input, qint64 frame)
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        const int len = qBound(0, input.provider->readSamples(input.readBuffer, FrameSize), qMin(FrameSize, input.readBuffer.size()));
+        QVector<float> &buffer = input.frames[frame % 2];
+        std::copy(input.readBuffer.cbegin(), input.readBuffer.cbegin() + len, buffer.begin());
+        std::fill(buffer.begin() + len, buffer.end(), 0.0f);
+        input.renderedFrame.store(frame, std::memory_order_release);
+
+        const qint64 us = timer.nsecsElapsed() / 1000;
+        m_inputFrames++;
+        m_sumRenderUs += us;
+        qint64 max = m_maxRenderUs.load();
+        while (us > max && !m_maxRenderUs.compare_exchange_weak(max, us)) {}
+    }
+
+    void CParallelMixingSampleProvider::mixNextFrame()
+    {
+        const qint64 frame = ++m_mixFrame;
+        if (!m_started)
+        {
+            // first frame is rendered right here, the workers start one frame ahead
+            m_started = true;
+            for (const auto &input : m_inputs) { this->renderInput(*input, frame); }
+            if (m_mode == Threaded) { this->startThreads(); }
+        }
+        else if (m_mode == Offline)
+        {
+            for (const auto &input : m_inputs) { this->renderInput(*input, frame); }
+        }
+
+        // same order as CMixingSampleProvider, so offline mixing gives the same result
+        std::fill(m_mix.begin(), m_mix.end(), 0.0f);
+        int missing = 0;
+        for (const auto &input : m_inputs)
+        {
+            if (input->renderedFrame.load(std::memory_order_acquire) != frame) { missing++; continue; }
+            const QVector<float> &buffer = input->frames[frame % 2];
+            for (int n = 0; n < FrameSize; n++) { m_mix[n] += buffer[n]; }
+        }
+
+        m_frames++;
+        if (missing > 0)
+        {
+            m_underruns += missing;
+            m_framesWithUnderrun++;
+        }
+
+        m_mixPosition = 0;
+        if (m_mode == Threaded) { this->requestFrame(frame + 1); }
+    }
+
+    void CParallelMixingSampleProvider::startThreads()
+    {
+        if (m_inputs.empty()) { return; }
+
+        // one core is left for the audio callback and the network
+        const int inputs = static_cast<int>(m_inputs.size());
+        const int threads = qBound(1, QThread::idealThreadCount() - 1, inputs);
+        for (int t = 0; t < threads; t++)
+        {
+            QVector<Input *> inputsOfThread;
+            for (int i = t; i < inputs; i += threads) { inputsOfThread.push_back(m_inputs[static_cast<size_t>(i)].get()); }
+            m_threads.push_back(std::make_unique<CRenderThread>(this, inputsOfThread));
+            m_threads.back()->setObjectName(QStringLiteral("%1 render %2").arg(classNameShort(this)).arg(t));
+            m_threads.back()->start(QThread::TimeCriticalPriority);
+        }
+    }
+
+    void CParallelMixingSampleProvider::stopThreads()
+    {
+        {
+            QMutexLocker l(&m_mutexRequest);
+            m_stop = true;
+            m_frameRequested.wakeAll();
+        }
+        for (const auto &thread : m_threads) { thread->wait(); }
+        m_threads.clear();
+    }
+
+    void CParallelMixingSampleProvider::requestFrame(qint64 frame)
+    {
+        QMutexLocker l(&m_mutexRequest);
+        m_requestedFrame = frame;
+        m_frameRequested.wakeAll();
+    }
+} // ns
@@ -0,0 +1,157 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKSOUND_SAMPLEPROVIDER_PARALLELMIXINGSAMPLEPROVIDER_H
+#define BLACKSOUND_SAMPLEPROVIDER_PARALLELMIXINGSAMPLEPROVIDER_H
+
+#include "blacksound/blacksoundexport.h"
+#include "blacksound/sampleprovider/sampleprovider.h"
+
+#include <QMutex>
+#include <QString>
+#include <QVector>
+#include <QWaitCondition>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace BlackSound::SampleProvider
+{
+    /*!
+     * Mixer which renders its inputs one frame ahead on worker threads.
+     *
+     * Each input renders frame n + 1 into its own preallocated buffer while frame n is played,
+     * readSamples only sums finished frames and never waits for an input. An input which
+     * is not ready in time is an underrun and contributes silence to that frame.
+     * The inputs are fixed once the mixer is started, they are never removed.
+     *
+     * \remark readSamples of the inputs is called in the worker threads, so the inputs have to
+     *         lock their state against other users themselves
+     */
+    class BLACKSOUND_EXPORT CParallelMixingSampleProvider : public ISampleProvider
+    {
+        Q_OBJECT
+
+    public:
+        //! How the inputs are rendered
+        enum RenderMode
+        {
+            Threaded, //!< inputs render one frame ahead on worker threads
+            Offline   //!< inputs render in order when a frame is needed, deterministic and without underruns
+        };
+
+        //! Samples per frame, 20ms at 48kHz
+        static constexpr int FrameSize = 960;
+
+        //! Mixing statistics
+        struct Metrics
+        {
+            qint64 frames = 0;             //!< frames mixed
+            qint64 inputFrames = 0;        //!< input frames rendered
+            qint64 underruns = 0;          //!< input frames not ready in time, replaced by silence
+            qint64 framesWithUnderrun = 0; //!< frames with at least one underrun
+            qint64 maxRenderUs = 0;        //!< slowest input frame
+            qint64 sumRenderUs = 0;        //!< all input frames
+
+            //! Average render time of an input frame
+            double getAverageRenderUs() const { return inputFrames > 0 ? static_cast<double>(sumRenderUs) / inputFrames : 0.0; }
+
+            //! As string
+            QString toQString() const;
+        };
+
+        //! Ctor
+        CParallelMixingSampleProvider(RenderMode mode = Threaded, QObject *parent = nullptr);
+
+        //! Dtor, stops the worker threads
+        virtual ~CParallelMixingSampleProvider() override;
+
+        //! Add an input
+        //! \return false if already started
+        bool addMixerInput(ISampleProvider *provider);
+
+        //! Render mode
+        RenderMode getRenderMode() const { return m_mode; }
+
+        //! Number of worker threads, 0 until started or in offline mode
+        int getThreadCount() const { return static_cast<int>(m_threads.size()); }
+
+        //! \copydoc ISampleProvider::readSamples
+        //! \remark starts the worker threads with the first call
+        virtual int readSamples(QVector<float> &samples, qint64 count) override;
+
+        //! Wait until all inputs have rendered the frame played next
+        //! \remark for tests, never to be called from the audio callback
+        //! \return false on timeout
+        bool waitForNextFrame(int timeoutMs);
+
+        //! Statistics
+        //! \threadsafe
+        Metrics getMetrics() const;
+
+        //! Reset statistics
+        //! \threadsafe
+        void resetMetrics();
+
+    private:
+        class CRenderThread;
+
+        //! One input with its frame buffers
+        struct Input
+        {
+            ISampleProvider *provider = nullptr;   //!< the input
+            QVector<float> frames[2];              //!< frame n in frames[n % 2]
+            QVector<float> readBuffer;             //!< buffer for readSamples of the input
+            std::atomic<qint64> renderedFrame { -1 }; //!< last frame completely rendered
+        };
+
+        //! Render frame of the input into its buffer
+        void renderInput(Input &input, qint64 frame);
+
+        //! Sum the next frame into m_mix
+        void mixNextFrame();
+
+        //! Start the worker threads
+        void startThreads();
+
+        //! Stop the worker threads
+        void stopThreads();
+
+        //! Request the workers to render the frame
+        void requestFrame(qint64 frame);
+
+        const RenderMode m_mode;
+        std::vector<std::unique_ptr<Input>> m_inputs;
+        std::vector<std::unique_ptr<CRenderThread>> m_threads;
+        bool m_started = false;
+
+        // audio callback only
+        QVector<float> m_mix;   //!< current frame
+        int m_mixPosition = FrameSize; //!< next sample of m_mix to be read
+        qint64 m_mixFrame = -1; //!< number of the current frame
+
+        // worker requests
+        QMutex m_mutexRequest;
+        QWaitCondition m_frameRequested;
+        QWaitCondition m_frameRendered;
+        qint64 m_requestedFrame = -1; //!< frame the workers shall render
+        bool m_stop = false;
+
+        // statistics
+        std::atomic<qint64> m_frames { 0 };
+        std::atomic<qint64> m_inputFrames { 0 };
+        std::atomic<qint64> m_underruns { 0 };
+        std::atomic<qint64> m_framesWithUnderrun { 0 };
+        std::atomic<qint64> m_maxRenderUs { 0 };
+        std::atomic<qint64> m_sumRenderUs { 0 };
+    };
+} // ns
+
+#endif // guard
@@ -35,17 +35,8 @@ namespace BlackSound::SampleProvider
 
         if (m_enabled)
         {
-            for (int sample = 0; sample < samplesRead; sample += m_channels)
-            {
-                double in1 = samples.at(sample);
-                double in2 = (m_channels == 1) ? 0 : samples.at(sample + 1);
-                m_simpleCompressor.process(in1, in2);
-                samples[sample] = static_cast<float>(in1);
-                if (m_channels > 1)
-                {
-                    samples[sample + 1] = static_cast<float>(in2);
-                }
-            }
+            // interleaved frames, block wise
+            m_simpleCompressor.process(samples.data(), samplesRead / m_channels, m_channels);
         }
         return samplesRead;
     }
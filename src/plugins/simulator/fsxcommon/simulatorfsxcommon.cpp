@@ -23,6 +23,7 @@
 #include "blackmisc/geo/elevationplane.h"
 #include "blackmisc/math/mathutils.h"
 #include "blackmisc/country.h"
+#include "blackmisc/latencytrace.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/statusmessagelist.h"
 #include "blackmisc/threadutils.h"
@@ -1998,6 +1999,7 @@ namespace BlackSimPlugin::FsxCommon
                 // update situation
                 if (forceUpdate || !this->isEqualLastSent(result.getInterpolatedSituation()))
                 {
+                    const CLatencySpan span(CLatencyTrace::SimulatorSend, callsign.asString());
                     SIMCONNECT_DATA_INITPOSITION position = this->aircraftSituationToFsxPosition(result, sendGround);
                     const HRESULT hr = this->logAndTraceSendId(
                                             SimConnect_SetDataOnSimObject(
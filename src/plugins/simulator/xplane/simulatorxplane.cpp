@@ -51,6 +51,7 @@
 #include "blackmisc/mixin/mixincompare.h"
 #include "blackmisc/dbusserver.h"
 #include "blackmisc/iterator.h"
+#include "blackmisc/latencytrace.h"
 #include "blackmisc/logmessage.h"
 #include "blackmisc/setbuilder.h"
 #include "blackconfig/buildconfig.h"
@@ -533,6 +534,12 @@ namespace BlackSimPlugin::XPlane
         // load CSL
         this->loadCslPackages();
 
+        // plane updates via shared memory if XSwiftBus runs on this machine
+        if (m_sharedTraffic.open(m_trafficProxy))
+        {
+            CLogMessage(this).info(u"Sending plane updates via shared memory '%1'") << m_sharedTraffic.getName();
+        }
+
         // finish
         this->initSimulatorInternals();
         this->emitSimulatorCombinedStatus();
@@ -543,6 +550,7 @@ namespace BlackSimPlugin::XPlane
     bool CSimulatorXPlane::disconnectFrom()
     {
         if (!this->isConnected()) { return true; } // avoid emit if already disconnected
+        m_sharedTraffic.close(m_trafficProxy);
         this->disconnectFromDBus();
         if (m_watcher) { m_watcher->setConnection(m_dBusConnection); }
         delete m_serviceProxy;
@@ -563,6 +571,7 @@ namespace BlackSimPlugin::XPlane
         if (!m_serviceProxy) { return; }
         CLogMessage(this).info(u"XPlane xSwiftBus service unregistered");
 
+        m_sharedTraffic.close(nullptr);
         if (m_dbusMode == P2P) { m_dBusConnection.disconnectFromPeer(m_dBusConnection.name()); }
         m_dBusConnection = QDBusConnection { "default" };
         if (m_watcher) { m_watcher->setConnection(m_dBusConnection); }
@@ -829,7 +838,7 @@ namespace BlackSimPlugin::XPlane
             m_trafficProxy->addPlane(callsign, aircraftModel.getModelString(),
                                         newRemoteAircraft.getAircraftIcaoCode().getDesignator(),
                                         newRemoteAircraft.getAirlineIcaoCode().getDesignator(),
-                                        livery);
+                                        livery, m_sharedTraffic.addPlane(newRemoteAircraft.getCallsign()));
             PlanesPositions pos;
             pos.push_back(newRemoteAircraft.getSituation());
             m_trafficProxy->setPlanesPositions(pos);
@@ -859,6 +868,7 @@ namespace BlackSimPlugin::XPlane
         if (!this->isTestMode() && !m_xplaneAircraftObjects.contains(callsign) && !m_pendingToBeAddedAircraft.containsCallsign(callsign) && !m_addingInProgressAircraft.contains(callsign))
         {
             // not existing aircraft
+            m_sharedTraffic.removePlane(callsign); // i.e. adding failed
             return false;
         }
 
@@ -896,6 +906,7 @@ namespace BlackSimPlugin::XPlane
         }
 
         m_trafficProxy->removePlane(callsign.asString());
+        m_sharedTraffic.removePlane(callsign);
         m_xplaneAircraftObjects.remove(callsign);
         m_pendingToBeAddedAircraft.removeByCallsign(callsign);
 
@@ -1034,6 +1045,9 @@ namespace BlackSimPlugin::XPlane
     {
         Q_ASSERT_X(CThreadUtils::isInThisThread(this), Q_FUNC_INFO, "thread");
 
+        const bool useSharedTraffic = m_sharedTraffic.isOpen();
+        if (useSharedTraffic) { this->receiveRemoteAircraftDataFromSharedTraffic(); }
+
         const int remoteAircraftNo = this->getAircraftInRangeCount();
         if (remoteAircraftNo < 1) { return; }
 
@@ -1045,6 +1059,7 @@ namespace BlackSimPlugin::XPlane
         PlanesPositions planesPositions;
         PlanesSurfaces planesSurfaces;
         PlanesTransponders planesTransponders;
+        int droppedRecords = 0;
 
         int aircraftNumber = 0;
         const bool updateAllAircraft = this->isUpdateAllRemoteAircraft(currentTimestamp);
@@ -1063,26 +1078,39 @@ namespace BlackSimPlugin::XPlane
             // skip no longer in range
             if (!callsignsInRange.contains(callsign)) { continue; }
 
-            planesTransponders.callsigns.push_back(callsign.asString());
-            planesTransponders.codes.push_back(xplaneAircraft.getAircraft().getTransponderCode());
-            CTransponder::TransponderMode transponderMode = xplaneAircraft.getAircraft().getTransponderMode();
-            planesTransponders.idents.push_back(transponderMode == CTransponder::StateIdent);
-            planesTransponders.modeCs.push_back(transponderMode == CTransponder::ModeC);
+            // with shared memory one record per plane, otherwise parallel lists for DBus
+            // planes added before the memory was opened are still updated via DBus
+            const bool sharedPlane = useSharedTraffic && m_sharedTraffic.hasPlane(callsign);
+            CXSwiftBusSharedTraffic::PlaneRecord record;
+            if (sharedPlane)
+            {
+                record = m_sharedTraffic.record(callsign);
+                CXSwiftBusSharedTraffic::setTransponder(record, xplaneAircraft.getAircraft().getTransponder());
+            }
+            else
+            {
+                planesTransponders.callsigns.push_back(callsign.asString());
+                planesTransponders.codes.push_back(xplaneAircraft.getAircraft().getTransponderCode());
+                CTransponder::TransponderMode transponderMode = xplaneAircraft.getAircraft().getTransponderMode();
+                planesTransponders.idents.push_back(transponderMode == CTransponder::StateIdent);
+                planesTransponders.modeCs.push_back(transponderMode == CTransponder::ModeC);
+            }
 
             // setup
             const CInterpolationAndRenderingSetupPerCallsign setup = this->getInterpolationSetupConsolidated(callsign, updateAllAircraft);
 
             // interpolated situation/parts
             const CInterpolationResult result = xplaneAircraft.getInterpolation(currentTimestamp, setup, aircraftNumber++);
+            const CAircraftSituation interpolatedSituation(result);
+            bool sendSituation = false;
             if (result.getInterpolationStatus().hasValidSituation())
             {
-                const CAircraftSituation interpolatedSituation(result);
-
                 // update situation
-                if (updateAllAircraft || !this->isEqualLastSent(interpolatedSituation))
+                sendSituation = updateAllAircraft || !this->isEqualLastSent(interpolatedSituation);
+                if (sendSituation)
                 {
-                    this->rememberLastSent(interpolatedSituation);
-                    planesPositions.push_back(interpolatedSituation);
+                    if (sharedPlane) { CXSwiftBusSharedTraffic::setPosition(record, interpolatedSituation); }
+                    else { planesPositions.push_back(interpolatedSituation); }
                 }
             }
             else
@@ -1091,17 +1119,35 @@ namespace BlackSimPlugin::XPlane
             }
 
             const CAircraftParts parts(result);
+            bool sendParts = false;
             if (result.getPartsStatus().isSupportingParts() || parts.getPartsDetails() == CAircraftParts::GuessedParts)
             {
-                if (updateAllAircraft || !this->isEqualLastSent(parts, callsign))
+                sendParts = updateAllAircraft || !this->isEqualLastSent(parts, callsign);
+                if (sendParts)
                 {
-                    this->rememberLastSent(parts, callsign);
-                    planesSurfaces.push_back(xplaneAircraft.getCallsign(), parts);
+                    if (sharedPlane) { CXSwiftBusSharedTraffic::setSurfaces(record, parts); }
+                    else { planesSurfaces.push_back(xplaneAircraft.getCallsign(), parts); }
                 }
             }
 
+            // a dropped record is not remembered, so it is sent again with the next update
+            if (sharedPlane && !m_sharedTraffic.send(record))
+            {
+                droppedRecords++;
+                continue;
+            }
+            if (sendSituation) { this->rememberLastSent(interpolatedSituation); }
+            if (sendParts) { this->rememberLastSent(parts, callsign); }
+
         } // all callsigns
 
+        if (droppedRecords > 0)
+        {
+            CLogMessage(this).debug(u"XSwiftBus behind, %1 plane updates dropped, %2 in total") << droppedRecords << m_sharedTraffic.getDroppedRecords();
+        }
+
+        // batch for all aircraft, so traced without callsign
+        const CLatencySpan span(CLatencyTrace::SimulatorSend);
         if (!planesTransponders.isEmpty())
         {
             m_trafficProxy->setPlanesTransponders(planesTransponders);
@@ -1142,6 +1188,12 @@ namespace BlackSimPlugin::XPlane
     {
         if (callsigns.isEmpty()) { return; }
         if (!m_trafficProxy || this->isShuttingDown()) { return; }
+        if (m_sharedTraffic.isOpen())
+        {
+            // answered in the next frames, see receiveRemoteAircraftDataFromSharedTraffic
+            m_sharedTraffic.requestRemoteAircraftData(callsigns);
+            return;
+        }
         const QStringList csStrings = callsigns.getCallsignStrings();
         QPointer<CSimulatorXPlane> myself(this);
         m_trafficProxy->getRemoteAircraftData(csStrings, [ = ](const QStringList & callsigns, const QDoubleList & latitudesDeg, const QDoubleList & longitudesDeg, const QDoubleList & elevationsMeters, const QBoolList & waterFlags, const QDoubleList & verticalOffsetsMeters)
@@ -1162,6 +1214,18 @@ namespace BlackSimPlugin::XPlane
         });
     }
 
+    void CSimulatorXPlane::receiveRemoteAircraftDataFromSharedTraffic()
+    {
+        QStringList callsigns;
+        QDoubleList latitudesDeg;
+        QDoubleList longitudesDeg;
+        QDoubleList elevationsMeters;
+        QBoolList waterFlags;
+        QDoubleList verticalOffsetsMeters;
+        if (m_sharedTraffic.receiveRemoteAircraftData(callsigns, latitudesDeg, longitudesDeg, elevationsMeters, waterFlags, verticalOffsetsMeters) < 1) { return; }
+        this->updateRemoteAircraftFromSimulator(callsigns, latitudesDeg, longitudesDeg, elevationsMeters, waterFlags, verticalOffsetsMeters);
+    }
+
     void CSimulatorXPlane::updateRemoteAircraftFromSimulator(
         const QStringList &callsigns,        const QDoubleList &latitudesDeg, const QDoubleList &longitudesDeg,
         const QDoubleList &elevationsMeters, const QBoolList &waterFlags,     const QDoubleList &verticalOffsetsMeters)
@@ -1341,6 +1405,7 @@ namespace BlackSimPlugin::XPlane
 
         Q_ASSERT_X(addedRemoteAircraft.hasCallsign(), Q_FUNC_INFO, "No callsign"); // already checked above, MUST never happen
         Q_ASSERT_X(addedRemoteAircraft.getCallsign() == cs, Q_FUNC_INFO, "No callsign"); // already checked above, MUST never happen
+        m_sharedTraffic.confirmPlane(cs); // XSwiftBus knows the plane ID now, records are applied
         m_xplaneAircraftObjects.insert(cs, CXPlaneMPAircraft(addedRemoteAircraft, this, &m_interpolationLogger));
         emit this->aircraftRenderingChanged(addedRemoteAircraft);
     }
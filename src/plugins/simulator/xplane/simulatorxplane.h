@@ -12,6 +12,7 @@
 #define BLACKSIMPLUGIN_SIMULATOR_XPLANE_H
 
 #include "xplanempaircraft.h"
+#include "xswiftbussharedtraffic.h"
 #include "plugins/simulator/xplaneconfig/simulatorxplaneconfig.h"
 #include "plugins/simulator/plugincommon/simulatorplugincommon.h"
 #include "blackmisc/simulation/aircraftmodellist.h"
@@ -211,6 +212,9 @@ namespace BlackSimPlugin::XPlane
         void triggerRequestRemoteAircraftDataFromXPlane(const BlackMisc::Aviation::CCallsignSet &callsigns);
         //! @}
 
+        //! Elevations and CGs requested via shared memory
+        void receiveRemoteAircraftDataFromSharedTraffic();
+
         //! Adding new aircraft
         //! @{
         void addNextPendingAircraft();
@@ -268,6 +272,7 @@ namespace BlackSimPlugin::XPlane
         CXSwiftBusServiceProxy *m_serviceProxy { nullptr };
         CXSwiftBusTrafficProxy *m_trafficProxy { nullptr };
         CXSwiftBusWeatherProxy *m_weatherProxy { nullptr };
+        CXSwiftBusSharedTraffic m_sharedTraffic; //!< plane updates via shared memory if available, DBus for control only then
         QTimer m_fastTimer;
         QTimer m_slowTimer;
         QTimer m_airportUpdater;
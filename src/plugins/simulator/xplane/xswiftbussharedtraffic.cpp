@@ -0,0 +1,164 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#include "xswiftbussharedtraffic.h"
+
+#include <QCoreApplication>
+
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation::XPlane::SharedTraffic;
+
+namespace BlackSimPlugin::XPlane
+{
+    bool CXSwiftBusSharedTraffic::open(CXSwiftBusTrafficProxy *trafficProxy)
+    {
+        this->close(nullptr);
+        if (!trafficProxy || !CSharedTraffic::isSupported()) { return false; }
+        if (!m_memory.create(CSharedTraffic::memoryName(QCoreApplication::applicationPid()))) { return false; }
+
+        // XSwiftBus on another machine or an older version cannot open it
+        if (trafficProxy->openSharedTraffic(this->getName())) { return true; }
+        m_memory.close();
+        return false;
+    }
+
+    void CXSwiftBusSharedTraffic::close(CXSwiftBusTrafficProxy *trafficProxy)
+    {
+        m_pendingIds.clear();
+        m_confirmedIds.clear();
+        m_callsigns.clear();
+        if (!m_memory.isOpen()) { return; }
+        if (trafficProxy) { trafficProxy->closeSharedTraffic(); }
+        m_memory.close();
+    }
+
+    int CXSwiftBusSharedTraffic::addPlane(const CCallsign &callsign)
+    {
+        // adding again (i.e. retry) keeps the ID, as XSwiftBus ignores adding a known callsign
+        const auto confirmed = m_confirmedIds.constFind(callsign);
+        if (confirmed != m_confirmedIds.constEnd()) { return confirmed.value(); }
+        const auto pending = m_pendingIds.constFind(callsign);
+        if (pending != m_pendingIds.constEnd()) { return pending.value(); }
+
+        const int id = m_nextPlaneId++;
+        m_pendingIds.insert(callsign, id);
+        return id;
+    }
+
+    void CXSwiftBusSharedTraffic::confirmPlane(const CCallsign &callsign)
+    {
+        const auto pending = m_pendingIds.find(callsign);
+        if (pending == m_pendingIds.end()) { return; } // added before the memory was opened, DBus only
+        const int id = pending.value();
+        m_pendingIds.erase(pending);
+        m_confirmedIds.insert(callsign, id);
+        m_callsigns.insert(id, callsign);
+    }
+
+    void CXSwiftBusSharedTraffic::removePlane(const CCallsign &callsign)
+    {
+        m_pendingIds.remove(callsign);
+        const auto confirmed = m_confirmedIds.find(callsign);
+        if (confirmed == m_confirmedIds.end()) { return; }
+        m_callsigns.remove(confirmed.value());
+        m_confirmedIds.erase(confirmed);
+    }
+
+    CXSwiftBusSharedTraffic::PlaneRecord CXSwiftBusSharedTraffic::record(const CCallsign &callsign) const
+    {
+        PlaneRecord record;
+        record.planeId = m_confirmedIds.value(callsign, -1);
+        return record;
+    }
+
+    void CXSwiftBusSharedTraffic::setPosition(PlaneRecord &record, const CAircraftSituation &situation)
+    {
+        record.flags |= HasPosition;
+        record.latitudeDeg  = situation.latitude().value(CAngleUnit::deg());
+        record.longitudeDeg = situation.longitude().value(CAngleUnit::deg());
+        record.altitudeFt   = situation.getAltitude().value(CLengthUnit::ft());
+        record.pitchDeg     = situation.getPitch().value(CAngleUnit::deg());
+        record.rollDeg      = situation.getBank().value(CAngleUnit::deg());
+        record.headingDeg   = situation.getHeading().value(CAngleUnit::deg());
+        record.onGround     = situation.getOnGround() == CAircraftSituation::OnGround;
+    }
+
+    void CXSwiftBusSharedTraffic::setSurfaces(PlaneRecord &record, const CAircraftParts &parts)
+    {
+        // keep in sync with PlanesSurfaces::push_back
+        record.flags |= HasSurfaces;
+        record.gear        = parts.isFixedGearDown() ? 1.0f : 0.0f;
+        record.flaps       = static_cast<float>(parts.getFlapsPercent() / 100.0);
+        record.spoilers    = parts.isSpoilersOut() ? 1.0f : 0.0f;
+        record.speedBrakes = parts.isSpoilersOut() ? 1.0f : 0.0f;
+        record.slats       = static_cast<float>(parts.getFlapsPercent() / 100.0);
+        record.wingSweep   = 0.0f;
+        record.thrust      = parts.isAnyEngineOn() ? 0.75f : 0.0f;
+        record.elevator    = 0.0f;
+        record.rudder      = 0.0f;
+        record.aileron     = 0.0f;
+        record.lights = 0;
+        if (parts.getLights().isLandingOn()) { record.lights |= LandingLight; }
+        if (parts.getLights().isTaxiOn())    { record.lights |= TaxiLight; }
+        if (parts.getLights().isBeaconOn())  { record.lights |= BeaconLight; }
+        if (parts.getLights().isStrobeOn())  { record.lights |= StrobeLight; }
+        if (parts.getLights().isNavOn())     { record.lights |= NavLight; }
+        record.lightPattern = 0;
+    }
+
+    void CXSwiftBusSharedTraffic::setTransponder(PlaneRecord &record, const CTransponder &transponder)
+    {
+        record.flags |= HasTransponder;
+        record.transponderCode = transponder.getTransponderCode();
+        switch (transponder.getTransponderMode())
+        {
+        case CTransponder::StateIdent: record.transponderMode = Ident; break;
+        case CTransponder::ModeC: record.transponderMode = ModeC; break;
+        default: record.transponderMode = Standby; break;
+        }
+    }
+
+    bool CXSwiftBusSharedTraffic::send(const PlaneRecord &record)
+    {
+        return m_memory.planes().push(record);
+    }
+
+    void CXSwiftBusSharedTraffic::requestRemoteAircraftData(const CCallsignSet &callsigns)
+    {
+        CRing<PlaneRecord> planes = m_memory.planes();
+        for (const CCallsign &callsign : callsigns)
+        {
+            if (!this->hasPlane(callsign)) { continue; } // requested again once confirmed
+            PlaneRecord request = this->record(callsign);
+            request.flags = RequestsRemoteData;
+            if (!planes.push(request)) { break; } // requested again later
+        }
+    }
+
+    int CXSwiftBusSharedTraffic::receiveRemoteAircraftData(QStringList &callsigns, QDoubleList &latitudesDeg, QDoubleList &longitudesDeg,
+            QDoubleList &elevationsMeters, QBoolList &waterFlags, QDoubleList &verticalOffsetsMeters)
+    {
+        CRing<RemoteDataRecord> remoteData = m_memory.remoteData();
+        RemoteDataRecord data;
+        int received = 0;
+        while (remoteData.pop(data))
+        {
+            const CCallsign callsign = m_callsigns.value(data.planeId);
+            if (callsign.isEmpty()) { continue; } // removed meanwhile
+            callsigns.push_back(callsign.asString());
+            latitudesDeg.push_back(data.latitudeDeg);
+            longitudesDeg.push_back(data.longitudeDeg);
+            elevationsMeters.push_back(data.elevationM);
+            waterFlags.push_back(data.isWater != 0);
+            verticalOffsetsMeters.push_back(data.verticalOffsetM);
+            received++;
+        }
+        return received;
+    }
+} // ns
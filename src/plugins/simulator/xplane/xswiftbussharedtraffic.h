@@ -0,0 +1,103 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \file
+
+#ifndef BLACKSIMPLUGIN_XSWIFTBUS_SHAREDTRAFFIC_H
+#define BLACKSIMPLUGIN_XSWIFTBUS_SHAREDTRAFFIC_H
+
+#include "xswiftbustrafficproxy.h"
+#include "blackmisc/simulation/xplane/sharedtraffic.h"
+#include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/aviation/callsignset.h"
+#include "blackmisc/aviation/transponder.h"
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+namespace BlackSimPlugin::XPlane
+{
+    /*!
+     * Sends plane updates to XSwiftBus through shared memory instead of DBus method calls.
+     * Planes are identified by IDs assigned here and passed to XSwiftBus with "addPlane". IDs are
+     * not reused, so records of a removed plane are never applied to another plane.
+     * Records are only sent for planes XSwiftBus has confirmed, before XSwiftBus would drop them.
+     * \remark Only works if swift and X-Plane run on the same machine and the platform supports it,
+     *         otherwise open fails and the DBus methods are used as before
+     */
+    class CXSwiftBusSharedTraffic
+    {
+    public:
+        //! Plane record
+        using PlaneRecord = BlackMisc::Simulation::XPlane::SharedTraffic::PlaneRecord;
+
+        //! Create the memory and let XSwiftBus open it
+        bool open(CXSwiftBusTrafficProxy *trafficProxy);
+
+        //! Tell XSwiftBus (if still connected) and remove the memory
+        //! \remark forgets all plane IDs
+        void close(CXSwiftBusTrafficProxy *trafficProxy);
+
+        //! Is open?
+        bool isOpen() const { return m_memory.isOpen(); }
+
+        //! Name of the memory
+        QString getName() const { return QString::fromStdString(m_memory.getName()); }
+
+        //! Plane ID to be passed with "addPlane", the same ID until the plane is removed
+        int addPlane(const BlackMisc::Aviation::CCallsign &callsign);
+
+        //! XSwiftBus has added the plane, records can be sent from now on
+        void confirmPlane(const BlackMisc::Aviation::CCallsign &callsign);
+
+        //! Plane removed, its ID is released and not used again
+        void removePlane(const BlackMisc::Aviation::CCallsign &callsign);
+
+        //! Plane confirmed by XSwiftBus, so records for it are applied?
+        bool hasPlane(const BlackMisc::Aviation::CCallsign &callsign) const { return m_confirmedIds.contains(callsign); }
+
+        //! Empty record for a confirmed plane
+        PlaneRecord record(const BlackMisc::Aviation::CCallsign &callsign) const;
+
+        //! Set the position part, same values as sent via DBus
+        static void setPosition(PlaneRecord &record, const BlackMisc::Aviation::CAircraftSituation &situation);
+
+        //! Set the surfaces part, same values as sent via DBus
+        static void setSurfaces(PlaneRecord &record, const BlackMisc::Aviation::CAircraftParts &parts);
+
+        //! Set the transponder part
+        static void setTransponder(PlaneRecord &record, const BlackMisc::Aviation::CTransponder &transponder);
+
+        //! Send the record, false if XSwiftBus is behind and the record was dropped
+        bool send(const PlaneRecord &record);
+
+        //! Request ground elevations and offsets, received with the next frames
+        //! \remark planes not yet confirmed are skipped
+        void requestRemoteAircraftData(const BlackMisc::Aviation::CCallsignSet &callsigns);
+
+        //! Ground elevations and offsets received so far, in the same format as the DBus reply
+        //! \return number of received planes
+        int receiveRemoteAircraftData(QStringList &callsigns, QDoubleList &latitudesDeg, QDoubleList &longitudesDeg,
+                                      QDoubleList &elevationsMeters, QBoolList &waterFlags, QDoubleList &verticalOffsetsMeters);
+
+        //! Records not sent because XSwiftBus was behind
+        quint64 getDroppedRecords() const { return m_memory.planes().dropped(); }
+
+    private:
+        BlackMisc::Simulation::XPlane::SharedTraffic::CSharedTraffic m_memory;
+        QHash<BlackMisc::Aviation::CCallsign, int> m_pendingIds;   //!< passed with "addPlane", not yet confirmed
+        QHash<BlackMisc::Aviation::CCallsign, int> m_confirmedIds; //!< planes known by XSwiftBus
+        QHash<int, BlackMisc::Aviation::CCallsign> m_callsigns;    //!< confirmed plane ID -> callsign
+        int m_nextPlaneId = 0;
+    };
+} // ns
+
+#endif // guard
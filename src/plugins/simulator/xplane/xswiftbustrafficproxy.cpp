@@ -92,9 +92,9 @@ namespace BlackSimPlugin::XPlane
         m_dbusInterface->callDBus(QLatin1String("setMaxDrawDistance"), nauticalMiles);
     }
 
-    void CXSwiftBusTrafficProxy::addPlane(const QString &callsign, const QString &modelName, const QString &aircraftIcao, const QString &airlineIcao, const QString &livery)
+    void CXSwiftBusTrafficProxy::addPlane(const QString &callsign, const QString &modelName, const QString &aircraftIcao, const QString &airlineIcao, const QString &livery, int planeId)
     {
-        m_dbusInterface->callDBus(QLatin1String("addPlane"), callsign, modelName, aircraftIcao, airlineIcao, livery);
+        m_dbusInterface->callDBus(QLatin1String("addPlane"), callsign, modelName, aircraftIcao, airlineIcao, livery, planeId);
     }
 
     void CXSwiftBusTrafficProxy::removePlane(const QString &callsign)
@@ -196,4 +196,14 @@ namespace BlackSimPlugin::XPlane
     {
         m_dbusInterface->callDBus(QLatin1String("setFollowedAircraft"), callsign);
     }
+
+    bool CXSwiftBusTrafficProxy::openSharedTraffic(const QString &name)
+    {
+        return m_dbusInterface->callDBusRet<bool>(QLatin1String("openSharedTraffic"), name);
+    }
+
+    void CXSwiftBusTrafficProxy::closeSharedTraffic()
+    {
+        m_dbusInterface->callDBus(QLatin1String("closeSharedTraffic"));
+    }
 }
@@ -218,7 +218,7 @@ namespace BlackSimPlugin::XPlane
         void setMaxDrawDistance(double nauticalMiles);
 
         //! \copydoc XSwiftBus::CTraffic::addPlane
-        void addPlane(const QString &callsign, const QString &modelName, const QString &aircraftIcao, const QString &airlineIcao, const QString &livery);
+        void addPlane(const QString &callsign, const QString &modelName, const QString &aircraftIcao, const QString &airlineIcao, const QString &livery, int planeId = -1);
 
         //! \copydoc XSwiftBus::CTraffic::removePlane
         void removePlane(const QString &callsign);
@@ -248,6 +248,12 @@ namespace BlackSimPlugin::XPlane
         //! \copydoc XSwiftBus::CTraffic::setFollowedAircraft
         void setFollowedAircraft(const QString &callsign);
 
+        //! \copydoc XSwiftBus::CTraffic::openSharedTraffic
+        bool openSharedTraffic(const QString &name);
+
+        //! \copydoc XSwiftBus::CTraffic::closeSharedTraffic
+        void closeSharedTraffic();
+
     private:
         BlackMisc::CGenericDBusInterface *m_dbusInterface = nullptr;
     };
@@ -15,6 +15,7 @@
 #include "blackmisc/logmessage.h"
 #include "blackconfig/buildconfig.h"
 
+#include <QBitArray>
 #include <QNetworkRequest>
 #include <QNetworkReply>
 #include <QEventLoop>
@@ -80,41 +81,103 @@ namespace BlackWxPlugin::Gfs
         QString unit;
     };
 
-    struct GfsIsobaricLayer
+    //! Columns of one isobaric level, index is the grid point index
+    struct GfsIsobaricLevel
     {
-        float temperature = 0.0;
-        float relativeHumidity = 0.0;
-        float windU = 0.0;
-        float windV = 0.0;
+        QVector<float> temperature;
+        QVector<float> relativeHumidity;
+        QVector<float> windU;
+        QVector<float> windV;
     };
 
-    inline bool operator==(const GfsIsobaricLayer &lhs, const GfsIsobaricLayer &rhs)
+    //! Columns of one cloud level, index is the grid point index
+    struct GfsCloudLevel
     {
-        return qFuzzyCompare(lhs.temperature, rhs.temperature) &&
-                qFuzzyCompare(lhs.relativeHumidity, rhs.relativeHumidity) &&
-                qFuzzyCompare(lhs.windU, rhs.windU) &&
-                qFuzzyCompare(lhs.windV, rhs.windV);
-    }
+        QVector<float> bottomLevelPressure;
+        QVector<float> topLevelPressure;
+        QVector<float> totalCoverage;
+        QVector<float> topLevelTemperature;
+    };
 
-    struct GfsCloudLayer
+    //! Selected GFS grid points, stored columnar so each GRIB field is filled in one pass
+    struct GfsGrid
     {
-        float bottomLevelPressure = 0.0;
-        float topLevelPressure = 0.0;
-        float totalCoverage = 0.0;
-        float topLevelTemperature = 0.0;
-    };
+        QVector<int> fieldPositions; //!< position in GRIB field, ascending
+        QVector<float> latitudes;
+        QVector<float> longitudes;
+        QVector<float> surfaceRain;
+        QVector<float> surfaceSnow;
+        QVector<float> surfacePrecipitationRate;
+        QVector<float> pressureAtMsl;
+        QMap<float, GfsIsobaricLevel> isobaricLevels;
+        QMap<int, GfsCloudLevel> cloudLevels;
+        bool initialized = false; //!< grid selection done
+
+        int size() const { return fieldPositions.size(); }
+
+        void clear() { *this = GfsGrid(); }
+
+        //! Append a grid point
+        void append(int fieldPosition, float latitude, float longitude)
+        {
+            fieldPositions.push_back(fieldPosition);
+            latitudes.push_back(latitude);
+            longitudes.push_back(longitude);
+        }
+
+        //! Size the per point columns
+        void allocateColumns()
+        {
+            const int n = this->size();
+            surfaceRain.fill(0.0f, n);
+            surfaceSnow.fill(0.0f, n);
+            surfacePrecipitationRate.fill(0.0f, n);
+            pressureAtMsl.fill(0.0f, n);
+        }
 
-    struct GfsGridPoint
-    {
-        float latitude = 0.0;
-        float longitude = 0.0;
-        int fieldPosition = 0;
-        QHash<int, GfsCloudLayer> cloudLayers;
-        QHash<float, GfsIsobaricLayer> isobaricLayers;
-        float surfaceRain = 0;
-        float surfaceSnow = 0;
-        float surfacePrecipitationRate = 0;
-        float pressureAtMsl = 0.0;
+        //! Columns of level, created if not existing
+        GfsIsobaricLevel &isobaricLevel(float level)
+        {
+            auto it = isobaricLevels.find(level);
+            if (it != isobaricLevels.end()) { return it.value(); }
+            const int n = this->size();
+            GfsIsobaricLevel columns;
+            columns.temperature.fill(0.0f, n);
+            columns.relativeHumidity.fill(0.0f, n);
+            columns.windU.fill(0.0f, n);
+            columns.windV.fill(0.0f, n);
+            return isobaricLevels.insert(level, columns).value();
+        }
+
+        //! Columns of level, created if not existing
+        GfsCloudLevel &cloudLevel(int level)
+        {
+            auto it = cloudLevels.find(level);
+            if (it != cloudLevels.end()) { return it.value(); }
+            const int n = this->size();
+            GfsCloudLevel columns;
+            columns.bottomLevelPressure.fill(0.0f, n);
+            columns.topLevelPressure.fill(0.0f, n);
+            columns.totalCoverage.fill(0.0f, n);
+            columns.topLevelTemperature.fill(0.0f, n);
+            return cloudLevels.insert(level, columns).value();
+        }
+
+        //! Copy the values of all selected grid points from the GRIB field, single pass
+        template <class F>
+        void gather(const g2float *fld, QVector<float> &column, F transform) const
+        {
+            const int n = this->size();
+            const int *positions = fieldPositions.constData();
+            float *values = column.data();
+            for (int i = 0; i < n; ++i) { transform(values[i], fld[positions[i]]); }
+        }
+
+        //! Copy the values of all selected grid points from the GRIB field, single pass
+        void gather(const g2float *fld, QVector<float> &column) const
+        {
+            this->gather(fld, column, [](float &value, g2float fieldValue) { value = fieldValue; });
+        }
     };
     //! \endcond
 
@@ -140,7 +203,7 @@ namespace BlackWxPlugin::Gfs
     }
 
     CWeatherDataGfs::CWeatherDataGfs(QObject *parent) :
-        IWeatherData(parent)
+        IWeatherData(parent), m_gfsWeatherGrid(new GfsGrid)
     { }
 
     CWeatherDataGfs::~CWeatherDataGfs()
@@ -332,7 +395,7 @@ namespace BlackWxPlugin::Gfs
         m_lockData.unlock();
         QWriteLocker lock(&m_lockData);
 
-        m_gfsWeatherGrid.clear();
+        m_gfsWeatherGrid->clear();
         m_weatherGrid.clear();
 
         // Messages should be 76. This is a combination
@@ -377,7 +440,7 @@ namespace BlackWxPlugin::Gfs
                 if (nscan != 0) {  CLogMessage(this).error(u"Can only handle scanning mode NS:WE."); }
                 if (npnts != nx * ny) {  CLogMessage(this).error(u"Cannot handle non-regular grid."); }
 
-                if (m_gfsWeatherGrid.isEmpty()) { createWeatherGrid(gfld); }
+                if (!m_gfsWeatherGrid->initialized) { createWeatherGrid(gfld); }
 
                 if (gfld->ipdtnum == 0) { handleProductDefinitionTemplate40(gfld); }
                 else if (gfld->ipdtnum == 8) { handleProductDefinitionTemplate48(gfld); }
@@ -395,64 +458,74 @@ namespace BlackWxPlugin::Gfs
             BLACK_VERIFY_X(false, Q_FUNC_INFO, "Format change in GRIB, too many messages");
         }
 
-        const int weatherGridPointsNo = m_gfsWeatherGrid.size();
+        const GfsGrid &gfsGrid = *m_gfsWeatherGrid;
+        const int weatherGridPointsNo = gfsGrid.size();
         CLogMessage(this).debug() << "Parsed"   << messageNo << "GRIB messages.";
         CLogMessage(this).debug() << "Obtained" << weatherGridPointsNo << "grid points.";
 
         constexpr int maxPoints = 200;
-        for (const GfsGridPoint &gfsGridPoint : std::as_const(m_gfsWeatherGrid))
+        for (int i = 0; i < weatherGridPointsNo; ++i)
         {
             if (QThread::currentThread()->isInterruptionRequested()) { return false; }
 
+            const float pressureAtMslPa = gfsGrid.pressureAtMsl[i];
             CTemperatureLayerList temperatureLayers;
             CWindLayerList windLayers;
-            for (const GfsIsobaricLayer &isobaricLayer : gfsGridPoint.isobaricLayers)
+            for (auto it = gfsGrid.isobaricLevels.cbegin(); it != gfsGrid.isobaricLevels.cend(); ++it)
             {
-                float level = gfsGridPoint.isobaricLayers.key(isobaricLayer);
-                double altitudeFt = calculateAltitudeFt(gfsGridPoint.pressureAtMsl, level, isobaricLayer.temperature);
+                const float level = it.key();
+                const GfsIsobaricLevel &isobaricLevel = it.value();
+                const float temperatureK = isobaricLevel.temperature[i];
+                const float relativeHumidity = isobaricLevel.relativeHumidity[i];
+                const float windU = isobaricLevel.windU[i];
+                const float windV = isobaricLevel.windV[i];
+                double altitudeFt = calculateAltitudeFt(pressureAtMslPa, level, temperatureK);
 
                 CAltitude altitude(altitudeFt, CAltitude::MeanSeaLevel, CLengthUnit::ft());
 
-                auto temperature = CTemperature { isobaricLayer.temperature, CTemperatureUnit::K() };
-                auto dewPoint = calculateDewPoint(temperature, isobaricLayer.relativeHumidity);
+                auto temperature = CTemperature { temperatureK, CTemperatureUnit::K() };
+                auto dewPoint = calculateDewPoint(temperature, relativeHumidity);
 
-                CTemperatureLayer temperatureLayer(altitude, temperature, dewPoint, isobaricLayer.relativeHumidity);
+                CTemperatureLayer temperatureLayer(altitude, temperature, dewPoint, relativeHumidity);
                 temperatureLayers.push_back(temperatureLayer);
 
-                double windDirection = -1 * CMathUtils::rad2deg(std::atan2(-isobaricLayer.windU, isobaricLayer.windV));
+                double windDirection = -1 * CMathUtils::rad2deg(std::atan2(-windU, windV));
                 windDirection += 180.0;
                 if (windDirection < 0.0) { windDirection += 360.0; }
                 if (windDirection >= 360.0) { windDirection -= 360.0; }
-                double windSpeed = std::hypot(isobaricLayer.windU, isobaricLayer.windV);
+                double windSpeed = std::hypot(windU, windV);
                 CWindLayer windLayer(altitude, CAngle(windDirection, CAngleUnit::deg()), CSpeed(windSpeed, CSpeedUnit::m_s()), {});
                 windLayers.push_back(windLayer);
             }
 
             CCloudLayerList cloudLayers;
-            for (const GfsCloudLayer &gfsCloudLayer : std::as_const(gfsGridPoint.cloudLayers))
+            for (const GfsCloudLevel &cloudLevel : gfsGrid.cloudLevels)
             {
-                if (std::isnan(gfsCloudLayer.bottomLevelPressure) || std::isnan(gfsCloudLayer.topLevelPressure) || std::isnan(gfsCloudLayer.topLevelTemperature)) { continue; }
+                const float bottomLevelPressure = cloudLevel.bottomLevelPressure[i];
+                const float topLevelPressure = cloudLevel.topLevelPressure[i];
+                const float topLevelTemperature = cloudLevel.topLevelTemperature[i];
+                if (std::isnan(bottomLevelPressure) || std::isnan(topLevelPressure) || std::isnan(topLevelTemperature)) { continue; }
 
                 CCloudLayer cloudLayer;
-                double bottomLevelFt = calculateAltitudeFt(gfsGridPoint.pressureAtMsl, gfsCloudLayer.bottomLevelPressure, gfsCloudLayer.topLevelTemperature);
-                double topLevelFt = calculateAltitudeFt(gfsGridPoint.pressureAtMsl, gfsCloudLayer.topLevelPressure, gfsCloudLayer.topLevelTemperature);
+                double bottomLevelFt = calculateAltitudeFt(pressureAtMslPa, bottomLevelPressure, topLevelTemperature);
+                double topLevelFt = calculateAltitudeFt(pressureAtMslPa, topLevelPressure, topLevelTemperature);
                 cloudLayer.setBase(CAltitude(bottomLevelFt, CAltitude::MeanSeaLevel, CLengthUnit::ft()));
                 cloudLayer.setTop(CAltitude(topLevelFt, CAltitude::MeanSeaLevel, CLengthUnit::ft()));
-                cloudLayer.setCoveragePercent(qRound(gfsCloudLayer.totalCoverage));
-                if (gfsGridPoint.surfaceSnow > 0.0) { cloudLayer.setPrecipitation(CCloudLayer::Snow); }
-                if (gfsGridPoint.surfaceRain > 0.0) { cloudLayer.setPrecipitation(CCloudLayer::Rain); }
+                cloudLayer.setCoveragePercent(qRound(cloudLevel.totalCoverage[i]));
+                if (gfsGrid.surfaceSnow[i] > 0.0) { cloudLayer.setPrecipitation(CCloudLayer::Snow); }
+                if (gfsGrid.surfaceRain[i] > 0.0) { cloudLayer.setPrecipitation(CCloudLayer::Rain); }
 
                 // Precipitation rate is in kg m-2 s-1, which is equal to mm/s
                 // Multiply with 3600 to convert to mm/h
-                cloudLayer.setPrecipitationRate(gfsGridPoint.surfacePrecipitationRate * 3600.0);
+                cloudLayer.setPrecipitationRate(gfsGrid.surfacePrecipitationRate[i] * 3600.0);
                 cloudLayer.setClouds(CCloudLayer::CloudsUnknown);
                 cloudLayers.push_back(cloudLayer);
             }
 
-            auto pressureAtMsl = PhysicalQuantities::CPressure { gfsGridPoint.pressureAtMsl, PhysicalQuantities::CPressureUnit::Pa() };
+            auto pressureAtMsl = PhysicalQuantities::CPressure { pressureAtMslPa, PhysicalQuantities::CPressureUnit::Pa() };
 
-            const CLatitude latitude(gfsGridPoint.latitude, CAngleUnit::deg());
-            const CLongitude longitude(gfsGridPoint.longitude, CAngleUnit::deg());
+            const CLatitude latitude(gfsGrid.latitudes[i], CAngleUnit::deg());
+            const CLongitude longitude(gfsGrid.longitudes[i], CAngleUnit::deg());
             const auto position = CCoordinateGeodetic { latitude, longitude };
             const CGridPoint gridPoint({}, position, cloudLayers, temperatureLayers, {}, windLayers, pressureAtMsl);
             m_weatherGrid.push_back(gridPoint);
@@ -601,46 +674,124 @@ namespace BlackWxPlugin::Gfs
         }
         dy = fabs(dy);
 
-        if (nx > 0 && ny > 0)
+        GfsGrid &gfsGrid = *m_gfsWeatherGrid;
+        gfsGrid.initialized = true;
+        if (nx < 1 || ny < 1) { return; }
+
+        const auto cellLongitude = [ = ](int ix)
+        {
+            float longitude = longitude1 + ix * dx;
+            if (longitude >= 360.0f) { longitude -= 360.0f; }
+            if (longitude <   0.0f) { longitude += 360.0f; }
+            return longitude;
+        };
+
+        if (m_maxRange == CLength())
         {
+            gfsGrid.fieldPositions.reserve(npnts);
             for (int iy = 0; iy < ny; iy++)
             {
-                int i = nx * iy;
-                for (int ix = 0; ix < nx; ix++)
+                for (int ix = 0; ix < nx; ix++) { gfsGrid.append(ix + nx * iy, latitude1 - iy * dy, cellLongitude(ix)); }
+            }
+            gfsGrid.allocateColumns();
+            return;
+        }
+
+        // Select only the window of cells around each requested point, computed from the lat/lon bounds.
+        // Cells are marked, so overlapping windows are not added twice and the field order is kept.
+        constexpr double earthRadiusMeters = 6371000.8;
+        const double rangeRad = m_maxRange.value(CLengthUnit::m()) / earthRadiusMeters;
+        const double rangeDeg = CMathUtils::rad2deg(rangeRad);
+        const bool wrapsAround = dx > 0.0f && (nx * dx) >= 359.9f;
+        QBitArray selected(npnts);
+        int selectedCells = 0;
+
+        for (const CGridPoint &fixedGridPoint : std::as_const(m_grid))
+        {
+            const double lat0Deg = fixedGridPoint.getPosition().latitude().value(CAngleUnit::deg());
+            double lon0Deg = fixedGridPoint.getPosition().longitude().value(CAngleUnit::deg());
+            if (lon0Deg < 0.0) { lon0Deg += 360.0; }
+            const double lat0Rad = CMathUtils::deg2rad(lat0Deg);
+            const double cosLat0 = std::cos(lat0Rad);
+
+            // rows within the latitude band
+            const double northDeg = qMin(90.0, lat0Deg + rangeDeg);
+            const double southDeg = qMax(-90.0, lat0Deg - rangeDeg);
+            int iyMin = 0;
+            int iyMax = 0;
+            if (dy > 0.0f)
+            {
+                iyMin = qMax(0, static_cast<int>(std::ceil((latitude1 - northDeg) / dy)));
+                iyMax = qMin(ny - 1, static_cast<int>(std::floor((latitude1 - southDeg) / dy)));
+            }
+
+            // columns, half width of the spherical cap, all columns if the cap contains a pole
+            bool allColumns = !(dx > 0.0f) || northDeg >= 90.0 || southDeg <= -90.0 || std::sin(rangeRad) >= cosLat0;
+            double halfWidthDeg = 180.0;
+            if (!allColumns)
+            {
+                halfWidthDeg = CMathUtils::rad2deg(std::asin(std::sin(rangeRad) / cosLat0));
+                allColumns = halfWidthDeg >= 180.0;
+            }
+            int ixFrom = 0;
+            int ixTo = nx - 1;
+            if (!allColumns)
+            {
+                double relativeLonDeg = lon0Deg - longitude1;
+                if (wrapsAround && relativeLonDeg < 0.0) { relativeLonDeg += 360.0; }
+                ixFrom = static_cast<int>(std::floor((relativeLonDeg - halfWidthDeg) / dx));
+                ixTo   = static_cast<int>(std::ceil((relativeLonDeg + halfWidthDeg) / dx));
+                if (!wrapsAround)
                 {
-                    GfsGridPoint gridPoint;
-                    gridPoint.latitude = latitude1 - iy * dy;
-                    gridPoint.longitude = longitude1 + ix * dx;
-                    if (gridPoint.longitude >= 360.0f) { gridPoint.longitude -= 360.0f; }
-                    if (gridPoint.longitude  <   0.0f) { gridPoint.longitude += 360.0f; }
-                    gridPoint.fieldPosition = ix + i;
-                    const CCoordinateGeodetic gridPointPosition(gridPoint.latitude, gridPoint.longitude, 0);
-                    if (m_maxRange == CLength())
-                    {
-                        m_gfsWeatherGrid.append(gridPoint);
-                    }
-                    else
+                    ixFrom = qMax(0, ixFrom);
+                    ixTo = qMin(nx - 1, ixTo);
+                }
+                else if (ixTo - ixFrom >= nx) { ixFrom = 0; ixTo = nx - 1; }
+            }
+
+            for (int iy = iyMin; iy <= iyMax; iy++)
+            {
+                const double latDeg = latitude1 - iy * dy;
+                const double latRad = CMathUtils::deg2rad(latDeg);
+                const double cosLat = std::cos(latRad);
+                const double dLatRad = std::abs(latRad - lat0Rad);
+                for (int i = ixFrom; i <= ixTo; i++)
+                {
+                    const int ix = ((i % nx) + nx) % nx;
+                    const int fieldPosition = ix + nx * iy;
+                    if (selected.testBit(fieldPosition)) { continue; }
+
+                    double dLonDeg = std::abs(cellLongitude(ix) - lon0Deg);
+                    if (dLonDeg > 180.0) { dLonDeg = 360.0 - dLonDeg; }
+                    const double dLonRad = CMathUtils::deg2rad(dLonDeg);
+
+                    // meridian + parallel path is an upper bound of the great circle distance,
+                    // only cells at the edge of the window need the exact check
+                    if (dLatRad + dLonRad * cosLat > rangeRad)
                     {
-                        for (const CGridPoint &fixedGridPoint : std::as_const(m_grid))
-                        {
-                            const CLength distance = calculateGreatCircleDistance(gridPointPosition, fixedGridPoint.getPosition());
-                            if (distance.isNull())
-                            {
-                                BLACK_VERIFY_X(!CBuildConfig::isLocalDeveloperDebugBuild(), Q_FUNC_INFO, "Suspicious value, why is that?");
-                            }
-                            else
-                            {
-                                if (distance < m_maxRange)
-                                {
-                                    m_gfsWeatherGrid.append(gridPoint);
-                                    break;
-                                }
-                            }
-                        }
+                        const double sinDLat = std::sin(dLatRad / 2.0);
+                        const double sinDLon = std::sin(dLonRad / 2.0);
+                        const double h = sinDLat * sinDLat + cosLat0 * cosLat * sinDLon * sinDLon;
+                        const double distanceRad = 2.0 * std::asin(qMin(1.0, std::sqrt(h)));
+                        if (!(distanceRad < rangeRad)) { continue; }
                     }
-                } // for
-            } // for
-        } // if
+                    selected.setBit(fieldPosition);
+                    selectedCells++;
+                }
+            }
+        }
+
+        gfsGrid.fieldPositions.reserve(selectedCells);
+        gfsGrid.latitudes.reserve(selectedCells);
+        gfsGrid.longitudes.reserve(selectedCells);
+        for (int fieldPosition = 0; fieldPosition < npnts && gfsGrid.size() < selectedCells; fieldPosition++)
+        {
+            if (!selected.testBit(fieldPosition)) { continue; }
+            const int iy = fieldPosition / nx;
+            const int ix = fieldPosition % nx;
+            gfsGrid.append(fieldPosition, latitude1 - iy * dy, cellLongitude(ix));
+        }
+        gfsGrid.allocateColumns();
     }
 
     void CWeatherDataGfs::handleProductDefinitionTemplate40(const gribfield *gfld)
@@ -740,123 +891,98 @@ namespace BlackWxPlugin::Gfs
 
     void CWeatherDataGfs::setTemperature(const g2float *fld, float level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
-        {
-            if (level > 0) { gridPoint.isobaricLayers[level].temperature = fld[gridPoint.fieldPosition]; }
-        }
+        if (level > 0) { m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->isobaricLevel(level).temperature); }
     }
 
     void CWeatherDataGfs::setHumidity(const g2float *fld, float level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
-        {
-            gridPoint.isobaricLayers[level].relativeHumidity = fld[gridPoint.fieldPosition];
-        }
+        m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->isobaricLevel(level).relativeHumidity);
     }
 
     void CWeatherDataGfs::setWindV(const g2float *fld, float level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
-        {
-            gridPoint.isobaricLayers[level].windV = fld[gridPoint.fieldPosition];
-        }
+        m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->isobaricLevel(level).windV);
     }
 
     void CWeatherDataGfs::setWindU(const g2float *fld, float level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
-        {
-            gridPoint.isobaricLayers[level].windU = fld[gridPoint.fieldPosition];
-        }
+        m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->isobaricLevel(level).windU);
     }
 
     void CWeatherDataGfs::setCloudCoverage(const g2float *fld, int level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->cloudLevel(level).totalCoverage, [](float &value, g2float fieldValue)
         {
-            if (fld[gridPoint.fieldPosition] > 0.0f) { gridPoint.cloudLayers[level].totalCoverage = fld[gridPoint.fieldPosition]; }
-        }
+            if (fieldValue > 0.0f) { value = fieldValue; }
+        });
     }
 
     void CWeatherDataGfs::setCloudLevel(const g2float *fld, int surfaceType, int level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        GfsCloudLevel &cloudLevel = m_gfsWeatherGrid->cloudLevel(level);
+        QVector<float> *column = nullptr;
+        switch (surfaceType)
+        {
+        case LowCloudBottomLevel:
+        case MiddleCloudBottomLevel:
+        case HighCloudBottomLevel:
+            column = &cloudLevel.bottomLevelPressure;
+            break;
+        case LowCloudTopLevel:
+        case MiddleCloudTopLevel:
+        case HighCloudTopLevel:
+            column = &cloudLevel.topLevelPressure;
+            break;
+        default:
+            Q_ASSERT(false);
+            return;
+        }
+
+        m_gfsWeatherGrid->gather(fld, *column, [](float &value, g2float fieldValue)
         {
             static const g2float minimumLevel = 1000.0;
-            float levelPressure = std::numeric_limits<float>::quiet_NaN();
-            g2float fieldValue = fld[gridPoint.fieldPosition];
             // A value of 9.999e20 is undefined. Check that the pressure value is below
-            if (fieldValue < 9.998e20f && fieldValue > minimumLevel) { levelPressure = fld[gridPoint.fieldPosition]; }
-            switch (surfaceType)
-            {
-            case LowCloudBottomLevel:
-            case MiddleCloudBottomLevel:
-            case HighCloudBottomLevel:
-                gridPoint.cloudLayers[level].bottomLevelPressure = levelPressure;
-                break;
-            case LowCloudTopLevel:
-            case MiddleCloudTopLevel:
-            case HighCloudTopLevel:
-                gridPoint.cloudLayers[level].topLevelPressure = levelPressure;
-                break;
-            default:
-                Q_ASSERT(false);
-                break;
-            }
-        }
+            value = (fieldValue < 9.998e20f && fieldValue > minimumLevel) ? fieldValue : std::numeric_limits<float>::quiet_NaN();
+        });
     }
 
     void CWeatherDataGfs::setCloudTemperature(const g2float *fld, int surfaceType, int level)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
+        switch (surfaceType)
         {
-            float temperature = std::numeric_limits<float>::quiet_NaN();
-            g2float fieldValue = fld[gridPoint.fieldPosition];
-            if (fieldValue < 9.998e20f) { temperature = fld[gridPoint.fieldPosition]; }
-            switch (surfaceType)
-            {
-            case LowCloudTopLevel:
-            case MiddleCloudTopLevel:
-            case HighCloudTopLevel:
-                gridPoint.cloudLayers[level].topLevelTemperature = temperature;
-                break;
-            default:
-                Q_ASSERT(false);
-                break;
-            }
+        case LowCloudTopLevel:
+        case MiddleCloudTopLevel:
+        case HighCloudTopLevel:
+            break;
+        default:
+            Q_ASSERT(false);
+            return;
         }
+
+        m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->cloudLevel(level).topLevelTemperature, [](float &value, g2float fieldValue)
+        {
+            value = fieldValue < 9.998e20f ? fieldValue : std::numeric_limits<float>::quiet_NaN();
+        });
     }
 
     void CWeatherDataGfs::setPressureAtMsl(const g2float *fld)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
-        {
-            gridPoint.pressureAtMsl = fld[gridPoint.fieldPosition];
-        }
+        m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->pressureAtMsl);
     }
 
     void CWeatherDataGfs::setSurfaceRain(const g2float *fld)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
-        {
-            gridPoint.surfaceRain = fld[gridPoint.fieldPosition];
-        }
+        m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->surfaceRain);
     }
 
     void CWeatherDataGfs::setSurfaceSnow(const g2float *fld)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
-        {
-            gridPoint.surfaceSnow = fld[gridPoint.fieldPosition];
-        }
+        m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->surfaceSnow);
     }
 
     void CWeatherDataGfs::setPrecipitationRate(const g2float *fld)
     {
-        for (auto &gridPoint : m_gfsWeatherGrid)
-        {
-            gridPoint.surfacePrecipitationRate = fld[gridPoint.fieldPosition];
-        }
+        m_gfsWeatherGrid->gather(fld, m_gfsWeatherGrid->surfacePrecipitationRate);
     }
 
     CTemperature CWeatherDataGfs::calculateDewPoint(const CTemperature &temperature, double relativeHumidity)
@@ -24,6 +24,7 @@
 #include <QNetworkReply>
 #include <QNetworkAccessManager>
 #include <QPointer>
+#include <QScopedPointer>
 #include <array>
 
 namespace BlackMisc::PhysicalQuantities { class CTemperature; }
@@ -31,7 +32,7 @@ namespace BlackWxPlugin::Gfs
 {
     struct Grib2ParameterKey;
     struct Grib2ParameterValue;
-    struct GfsGridPoint;
+    struct GfsGrid;
 
     /*!
      * GFS implemenation
@@ -91,7 +92,7 @@ namespace BlackWxPlugin::Gfs
         mutable QReadWriteLock m_lockData;
         QByteArray m_gribData;
 
-        QVector<GfsGridPoint> m_gfsWeatherGrid;
+        QScopedPointer<GfsGrid> m_gfsWeatherGrid; //!< selected GFS grid points, columnar
         BlackMisc::Weather::CWeatherGrid m_weatherGrid;
 
         QPointer<BlackMisc::CWorker> m_parseGribFileWorker; //!< worker will destroy itself, so weak pointer
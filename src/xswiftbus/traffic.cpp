@@ -300,7 +300,7 @@ namespace XSwiftBus
         if (s.setMaxDrawDistanceNM(nauticalMiles)) { this->setSettings(s); }
     }
 
-    void CTraffic::addPlane(const std::string &callsign, const std::string &modelName, const std::string &aircraftIcao, const std::string &airlineIcao, const std::string &livery)
+    void CTraffic::addPlane(const std::string &callsign, const std::string &modelName, const std::string &aircraftIcao, const std::string &airlineIcao, const std::string &livery, int planeId)
     {
         auto planeIt = m_planesByCallsign.find(callsign);
         if (planeIt != m_planesByCallsign.end()) { return; }
@@ -325,6 +325,11 @@ namespace XSwiftBus
         Plane *plane = new Plane(id, callsign, aircraftIcao, airlineIcao, livery, modelName);
         m_planesByCallsign[callsign] = plane;
         m_planesById[id] = plane;
+        if (planeId >= 0)
+        {
+            plane->sharedId = planeId;
+            m_planesBySharedId[planeId] = plane;
+        }
 
         // Create view menu item
         CMenuItem planeViewMenuItem = m_followPlaneViewSubMenu.item(callsign, [this, callsign] { switchToFollowPlaneView(callsign); });
@@ -352,6 +357,7 @@ namespace XSwiftBus
         Plane *plane = planeIt->second;
         m_planesByCallsign.erase(callsign);
         m_planesById.erase(plane->id);
+        if (plane->sharedId >= 0) { m_planesBySharedId.erase(plane->sharedId); }
         XPMPDestroyPlane(plane->id);
         delete plane;
     }
@@ -374,6 +380,7 @@ namespace XSwiftBus
 
         m_planesByCallsign.clear();
         m_planesById.clear();
+        m_planesBySharedId.clear();
         m_followPlaneViewMenuItems.clear();
         m_followPlaneViewSequence.clear();
     }
@@ -389,29 +396,33 @@ namespace XSwiftBus
 
             Plane *plane = planeIt->second;
             if (!plane) { continue; }
-            plane->positions[2].lat = latitudesDeg.at(i);
-            plane->positions[2].lon = longitudesDeg.at(i);
-            plane->positions[2].elevation = altitudesFt.at(i);
-            plane->positions[2].pitch   = static_cast<float>(pitchesDeg.at(i));
-            plane->positions[2].roll    = static_cast<float>(rollsDeg.at(i));
-            plane->positions[2].heading = static_cast<float>(headingsDeg.at(i));
-            plane->positions[2].offsetScale = 1.0f;
-            plane->positions[2].clampToGround = true;
-            plane->positionTimes[2] = std::chrono::steady_clock::now();
-
-            // save 2 positions at 1-second intervals for use in interpolation
-            if (plane->positionTimes[2] - plane->positionTimes[1] > 1s)
-            {
-                plane->positionTimes[0] = plane->positionTimes[1];
-                plane->positionTimes[1] = plane->positionTimes[2];
-                std::memcpy(&plane->positions[0], &plane->positions[1], sizeof(plane->positions[0]));
-                std::memcpy(&plane->positions[1], &plane->positions[2], sizeof(plane->positions[0]));
-            }
-
+            setPlanePosition(plane, latitudesDeg.at(i), longitudesDeg.at(i), altitudesFt.at(i), pitchesDeg.at(i), rollsDeg.at(i), headingsDeg.at(i));
             if (setOnGround) { plane->isOnGround = onGrounds.at(i); }
         }
     }
 
+    void CTraffic::setPlanePosition(Plane *plane, double latitudeDeg, double longitudeDeg, double altitudeFt, double pitchDeg, double rollDeg, double headingDeg)
+    {
+        plane->positions[2].lat = latitudeDeg;
+        plane->positions[2].lon = longitudeDeg;
+        plane->positions[2].elevation = altitudeFt;
+        plane->positions[2].pitch   = static_cast<float>(pitchDeg);
+        plane->positions[2].roll    = static_cast<float>(rollDeg);
+        plane->positions[2].heading = static_cast<float>(headingDeg);
+        plane->positions[2].offsetScale = 1.0f;
+        plane->positions[2].clampToGround = true;
+        plane->positionTimes[2] = std::chrono::steady_clock::now();
+
+        // save 2 positions at 1-second intervals for use in interpolation
+        if (plane->positionTimes[2] - plane->positionTimes[1] > 1s)
+        {
+            plane->positionTimes[0] = plane->positionTimes[1];
+            plane->positionTimes[1] = plane->positionTimes[2];
+            std::memcpy(&plane->positions[0], &plane->positions[1], sizeof(plane->positions[0]));
+            std::memcpy(&plane->positions[1], &plane->positions[2], sizeof(plane->positions[0]));
+        }
+    }
+
     void CTraffic::setPlanesSurfaces(const std::vector<std::string> &callsigns, const std::vector<double> &gears, const std::vector<double> &flaps, const std::vector<double> &spoilers,
                                      const std::vector<double> &speedBrakes, const std::vector<double> &slats, const std::vector<double> &wingSweeps, const std::vector<double> &thrusts,
                                      const std::vector<double> &elevators, const std::vector<double> &rudders, const std::vector<double> &ailerons,
@@ -439,24 +450,29 @@ namespace XSwiftBus
             plane->surfaces.yokePitch = static_cast<float>(elevators.at(i));
             plane->surfaces.yokeHeading = static_cast<float>(rudders.at(i));
             plane->surfaces.yokeRoll = static_cast<float>(ailerons.at(i));
-            if (bundleTaxiLandingLights)
-            {
-                const bool on = landLights.at(i) || taxiLights.at(i);
-                plane->surfaces.lights.landLights = on;
-                plane->surfaces.lights.taxiLights = on;
-            }
-            else
-            {
-                plane->surfaces.lights.landLights = landLights.at(i);
-                plane->surfaces.lights.taxiLights = taxiLights.at(i);
-            }
-            plane->surfaces.lights.bcnLights = beaconLights.at(i);
-            plane->surfaces.lights.strbLights = strobeLights.at(i);
-            plane->surfaces.lights.navLights = navLights.at(i);
-            plane->surfaces.lights.flashPattern = static_cast<unsigned int>(lightPatterns.at(i));
+            setPlaneLights(plane, landLights.at(i), taxiLights.at(i), beaconLights.at(i), strobeLights.at(i), navLights.at(i), lightPatterns.at(i), bundleTaxiLandingLights);
         }
     }
 
+    void CTraffic::setPlaneLights(Plane *plane, bool landLights, bool taxiLights, bool beaconLights, bool strobeLights, bool navLights, int lightPattern, bool bundleTaxiLandingLights)
+    {
+        if (bundleTaxiLandingLights)
+        {
+            const bool on = landLights || taxiLights;
+            plane->surfaces.lights.landLights = on;
+            plane->surfaces.lights.taxiLights = on;
+        }
+        else
+        {
+            plane->surfaces.lights.landLights = landLights;
+            plane->surfaces.lights.taxiLights = taxiLights;
+        }
+        plane->surfaces.lights.bcnLights = beaconLights;
+        plane->surfaces.lights.strbLights = strobeLights;
+        plane->surfaces.lights.navLights = navLights;
+        plane->surfaces.lights.flashPattern = static_cast<unsigned int>(lightPattern);
+    }
+
     void CTraffic::setPlanesTransponders(const std::vector<std::string> &callsigns, const std::vector<int> &codes, const std::vector<bool> &modeCs, const std::vector<bool> &idents)
     {
         for (size_t i = 0; i < callsigns.size(); i++)
@@ -467,13 +483,18 @@ namespace XSwiftBus
             Plane *plane = planeIt->second;
             if (!plane) { continue; }
 
-            plane->surveillance.code = codes.at(i);
-            if (idents.at(i)) { plane->surveillance.mode = xpmpTransponderMode_ModeC_Ident; }
-            else if (modeCs.at(i)) { plane->surveillance.mode = xpmpTransponderMode_ModeC; }
-            else { plane->surveillance.mode = xpmpTransponderMode_Standby; }
+            setPlaneTransponder(plane, codes.at(i), modeCs.at(i), idents.at(i));
         }
     }
 
+    void CTraffic::setPlaneTransponder(Plane *plane, int code, bool modeC, bool ident)
+    {
+        plane->surveillance.code = code;
+        if (ident) { plane->surveillance.mode = xpmpTransponderMode_ModeC_Ident; }
+        else if (modeC) { plane->surveillance.mode = xpmpTransponderMode_ModeC; }
+        else { plane->surveillance.mode = xpmpTransponderMode_Standby; }
+    }
+
     void CTraffic::getRemoteAircraftData(std::vector<std::string> &callsigns, std::vector<double> &latitudesDeg, std::vector<double> &longitudesDeg,
                                          std::vector<double> &elevationsM, std::vector<bool> &waterFlags, std::vector<double> &verticalOffsets) const
     {
@@ -495,26 +516,28 @@ namespace XSwiftBus
             const Plane *plane = planeIt->second;
             assert(plane);
 
-            const double latDeg = plane->positions[2].lat;
-            const double lonDeg = plane->positions[2].lon;
-            double groundElevation = 0.0;
             bool isWater = false;
-            if (getSettings().isTerrainProbeEnabled())
-            {
-                // we expect elevation in meters
-                groundElevation = plane->terrainProbe.getElevation(latDeg, lonDeg, plane->positions[2].elevation, requestedCallsign, isWater).front();
-                if (std::isnan(groundElevation)) { groundElevation = 0.0; }
-            }
+            const double groundElevation = getGroundElevation(plane, isWater);
 
             callsigns.push_back(requestedCallsign);
-            latitudesDeg.push_back(latDeg);
-            longitudesDeg.push_back(lonDeg);
+            latitudesDeg.push_back(plane->positions[2].lat);
+            longitudesDeg.push_back(plane->positions[2].lon);
             elevationsM.push_back(groundElevation);
             waterFlags.push_back(isWater);
             verticalOffsets.push_back(0); // xpmp2 adjusts the offset for us, so effectively always zero
         }
     }
 
+    double CTraffic::getGroundElevation(const Plane *plane, bool &o_isWater) const
+    {
+        o_isWater = false;
+        if (!getSettings().isTerrainProbeEnabled()) { return 0.0; }
+
+        // we expect elevation in meters
+        const double groundElevation = plane->terrainProbe.getElevation(plane->positions[2].lat, plane->positions[2].lon, plane->positions[2].elevation, plane->callsign, o_isWater).front();
+        return std::isnan(groundElevation) ? 0.0 : groundElevation;
+    }
+
     std::array<double, 3> CTraffic::getElevationAtPosition(const std::string &callsign, double latitudeDeg, double longitudeDeg, double altitudeMeters, bool &o_isWater) const
     {
         if (!getSettings().isTerrainProbeEnabled()) { return {{ std::numeric_limits<double>::quiet_NaN(), latitudeDeg, longitudeDeg }}; }
@@ -536,8 +559,80 @@ namespace XSwiftBus
         this->switchToFollowPlaneView(callsign);
     }
 
+    bool CTraffic::openSharedTraffic(const std::string &name)
+    {
+        if (!m_sharedTraffic.open(name))
+        {
+            WARNING_LOG("Cannot open shared traffic memory " + name + ", using DBus");
+            return false;
+        }
+        INFO_LOG("Using shared traffic memory " + name);
+        return true;
+    }
+
+    void CTraffic::closeSharedTraffic()
+    {
+        m_sharedTraffic.close();
+    }
+
+    void CTraffic::processSharedTraffic()
+    {
+        using namespace BlackMisc::Simulation::XPlane::SharedTraffic;
+        if (!m_sharedTraffic.isOpen()) { return; }
+
+        const bool bundleTaxiLandingLights = this->getSettings().isBundlingTaxiAndLandingLights();
+        CRing<PlaneRecord> planes = m_sharedTraffic.planes();
+        CRing<RemoteDataRecord> remoteData = m_sharedTraffic.remoteData();
+        PlaneRecord record;
+        while (planes.pop(record))
+        {
+            const auto planeIt = m_planesBySharedId.find(record.planeId);
+            if (planeIt == m_planesBySharedId.end()) { continue; } // removed meanwhile
+            Plane *plane = planeIt->second;
+
+            if (record.flags & HasPosition)
+            {
+                setPlanePosition(plane, record.latitudeDeg, record.longitudeDeg, record.altitudeFt, record.pitchDeg, record.rollDeg, record.headingDeg);
+                plane->isOnGround = record.onGround != 0;
+            }
+            if (record.flags & HasSurfaces)
+            {
+                plane->hasSurfaces = true;
+                plane->targetGearPosition = record.gear;
+                plane->surfaces.flapRatio = record.flaps;
+                plane->surfaces.spoilerRatio = record.spoilers;
+                plane->surfaces.speedBrakeRatio = record.speedBrakes;
+                plane->surfaces.slatRatio = record.slats;
+                plane->surfaces.wingSweep = record.wingSweep;
+                plane->surfaces.thrust = record.thrust;
+                plane->surfaces.yokePitch = record.elevator;
+                plane->surfaces.yokeHeading = record.rudder;
+                plane->surfaces.yokeRoll = record.aileron;
+                setPlaneLights(plane, record.lights & LandingLight, record.lights & TaxiLight, record.lights & BeaconLight,
+                               record.lights & StrobeLight, record.lights & NavLight, record.lightPattern, bundleTaxiLandingLights);
+            }
+            if (record.flags & HasTransponder)
+            {
+                setPlaneTransponder(plane, record.transponderCode, record.transponderMode == ModeC, record.transponderMode == Ident);
+            }
+            if (record.flags & RequestsRemoteData)
+            {
+                RemoteDataRecord data;
+                bool isWater = false;
+                data.planeId = record.planeId;
+                data.elevationM = getGroundElevation(plane, isWater);
+                data.isWater = isWater;
+                data.latitudeDeg = plane->positions[2].lat;
+                data.longitudeDeg = plane->positions[2].lon;
+                data.verticalOffsetM = 0; // xpmp2 adjusts the offset for us, so effectively always zero
+                remoteData.push(data); // if full, swift requests again
+            }
+        }
+    }
+
     void CTraffic::dbusDisconnectedHandler()
     {
+        closeSharedTraffic();
         removeAllPlanes();
     }
 
@@ -640,16 +735,18 @@ namespace XSwiftBus
                 std::string aircraftIcao;
                 std::string airlineIcao;
                 std::string livery;
+                int planeId = -1; // optional
                 message.beginArgumentRead();
                 message.getArgument(callsign);
                 message.getArgument(modelName);
                 message.getArgument(aircraftIcao);
                 message.getArgument(airlineIcao);
                 message.getArgument(livery);
+                message.getArgument(planeId);
 
                 queueDBusCall([ = ]()
                 {
-                    addPlane(callsign, modelName, aircraftIcao, airlineIcao, livery);
+                    addPlane(callsign, modelName, aircraftIcao, airlineIcao, livery, planeId);
                 });
             }
             else if (message.getMethodName() == "removePlane")
@@ -807,6 +904,24 @@ namespace XSwiftBus
                     sendDBusMessage(reply);
                 });
             }
+            else if (message.getMethodName() == "openSharedTraffic")
+            {
+                std::string name;
+                message.beginArgumentRead();
+                message.getArgument(name);
+                queueDBusCall([ = ]()
+                {
+                    sendDBusReply(sender, serial, openSharedTraffic(name));
+                });
+            }
+            else if (message.getMethodName() == "closeSharedTraffic")
+            {
+                maybeSendEmptyDBusReply(wantsReply, sender, serial);
+                queueDBusCall([ = ]()
+                {
+                    closeSharedTraffic();
+                });
+            }
             else if (message.getMethodName() == "setFollowedAircraft")
             {
                 maybeSendEmptyDBusReply(wantsReply, sender, serial);
@@ -830,6 +945,7 @@ namespace XSwiftBus
     int CTraffic::process()
     {
         invokeQueuedDBusCalls();
+        processSharedTraffic();
         doPlaneUpdates();
         setDrawingLabels(getSettings().isDrawingLabels(), getSettings().getLabelColor());
         emitSimFrame();
@@ -19,6 +19,7 @@
 #include "drawable.h"
 #include "menus.h"
 #include "XPMPMultiplayer.h"
+#include "blackmisc/simulation/xplane/sharedtraffic.h"
 #include <XPLM/XPLMCamera.h>
 #include <XPLM/XPLMDisplay.h>
 #include <functional>
@@ -88,7 +89,8 @@ namespace XSwiftBus
         void setMaxDrawDistance(double nauticalMiles);
 
         //! Introduce a new traffic aircraft
-        void addPlane(const std::string &callsign, const std::string &modelName, const std::string &aircraftIcao, const std::string &airlineIcao, const std::string &livery);
+        //! \remark planeId identifies the plane in the shared memory records, -1 if not used
+        void addPlane(const std::string &callsign, const std::string &modelName, const std::string &aircraftIcao, const std::string &airlineIcao, const std::string &livery, int planeId = -1);
 
         //! Remove a traffic aircraft
         void removePlane(const std::string &callsign);
@@ -121,6 +123,12 @@ namespace XSwiftBus
         //! Sets the aircraft with callsign to be followed in plane view
         void setFollowedAircraft(const std::string &callsign);
 
+        //! Receive plane updates from the shared memory created by the swift side, DBus is then only used for control
+        bool openSharedTraffic(const std::string &name);
+
+        //! Back to plane updates via DBus only
+        void closeSharedTraffic();
+
         //! Perform generic processing
         int process();
 
@@ -162,6 +170,12 @@ namespace XSwiftBus
         XPMPConfiguration_t m_configuration = {};
         void updateConfiguration();
 
+        //! Shared memory transport
+        BlackMisc::Simulation::XPlane::SharedTraffic::CSharedTraffic m_sharedTraffic;
+
+        //! Apply all plane records from the shared memory and answer the remote data requests
+        void processSharedTraffic();
+
         static int orbitPlaneFunc(XPLMCameraPosition_t *cameraPosition, int isLosingControl, void *refcon);
         static int followAircraftKeySniffer(char character, XPLMKeyFlags flags, char virtualKey, void *refcon);
 
@@ -175,6 +189,7 @@ namespace XSwiftBus
             std::string livery;
             std::string modelName;
             std::string nightTextureMode;
+            int sharedId = -1;
             bool hasSurfaces = false;
             bool isOnGround  = false;
             char label[32] {};
@@ -189,6 +204,18 @@ namespace XSwiftBus
                   const std::string &livery_, const std::string &modelName_);
         };
 
+        //! Set the latest position
+        static void setPlanePosition(Plane *plane, double latitudeDeg, double longitudeDeg, double altitudeFt, double pitchDeg, double rollDeg, double headingDeg);
+
+        //! Set the transponder
+        static void setPlaneTransponder(Plane *plane, int code, bool modeC, bool ident);
+
+        //! Set the lights
+        static void setPlaneLights(Plane *plane, bool landLights, bool taxiLights, bool beaconLights, bool strobeLights, bool navLights, int lightPattern, bool bundleTaxiLandingLights);
+
+        //! Ground elevation below the latest position in meters, 0 if not available
+        double getGroundElevation(const Plane *plane, bool &o_isWater) const;
+
         //! Label renderer
         class Labels : public CDrawable
         {
@@ -242,6 +269,7 @@ namespace XSwiftBus
         std::unordered_map<std::string, std::string> m_modelStrings; // mapping uppercase to mixedcase
         std::unordered_map<std::string, Plane *> m_planesByCallsign;
         std::unordered_map<void *, Plane *> m_planesById;
+        std::unordered_map<int, Plane *> m_planesBySharedId;
         std::vector<std::string> m_followPlaneViewSequence;
         // std::chrono::system_clock::time_point m_timestampLastSimFrame = std::chrono::system_clock::now();
 
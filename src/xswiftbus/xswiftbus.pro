@@ -27,6 +27,9 @@ else:macx {
 else:unix {
     # Flags needed because there is no XPLM link library
     QMAKE_LFLAGS += -shared -rdynamic -nodefaultlibs -undefined_warning -Wl,--version-script=$$PWD/xswiftbus.map
+
+    # shm_open for the shared traffic memory
+    LIBS += -lrt
 }
 
 DEPENDPATH += . $$SourceRoot/src
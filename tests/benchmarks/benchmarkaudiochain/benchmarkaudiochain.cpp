@@ -0,0 +1,225 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblacksound
+
+#include "blacksound/dsp/biquadfilter.h"
+#include "blacksound/dsp/biquadfiltercascade.h"
+#include "blacksound/dsp/SimpleComp.h"
+#include "test.h"
+
+#include <QTest>
+#include <QVector>
+#include <QtMath>
+
+using namespace BlackSound::Dsp;
+using namespace chunkware_simple;
+
+namespace BlackSoundTest
+{
+    //! Receiver audio chain as in CReceiverSampleProvider: compressor, VHF equalizer and gain.
+    //! Each iteration processes Frames frames of 20ms for Receivers receivers.
+    class CBenchmarkAudioChain : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init test case data
+        void initTestCase();
+
+        //! Equalizer, one sample after another through each filter
+        void equalizerPerSample();
+
+        //! Equalizer, BiQuadFilterCascade for the whole frame
+        void equalizerBlock();
+
+        //! Compressor, per frame as before
+        void compressorPerSample();
+
+        //! Compressor, whole frame
+        void compressorBlock();
+
+        //! Compressor, equalizer and gain, per sample
+        void chainPerSample();
+
+        //! Compressor, equalizer and gain, block processing
+        void chainBlock();
+
+    private:
+        static constexpr int Receivers = 4;   //!< receivers mixed
+        static constexpr int Frames = 50;     //!< frames per iteration, 1s
+        static constexpr int FrameSize = 960; //!< 20ms at 48kHz
+
+        //! VHF equalizer filters of CEqualizerSampleProvider
+        static QVector<BiQuadFilter> vhfFilters();
+
+        //! Compressor as in CSimpleCompressorEffect
+        static SimpleComp compressor();
+
+        QVector<float> m_input; //!< one second of audio
+    };
+
+    void CBenchmarkAudioChain::initTestCase()
+    {
+        m_input.clear();
+        for (int i = 0; i < Frames * FrameSize; ++i)
+        {
+            m_input.push_back(static_cast<float>(0.6 * qSin(i * 0.07) * qSin(i * 0.0013)));
+        }
+    }
+
+    void CBenchmarkAudioChain::equalizerPerSample()
+    {
+        QVector<QVector<BiQuadFilter>> filters(Receivers, vhfFilters());
+        QVector<float> samples;
+        QBENCHMARK
+        {
+            for (QVector<BiQuadFilter> &receiver : filters)
+            {
+                samples = m_input;
+                for (float &sample : samples)
+                {
+                    for (BiQuadFilter &filter : receiver) { sample = filter.transform(sample); }
+                }
+            }
+        }
+        QVERIFY(samples.size() == m_input.size());
+    }
+
+    void CBenchmarkAudioChain::equalizerBlock()
+    {
+        QVector<BiQuadFilterCascade> filters(Receivers, BiQuadFilterCascade(vhfFilters()));
+        QVector<float> samples;
+        QBENCHMARK
+        {
+            for (BiQuadFilterCascade &receiver : filters)
+            {
+                samples = m_input;
+                for (int n = 0; n < samples.size(); n += FrameSize) { receiver.transform(samples.data() + n, FrameSize); }
+            }
+        }
+        QVERIFY(samples.size() == m_input.size());
+    }
+
+    void CBenchmarkAudioChain::compressorPerSample()
+    {
+        QVector<SimpleComp> compressors(Receivers, compressor());
+        QVector<float> samples;
+        QBENCHMARK
+        {
+            for (SimpleComp &receiver : compressors)
+            {
+                samples = m_input;
+                for (float &sample : samples)
+                {
+                    double in1 = sample;
+                    double in2 = 0;
+                    receiver.process(in1, in2);
+                    sample = static_cast<float>(in1);
+                }
+            }
+        }
+        QVERIFY(samples.size() == m_input.size());
+    }
+
+    void CBenchmarkAudioChain::compressorBlock()
+    {
+        QVector<SimpleComp> compressors(Receivers, compressor());
+        QVector<float> samples;
+        QBENCHMARK
+        {
+            for (SimpleComp &receiver : compressors)
+            {
+                samples = m_input;
+                for (int n = 0; n < samples.size(); n += FrameSize) { receiver.process(samples.data() + n, FrameSize, 1); }
+            }
+        }
+        QVERIFY(samples.size() == m_input.size());
+    }
+
+    void CBenchmarkAudioChain::chainPerSample()
+    {
+        QVector<SimpleComp> compressors(Receivers, compressor());
+        QVector<QVector<BiQuadFilter>> filters(Receivers, vhfFilters());
+        QVector<float> mix(m_input.size());
+        QBENCHMARK
+        {
+            mix.fill(0.0f);
+            for (int r = 0; r < Receivers; ++r)
+            {
+                for (int i = 0; i < m_input.size(); ++i)
+                {
+                    double in1 = m_input.at(i);
+                    double in2 = 0;
+                    compressors[r].process(in1, in2);
+                    float sample = static_cast<float>(in1);
+                    for (BiQuadFilter &filter : filters[r]) { sample = filter.transform(sample); }
+                    mix[i] += sample * 1.1f;
+                }
+            }
+        }
+        QVERIFY(mix.size() == m_input.size());
+    }
+
+    void CBenchmarkAudioChain::chainBlock()
+    {
+        QVector<SimpleComp> compressors(Receivers, compressor());
+        QVector<BiQuadFilterCascade> filters(Receivers, BiQuadFilterCascade(vhfFilters()));
+        QVector<float> mix(m_input.size());
+        QVector<float> frame(FrameSize);
+        QBENCHMARK
+        {
+            mix.fill(0.0f);
+            for (int r = 0; r < Receivers; ++r)
+            {
+                for (int n = 0; n < m_input.size(); n += FrameSize)
+                {
+                    std::copy(m_input.cbegin() + n, m_input.cbegin() + n + FrameSize, frame.begin());
+                    compressors[r].process(frame.data(), FrameSize, 1);
+                    filters[r].transform(frame.data(), FrameSize);
+                    for (int i = 0; i < FrameSize; ++i) { mix[n + i] += frame.at(i) * 1.1f; }
+                }
+            }
+        }
+        QVERIFY(mix.size() == m_input.size());
+    }
+
+    QVector<BiQuadFilter> CBenchmarkAudioChain::vhfFilters()
+    {
+        return
+        {
+            BiQuadFilter::highPassFilter(44100, 310, 0.25),
+            BiQuadFilter::peakingEQ(44100, 450, 0.75, 17.0),
+            BiQuadFilter::peakingEQ(44100, 1450, 1.0, 25.0),
+            BiQuadFilter::peakingEQ(44100, 2000, 1.0, 25.0),
+            BiQuadFilter::lowPassFilter(44100, 2500, 0.25)
+        };
+    }
+
+    SimpleComp CBenchmarkAudioChain::compressor()
+    {
+        SimpleComp compressor;
+        compressor.setAttack(5.0);
+        compressor.setRelease(10.0);
+        compressor.setSampleRate(48000.0);
+        compressor.setThresh(16.0);
+        compressor.setRatio(6.0);
+        compressor.setMakeUpGain(-5.5);
+        compressor.initRuntime();
+        return compressor;
+    }
+} // namespace
+
+//! main
+BLACKTEST_BENCHMARK_MAIN(BlackSoundTest::CBenchmarkAudioChain);
+
+#include "benchmarkaudiochain.moc"
+
+//! \endcond
@@ -0,0 +1,26 @@
+load(common_pre)
+
+QT += core dbus multimedia testlib
+
+TARGET = benchmarkaudiochain
+CONFIG   -= app_bundle
+CONFIG   += blackconfig
+CONFIG   += blackmisc
+CONFIG   += blacksound
+
+TEMPLATE = app
+
+DEPENDPATH += \
+    . \
+    $$SourceRoot/src \
+    $$SourceRoot/tests \
+
+INCLUDEPATH += \
+    $$SourceRoot/src \
+    $$SourceRoot/tests \
+
+SOURCES += benchmarkaudiochain.cpp
+
+DESTDIR = $$DestRoot/bin
+
+load(common_post)
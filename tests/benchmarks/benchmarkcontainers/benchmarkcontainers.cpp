@@ -0,0 +1,156 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/test/testdata.h"
+#include "blackmisc/registermetadata.h"
+#include "blackmisc/variant.h"
+#include "benchmarks/benchmarkdata.h"
+#include "test.h"
+
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Simulation;
+using namespace BlackMisc::Test;
+
+namespace BlackMiscTest
+{
+    //! CSequence and CVariant benchmarks
+    class CBenchmarkContainers : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init test case data
+        void initTestCase();
+
+        //! CSequence::findBy
+        //! @{
+        void findBy_data();
+        void findBy();
+        //! @}
+
+        //! CSequence::sortBy
+        //! @{
+        void sortBy_data();
+        void sortBy();
+        //! @}
+
+        //! CSequence::partiallySortBy
+        //! @{
+        void partiallySortBy_data();
+        void partiallySortBy();
+        //! @}
+
+        //! Value object to CVariant and back
+        void variantValueObject();
+
+        //! List to CVariant and back
+        //! @{
+        void variantList_data();
+        void variantList();
+        //! @}
+
+        //! CVariant to string
+        void variantToString();
+    };
+
+    void CBenchmarkContainers::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CBenchmarkContainers::findBy_data() { benchmarkSizes(); }
+
+    void CBenchmarkContainers::findBy()
+    {
+        QFETCH(int, size);
+        const CAircraftModelList list = benchmarkModels(size);
+        const QString modelString = list[size / 2].getModelString();
+        int found = 0;
+        QBENCHMARK
+        {
+            found = list.findBy([&](const CAircraftModel &m) { return m.getModelString() == modelString; }).size();
+        }
+        QCOMPARE(found, 1);
+    }
+
+    void CBenchmarkContainers::sortBy_data() { benchmarkSizes(); }
+
+    void CBenchmarkContainers::sortBy()
+    {
+        QFETCH(int, size);
+        const CAircraftModelList list = benchmarkModels(size);
+        QBENCHMARK
+        {
+            CAircraftModelList sorted(list);
+            sorted.sortBy(&CAircraftModel::getModelString);
+        }
+    }
+
+    void CBenchmarkContainers::partiallySortBy_data() { benchmarkSizes(); }
+
+    void CBenchmarkContainers::partiallySortBy()
+    {
+        QFETCH(int, size);
+        const CAircraftModelList list = benchmarkModels(size);
+        QBENCHMARK
+        {
+            CAircraftModelList sorted(list);
+            sorted.partiallySortBy(10, &CAircraftModel::getDbKey);
+        }
+    }
+
+    void CBenchmarkContainers::variantValueObject()
+    {
+        const CAircraftModel model = CTestData::getDbAircraftModelFsxAerosoftA320();
+        CAircraftModel result;
+        QBENCHMARK
+        {
+            result = CVariant::from(model).to<CAircraftModel>();
+        }
+        QCOMPARE(result, model);
+    }
+
+    void CBenchmarkContainers::variantList_data() { benchmarkSizes(); }
+
+    void CBenchmarkContainers::variantList()
+    {
+        QFETCH(int, size);
+        const CAircraftModelList list = benchmarkModels(size);
+        CAircraftModelList result;
+        QBENCHMARK
+        {
+            result = CVariant::from(list).to<CAircraftModelList>();
+        }
+        QCOMPARE(result.size(), list.size());
+    }
+
+    void CBenchmarkContainers::variantToString()
+    {
+        const CVariant variant = CVariant::from(CTestData::getDbAircraftModelFsxAerosoftA320());
+        QString s;
+        QBENCHMARK
+        {
+            s = variant.toQString();
+        }
+        QVERIFY(!s.isEmpty());
+    }
+} // namespace
+
+//! main
+BLACKTEST_BENCHMARK_MAIN(BlackMiscTest::CBenchmarkContainers);
+
+#include "benchmarkcontainers.moc"
+
+//! \endcond
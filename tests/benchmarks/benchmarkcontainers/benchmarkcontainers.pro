@@ -0,0 +1,25 @@
+load(common_pre)
+
+QT += core dbus testlib
+
+TARGET = benchmarkcontainers
+CONFIG   -= app_bundle
+CONFIG   += blackconfig
+CONFIG   += blackmisc
+
+TEMPLATE = app
+
+DEPENDPATH += \
+    . \
+    $$SourceRoot/src \
+    $$SourceRoot/tests \
+
+INCLUDEPATH += \
+    $$SourceRoot/src \
+    $$SourceRoot/tests \
+
+SOURCES += benchmarkcontainers.cpp
+
+DESTDIR = $$DestRoot/bin
+
+load(common_post)
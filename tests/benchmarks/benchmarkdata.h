@@ -0,0 +1,54 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+#ifndef BLACKMISCTEST_BENCHMARKDATA_H
+#define BLACKMISCTEST_BENCHMARKDATA_H
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/test/testdata.h"
+
+#include <QString>
+#include <QTest>
+
+namespace BlackMiscTest
+{
+    //! Container sizes as benchmark data, column "size"
+    inline void benchmarkSizes()
+    {
+        QTest::addColumn<int>("size");
+        QTest::newRow("100") << 100;
+        QTest::newRow("1000") << 1000;
+        QTest::newRow("10000") << 10000;
+    }
+
+    //! Models with unique keys and model strings in pseudo random order
+    inline BlackMisc::Simulation::CAircraftModelList benchmarkModels(int size)
+    {
+        using namespace BlackMisc::Simulation;
+        const CAircraftModel a320 = BlackMisc::Test::CTestData::getDbAircraftModelFsxAerosoftA320();
+        const CAircraftModel c172 = BlackMisc::Test::CTestData::getDbAircraftModelFsxA2AC172Skyhawk();
+        CAircraftModelList list;
+        for (int i = 0; i < size; ++i)
+        {
+            const int key = static_cast<int>((static_cast<qint64>(i) * 7919) % size); // 7919 is prime, so this is a permutation
+            CAircraftModel model(key % 2 ? a320 : c172);
+            model.setDbKey(key + 1);
+            model.setModelString(QStringLiteral("Benchmark model %1").arg(key));
+            list.push_back(model);
+        }
+        return list;
+    }
+} // ns
+
+//! \endcond
+
+#endif // guard
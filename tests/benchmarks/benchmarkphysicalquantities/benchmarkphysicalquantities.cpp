@@ -0,0 +1,149 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/units.h"
+#include "blackmisc/registermetadata.h"
+#include "test.h"
+
+#include <QTest>
+#include <QVector>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackMiscTest
+{
+    //! Physical quantity and geo benchmarks, each iteration handles Count values
+    class CBenchmarkPhysicalQuantities : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init test case data
+        void initTestCase();
+
+        //! Sum of lengths in different units
+        void lengthArithmetic();
+
+        //! Value in another unit
+        void unitConversion();
+
+        //! Parse from string
+        void parseFromString();
+
+        //! Great circle distance
+        void greatCircleDistance();
+
+        //! Bearing
+        void bearing();
+
+    private:
+        static constexpr int Count = 1000; //!< values per iteration
+
+        //! Coordinates around the world
+        static QVector<CCoordinateGeodetic> coordinates();
+    };
+
+    void CBenchmarkPhysicalQuantities::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CBenchmarkPhysicalQuantities::lengthArithmetic()
+    {
+        QVector<CLength> lengths;
+        for (int i = 0; i < Count; ++i) { lengths.push_back(CLength(i, i % 2 ? CLengthUnit::m() : CLengthUnit::ft())); }
+        CLength sum(0, CLengthUnit::m());
+        QBENCHMARK
+        {
+            sum = CLength(0, CLengthUnit::m());
+            for (const CLength &l : std::as_const(lengths)) { sum += l * 2.0; }
+        }
+        QVERIFY(sum.value(CLengthUnit::m()) > 0);
+    }
+
+    void CBenchmarkPhysicalQuantities::unitConversion()
+    {
+        QVector<CSpeed> speeds;
+        for (int i = 0; i < Count; ++i) { speeds.push_back(CSpeed(i, CSpeedUnit::kts())); }
+        double sum = 0;
+        QBENCHMARK
+        {
+            sum = 0;
+            for (const CSpeed &s : std::as_const(speeds)) { sum += s.value(CSpeedUnit::km_h()); }
+        }
+        QVERIFY(sum > 0);
+    }
+
+    void CBenchmarkPhysicalQuantities::parseFromString()
+    {
+        QStringList strings;
+        for (int i = 0; i < Count; ++i) { strings.push_back(QStringLiteral("%1.5%2").arg(i).arg(i % 2 ? "ft" : "m")); }
+        CLength length;
+        QBENCHMARK
+        {
+            for (const QString &s : std::as_const(strings)) { length.parseFromString(s); }
+        }
+        QVERIFY(!length.isNull());
+    }
+
+    void CBenchmarkPhysicalQuantities::greatCircleDistance()
+    {
+        const QVector<CCoordinateGeodetic> coordinates = CBenchmarkPhysicalQuantities::coordinates();
+        double sumM = 0;
+        QBENCHMARK
+        {
+            sumM = 0;
+            for (int i = 1; i < coordinates.size(); ++i)
+            {
+                sumM += calculateGreatCircleDistance(coordinates[i - 1], coordinates[i]).value(CLengthUnit::m());
+            }
+        }
+        QVERIFY(sumM > 0);
+    }
+
+    void CBenchmarkPhysicalQuantities::bearing()
+    {
+        const QVector<CCoordinateGeodetic> coordinates = CBenchmarkPhysicalQuantities::coordinates();
+        double sumDeg = 0;
+        QBENCHMARK
+        {
+            sumDeg = 0;
+            for (int i = 1; i < coordinates.size(); ++i)
+            {
+                sumDeg += calculateBearing(coordinates[i - 1], coordinates[i]).value(CAngleUnit::deg());
+            }
+        }
+        QVERIFY(sumDeg != 0);
+    }
+
+    QVector<CCoordinateGeodetic> CBenchmarkPhysicalQuantities::coordinates()
+    {
+        QVector<CCoordinateGeodetic> coordinates;
+        for (int i = 0; i < Count; ++i)
+        {
+            coordinates.push_back(CCoordinateGeodetic((i * 37) % 170 - 85.0, (i * 71) % 360 - 180.0, i * 10.0));
+        }
+        return coordinates;
+    }
+} // namespace
+
+//! main
+BLACKTEST_BENCHMARK_MAIN(BlackMiscTest::CBenchmarkPhysicalQuantities);
+
+#include "benchmarkphysicalquantities.moc"
+
+//! \endcond
@@ -0,0 +1,10 @@
+TEMPLATE = subdirs
+
+# Benchmarks are no test cases, they are not run by "make check".
+# Each benchmark writes <name>_testresults.xml and <name>_benchmarkresults.csv
+# into the working directory, the csv files can be compared between releases.
+SUBDIRS += \
+    benchmarkaudiochain \
+    benchmarkcontainers \
+    benchmarkphysicalquantities \
+    benchmarkserialization \
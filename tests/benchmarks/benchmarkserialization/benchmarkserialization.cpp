@@ -0,0 +1,151 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "blackmisc/dbusutils.h"
+#include "blackmisc/registermetadata.h"
+#include "benchmarks/benchmarkdata.h"
+#include "test.h"
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QDBusArgument>
+#include <QJsonDocument>
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! JSON, QDataStream and DBus benchmarks of large model lists
+    class CBenchmarkSerialization : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init test case data
+        void initTestCase();
+
+        //! To JSON
+        //! @{
+        void toJson_data();
+        void toJson();
+        //! @}
+
+        //! JSON round trip via string
+        //! @{
+        void jsonRoundTrip_data();
+        void jsonRoundTrip();
+        //! @}
+
+        //! QDataStream round trip
+        //! @{
+        void dataStreamRoundTrip_data();
+        void dataStreamRoundTrip();
+        //! @}
+
+        //! DBus marshalling
+        //! @{
+        void dBusMarshall_data();
+        void dBusMarshall();
+        //! @}
+
+        //! DBus signature
+        void dBusSignature();
+    };
+
+    void CBenchmarkSerialization::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CBenchmarkSerialization::toJson_data() { benchmarkSizes(); }
+
+    void CBenchmarkSerialization::toJson()
+    {
+        QFETCH(int, size);
+        const CAircraftModelList list = benchmarkModels(size);
+        QJsonObject json;
+        QBENCHMARK
+        {
+            json = list.toJson();
+        }
+        QVERIFY(!json.isEmpty());
+    }
+
+    void CBenchmarkSerialization::jsonRoundTrip_data() { benchmarkSizes(); }
+
+    void CBenchmarkSerialization::jsonRoundTrip()
+    {
+        QFETCH(int, size);
+        const CAircraftModelList list = benchmarkModels(size);
+        CAircraftModelList result;
+        QBENCHMARK
+        {
+            result.convertFromJson(list.toJsonString(QJsonDocument::Compact));
+        }
+        QCOMPARE(result.size(), list.size());
+    }
+
+    void CBenchmarkSerialization::dataStreamRoundTrip_data() { benchmarkSizes(); }
+
+    void CBenchmarkSerialization::dataStreamRoundTrip()
+    {
+        QFETCH(int, size);
+        const CAircraftModelList list = benchmarkModels(size);
+        CAircraftModelList result;
+        QBENCHMARK
+        {
+            QByteArray bytes;
+            {
+                QDataStream writer(&bytes, QIODevice::WriteOnly);
+                writer << list;
+            }
+            QDataStream reader(bytes);
+            reader >> result;
+        }
+        QCOMPARE(result, list);
+    }
+
+    void CBenchmarkSerialization::dBusMarshall_data() { benchmarkSizes(); }
+
+    void CBenchmarkSerialization::dBusMarshall()
+    {
+        // unmarshalling needs a message sent via a bus, so only marshalling is measured
+        QFETCH(int, size);
+        const CAircraftModelList list = benchmarkModels(size);
+        QBENCHMARK
+        {
+            QDBusArgument arg;
+            arg << list;
+        }
+    }
+
+    void CBenchmarkSerialization::dBusSignature()
+    {
+        const CAircraftModelList list = benchmarkModels(10);
+        QString signature;
+        QBENCHMARK
+        {
+            signature = CDBusUtils::dBusSignature(list);
+        }
+        QVERIFY(!signature.isEmpty());
+    }
+} // namespace
+
+//! main
+BLACKTEST_BENCHMARK_MAIN(BlackMiscTest::CBenchmarkSerialization);
+
+#include "benchmarkserialization.moc"
+
+//! \endcond
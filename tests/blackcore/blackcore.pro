@@ -3,4 +3,9 @@ TEMPLATE = subdirs
 SUBDIRS += \
     context \
     fsd \
+    vatsim \
+    testafvpipelineharness \
     testconnectivity \
+    testmatchingscriptenginepool \
+    testpttfastpath \
+    testtransceiverstate \
@@ -0,0 +1,195 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution and at http://www.swift-project.org/license.html. No part of swift project,
+ * including this file, may be copied, modified, propagated, or distributed except according to the terms
+ * contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+
+/*!
+* \file
+* \ingroup testblackfsd
+*/
+
+#include "blackcore/fsd/fsdclient.h"
+#include "blackcore/fsd/fsdreplay.h"
+#include "blackmisc/aviation/aircraftsituation.h"
+#include "blackmisc/network/clientprovider.h"
+#include "blackmisc/simulation/ownaircraftproviderdummy.h"
+#include "blackmisc/simulation/remoteaircraftproviderdummy.h"
+#include "blackmisc/registermetadata.h"
+#include "test.h"
+
+#include <QObject>
+#include <QSignalSpy>
+#include <QTest>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Network;
+using namespace BlackMisc::Simulation;
+using namespace BlackCore::Fsd;
+
+namespace BlackFsdTest
+{
+    //! Testing FSD replay
+    class CTestFsdReplay : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        //! Constructor
+        explicit CTestFsdReplay(QObject *parent = nullptr) : QObject(parent) {}
+
+    private slots:
+        void initTestCase();
+        void init();
+        void cleanup();
+        void testLoad();
+        void testFanOutCallsign();
+        void testReplayAsFastAsPossible();
+        void testReplayFanOut();
+        void testReplayTimed();
+        void testReplayStages();
+
+    private:
+        //! Some recorded lines
+        static QStringList capture();
+
+        CFSDClient *m_client = nullptr;
+    };
+
+    void CTestFsdReplay::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CTestFsdReplay::init()
+    {
+        m_client = new CFSDClient(CClientProviderDummy::instance(), COwnAircraftProviderDummy::instance(), CRemoteAircraftProviderDummy::instance(), this);
+    }
+
+    void CTestFsdReplay::cleanup()
+    {
+        delete m_client;
+        m_client = nullptr;
+    }
+
+    QStringList CTestFsdReplay::capture()
+    {
+        return
+        {
+            "23:59:59.900 FSD Recv=>@N:DLH123:1200:1:48.353855:11.786155:110:0:4290769188:1",
+            "23:59:59.950 FSD Sent=>@N:ABCD:1200:1:48.353855:11.786155:110:0:4290769188:1",
+            "00:00:00.000 FSD Recv=>^BAW345:48.35385:11.78615:1500.0:1490.0:4290769188:0.0:0.0:0.0:0.0:0.0:0.0:0.0",
+            "00:00:00.050 FSD Recv=>#TMEDMM_CTR:BAW345:Hello",
+            "00:00:00.100 FSD Recv=>@N:DLH123:1200:1:48.353900:11.786200:110:0:4290769188:1"
+        };
+    }
+
+    void CTestFsdReplay::testLoad()
+    {
+        CFsdReplay replay(m_client);
+        QCOMPARE(replay.loadFromLines(capture()), 4);
+        QCOMPARE(replay.getRecordedPilotCallsigns().size(), 2);
+        QVERIFY(replay.getRecordedPilotCallsigns().contains("DLH123"));
+        QVERIFY(replay.getRecordedPilotCallsigns().contains("BAW345"));
+        QCOMPARE(replay.getRecordedDurationMs(), 200); // crosses midnight
+    }
+
+    void CTestFsdReplay::testFanOutCallsign()
+    {
+        QCOMPARE(CFsdReplay::fanOutCallsign("DLH123", 0), "DLH123");
+        QCOMPARE(CFsdReplay::fanOutCallsign("DLH123", 1), "DLH123R1");
+        QCOMPARE(CFsdReplay::fanOutCallsign("DLH123", 35), "DLH123RZ");
+    }
+
+    void CTestFsdReplay::testReplayAsFastAsPossible()
+    {
+        CFsdReplay replay(m_client);
+        replay.loadFromLines(capture());
+        replay.setSpeedFactor(0);
+
+        QSignalSpy positionSpy(m_client, &CFSDClient::pilotDataUpdateReceived);
+        QSignalSpy finishedSpy(&replay, &CFsdReplay::finished);
+        QVERIFY(replay.start());
+        if (finishedSpy.isEmpty()) { QVERIFY(finishedSpy.wait(2000)); }
+
+        QCOMPARE(positionSpy.count(), 2);
+        QCOMPARE(replay.getSentMessageCount(), 4);
+        QVERIFY(replay.getMessagesPerSecond() > 0.0); // finished only when all messages are parsed
+        QVERIFY(replay.getAverageLatencyUs(CFsdReplay::StageParsed) >= 0.0);
+        QCOMPARE(replay.getAverageLatencyUs(CFsdReplay::StageStored), -1.0);
+    }
+
+    void CTestFsdReplay::testReplayFanOut()
+    {
+        CFsdReplay replay(m_client);
+        replay.loadFromLines(capture());
+        replay.setSpeedFactor(0);
+        replay.setFanOut(3);
+
+        QSignalSpy positionSpy(m_client, &CFSDClient::pilotDataUpdateReceived);
+        QSignalSpy visualSpy(m_client, &CFSDClient::visualPilotDataUpdateReceived);
+        QSignalSpy finishedSpy(&replay, &CFsdReplay::finished);
+        QVERIFY(replay.start());
+        if (finishedSpy.isEmpty()) { QVERIFY(finishedSpy.wait(2000)); }
+
+        QCOMPARE(positionSpy.count(), 6);
+        QCOMPARE(visualSpy.count(), 3);
+
+        QSet<QString> callsigns;
+        for (const QList<QVariant> &arguments : std::as_const(positionSpy))
+        {
+            callsigns.insert(arguments.at(0).value<CAircraftSituation>().getCallsign().asString());
+        }
+        QCOMPARE(callsigns, QSet<QString>({ "DLH123", "DLH123R1", "DLH123R2" }));
+    }
+
+    void CTestFsdReplay::testReplayTimed()
+    {
+        CFsdReplay replay(m_client);
+        replay.loadFromLines(capture());
+        replay.setSpeedFactor(2.0); // 200ms recorded
+
+        QSignalSpy finishedSpy(&replay, &CFsdReplay::finished);
+        QVERIFY(replay.start());
+        QVERIFY(finishedSpy.wait(2000));
+        const qint64 elapsedMs = finishedSpy.front().at(1).toLongLong();
+        QVERIFY2(elapsedMs >= 90, "Replay faster than recorded");
+    }
+
+    void CTestFsdReplay::testReplayStages()
+    {
+        CRemoteAircraftProviderDummy provider;
+        connect(m_client, &CFSDClient::pilotDataUpdateReceived, &provider, [&](const CAircraftSituation &situation)
+        {
+            provider.insertNewSituation(situation);
+        });
+
+        CFsdReplay replay(m_client);
+        replay.loadFromLines(capture());
+        replay.setSpeedFactor(0);
+        replay.measureStoredSituations(&provider);
+        replay.setMeasureInterpolation(true);
+
+        QSignalSpy finishedSpy(&replay, &CFsdReplay::finished);
+        QVERIFY(replay.start());
+        if (finishedSpy.isEmpty()) { QVERIFY(finishedSpy.wait(2000)); }
+
+        // stored and interpolated are reported queued
+        QTRY_VERIFY_WITH_TIMEOUT(replay.getAverageLatencyUs(CFsdReplay::StageInterpolated) >= 0.0, 2000);
+        QVERIFY(replay.getAverageLatencyUs(CFsdReplay::StageStored) >= 0.0);
+        QVERIFY(replay.getAverageLatencyUs(CFsdReplay::StageStored) >= replay.getAverageLatencyUs(CFsdReplay::StageParsed));
+    }
+}
+
+//! main
+BLACKTEST_MAIN(BlackFsdTest::CTestFsdReplay);
+
+#include "testfsdreplay.moc"
+
+//! \endcond
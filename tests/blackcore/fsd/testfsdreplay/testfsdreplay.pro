@@ -0,0 +1,30 @@
+load(common_pre)
+
+QT += core network dbus testlib multimedia
+
+TARGET = testfsdreplay
+CONFIG   -= app_bundle
+CONFIG   += blackconfig
+CONFIG   += blackmisc
+CONFIG   += blackcore
+CONFIG   += testcase
+CONFIG   += no_testcase_installs
+
+TEMPLATE = app
+
+DEPENDPATH += \
+    . \
+    $$SourceRoot/src \
+    $$SourceRoot/tests \
+
+INCLUDEPATH += \
+    $$SourceRoot/src \
+    $$SourceRoot/tests \
+
+SOURCES += testfsdreplay.cpp
+
+LIBS *= -lvatsimauth
+
+DESTDIR = $$DestRoot/bin
+
+load(common_post)
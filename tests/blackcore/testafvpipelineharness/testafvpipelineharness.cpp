@@ -0,0 +1,98 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackcore
+
+#include "blackcore/afv/clients/afvpipelineharness.h"
+#include "blackmisc/registermetadata.h"
+#include "test.h"
+
+#include <QTest>
+
+using namespace BlackCore::Afv::Clients;
+
+namespace BlackCoreTest
+{
+    //! Offline AFV receive path harness
+    class CTestAfvPipelineHarness : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init
+        void initTestCase();
+
+        //! Invalid configurations are rejected
+        void invalidConfig();
+
+        //! Offline runs with the same seed produce the same output
+        void deterministic();
+
+    private:
+        //! Short offline run with jitter and loss
+        static CAfvPipelineHarness::Config config(quint32 seed)
+        {
+            CAfvPipelineHarness::Config config;
+            config.speakers = 3;
+            config.receivers = 2;
+            config.durationMs = 5000;
+            config.talkMs = 1500;
+            config.pauseMs = 500;
+            config.jitterMs = 40;
+            config.lossRatio = 0.05;
+            config.seed = seed;
+            return config;
+        }
+    };
+
+    void CTestAfvPipelineHarness::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CTestAfvPipelineHarness::invalidConfig()
+    {
+        CAfvPipelineHarness::Config noSpeakers = config(1);
+        noSpeakers.speakers = 0;
+        QVERIFY(!CAfvPipelineHarness(noSpeakers).run());
+
+        CAfvPipelineHarness::Config loss = config(1);
+        loss.lossRatio = 1.5;
+        QVERIFY(!CAfvPipelineHarness(loss).run());
+    }
+
+    void CTestAfvPipelineHarness::deterministic()
+    {
+        CAfvPipelineHarness first(config(7));
+        QVERIFY(first.run());
+        QVERIFY(first.getPacketsSent() > 0);
+        QVERIFY(first.getPacketsReceived() > 0);
+        QVERIFY(first.getPacketsLost() < first.getPacketsSent());
+
+        CAfvPipelineHarness second(config(7));
+        QVERIFY(second.run());
+        QCOMPARE(second.getPacketsSent(), first.getPacketsSent());
+        QCOMPARE(second.getPacketsLost(), first.getPacketsLost());
+        QCOMPARE(second.getPacketsReceived(), first.getPacketsReceived());
+        QCOMPARE(second.getOutputHash(), first.getOutputHash());
+
+        // other jitter and loss, other output
+        CAfvPipelineHarness other(config(8));
+        QVERIFY(other.run());
+        QVERIFY(other.getOutputHash() != first.getOutputHash());
+    }
+} // ns
+
+//! main
+BLACKTEST_MAIN(BlackCoreTest::CTestAfvPipelineHarness);
+
+#include "testafvpipelineharness.moc"
+
+//! \endcond
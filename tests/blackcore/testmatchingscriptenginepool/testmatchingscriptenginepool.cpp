@@ -0,0 +1,95 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackcore
+
+#include "blackcore/matchingscriptenginepool.h"
+#include "blackmisc/fileutils.h"
+#include "test.h"
+
+#include <QFile>
+#include <QObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+using namespace BlackCore;
+using namespace BlackMisc;
+
+namespace BlackCoreTest
+{
+    //! Matching script engines
+    class CTestMatchingScriptEnginePool : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Restore the timeout
+        void cleanup();
+
+        //! A script which never finishes is interrupted, the engine is usable afterwards
+        void timeout();
+
+        //! A changed script file is read and compiled again
+        void hotReload();
+    };
+
+    void CTestMatchingScriptEnginePool::cleanup()
+    {
+        CMatchingScriptEnginePool::setTimeoutMs(CMatchingScriptEnginePool::DefaultTimeoutMs);
+    }
+
+    void CTestMatchingScriptEnginePool::timeout()
+    {
+        CMatchingScriptEnginePool::setTimeoutMs(200);
+        const CMatchingScriptEnginePool::RunResult endless = CMatchingScriptEnginePool::run(QStringLiteral("(function() { while (true) {} })"), QStringLiteral("endless.js"), {});
+        QVERIFY2(endless.timedOut, "Script not interrupted");
+        QVERIFY(endless.elapsedMs >= 100);
+        QVERIFY(!endless.compileError);
+
+        // CAircraftMatcher::matchingScript keeps the input model, there is no object as result
+        QVERIFY(!endless.value.isQObject());
+
+        // same thread, same engine
+        QObject probe;
+        probe.setObjectName(QStringLiteral("probe"));
+        const CMatchingScriptEnginePool::RunResult next = CMatchingScriptEnginePool::run(QStringLiteral("(function() { return probe.objectName; })"), QStringLiteral("next.js"), { { QStringLiteral("probe"), &probe } });
+        QVERIFY2(!next.timedOut, "Engine still interrupted");
+        QCOMPARE(next.value.toString(), QStringLiteral("probe"));
+    }
+
+    void CTestMatchingScriptEnginePool::hotReload()
+    {
+        const QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString fileName = CFileUtils::appendFilePaths(dir.path(), QStringLiteral("matching.js"));
+        QVERIFY(CMatchingScriptEnginePool::scriptSource(fileName).isEmpty());
+
+        const QString v1 = QStringLiteral("(function() { return 1; })");
+        QVERIFY(CFileUtils::writeStringToFile(v1, fileName));
+        QCOMPARE(CMatchingScriptEnginePool::scriptSource(fileName), v1);
+        QCOMPARE(CMatchingScriptEnginePool::run(CMatchingScriptEnginePool::scriptSource(fileName), fileName, {}).value.toInt(), 1);
+
+        // other size, detected even if the timestamp has not changed
+        const QString v2 = QStringLiteral("(function() { return 22; })");
+        QVERIFY(CFileUtils::writeStringToFile(v2, fileName));
+        QCOMPARE(CMatchingScriptEnginePool::scriptSource(fileName), v2);
+        QCOMPARE(CMatchingScriptEnginePool::run(CMatchingScriptEnginePool::scriptSource(fileName), fileName, {}).value.toInt(), 22);
+
+        QVERIFY(QFile::remove(fileName));
+        QVERIFY(CMatchingScriptEnginePool::scriptSource(fileName).isEmpty());
+    }
+} // ns
+
+//! main
+BLACKTEST_MAIN(BlackCoreTest::CTestMatchingScriptEnginePool);
+
+#include "testmatchingscriptenginepool.moc"
+
+//! \endcond
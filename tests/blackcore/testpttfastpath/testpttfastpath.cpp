@@ -0,0 +1,298 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackcore
+
+#include "blackcore/afv/clients/pttlatency.h"
+#include "blackcore/afv/clients/pttswitch.h"
+#include "blackcore/inputfastpath.h"
+#include "blackmisc/input/hotkeycombination.h"
+#include "blackmisc/input/joystickbutton.h"
+#include "blackmisc/input/keyboardkey.h"
+#include "test.h"
+
+#include <QTest>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace BlackCore;
+using namespace BlackCore::Afv::Clients;
+using namespace BlackMisc::Input;
+
+namespace BlackCoreTest
+{
+    //! Stands in for the AFV client: the Opus encoder sends a frame every FrameMs while transmitting, switched by CPttSwitch as in CAfvClient
+    class CEncoderStub
+    {
+    public:
+        //! Frame interval, shorter than the real 20ms to keep the test fast
+        static constexpr int FrameMs = 2;
+
+        //! Start encoding
+        CEncoderStub() : m_thread([this] { this->run(); }) {}
+
+        //! Stop encoding
+        ~CEncoderStub() { m_stop = true; m_thread.join(); }
+
+        //! Fast path
+        void setPttFast(bool active)
+        {
+            m_callbackThread = std::this_thread::get_id();
+            m_switch.fastPath(active);
+            m_calls++;
+        }
+
+        //! Latency
+        const CPttLatency &latency() const { return m_switch.latency(); }
+
+        //! Transmitting?
+        bool isTransmitting() const { return m_switch.isTransmitting(); }
+
+        //! Number of fast path calls
+        int calls() const { return m_calls; }
+
+        //! Thread of the last call
+        std::thread::id callbackThread() const { return m_callbackThread; }
+
+        //! Wait until the latency is measured for count transmissions
+        bool waitForMeasurements(int count) const
+        {
+            for (int i = 0; i < 1000 && this->latency().getCount() < count; ++i) { std::this_thread::sleep_for(std::chrono::milliseconds(FrameMs)); }
+            return this->latency().getCount() >= count;
+        }
+
+    private:
+        void run()
+        {
+            while (!m_stop)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(FrameMs));
+                if (m_switch.isTransmitting()) { m_switch.latency().frameSent(); }
+            }
+        }
+
+        CPttSwitch m_switch;
+        std::atomic_bool m_stop { false };
+        std::atomic_int m_calls { 0 };
+        std::thread::id m_callbackThread;
+        std::thread m_thread;
+    };
+
+    //! PTT fast path and latency measurement
+    class CTestPttFastPath : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Latency of one transmission is from the first key down to the first frame
+        void latency();
+
+        //! Synthetic key events switch transmitting directly in the input thread
+        void fastPath();
+
+        //! The regular path following the fast path does not switch again
+        void pttSwitch();
+
+        //! Unbound or not configured actions are not called
+        void unbind();
+
+        //! No PTT while a hotkey is captured, and the switch follows the regular path afterwards
+        void capture();
+
+    private:
+        //! Configured PTT combination
+        static CHotkeyCombination pttCombination() { return CHotkeyCombination(CKeyboardKey(Key_Space)); }
+
+        //! Configured actions
+        static QHash<CHotkeyCombination, QString> configuredActions()
+        {
+            QHash<CHotkeyCombination, QString> actions;
+            actions.insert(pttCombination(), "/Voice/Activate push-to-talk");
+            actions.insert(CHotkeyCombination(CKeyboardKey(Key_A)), "/Other/Action");
+            return actions;
+        }
+    };
+
+    void CTestPttFastPath::latency()
+    {
+        CPttLatency latency;
+        QCOMPARE(latency.getCount(), 0);
+        QCOMPARE(latency.getLastMs(), -1.0);
+
+        latency.keyDown(1000000);
+        latency.keyDown(5000000); // regular path after the fast path, ignored
+        QCOMPARE(latency.frameSent(4000000), qint64(3000000));
+        QCOMPARE(latency.frameSent(24000000), qint64(-1)); // only the first frame
+        latency.keyUp();
+
+        // released before any frame was sent
+        latency.keyDown(30000000);
+        latency.keyUp();
+        QCOMPARE(latency.frameSent(40000000), qint64(-1));
+
+        latency.keyDown(50000000);
+        QCOMPARE(latency.frameSent(57000000), qint64(7000000));
+        latency.keyUp();
+
+        QCOMPARE(latency.getCount(), 2);
+        QCOMPARE(latency.getLastMs(), 7.0);
+        QCOMPARE(latency.getMinMs(), 3.0);
+        QCOMPARE(latency.getMaxMs(), 7.0);
+        QCOMPARE(latency.getAverageMs(), 5.0);
+
+        latency.reset();
+        QCOMPARE(latency.getCount(), 0);
+    }
+
+    void CTestPttFastPath::fastPath()
+    {
+        CInputFastPath fastPath;
+        fastPath.setConfiguredActions(configuredActions());
+        CEncoderStub encoder;
+        fastPath.bind("/Voice/Activate push-to-talk", [&encoder](bool active) { encoder.setPttFast(active); });
+        QVERIFY(fastPath.hasBindings());
+
+        // keyboard events from an input thread
+        CHotkeyCombination pttWithShift = pttCombination();
+        pttWithShift.addKeyboardKey(CKeyboardKey(Key_ShiftLeft));
+        constexpr int Transmissions = 5;
+        std::thread input([&]
+        {
+            for (int i = 0; i < Transmissions; ++i)
+            {
+                fastPath.processKeyCombination(pttCombination());
+                if (!encoder.isTransmitting()) { return; } // switched synchronously
+                fastPath.processKeyCombination(pttWithShift); // still PTT
+                encoder.waitForMeasurements(i + 1);
+                fastPath.processKeyCombination({});
+                if (encoder.isTransmitting()) { return; }
+            }
+        });
+        const std::thread::id inputThread = input.get_id();
+        input.join();
+
+        QCOMPARE(encoder.calls(), 2 * Transmissions);
+        QVERIFY(encoder.callbackThread() == inputThread);
+        QVERIFY(!encoder.isTransmitting());
+        QCOMPARE(encoder.latency().getCount(), Transmissions);
+        QVERIFY2(encoder.latency().getMaxMs() < 1000.0, qPrintable(encoder.latency().toQString()));
+
+        // joystick button mapped as PTT, merged with the keyboard keys
+        CHotkeyCombination button;
+        button.addJoystickButton(CJoystickButton("stick", 1));
+        QHash<CHotkeyCombination, QString> actions = configuredActions();
+        actions.insert(button, "/Voice/Activate push-to-talk");
+        fastPath.setConfiguredActions(actions);
+        fastPath.processButtonCombination(button);
+        QVERIFY(encoder.isTransmitting());
+        fastPath.processKeyCombination(CHotkeyCombination(CKeyboardKey(Key_A)));
+        QVERIFY(encoder.isTransmitting());
+        fastPath.processButtonCombination({});
+        QVERIFY(!encoder.isTransmitting());
+    }
+
+    void CTestPttFastPath::pttSwitch()
+    {
+        // short tap, the fast key up is before the regular key down
+        CPttSwitch ptt;
+        ptt.fastPath(true);
+        QVERIFY(ptt.isTransmitting());
+        ptt.fastPath(false);
+        QVERIFY(!ptt.isTransmitting());
+        QVERIFY(!ptt.regularPath(true));
+        QVERIFY2(!ptt.isTransmitting(), "Regular key down after the tap switched on again");
+        QVERIFY(!ptt.regularPath(false));
+        QVERIFY(!ptt.isTransmitting());
+        QCOMPARE(ptt.latency().frameSent(), qint64(-1)); // no measurement started by the regular path
+
+        // key held, the regular path follows
+        ptt.fastPath(true);
+        QVERIFY(!ptt.regularPath(true));
+        QVERIFY(ptt.isTransmitting());
+        QVERIFY(ptt.latency().frameSent() >= 0);
+        ptt.fastPath(true); // repeated, no change
+        ptt.fastPath(false);
+        QVERIFY(!ptt.regularPath(false));
+        QVERIFY(!ptt.isTransmitting());
+        QCOMPARE(ptt.latency().getCount(), 1);
+
+        // PTT without fast path, e.g. from the UI
+        QVERIFY(ptt.regularPath(true));
+        QVERIFY(ptt.isTransmitting());
+        QVERIFY(ptt.regularPath(false));
+        QVERIFY(!ptt.isTransmitting());
+    }
+
+    void CTestPttFastPath::unbind()
+    {
+        CInputFastPath fastPath;
+        int calls = 0;
+        const int index = fastPath.bind("/Voice/Activate push-to-talk", [&calls](bool) { calls++; });
+
+        // not configured yet
+        fastPath.processKeyCombination(pttCombination());
+        fastPath.processKeyCombination({});
+        QCOMPARE(calls, 0);
+
+        fastPath.setConfiguredActions(configuredActions());
+        fastPath.processKeyCombination(CHotkeyCombination(CKeyboardKey(Key_A))); // action without fast path
+        QCOMPARE(calls, 0);
+        fastPath.processKeyCombination(pttCombination());
+        QCOMPARE(calls, 1);
+
+        fastPath.unbind(index);
+        QVERIFY(!fastPath.hasBindings());
+        fastPath.processKeyCombination({});
+        fastPath.processKeyCombination(pttCombination());
+        QCOMPARE(calls, 1);
+    }
+
+    void CTestPttFastPath::capture()
+    {
+        CInputFastPath fastPath;
+        fastPath.setConfiguredActions(configuredActions());
+        CPttSwitch ptt;
+        fastPath.bind("/Voice/Activate push-to-talk", [&ptt](bool active) { ptt.fastPath(active); });
+
+        // key down reaches the fast path, the regular path is already capturing
+        fastPath.processKeyCombination(pttCombination());
+        QVERIFY(ptt.isTransmitting());
+        fastPath.suspend();
+        fastPath.processKeyCombination({});
+        fastPath.processKeyCombination(pttCombination());
+        QVERIFY2(ptt.isTransmitting(), "Fast path called while suspended");
+
+        // capture finished, the regular path never saw PTT
+        ptt.reset();
+        QVERIFY(!ptt.isTransmitting());
+        fastPath.resume({});
+        fastPath.processKeyCombination({});
+        QVERIFY(!ptt.isTransmitting());
+
+        // the regular path is not swallowed anymore
+        QVERIFY(ptt.regularPath(true));
+        QVERIFY(ptt.isTransmitting());
+        QVERIFY(ptt.regularPath(false));
+        QVERIFY(!ptt.isTransmitting());
+
+        // fast path works again
+        fastPath.processKeyCombination(pttCombination());
+        QVERIFY(ptt.isTransmitting());
+        QVERIFY(!ptt.regularPath(true));
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackCoreTest::CTestPttFastPath);
+
+#include "testpttfastpath.moc"
+
+//! \endcond
@@ -0,0 +1,174 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackcore
+
+#include "blackcore/afv/clients/transceiverstate.h"
+#include "blackmisc/lockfree.h"
+#include "test.h"
+
+#include <QTest>
+
+using namespace BlackCore::Afv;
+using namespace BlackCore::Afv::Clients;
+
+namespace BlackCoreTest
+{
+    //! Transceiver snapshot of the AFV client
+    class CTestTransceiverState : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Distance approximation
+        void distance();
+
+        //! Small movements are no change, larger ones, frequencies, enabled and transmitting transceivers are
+        void thresholds();
+
+        //! Only the enabled transceivers are sent to the voice server
+        void sendSuppression();
+
+        //! Changes applied to the current snapshot keep the changes of other writers
+        void sharedWrite();
+
+    private:
+        //! Degrees of latitude per meter
+        static constexpr double DegPerM = 1.0 / 111194.93;
+
+        //! Transceiver at 50N 8E
+        static TransceiverDto transceiver(quint16 id, quint32 frequencyHz)
+        {
+            TransceiverDto dto;
+            dto.id = id;
+            dto.frequencyHz = frequencyHz;
+            dto.LatDeg = 50.0;
+            dto.LonDeg = 8.0;
+            dto.HeightMslM = dto.HeightAglM = 1000.0;
+            return dto;
+        }
+
+        //! COM1 and COM2, both enabled, COM1 transmitting
+        static CTransceiverState state()
+        {
+            const TransceiverDto com1 = transceiver(0, 122800000);
+            const TransceiverDto com2 = transceiver(1, 121500000);
+            return CTransceiverState({ com1, com2 }, { 0, 1 }, { TxTransceiverDto(com1) });
+        }
+    };
+
+    void CTestTransceiverState::distance()
+    {
+        TransceiverDto a = transceiver(0, 122800000);
+        TransceiverDto b = a;
+        QCOMPARE(CTransceiverState::distanceM(a, b), 0.0);
+
+        b.LatDeg += 1.0;
+        QVERIFY(qAbs(CTransceiverState::distanceM(a, b) - 111194.93) < 1.0);
+
+        // one degree of longitude at 60N is half a degree of latitude
+        a.LatDeg = b.LatDeg = 60.0;
+        b.LonDeg = a.LonDeg + 1.0;
+        QVERIFY(qAbs(CTransceiverState::distanceM(a, b) - 111194.93 / 2.0) < 10.0);
+    }
+
+    void CTestTransceiverState::thresholds()
+    {
+        const CTransceiverState current = state();
+        QVERIFY(!current.isChanged(current));
+
+        CTransceiverState moved = current;
+        moved.setPosition(50.0 + 0.5 * CTransceiverState::PositionThresholdM * DegPerM, 8.0, 1000.0);
+        QVERIFY2(!moved.isChanged(current), "Small movement");
+        moved.setPosition(50.0 + 1.5 * CTransceiverState::PositionThresholdM * DegPerM, 8.0, 1000.0);
+        QVERIFY(moved.isChanged(current));
+
+        CTransceiverState climbed = current;
+        climbed.setPosition(50.0, 8.0, 1000.0 + 0.5 * CTransceiverState::HeightThresholdM);
+        QVERIFY2(!climbed.isChanged(current), "Small climb");
+        climbed.setPosition(50.0, 8.0, 1000.0 + 1.5 * CTransceiverState::HeightThresholdM);
+        QVERIFY(climbed.isChanged(current));
+
+        CTransceiverState tuned = current;
+        QVERIFY(!tuned.setFrequencyHz(1, 121500000));
+        QVERIFY(tuned.setFrequencyHz(1, 121600000));
+        QVERIFY(tuned.isChanged(current));
+
+        CTransceiverState disabled = current;
+        disabled.setEnabled(1, false);
+        QVERIFY(disabled.isChanged(current));
+        QVERIFY(!disabled.isEnabled(1));
+        QCOMPARE(disabled.getEnabledTransceivers().size(), 1);
+
+        CTransceiverState transmitting = current;
+        transmitting.setTransmittingTransceivers({ TxTransceiverDto(transceiver(1, 121500000)) });
+        QVERIFY(transmitting.isChanged(current));
+        QVERIFY(transmitting.isTransmitting(1));
+        QVERIFY(!transmitting.isTransmitting(0));
+    }
+
+    void CTestTransceiverState::sendSuppression()
+    {
+        CTransceiverState current = state();
+        current.setEnabled(1, false);
+        const QVector<TransceiverDto> sent = current.getEnabledTransceivers();
+        QVERIFY(!current.isChangedForVoiceServer(sent));
+
+        // disabled transceiver tuned, nothing to send
+        CTransceiverState next = current;
+        next.setFrequencyHz(1, 121600000);
+        QVERIFY(!next.isChangedForVoiceServer(sent));
+        QVERIFY(next.isChanged(current)); // but a new snapshot
+
+        // small movements are not sent
+        next.setPosition(50.0 + 0.5 * CTransceiverState::PositionThresholdM * DegPerM, 8.0, 1000.0);
+        QVERIFY(!next.isChangedForVoiceServer(sent));
+
+        // accumulated movements are sent, as compared with the last sent transceivers
+        next.setPosition(50.0 + 1.5 * CTransceiverState::PositionThresholdM * DegPerM, 8.0, 1000.0);
+        QVERIFY(next.isChangedForVoiceServer(sent));
+
+        // enabled transceiver tuned or enabled
+        next = current;
+        next.setFrequencyHz(0, 118000000);
+        QVERIFY(next.isChangedForVoiceServer(sent));
+        next = current;
+        next.setEnabled(1, true);
+        QVERIFY(next.isChangedForVoiceServer(sent));
+    }
+
+    void CTestTransceiverState::sharedWrite()
+    {
+        // the cockpit update is based on an older snapshot, meanwhile COM2 was disabled
+        BlackMisc::LockFree<CTransceiverState> lockFree(state());
+        const CTransceiverState older = lockFree.read().get();
+        lockFree.sharedWrite([](CTransceiverState & state) { state.setEnabled(1, false); });
+
+        TransceiverDto com1 = transceiver(0, 118000000);
+        TransceiverDto com2 = transceiver(1, 121500000);
+        const QVector<TransceiverDto> tuned { com1, com2 };
+        CTransceiverState newState(older);
+        newState.setTransceivers(tuned);
+        QVERIFY(newState.isChanged(older));
+
+        // applied to the current state, as in CAfvClient::updateFromOwnAircraft
+        lockFree.sharedWrite([&](CTransceiverState & state) { state.setTransceivers(tuned); });
+        const CTransceiverState result = lockFree.read().get();
+        QVERIFY2(!result.isEnabled(1), "Concurrent change lost");
+        QCOMPARE(result.getFrequencyHz(0, 0), quint32(118000000));
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackCoreTest::CTestTransceiverState);
+
+#include "testtransceiverstate.moc"
+
+//! \endcond
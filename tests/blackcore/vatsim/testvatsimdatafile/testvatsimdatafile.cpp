@@ -0,0 +1,103 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackcore
+
+#include "blackcore/vatsim/vatsimdatafilesnapshot.h"
+#include "blackmisc/aviation/atcstation.h"
+#include "blackmisc/aviation/callsign.h"
+#include "blackmisc/geo/coordinategeodetic.h"
+#include "blackmisc/network/user.h"
+#include "blackmisc/network/voicecapabilities.h"
+#include "blackmisc/simulation/simulatedaircraft.h"
+#include "test.h"
+
+#include <QObject>
+#include <QTest>
+
+using namespace BlackCore::Vatsim;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::Network;
+using namespace BlackMisc::Simulation;
+
+namespace BlackCoreTest
+{
+    //! VATSIM data file snapshot tests
+    class CTestVatsimDataFile : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Callsign indexes
+        void snapshotIndexes();
+
+        //! Diff between two snapshots
+        void snapshotDiff();
+
+    private:
+        //! Aircraft at position
+        static CSimulatedAircraft aircraft(const QString &callsign, const QString &name, double lat);
+    };
+
+    CSimulatedAircraft CTestVatsimDataFile::aircraft(const QString &callsign, const QString &name, double lat)
+    {
+        const CCallsign cs(callsign);
+        const CAircraftSituation situation(cs, CCoordinateGeodetic(lat, 11.0, 1000.0));
+        return CSimulatedAircraft(cs, CUser("123", name, cs), situation);
+    }
+
+    void CTestVatsimDataFile::snapshotIndexes()
+    {
+        const CSimulatedAircraftList aircraftList({ aircraft("DLH123", "Joe Doe", 48.0), aircraft("BAW345", "Jane Doe", 49.0) });
+        const CAtcStationList stations({ CAtcStation("EDDM_TWR"), CAtcStation("EDDM_ATIS"), CAtcStation("EDDM_TWR") });
+        const CVatsimDataFileSnapshot snapshot(aircraftList, stations, { { CCallsign("DLH123"), CFlightPlanRemarks("/V/") } }, QDateTime::currentDateTimeUtc());
+
+        QCOMPARE(snapshot.getAircraftForCallsign("BAW345").getPilot().getRealName(), QString("Jane Doe"));
+        QVERIFY(!snapshot.getAircraftForCallsign("EZY999").hasCallsign());
+        QCOMPARE(snapshot.getAircraftForCallsigns(CCallsignSet(QStringList({ "BAW345", "DLH123" }))).size(), 2);
+        QCOMPARE(snapshot.getAtcStationsForCallsigns(CCallsignSet(CCallsign("EDDM_TWR"))).size(), 2);
+        QCOMPARE(snapshot.getAtcStationsForCallsigns(CCallsignSet(QStringList({ "EDDM_TWR", "EDDM_ATIS" }))), stations);
+        QCOMPARE(snapshot.getFlightPlanRemarksForCallsign("DLH123").getVoiceCapabilities().getCapabilities(), CVoiceCapabilities::Voice);
+        QVERIFY(snapshot.getDiff().isEmpty());
+    }
+
+    void CTestVatsimDataFile::snapshotDiff()
+    {
+        const QDateTime ts1 = QDateTime::currentDateTimeUtc();
+        const QDateTime ts2 = ts1.addSecs(60);
+        const CVatsimDataFileSnapshot snapshot1(
+            CSimulatedAircraftList({ aircraft("DLH123", "Joe Doe", 48.0), aircraft("BAW345", "Jane Doe", 49.0), aircraft("AFR1", "Max Doe", 50.0) }),
+            CAtcStationList({ CAtcStation("EDDM_TWR"), CAtcStation("EDDF_TWR") }), {}, ts1);
+
+        CAtcStation changedStation("EDDF_TWR");
+        changedStation.setControllerRealName("John Doe");
+        const CVatsimDataFileSnapshot snapshot2(
+            CSimulatedAircraftList({ aircraft("DLH123", "Joe Doe", 48.5), aircraft("BAW345", "Jane Smith", 49.0), aircraft("EZY999", "Tim Doe", 51.0) }),
+            CAtcStationList({ changedStation, CAtcStation("EGLL_TWR") }), {}, ts2, &snapshot1);
+
+        const CVatsimDataFileDiff &diff = snapshot2.getDiff();
+        QCOMPARE(snapshot2.getPreviousUpdateTimestamp(), ts1);
+        QCOMPARE(diff.addedPilots, CCallsignSet(CCallsign("EZY999")));
+        QCOMPARE(diff.removedPilots, CCallsignSet(CCallsign("AFR1")));
+        QCOMPARE(diff.changedPilots, CCallsignSet(CCallsign("BAW345"))); // DLH123 only moved
+        QCOMPARE(diff.addedControllers, CCallsignSet(CCallsign("EGLL_TWR")));
+        QCOMPARE(diff.removedControllers, CCallsignSet(CCallsign("EDDM_TWR")));
+        QCOMPARE(diff.changedControllers, CCallsignSet(CCallsign("EDDF_TWR")));
+        QCOMPARE(diff.getAddedOrChangedPilots().size(), 2);
+    }
+} // namespace
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackCoreTest::CTestVatsimDataFile);
+
+#include "testvatsimdatafile.moc"
+
+//! \endcond
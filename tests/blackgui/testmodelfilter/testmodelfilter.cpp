@@ -0,0 +1,137 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackgui
+
+#include "blackgui/models/aircraftmodelfilter.h"
+#include "blackmisc/aviation/livery.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "test.h"
+
+#include <QTest>
+
+using namespace BlackGui::Models;
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Simulation;
+
+namespace BlackGuiTest
+{
+    //! Test model filters
+    class CTestModelFilter : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Refined wildcard expressions
+        void refinedExpressions();
+
+        //! Refined filters
+        void refinedFilters();
+
+        //! Large containers are filtered in chunks, the result is the same
+        void chunkedFilter();
+
+        //! Cancelled filters stop early
+        void cancelledFilter();
+
+    private:
+        //! Filter by model string
+        static CAircraftModelFilter modelStringFilter(const QString &modelString, Qt::CheckState military = Qt::PartiallyChecked);
+
+        //! Models "MODEL 0" ... "MODEL n-1", every third is military
+        static CAircraftModelList models(int size);
+    };
+
+    void CTestModelFilter::refinedExpressions()
+    {
+        using Filter = IModelFilter<CAircraftModelList>;
+        QVERIFY(Filter::isRefinedFilterExpression("A3*", ""));
+        QVERIFY(Filter::isRefinedFilterExpression("A3*", "A3*"));
+        QVERIFY(Filter::isRefinedFilterExpression("A32*", "A3*"));
+        QVERIFY(Filter::isRefinedFilterExpression("A320", "A3*"));
+        QVERIFY(Filter::isRefinedFilterExpression("*BUS*", "*BU*"));
+        QVERIFY(Filter::isRefinedFilterExpression("AIRBUS*", "*BU*"));
+        QVERIFY(Filter::isRefinedFilterExpression("*320", "*20"));
+
+        QVERIFY(!Filter::isRefinedFilterExpression("", "A3*"));
+        QVERIFY(!Filter::isRefinedFilterExpression("A*", "A3*"));
+        QVERIFY(!Filter::isRefinedFilterExpression("*A32*", "A3*"));
+        QVERIFY(!Filter::isRefinedFilterExpression("A321", "A320"));
+        QVERIFY(!Filter::isRefinedFilterExpression("A32*", "A*0"));
+        QVERIFY(!Filter::isRefinedFilterExpression("*320", "A3*"));
+    }
+
+    void CTestModelFilter::refinedFilters()
+    {
+        const CAircraftModelFilter first = modelStringFilter("MODEL 1*");
+        const CAircraftModelFilter refined = modelStringFilter("MODEL 12*");
+        QVERIFY(refined.isRefinementOf(first));
+        QVERIFY(!first.isRefinementOf(refined));
+        QVERIFY(!modelStringFilter("MODEL 12*", Qt::Checked).isRefinementOf(first));
+
+        const CAircraftModelList all = models(1000);
+        QCOMPARE(refined.filter(first.filter(all)), refined.filter(all));
+    }
+
+    void CTestModelFilter::chunkedFilter()
+    {
+        const int size = 3 * IModelFilter<CAircraftModelList>::ParallelFilterThreshold + 11;
+        const CAircraftModelList all = models(size);
+        const CAircraftModelFilter filter = modelStringFilter("*1*", Qt::Checked);
+
+        CAircraftModelList expected;
+        for (const CAircraftModel &model : all)
+        {
+            if (model.isMilitary() && model.getModelString().contains('1')) { expected.push_back(model); }
+        }
+        QVERIFY(!expected.isEmpty());
+        QCOMPARE(filter.filter(all), expected);
+    }
+
+    void CTestModelFilter::cancelledFilter()
+    {
+        CAircraftModelFilter filter = modelStringFilter("MODEL*");
+        QVERIFY(!filter.isCancelled());
+        filter.cancel();
+        QVERIFY(filter.isCancelled());
+        QVERIFY(filter.filter(models(100)).isEmpty());
+    }
+
+    CAircraftModelFilter CTestModelFilter::modelStringFilter(const QString &modelString, Qt::CheckState military)
+    {
+        return CAircraftModelFilter(-1, modelString, {}, CAircraftModel::All, BlackMisc::Db::All, military, Qt::PartiallyChecked,
+                                    {}, {}, {}, {}, {}, {}, {});
+    }
+
+    CAircraftModelList CTestModelFilter::models(int size)
+    {
+        CAircraftModelList models;
+        for (int i = 0; i < size; ++i)
+        {
+            CAircraftModel model(QStringLiteral("MODEL %1").arg(i), CAircraftModel::TypeOwnSimulatorModel);
+            if (i % 3 == 0)
+            {
+                CLivery livery;
+                livery.setMilitary(true);
+                model.setLivery(livery);
+            }
+            models.push_back(model);
+        }
+        return models;
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackGuiTest::CTestModelFilter);
+
+#include "testmodelfilter.moc"
+
+//! \endcond
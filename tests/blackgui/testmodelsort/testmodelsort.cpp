@@ -0,0 +1,98 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackgui
+
+#include "blackgui/models/modelsortkey.h"
+#include "blackmisc/pq/length.h"
+#include "blackmisc/registermetadata.h"
+#include "test.h"
+
+#include <QTest>
+#include <QVector>
+#include <algorithm>
+#include <numeric>
+
+using namespace BlackGui::Models;
+using namespace BlackMisc;
+using namespace BlackMisc::PhysicalQuantities;
+
+namespace BlackGuiTest
+{
+    //! Test sorting of list models
+    class CTestModelSort : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Init test case data
+        void initTestCase();
+
+        //! Keys compare like CVariant
+        void sortKeys();
+
+        //! Parallel sorting gives the same order as sorting on one thread
+        void parallelSort();
+    };
+
+    void CTestModelSort::initTestCase()
+    {
+        BlackMisc::registerMetadata();
+    }
+
+    void CTestModelSort::sortKeys()
+    {
+        const QVector<QVariant> values
+        {
+            3, -7, 3, 2.5, 1.0, QStringLiteral("b"), QStringLiteral("a"), QStringLiteral("B"), QStringLiteral("A"), QStringLiteral("ab"), QString(), true, false,
+            QVariant::fromValue(CLength(5, CLengthUnit::m())), QVariant::fromValue(CLength(10, CLengthUnit::ft())), QVariant()
+        };
+        for (const QVariant &a : values)
+        {
+            for (const QVariant &b : values)
+            {
+                // strings are sorted case insensitive, unlike CVariant
+                const bool strings = a.userType() == QMetaType::QString && b.userType() == QMetaType::QString;
+                const int ci = strings ? a.toString().compare(b.toString(), Qt::CaseInsensitive) : 0;
+                const int expected = !strings ? compare(CVariant(a), CVariant(b)) : (ci != 0 ? ci : a.toString().compare(b.toString()));
+                const int c = CModelSortKey(a).compare(CModelSortKey(b));
+                QVERIFY2((expected < 0) == (c < 0) && (expected > 0) == (c > 0), qPrintable(a.toString() + " " + b.toString()));
+            }
+        }
+        QVERIFY(CModelSortKey(QStringLiteral("a")).compare(CModelSortKey(QStringLiteral("B"))) < 0);
+        QVERIFY(CModelSortKey(QStringLiteral("A")).compare(CModelSortKey(QStringLiteral("a"))) != 0);
+    }
+
+    void CTestModelSort::parallelSort()
+    {
+        const int size = 4 * Private::ParallelSortThreshold + 17;
+        QVector<int> v;
+        for (int i = 0; i < size; ++i) { v.push_back(static_cast<int>((static_cast<qint64>(i) * 7919) % 1000)); }
+        const QVector<int> &values = v;
+
+        // equal values keep their order, so there is only one valid result
+        const auto cmp = [&values](int a, int b) { return values[a] != values[b] ? values[a] < values[b] : a < b; };
+        const QVector<int> rows = Private::sortRows(size, cmp);
+        QVector<int> expected(size);
+        std::iota(expected.begin(), expected.end(), 0);
+        std::sort(expected.begin(), expected.end(), cmp);
+        QCOMPARE(rows, expected);
+
+        const QVector<int> small = Private::sortRows(100, cmp);
+        QVERIFY(std::is_sorted(small.begin(), small.end(), cmp));
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackGuiTest::CTestModelSort);
+
+#include "testmodelsort.moc"
+
+//! \endcond
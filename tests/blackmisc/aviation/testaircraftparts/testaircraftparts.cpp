@@ -11,6 +11,7 @@
 //! \ingroup testblackmisc
 
 #include "blackmisc/aviation/aircraftparts.h"
+#include "blackmisc/aviation/aircraftpartsdelta.h"
 #include "blackmisc/json.h"
 #include "test.h"
 #include <QTest>
@@ -30,6 +31,12 @@ namespace BlackMiscTest
         //! Test ground flag
         void groundFlag();
 
+        //! Typed delta gives the same parts as merging the JSON objects
+        void partsDelta();
+
+        //! Unknown attributes are kept, but not applied
+        void partsDeltaUnknownAttributes();
+
     private:
         //! Test parts
         BlackMisc::Aviation::CAircraftParts testParts1() const;
@@ -76,6 +83,75 @@ namespace BlackMiscTest
         // const QString json2 = stringFromJsonObject(deltaJson21);
     }
 
+    void CTestAircraftParts::partsDelta()
+    {
+        // as received from the network, without the lights not sent
+        const CAircraftParts previous = CAircraftParts::fromJson(this->testParts1().toJson());
+
+        // incremental packet as sent by other clients
+        const QJsonObject incremental = jsonObjectFromString(
+            R"({"is_full_data": false, "gear_down": false, "flaps_pct": 25, "lights": {"landing_on": false, "nav_on": true}, "engines": {"2": {"on": false}, "5": {"on": true}}})");
+        const CAircraftPartsDelta delta = CAircraftPartsDelta::fromJson(incremental);
+        QVERIFY(!delta.isFull());
+        QVERIFY(delta.hasAttribute(CAircraftPartsDelta::GearDown));
+        QVERIFY(!delta.hasAttribute(CAircraftPartsDelta::OnGround));
+        QVERIFY(delta.getUnknownAttributes().isEmpty());
+        QCOMPARE(delta.getAttributesCount(), incremental.size());
+
+        CAircraftParts expected;
+        expected.convertFromJson(applyIncrementalObject(previous.toJson(), incremental));
+        const CAircraftParts parts = delta.toParts(previous);
+        QCOMPARE(parts, expected);
+        QVERIFY(!parts.isGearDown());
+        QVERIFY(parts.isOnGround());
+        QCOMPARE(parts.getFlapsPercent(), 25);
+        QVERIFY(!parts.getLights().isLandingOn());
+        QVERIFY(parts.getLights().isStrobeOn());
+        QCOMPARE(parts.getEnginesCount(), 5);
+        QVERIFY(!parts.isEngineOn(2));
+        QVERIFY(parts.isEngineOn(5));
+        QCOMPARE(delta.toJson(), incremental);
+
+        // full packet does not depend on the previous parts
+        const QJsonObject full = previous.toFullJson();
+        const CAircraftPartsDelta fullDelta = CAircraftPartsDelta::fromJson(full);
+        QVERIFY(fullDelta.isFull());
+        QCOMPARE(fullDelta.getAttributesCount(), CAircraftParts::attributesCountFullJson);
+        QCOMPARE(fullDelta.toParts(parts), previous);
+        QCOMPARE(fullDelta.toJson(), full);
+
+        // same as from the parts object
+        const CAircraftPartsDelta partsDelta = CAircraftPartsDelta::fromParts(previous, true);
+        QCOMPARE(partsDelta.toParts(), previous);
+        QCOMPARE(partsDelta.toJson(), full);
+    }
+
+    void CTestAircraftParts::partsDeltaUnknownAttributes()
+    {
+        const CAircraftParts previous = this->testParts1();
+        const QJsonObject incremental = jsonObjectFromString(
+            R"({"is_full_data": false, "spoilers_out": true, "thrust_pct": 80, "lights": {"wing_on": true}, "engines": {"1": {"on": false}, "99": {"on": true}}})");
+        const CAircraftPartsDelta delta = CAircraftPartsDelta::fromJson(incremental);
+        QVERIFY(!delta.isEmpty());
+        QVERIFY(!delta.hasAttribute(CAircraftPartsDelta::Lights));
+
+        const QJsonObject unknown = delta.getUnknownAttributes();
+        QCOMPARE(unknown.size(), 3);
+        QVERIFY(unknown.contains("thrust_pct"));
+        QVERIFY(unknown.value("lights").toObject().contains("wing_on"));
+        QVERIFY(unknown.value("engines").toObject().contains("99"));
+        QCOMPARE(delta.toJson(), incremental);
+
+        const CAircraftParts parts = delta.toParts(previous);
+        QVERIFY(parts.isSpoilersOut());
+        QVERIFY(!parts.isEngineOn(1));
+        QCOMPARE(parts.getEnginesCount(), previous.getEnginesCount());
+        QCOMPARE(parts.getLights(), previous.getLights());
+
+        QVERIFY(CAircraftPartsDelta().isEmpty());
+        QCOMPARE(CAircraftPartsDelta().toParts(previous), previous);
+    }
+
     CAircraftParts CTestAircraftParts::testParts1() const
     {
         const CAircraftLights lights = CAircraftLights::allLightsOn();
@@ -16,13 +16,16 @@
 #include "blackmisc/aviation/altitude.h"
 #include "blackmisc/aviation/atcstation.h"
 #include "blackmisc/aviation/callsign.h"
+#include "blackmisc/aviation/callsignid.h"
 #include "blackmisc/aviation/callsignset.h"
 #include "blackmisc/aviation/comsystem.h"
 #include "blackmisc/aviation/heading.h"
+#include "blackmisc/aviation/icaocodelookup.h"
 #include "blackmisc/aviation/informationmessage.h"
 #include "blackmisc/aviation/navsystem.h"
 #include "blackmisc/aviation/transponder.h"
 #include "blackmisc/mixin/mixincompare.h"
+#include "blackmisc/country.h"
 #include "blackmisc/geo/coordinategeodetic.h"
 #include "blackmisc/geo/latitude.h"
 #include "blackmisc/geo/longitude.h"
@@ -39,6 +42,7 @@
 #include <QString>
 #include <QTest>
 
+using namespace BlackMisc;
 using namespace BlackMisc::Aviation;
 using namespace BlackMisc::PhysicalQuantities;
 using namespace BlackMisc::Network;
@@ -67,6 +71,12 @@ namespace BlackMiscTest
         //! Callsigns and callsign containers
         void callsignWithContainers();
 
+        //! Interned callsign IDs
+        void callsignIds();
+
+        //! Indexed ICAO code lookup vs. list functions
+        void icaoCodeLookup();
+
         //! Testing copying and equality of objects
         void copyAndEqual();
 
@@ -212,6 +222,117 @@ namespace BlackMiscTest
         QVERIFY2(set.size() == 0, "Last should be gone");
     }
 
+    void CTestAviation::callsignIds()
+    {
+        const CCallsign cs1("TSTID_twr");
+        const CCallsign cs2("tstid_TWR");
+        const CCallsign cs3("TSTID123");
+        QCOMPARE(CCallsignIds::find(CCallsign("TSTIDNEVER")), CCallsignIds::InvalidId);
+
+        const int id1 = CCallsignIds::intern(cs1);
+        QVERIFY(id1 >= 0);
+        QCOMPARE(CCallsignIds::intern(cs2), id1); // case insensitive
+        QCOMPARE(CCallsignIds::find(cs2), id1);
+        QCOMPARE(CCallsignIds::callsign(id1), cs1);
+        QVERIFY(CCallsignIds::intern(cs3) != id1);
+        QVERIFY(CCallsignIds::callsign(-1).isEmpty());
+
+        CCallsignIdHash<int> hash;
+        QVERIFY(hash.isEmpty());
+        QVERIFY(!hash.contains(CCallsign("TSTIDNOTINHASH")));
+        hash.insert(cs1, 1);
+        hash[cs3] = 3;
+        QCOMPARE(hash.size(), 2);
+        QVERIFY(hash.contains(cs2));
+        QCOMPARE(hash.value(cs2), 1);
+        QCOMPARE(hash.value(id1), 1);
+        QCOMPARE(hash.value(CCallsign("TSTIDNOTINHASH"), -1), -1);
+        QVERIFY(hash.keys().contains(cs3));
+
+        int sum = 0;
+        for (int v : std::as_const(hash)) { sum += v; }
+        QCOMPARE(sum, 4);
+
+        QCOMPARE(hash.remove(cs2), 1);
+        QCOMPARE(hash.remove(cs2), 0);
+        QCOMPARE(hash.size(), 1);
+        hash.clear();
+        QVERIFY(hash.isEmpty());
+
+        // IDs are released with the last container, and not reused for other callsigns
+        const CCallsign dlh("TSTIDDLH", "Lufthansa");
+        const int countBefore = CCallsignIds::count();
+        {
+            CCallsignIdHash<int> hash1;
+            hash1.insert(dlh, 1);
+            const int id = CCallsignIds::find(dlh);
+            QVERIFY(id >= 0);
+            QCOMPARE(CCallsignIds::count(), countBefore + 1);
+            QVERIFY(CCallsignIds::callsign(id).getTelephonyDesignator().isEmpty()); // only the callsign string
+
+            CCallsignIdHash<int> copy(hash1);
+            QCOMPARE(hash1.remove(dlh), 1);
+            QCOMPARE(CCallsignIds::find(dlh), id); // still in the copy
+            copy.clear();
+            QCOMPARE(CCallsignIds::find(dlh), CCallsignIds::InvalidId);
+            QCOMPARE(CCallsignIds::count(), countBefore);
+            QVERIFY(CCallsignIds::callsign(id).isEmpty());
+
+            hash1[CCallsign("TSTIDOTHER")] = 2;
+            QVERIFY(CCallsignIds::find(CCallsign("TSTIDOTHER")) != id);
+            QVERIFY(CCallsignIds::callsign(id).isEmpty());
+
+            CCallsignIdHash<int> moved(std::move(hash1));
+            QCOMPARE(moved.value(CCallsign("TSTIDOTHER")), 2);
+        }
+        QCOMPARE(CCallsignIds::find(CCallsign("TSTIDOTHER")), CCallsignIds::InvalidId);
+        QCOMPARE(CCallsignIds::count(), countBefore);
+    }
+
+    void CTestAviation::icaoCodeLookup()
+    {
+        CAircraftIcaoCode a320("A320", "L2J");
+        a320.setDbKey(1);
+        a320.setIataCode("320");
+        a320.setFamily("A320");
+        a320.setRank(5);
+        CAircraftIcaoCode a320Best("A320", "L2J");
+        a320Best.setDbKey(2);
+        a320Best.setRank(1);
+        CAircraftIcaoCode b738("B738", "L2J");
+        b738.setDbKey(3);
+        b738.setFamily("B737");
+        CAircraftIcaoCode c172("C172", "L1P");
+        c172.setDbKey(4);
+        const CAircraftIcaoCodeList aircraft({ a320, b738, a320Best, c172 });
+
+        const CAirlineIcaoCode dlh("DLH", "Lufthansa", CCountry("DE", "Germany"), "LUFTHANSA", false, true);
+        const CAirlineIcaoCode vdlh("DLH", "Lufthansa Virtual", CCountry("DE", "Germany"), "LUFTHANSA", true, true);
+        const CAirlineIcaoCode baw("BAW", "British Airways", CCountry("GB", "United Kingdom"), "SPEEDBIRD", false, true);
+        const CAirlineIcaoCodeList airlines({ dlh, baw, vdlh });
+
+        const CIcaoCodeLookup lookup(aircraft, airlines);
+        QCOMPARE(lookup.findAircraftByDesignator("a320"), aircraft.findByDesignator("a320"));
+        QCOMPARE(lookup.findAircraftByDesignator("A320").size(), 2);
+        QCOMPARE(lookup.findFirstAircraftByDesignatorAndRank("A320").getDbKey(), 2);
+        QCOMPARE(lookup.findFirstAircraftByDesignatorAndRank("A320"), aircraft.findFirstByDesignatorAndRank("A320"));
+        QCOMPARE(lookup.findAircraftByIataCode("320"), aircraft.findByIataCode("320"));
+        QCOMPARE(lookup.findAircraftByFamily("B737"), aircraft.findByFamily("B737"));
+        QCOMPARE(lookup.findAircraftByKey(3), b738);
+        QVERIFY(lookup.containsAircraftDesignator("C172"));
+        QVERIFY(!lookup.containsAircraftDesignator("C150"));
+
+        QCOMPARE(lookup.findAirlinesByDesignator("dlh"), airlines.findByDesignator("dlh"));
+        QCOMPARE(lookup.findAirlinesByDesignator("DLH").size(), 2);
+        QCOMPARE(lookup.findAirlinesByVDesignator("VDLH"), airlines.findByVDesignator("VDLH"));
+        QCOMPARE(lookup.findAirlineByUniqueVDesignatorOrDefault("DLH", true), dlh);
+        QCOMPARE(lookup.findAirlinesByTelephonyDesignator("speedbird"), airlines.findByTelephonyDesignator("speedbird"));
+        QCOMPARE(lookup.findBestAirlineMatchByCallsign("BAW123"), baw);
+        QCOMPARE(lookup.findBestAirlineMatchByCallsign("DLH123"), airlines.findBestMatchByCallsign("DLH123"));
+        QVERIFY(lookup.containsAirlineVDesignator("VDLH"));
+        QVERIFY(!lookup.containsAirlineVDesignator("VBAW"));
+    }
+
     void CTestAviation::copyAndEqual()
     {
         const CFrequency f1(123.45, CFrequencyUnit::MHz());
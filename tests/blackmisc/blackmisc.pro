@@ -11,8 +11,10 @@ SUBDIRS += \
     testcontainers \
     testdatastream \
     testdbus \
+    testhttpdiskcache \
     testicon \
     testidentifier \
+    testlatencytrace \
     testlibrarypath \
     testprocess \
     testpropertyindex \
@@ -23,6 +23,7 @@
 #include "blackmisc/pq/pqstring.h"
 #include "blackmisc/pq/pressure.h"
 #include "blackmisc/pq/speed.h"
+#include "blackmisc/pq/staticquantity.h"
 #include "blackmisc/pq/temperature.h"
 #include "blackmisc/pq/time.h"
 #include "blackmisc/pq/units.h"
@@ -85,6 +86,9 @@ namespace BlackMiscTest
 
         //! Test user-defined literals
         void literalsTest();
+
+        //! Compile time unit quantities and interop with runtime units
+        void staticQuantities();
     };
 
     void CTestPhysicalQuantities::unitsBasics()
@@ -449,6 +453,37 @@ namespace BlackMiscTest
         QVERIFY2(510_hrmin == CTime(510, CTimeUnit::hrmin()), "Time needs to be the same");
         QVERIFY2(2637_minsec == CTime(2637, CTimeUnit::minsec()), "Time needs to be the same");
     }
+
+    void CTestPhysicalQuantities::staticQuantities()
+    {
+        // conversion folded at compile time
+        static_assert(CStaticLength::from<StaticUnits::ft>(1000).value<StaticUnits::m>() > 304.79 && CStaticLength::from<StaticUnits::ft>(1000).value<StaticUnits::m>() < 304.81, "Wrong ft factor");
+        static_assert(CStaticSpeed::from<StaticUnits::kts>(3600).value() > 1851.99 && CStaticSpeed::from<StaticUnits::kts>(3600).value() < 1852.01, "Wrong kts factor");
+        static_assert(CStaticLength::from<StaticUnits::km>(1) > CStaticLength::from<StaticUnits::NM>(0.5), "Wrong comparison");
+
+        const CLength l1(1000, CLengthUnit::ft());
+        const CStaticLength sl1(l1);
+        QVERIFY(CMathUtils::epsilonEqual(sl1.value<StaticUnits::m>(), l1.value(CLengthUnit::m())));
+        QVERIFY(CMathUtils::epsilonEqual(sl1.value<StaticUnits::ft>(), 1000.0));
+        QVERIFY2(sl1.toRuntime() == l1, "Roundtrip in default unit");
+        QVERIFY2(sl1.toRuntime(CLengthUnit::ft()).getUnit() == CLengthUnit::ft(), "Roundtrip keeps unit");
+        QVERIFY(CMathUtils::epsilonEqual(sl1.toRuntime(CLengthUnit::ft()).value(), 1000.0));
+
+        const CSpeed s1(100, CSpeedUnit::km_h());
+        const CStaticSpeed ss1(s1);
+        const CStaticSpeed ss2 = CStaticSpeed::from<StaticUnits::kts>(100);
+        QVERIFY(CMathUtils::epsilonEqual((ss1 + ss2).value<StaticUnits::kts>(), (s1 + CSpeed(100, CSpeedUnit::kts())).value(CSpeedUnit::kts())));
+        QVERIFY(CMathUtils::epsilonEqual(CStaticSpeed::interpolate(ss1, ss1 * 3.0, 0.5).value<StaticUnits::km_h>(), 200.0));
+        QVERIFY(CMathUtils::epsilonEqual(ss2 / ss2, 1.0));
+        QVERIFY(ss2 > ss1);
+
+        const CAngle a1(M_PI, CAngleUnit::rad());
+        QVERIFY(CMathUtils::epsilonEqual(CStaticAngle(a1).value<StaticUnits::deg>(), 180.0));
+        QVERIFY(CMathUtils::epsilonEqual(CStaticAngle::from<StaticUnits::deg>(90).value<StaticUnits::rad>(), M_PI / 2.0));
+
+        // null maps to 0
+        QVERIFY(CMathUtils::epsilonEqual(CStaticLength(CLength::null()).value(), 0.0));
+    }
 } // namespace
 
 //! main
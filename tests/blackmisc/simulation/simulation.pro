@@ -1,6 +1,9 @@
 TEMPLATE = subdirs
 SUBDIRS += \
+    testinterpolationlogger \
     testinterpolatorlinear \
     testinterpolatormisc \
     testinterpolatorparts \
+    testmodelstringdictionary \
     testxplane \
+    testxplanesharedtraffic \
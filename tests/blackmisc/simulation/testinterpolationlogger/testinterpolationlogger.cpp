@@ -0,0 +1,358 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/interpolationlogger.h"
+#include "blackmisc/simulation/interpolationlogrecord.h"
+#include "blackmisc/aviation/heading.h"
+#include "blackmisc/geo/elevationplane.h"
+#include "blackmisc/pq/units.h"
+#include "blackmisc/seqlockringbuffer.h"
+#include "test.h"
+
+#include <QBuffer>
+#include <QElapsedTimer>
+#include <QTest>
+#include <QThread>
+#include <QtDebug>
+#include <algorithm>
+
+using namespace BlackMisc;
+using namespace BlackMisc::Aviation;
+using namespace BlackMisc::Geo;
+using namespace BlackMisc::PhysicalQuantities;
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Interpolation logger, records, ring buffer and dump
+    class CTestInterpolationLogger : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Situation log to record and back
+        void situationRecord();
+
+        //! Parts log to record and back
+        void partsRecord();
+
+        //! Ring buffer overwriting the oldest records
+        void ringBuffer();
+
+        //! Dump written and read again
+        void dump();
+
+        //! Logging and reading the logs
+        void logger();
+
+        //! Time needed for logging, several callsigns and threads
+        void loggingOverhead();
+
+    private:
+        //! Test situation
+        static CAircraftSituation situation(const CCallsign &cs, int number);
+
+        //! Test log
+        static SituationLog situationLog(const CCallsign &cs, int number);
+
+        //! Test parts log
+        static PartsLog partsLog(const CCallsign &cs, int number);
+    };
+
+    CAircraftSituation CTestInterpolationLogger::situation(const CCallsign &cs, int number)
+    {
+        CAircraftSituation s(cs);
+        s.setMSecsSinceEpoch(1425000000000 + number * 5000);
+        s.setTimeOffsetMs(6000);
+        s.setPosition(CCoordinateGeodetic(48.0 + number * 0.01, 11.0 + number * 0.01, 1000.0 + number));
+        s.setGroundElevation(CElevationPlane(48.0, 11.0, 500.0, CLength(100, CLengthUnit::m())), CAircraftSituation::FromProvider);
+        s.setPitch(CAngle(2, CAngleUnit::deg()));
+        s.setBank(CAngle(-5, CAngleUnit::deg()));
+        s.setHeading(CHeading(270, CHeading::True, CAngleUnit::deg()));
+        s.setGroundSpeed(CSpeed(120 + number, CSpeedUnit::kts()));
+        s.setOnGround(CAircraftSituation::NotOnGround, CAircraftSituation::InFromNetwork);
+        s.setOnGroundFactor(0.0);
+        return s;
+    }
+
+    SituationLog CTestInterpolationLogger::situationLog(const CCallsign &cs, int number)
+    {
+        SituationLog log;
+        log.callsign = cs;
+        log.interpolator = 's';
+        log.tsCurrent = 1425000000000 + number * 100;
+        log.tsInterpolated = log.tsCurrent - 6000;
+        log.groundFactor = 0.25;
+        log.simTimeFraction = 0.5;
+        log.deltaSampleTimesMs = 5000;
+        log.useParts = true;
+        log.interpolantRecalc = (number % 2) == 0;
+        log.noNetworkSituations = 3;
+        log.elevationInfo = "elevation from provider";
+        log.altCorrection = "no correction";
+        log.cgAboveGround = CLength(5, CLengthUnit::ft());
+        log.interpolationSituations.push_back(situation(cs, number));
+        log.interpolationSituations.push_back(situation(cs, number + 1));
+        log.interpolationSituations.push_back(situation(cs, number + 2));
+        log.interpolationSituations.push_back(situation(cs, number + 3));
+        log.situationCurrent = situation(cs, number + 2);
+        log.parts = partsLog(cs, number).parts;
+        return log;
+    }
+
+    PartsLog CTestInterpolationLogger::partsLog(const CCallsign &cs, int number)
+    {
+        CAircraftParts parts(CAircraftLights(true, false, true, false, true, false), true, 20 + number % 10, false, CAircraftEngineList(), true);
+        CAircraftEngineList engines;
+        engines.initEngines(4, true);
+        engines.setEngineOn(2, false);
+        parts.setEngines(engines);
+        parts.setMSecsSinceEpoch(1425000000000 + number * 100);
+
+        PartsLog log;
+        log.callsign = cs;
+        log.tsCurrent = parts.getMSecsSinceEpoch();
+        log.noNetworkParts = 2;
+        log.parts = parts;
+        return log;
+    }
+
+    void CTestInterpolationLogger::situationRecord()
+    {
+        const SituationLog log = situationLog("DAMBZ", 1);
+        const SituationLog restored = SituationLogRecord::fromLog(log).toLog();
+
+        QCOMPARE(restored.callsign, log.callsign);
+        QCOMPARE(restored.interpolator, log.interpolator);
+        QCOMPARE(restored.tsCurrent, log.tsCurrent);
+        QCOMPARE(restored.tsInterpolated, log.tsInterpolated);
+        QCOMPARE(restored.groundFactor, log.groundFactor);
+        QCOMPARE(restored.interpolantRecalc, log.interpolantRecalc);
+        QCOMPARE(restored.elevationInfo, log.elevationInfo);
+        QCOMPARE(restored.altCorrection, log.altCorrection);
+        QVERIFY(restored.sceneryOffset.isNull());
+        QCOMPARE(restored.cgAboveGround.value(CLengthUnit::ft()), 5.0);
+
+        // only the latest 3 situations are kept
+        QCOMPARE(restored.interpolationSituations.size(), 3);
+        QCOMPARE(restored.oldestInterpolationSituation().getMSecsSinceEpoch(), log.interpolationSituations[1].getMSecsSinceEpoch());
+        QCOMPARE(restored.newestInterpolationSituation().getAdjustedMSecsSinceEpoch(), log.newestInterpolationSituation().getAdjustedMSecsSinceEpoch());
+
+        const CAircraftSituation &s1 = log.situationCurrent;
+        const CAircraftSituation &s2 = restored.situationCurrent;
+        QVERIFY(qAbs(s1.latitude().value(CAngleUnit::deg()) - s2.latitude().value(CAngleUnit::deg())) < 1e-6);
+        QVERIFY(qAbs(s1.longitude().value(CAngleUnit::deg()) - s2.longitude().value(CAngleUnit::deg())) < 1e-6);
+        QVERIFY(qAbs(s1.getAltitude().value(CLengthUnit::ft()) - s2.getAltitude().value(CLengthUnit::ft())) < 1e-3);
+        QVERIFY(qAbs(s1.getGroundElevation().value(CLengthUnit::ft()) - s2.getGroundElevation().value(CLengthUnit::ft())) < 1e-3);
+        QCOMPARE(s2.getGroundElevationInfo(), s1.getGroundElevationInfo());
+        QCOMPARE(s2.getHeading().value(CAngleUnit::deg()), 270.0);
+        QCOMPARE(s2.getGroundSpeed().value(CSpeedUnit::kts()), s1.getGroundSpeed().value(CSpeedUnit::kts()));
+        QCOMPARE(s2.getOnGround(), s1.getOnGround());
+        QCOMPARE(s2.getOnGroundDetails(), s1.getOnGroundDetails());
+        QCOMPARE(s2.getCallsign(), log.callsign);
+
+        // null situation stays null
+        SituationLog empty;
+        empty.callsign = "DAMBZ";
+        QVERIFY(SituationLogRecord::fromLog(empty).toLog().situationCurrent.isNull());
+    }
+
+    void CTestInterpolationLogger::partsRecord()
+    {
+        const PartsLog log = partsLog("DAMBZ", 3);
+        const PartsLog restored = PartsLogRecord::fromLog(log).toLog();
+        QCOMPARE(restored.callsign, log.callsign);
+        QCOMPARE(restored.tsCurrent, log.tsCurrent);
+        QCOMPARE(restored.noNetworkParts, log.noNetworkParts);
+        QVERIFY(restored.parts.equalValues(log.parts));
+        QCOMPARE(restored.parts.getEnginesCount(), 4);
+        QVERIFY(!restored.parts.isEngineOn(2));
+        QVERIFY(restored.parts.isEngineOn(3));
+        QVERIFY(restored.parts.getLights().isTaxiOn());
+        QVERIFY(!restored.parts.getLights().isLandingOn());
+
+        PartsLog nullParts;
+        nullParts.parts = CAircraftParts::null();
+        QVERIFY(PartsLogRecord::fromLog(nullParts).toLog().parts.isNull());
+    }
+
+    void CTestInterpolationLogger::ringBuffer()
+    {
+        CSeqLockRingBuffer<int, 8> ring;
+        QVERIFY(ring.toVector().isEmpty());
+        int latest = -1;
+        QVERIFY(!ring.latest(latest));
+
+        for (int i = 0; i < 5; i++) { ring.push(i); }
+        QCOMPARE(ring.toVector(), QVector<int>({ 0, 1, 2, 3, 4 }));
+
+        // wrap around, oldest overwritten
+        for (int i = 5; i < 20; i++) { ring.push(i); }
+        QCOMPARE(ring.written(), 20ull);
+        QCOMPARE(ring.toVector(), QVector<int>({ 12, 13, 14, 15, 16, 17, 18, 19 }));
+        QVERIFY(ring.latest(latest));
+        QCOMPARE(latest, 19);
+
+        // continue where a reader stopped, lost records are skipped
+        QVector<int> records;
+        quint64 next = ring.copyFrom(17, records);
+        QCOMPARE(next, 20ull);
+        QCOMPARE(records, QVector<int>({ 17, 18, 19 }));
+        records.clear();
+        next = ring.copyFrom(next, records);
+        QCOMPARE(next, 20ull);
+        QVERIFY(records.isEmpty());
+        next = ring.copyFrom(2, records);
+        QCOMPARE(records.size(), 8);
+        QCOMPARE(records.front(), 12);
+
+        ring.clear();
+        QVERIFY(ring.toVector().isEmpty());
+        QVERIFY(!ring.latest(latest));
+        ring.push(20);
+        QCOMPARE(ring.toVector(), QVector<int>({ 20 }));
+        QCOMPARE(ring.dropped(), 0ull);
+    }
+
+    void CTestInterpolationLogger::dump()
+    {
+        QVector<SituationLogRecord> situations;
+        QVector<PartsLogRecord> parts;
+        for (int i = 0; i < 10; i++)
+        {
+            situations.push_back(SituationLogRecord::fromLog(situationLog("DAMBZ", i)));
+            parts.push_back(PartsLogRecord::fromLog(partsLog("DLH123", i)));
+        }
+
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        QVERIFY(CInterpolationLogDump::writeHeader(buffer));
+        QVERIFY(CInterpolationLogDump::writeSituations(buffer, situations.mid(0, 4)));
+        QVERIFY(CInterpolationLogDump::writePartsRecords(buffer, parts));
+        QVERIFY(CInterpolationLogDump::writeSituations(buffer, situations.mid(4)));
+        QVERIFY(CInterpolationLogDump::writeSituations(buffer, {}));
+        buffer.close();
+
+        QVector<SituationLogRecord> readSituations;
+        QVector<PartsLogRecord> readParts;
+        buffer.open(QIODevice::ReadOnly);
+        QVERIFY(CInterpolationLogDump::read(buffer, readSituations, readParts));
+        buffer.close();
+        QCOMPARE(readSituations.size(), 10);
+        QCOMPARE(readParts.size(), 10);
+        for (int i = 0; i < 10; i++)
+        {
+            QCOMPARE(readSituations[i].tsCurrent, situations[i].tsCurrent);
+            QCOMPARE(readSituations[i].toLog().callsign.asString(), QString("DAMBZ"));
+            QCOMPARE(readParts[i].toLog().parts.getFlapsPercent(), parts[i].parts.flapsPercent);
+        }
+
+        // truncated last block is ignored
+        QByteArray truncated = buffer.data();
+        truncated.chop(10);
+        QBuffer truncatedBuffer(&truncated);
+        truncatedBuffer.open(QIODevice::ReadOnly);
+        readSituations.clear();
+        readParts.clear();
+        QVERIFY(CInterpolationLogDump::read(truncatedBuffer, readSituations, readParts));
+        QCOMPARE(readSituations.size(), 4);
+        QCOMPARE(readParts.size(), 10);
+
+        // no header
+        QByteArray noHeader("no dump");
+        QBuffer noHeaderBuffer(&noHeader);
+        noHeaderBuffer.open(QIODevice::ReadOnly);
+        QVERIFY(!CInterpolationLogDump::read(noHeaderBuffer, readSituations, readParts));
+    }
+
+    void CTestInterpolationLogger::logger()
+    {
+        CInterpolationLogger logger;
+        QVERIFY(logger.getSituationsLog().isEmpty());
+        QCOMPARE(logger.getLastSituationLog().tsCurrent, Q_INT64_C(-1));
+
+        const int number = CInterpolationLogger::SituationRingCapacity + 10;
+        for (int i = 0; i < number; i++)
+        {
+            logger.logInterpolation(situationLog("DAMBZ", i));
+            logger.logInterpolation(situationLog("DLH123", i));
+        }
+        logger.logParts(partsLog("DAMBZ", 1));
+
+        // ring buffers keep the latest logs per callsign
+        QCOMPARE(logger.getSituationsLog("DAMBZ").size(), CInterpolationLogger::SituationRingCapacity);
+        QCOMPARE(logger.getSituationsLog().size(), 2 * CInterpolationLogger::SituationRingCapacity);
+        QCOMPARE(logger.getSituationsLog("DAMBZ").last().tsCurrent, situationLog("DAMBZ", number - 1).tsCurrent);
+        QCOMPARE(logger.getLastSituationLog().callsign, CCallsign("DLH123"));
+        QCOMPARE(logger.getLastSituationLog("DAMBZ").interpolationSituations.size(), 4); // complete log
+        QCOMPARE(logger.getPartsLog("DAMBZ").size(), 1);
+        QVERIFY(logger.getPartsLog("DLH123").isEmpty());
+        QCOMPARE(logger.getLastPartsLog().callsign, CCallsign("DAMBZ"));
+
+        logger.clearLog();
+        QVERIFY(logger.getSituationsLog().isEmpty());
+        QVERIFY(logger.getPartsLog().isEmpty());
+        QCOMPARE(logger.getLastSituationLog("DAMBZ").tsCurrent, Q_INT64_C(-1));
+        logger.logInterpolation(situationLog("DAMBZ", 1));
+        QCOMPARE(logger.getSituationsLog().size(), 1);
+    }
+
+    void CTestInterpolationLogger::loggingOverhead()
+    {
+        // the interpolator logs once per callsign and update,
+        // logging must not add noticeable time to the interpolation it is meant to measure
+        constexpr int Callsigns = 8;
+        constexpr int LogsPerCallsign = 2000;
+        CInterpolationLogger logger;
+        QList<SituationLog> logs;
+        for (int c = 0; c < Callsigns; c++) { logs.push_back(situationLog(CCallsign(QStringLiteral("SWIFT%1").arg(c)), c)); }
+
+        QElapsedTimer time;
+        time.start();
+        for (int i = 0; i < LogsPerCallsign; i++)
+        {
+            for (const SituationLog &log : std::as_const(logs)) { logger.logInterpolation(log); }
+        }
+        const double nsPerLog = static_cast<double>(time.nsecsElapsed()) / (Callsigns * LogsPerCallsign);
+
+        // one thread per callsign while a reader copies the logs
+        QList<QThread *> threads;
+        for (const SituationLog &log : std::as_const(logs))
+        {
+            threads.push_back(QThread::create([&logger, log]
+            {
+                for (int i = 0; i < LogsPerCallsign; i++) { logger.logInterpolation(log); }
+            }));
+        }
+        time.restart();
+        for (QThread *thread : std::as_const(threads)) { thread->start(); }
+        int reads = 0;
+        while (std::any_of(threads.cbegin(), threads.cend(), [](const QThread * t) { return !t->isFinished(); }))
+        {
+            QVERIFY(logger.getSituationsLog().size() <= Callsigns * CInterpolationLogger::SituationRingCapacity);
+            reads++;
+        }
+        for (QThread *thread : std::as_const(threads)) { thread->wait(); delete thread; }
+        const double nsPerLogThreaded = static_cast<double>(time.nsecsElapsed()) / (Callsigns * LogsPerCallsign);
+
+        qInfo() << "Interpolation logging:" << qRound(nsPerLog) << "ns per log," << qRound(nsPerLogThreaded) << "ns per log with" << Callsigns << "threads and" << reads << "reads";
+        QCOMPARE(logger.getSituationsLog().size(), Callsigns * CInterpolationLogger::SituationRingCapacity);
+        QVERIFY2(nsPerLog < 100000, "Logging takes more than 100us");
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestInterpolationLogger);
+
+#include "testinterpolationlogger.moc"
+
+//! \endcond
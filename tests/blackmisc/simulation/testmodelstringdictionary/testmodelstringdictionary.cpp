@@ -0,0 +1,155 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/modelstringdictionary.h"
+#include "blackmisc/simulation/aircraftmodellist.h"
+#include "test.h"
+
+#include <QStringList>
+#include <QTest>
+
+using namespace BlackMisc::Simulation;
+
+namespace BlackMiscTest
+{
+    //! Model string dictionary tests
+    class CTestModelStringDictionary : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Exact lookups
+        void exactLookup();
+
+        //! Prefix lookups
+        void prefixLookup();
+
+        //! Removing strings and models
+        void remove();
+
+        //! Same results as the CAircraftModelList functions
+        void compareWithModelList();
+
+    private:
+        //! Model with DB key
+        static CAircraftModel model(const QString &modelString, int dbKey);
+
+        //! Some models
+        static CAircraftModelList models();
+    };
+
+    CAircraftModel CTestModelStringDictionary::model(const QString &modelString, int dbKey)
+    {
+        CAircraftModel m(modelString, CAircraftModel::TypeDatabaseEntry);
+        m.setDbKey(dbKey);
+        return m;
+    }
+
+    CAircraftModelList CTestModelStringDictionary::models()
+    {
+        return CAircraftModelList(
+        {
+            model("AI A320 Lufthansa", 1), model("AI A320 Condor", 2), model("AI A321 Lufthansa", 3),
+            model("AI A3", 4), model("Boeing 737-800 KLM", 5), model("Boeing 737", 6), model("B", 7)
+        });
+    }
+
+    void CTestModelStringDictionary::exactLookup()
+    {
+        const CModelStringDictionary dictionary(models());
+        QCOMPARE(dictionary.size(), 7);
+        QVERIFY(dictionary.contains("ai a320 condor"));
+        QVERIFY(dictionary.contains("AI A3"));
+        QVERIFY(!dictionary.contains("AI A"));
+        QVERIFY(!dictionary.contains(""));
+        QCOMPARE(dictionary.findFirstByModelStringOrDefault("boeing 737").getDbKey(), 6);
+        QVERIFY(!dictionary.findFirstByModelStringOrDefault("boeing 73").hasModelString());
+
+        const CModelStringDictionary strings(QStringList({ "Foo", "BAR" }));
+        QVERIFY(strings.contains("foo"));
+        QVERIFY(strings.contains("bar"));
+        QVERIFY(!strings.findFirstByModelStringOrDefault("foo").hasModelString());
+        QCOMPARE(strings.findModelStringsStartingWith("F"), QStringList({ "Foo" })); // as first added, not folded
+    }
+
+    void CTestModelStringDictionary::prefixLookup()
+    {
+        const CModelStringDictionary dictionary(models());
+        QCOMPARE(dictionary.findModelStringsStartingWith("ai a32"), QStringList({ "AI A320 CONDOR", "AI A320 LUFTHANSA", "AI A321 LUFTHANSA" }));
+        QCOMPARE(dictionary.findModelStringsStartingWith("AI A3").size(), 4);
+        QCOMPARE(dictionary.findModelStringsStartingWith("AI A3", 2).size(), 2);
+        QCOMPARE(dictionary.findModelStringsStartingWith("b"), QStringList({ "B", "BOEING 737", "BOEING 737-800 KLM" }));
+        QCOMPARE(dictionary.findModelStringsStartingWith("").size(), 7);
+        QVERIFY(dictionary.findModelStringsStartingWith("AI A33").isEmpty());
+        QVERIFY(dictionary.findModelStringsStartingWith("BOEING 737-800 KLM X").isEmpty());
+        QVERIFY(dictionary.containsPrefix("boeing 737-8"));
+        QVERIFY(!dictionary.containsPrefix("airbus"));
+        QCOMPARE(dictionary.findModelsStartingWith("ai a321").size(), 1);
+    }
+
+    void CTestModelStringDictionary::remove()
+    {
+        CModelStringDictionary dictionary(models());
+        QVERIFY(dictionary.removeModelString("ai a3"));
+        QVERIFY(!dictionary.removeModelString("ai a3"));
+        QVERIFY(!dictionary.contains("AI A3"));
+        QCOMPARE(dictionary.findModelStringsStartingWith("AI A3").size(), 3);
+
+        // edges are merged again, prefixes still found
+        QVERIFY(dictionary.removeModelString("AI A320 CONDOR"));
+        QCOMPARE(dictionary.findModelStringsStartingWith("AI A32"), QStringList({ "AI A320 LUFTHANSA", "AI A321 LUFTHANSA" }));
+        QCOMPARE(dictionary.findModelStringsStartingWith("AI A320 L"), QStringList({ "AI A320 LUFTHANSA" }));
+
+        // same string, other DB key
+        dictionary.insert(model("Boeing 737", 8));
+        QCOMPARE(dictionary.findByModelString("BOEING 737").size(), 2);
+        QVERIFY(dictionary.removeModel(model("Boeing 737", 6)));
+        QCOMPARE(dictionary.findFirstByModelStringOrDefault("BOEING 737").getDbKey(), 8);
+        QVERIFY(dictionary.removeModel(model("Boeing 737", 8)));
+        QVERIFY(!dictionary.contains("BOEING 737"));
+        QVERIFY(dictionary.contains("BOEING 737-800 KLM"));
+
+        QCOMPARE(dictionary.removeModelStrings(models()), 4);
+        QVERIFY(dictionary.isEmpty());
+        QVERIFY(dictionary.findModelStringsStartingWith("").isEmpty());
+
+        dictionary.insert(models());
+        QCOMPARE(dictionary.size(), 7);
+        QCOMPARE(dictionary.findModelStringsStartingWith("ai").size(), 4);
+    }
+
+    void CTestModelStringDictionary::compareWithModelList()
+    {
+        const CAircraftModelList modelList = models();
+        const CModelStringDictionary dictionary(modelList);
+        const QStringList candidates({ "ai a320 condor", "AI A3", "AI", "b", "Boeing 737-800 klm", "xyz", "" });
+        for (const QString &candidate : candidates)
+        {
+            QCOMPARE(dictionary.contains(candidate), modelList.containsModelString(candidate));
+            QCOMPARE(dictionary.findFirstByModelStringOrDefault(candidate), modelList.findFirstByModelStringOrDefault(candidate));
+            QCOMPARE(dictionary.findModelsStartingWith(candidate).size(), modelList.findModelsStartingWith(candidate).size());
+        }
+
+        const QStringList strings({ "ai a320 condor", "b", "unknown" });
+        QCOMPARE(modelList.findByModelStrings(strings, Qt::CaseInsensitive).size(), 2);
+        QCOMPARE(modelList.findByNotInModelStrings(strings, Qt::CaseInsensitive).size(), 5);
+        QCOMPARE(modelList.findByModelStrings(strings, Qt::CaseSensitive).size(), 0);
+        QCOMPARE(modelList.findByNotInModelStrings(strings, Qt::CaseSensitive).size(), 7);
+    }
+} // namespace
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackMiscTest::CTestModelStringDictionary);
+
+#include "testmodelstringdictionary.moc"
+
+//! \endcond
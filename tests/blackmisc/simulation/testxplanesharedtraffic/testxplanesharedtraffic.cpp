@@ -0,0 +1,229 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/simulation/xplane/sharedtraffic.h"
+#include "test.h"
+
+#include <QCoreApplication>
+#include <QTest>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+
+using namespace BlackMisc::Simulation::XPlane::SharedTraffic;
+
+namespace BlackMiscTest
+{
+    //! Replaces XSwiftBus and X-Plane: applies the plane records and answers remote data requests like CTraffic
+    class CStubConsumer
+    {
+    public:
+        //! Open the memory and start consuming
+        bool start(const std::string &name)
+        {
+            if (!m_memory.open(name)) { return false; }
+            m_thread = std::thread([this] { this->run(); });
+            return true;
+        }
+
+        //! Stop consuming
+        void stop()
+        {
+            m_stop = true;
+            if (m_thread.joinable()) { m_thread.join(); }
+        }
+
+        //! Latest state per plane ID, only valid after stop
+        const std::map<int, PlaneRecord> &planes() const { return m_planes; }
+
+        //! Records consumed, only valid after stop
+        int consumed() const { return m_consumed; }
+
+    private:
+        void run()
+        {
+            CRing<PlaneRecord> planes = m_memory.planes();
+            CRing<RemoteDataRecord> remoteData = m_memory.remoteData();
+            PlaneRecord record;
+            while (!m_stop || planes.size() > 0)
+            {
+                if (!planes.pop(record)) { std::this_thread::yield(); continue; }
+                m_consumed++;
+                PlaneRecord &plane = m_planes[record.planeId];
+                plane.planeId = record.planeId;
+                plane.flags |= record.flags;
+                if (record.flags & HasPosition)
+                {
+                    plane.latitudeDeg = record.latitudeDeg;
+                    plane.longitudeDeg = record.longitudeDeg;
+                    plane.altitudeFt = record.altitudeFt;
+                }
+                if (record.flags & HasTransponder) { plane.transponderCode = record.transponderCode; }
+                if (record.flags & RequestsRemoteData)
+                {
+                    RemoteDataRecord data;
+                    data.planeId = record.planeId;
+                    data.latitudeDeg = plane.latitudeDeg;
+                    data.longitudeDeg = plane.longitudeDeg;
+                    data.elevationM = 100.0 + record.planeId;
+                    data.isWater = record.planeId % 2;
+                    while (!remoteData.push(data)) { std::this_thread::yield(); }
+                }
+            }
+        }
+
+        CSharedTraffic m_memory;
+        std::thread m_thread;
+        std::atomic_bool m_stop { false };
+        std::map<int, PlaneRecord> m_planes;
+        int m_consumed = 0;
+    };
+
+    //! Shared memory transport between the X-Plane driver and XSwiftBus
+    class CTestXPlaneSharedTraffic : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Skip if not supported
+        void initTestCase();
+
+        //! Only matching memory can be opened, the creator removes it
+        void openAndClose();
+
+        //! Full rings drop and count, wrap around
+        void ring();
+
+        //! Updates and remote data requests via the stub consumer
+        void stubConsumer();
+
+    private:
+        //! Unique memory name per test
+        static std::string memoryName(const char *test) { return CSharedTraffic::memoryName(QCoreApplication::applicationPid()) + "_" + test; }
+    };
+
+    void CTestXPlaneSharedTraffic::initTestCase()
+    {
+        if (!CSharedTraffic::isSupported()) { QSKIP("Shared traffic memory not supported on this platform"); }
+    }
+
+    void CTestXPlaneSharedTraffic::openAndClose()
+    {
+        const std::string name = memoryName("open");
+        CSharedTraffic consumer;
+        QVERIFY(!consumer.open(name));
+
+        CSharedTraffic producer;
+        QVERIFY(producer.create(name, 16));
+        QVERIFY(producer.isOpen());
+        QCOMPARE(producer.getCapacity(), 16u);
+        QVERIFY(consumer.open(name));
+        QCOMPARE(consumer.getCapacity(), 16u);
+
+        // records written on one side are read on the other
+        PlaneRecord record;
+        record.planeId = 7;
+        QVERIFY(producer.planes().push(record));
+        QCOMPARE(consumer.planes().size(), static_cast<std::uint64_t>(1));
+        QVERIFY(consumer.planes().pop(record));
+        QCOMPARE(record.planeId, 7);
+
+        consumer.close();
+        producer.close();
+        QVERIFY(!consumer.open(name));
+    }
+
+    void CTestXPlaneSharedTraffic::ring()
+    {
+        CSharedTraffic memory;
+        QVERIFY(memory.create(memoryName("ring"), 4));
+        CRing<PlaneRecord> planes = memory.planes();
+
+        PlaneRecord record;
+        for (int round = 0; round < 3; ++round)
+        {
+            for (int i = 0; i < 4; ++i) { record.planeId = i; QVERIFY(planes.push(record)); }
+            record.planeId = 99;
+            QVERIFY(!planes.push(record));
+            for (int i = 0; i < 4; ++i) { QVERIFY(planes.pop(record)); QCOMPARE(record.planeId, i); }
+            QVERIFY(!planes.pop(record));
+        }
+        QCOMPARE(planes.dropped(), static_cast<std::uint64_t>(3));
+        QCOMPARE(memory.remoteData().size(), static_cast<std::uint64_t>(0));
+    }
+
+    void CTestXPlaneSharedTraffic::stubConsumer()
+    {
+        const std::string name = memoryName("stub");
+        CSharedTraffic producer;
+        QVERIFY(producer.create(name, 64));
+        CStubConsumer consumer;
+        QVERIFY(consumer.start(name));
+
+        constexpr int Planes = 50;
+        constexpr int Frames = 100;
+        CRing<PlaneRecord> planes = producer.planes();
+        int sent = 0;
+        for (int frame = 0; frame < Frames; ++frame)
+        {
+            for (int id = 0; id < Planes; ++id)
+            {
+                PlaneRecord record;
+                record.planeId = id;
+                record.flags = HasPosition | HasTransponder;
+                record.latitudeDeg = frame;
+                record.longitudeDeg = id;
+                record.transponderCode = 1000 + id;
+                if (frame == Frames - 1) { record.flags |= RequestsRemoteData; }
+                while (!planes.push(record)) { std::this_thread::yield(); } // the test must not lose the last frame
+                sent++;
+            }
+        }
+
+        // answers for the last frame
+        CRing<RemoteDataRecord> remoteData = producer.remoteData();
+        std::map<int, RemoteDataRecord> answers;
+        const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (static_cast<int>(answers.size()) < Planes && std::chrono::steady_clock::now() < timeout)
+        {
+            RemoteDataRecord data;
+            if (remoteData.pop(data)) { answers[data.planeId] = data; }
+            else { std::this_thread::yield(); }
+        }
+        consumer.stop();
+
+        QCOMPARE(consumer.consumed(), sent);
+        QCOMPARE(static_cast<int>(consumer.planes().size()), Planes);
+        QCOMPARE(static_cast<int>(answers.size()), Planes);
+        for (int id = 0; id < Planes; ++id)
+        {
+            const PlaneRecord &plane = consumer.planes().at(id);
+            QCOMPARE(plane.latitudeDeg, static_cast<double>(Frames - 1));
+            QCOMPARE(plane.longitudeDeg, static_cast<double>(id));
+            QCOMPARE(plane.transponderCode, 1000 + id);
+
+            const RemoteDataRecord &data = answers.at(id);
+            QCOMPARE(data.elevationM, 100.0 + id);
+            QCOMPARE(data.isWater, static_cast<std::uint32_t>(id % 2));
+            QCOMPARE(data.latitudeDeg, static_cast<double>(Frames - 1));
+        }
+    }
+} // ns
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestXPlaneSharedTraffic);
+
+#include "testxplanesharedtraffic.moc"
+
+//! \endcond
@@ -0,0 +1,30 @@
+load(common_pre)
+
+QT += core dbus testlib
+
+TARGET = testxplanesharedtraffic
+CONFIG   -= app_bundle
+CONFIG   += blackconfig
+CONFIG   += blackmisc
+CONFIG   += testcase
+CONFIG   += no_testcase_installs
+
+TEMPLATE = app
+
+DEPENDPATH += \
+    . \
+    $$SourceRoot/src \
+    $$SourceRoot/tests \
+
+INCLUDEPATH += \
+    $$SourceRoot/src \
+    $$SourceRoot/tests \
+
+SOURCES += testxplanesharedtraffic.cpp
+
+# shm_open
+linux: LIBS += -lrt
+
+DESTDIR = $$DestRoot/bin
+
+load(common_post)
@@ -36,6 +36,7 @@
 #include <QVector>
 #include <QtGlobal>
 #include <algorithm>
+#include <cstdlib>
 #include <iterator>
 #include <set>
 #include <vector>
@@ -66,6 +67,7 @@ namespace BlackMiscTest
         void joinAndSplit();
         void findTests();
         void sortTests();
+        void projectionTests();
         void removeTests();
         void dictionaryBasics();
         void timestampList();
@@ -201,6 +203,29 @@ namespace BlackMiscTest
         QVERIFY2(list.sortedBy(&Person::getAge, &Person::getName) == sorted, "sort by multiple members");
     }
 
+    void CTestContainers::projectionTests()
+    {
+        const CSequence<int> base { 5, -9, 3, 8, -1, 7, -4 };
+        const auto absolute = [](int i) { return std::abs(i); };
+
+        CSequence<int> sorted = base;
+        sorted.sortByProjection(absolute);
+        QVERIFY2(sorted == CSequence<int>({ -1, 3, -4, 5, 7, 8, -9 }), "sortByProjection");
+
+        CSequence<int> partial = base;
+        partial.partiallySortByProjection(3, absolute);
+        QVERIFY2(partial.frontOrDefault() == -1 && partial[1] == 3 && partial[2] == -4, "partiallySortByProjection");
+        QVERIFY2(partial.size() == base.size(), "partiallySortByProjection size");
+
+        QVERIFY2(base.smallestByProjection(2, absolute) == CSequence<int>({ -1, 3 }), "smallestByProjection");
+        QVERIFY2(base.smallestByProjection(20, absolute) == sorted, "smallestByProjection more than size");
+        QVERIFY2(base.smallestByProjection(0, absolute).isEmpty(), "smallestByProjection none");
+
+        const auto negative = base.filteredView([](int i) { return i < 0; });
+        QVERIFY2(negative.size() == 3, "filteredView");
+        QVERIFY2(CSequence<int>(negative.begin(), negative.end()) == CSequence<int>({ -9, -1, -4 }), "filteredView order");
+    }
+
     void CTestContainers::removeTests()
     {
         const CSequence<int> base { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
@@ -0,0 +1,240 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/network/httpdiskcache.h"
+#include "blackmisc/network/networkutils.h"
+#include "blackmisc/network/urlloglist.h"
+#include "test.h"
+
+#include <QByteArray>
+#include <QHostAddress>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QSignalSpy>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTemporaryDir>
+#include <QTest>
+
+using namespace BlackMisc::Network;
+
+namespace BlackMiscTest
+{
+    //! Minimal HTTP server answering with one fixed body, "304 not modified" for matching validators
+    class CHttpStub : public QObject
+    {
+        Q_OBJECT
+
+    public:
+        //! Constructor
+        CHttpStub(QObject *parent = nullptr) : QObject(parent)
+        {
+            connect(&m_server, &QTcpServer::newConnection, this, &CHttpStub::onNewConnection);
+            m_server.listen(QHostAddress::LocalHost);
+        }
+
+        //! URL of a path
+        QUrl url(const QString &path) const { return QUrl(QStringLiteral("http://127.0.0.1:%1%2").arg(m_server.serverPort()).arg(path)); }
+
+        //! Body returned by the server
+        static const QByteArray &body() { static const QByteArray b(QByteArray("swift data file\n").repeated(200)); return b; }
+
+        //! Headers of the last request, lower case names
+        QByteArray lastRequestHeader(const QByteArray &name) const { return m_lastRequest.value(name); }
+
+        //! Bytes of bodies sent so far
+        int bodyBytesSent() const { return m_bodyBytesSent; }
+
+        //! Requests answered with "304 not modified"
+        int notModifiedSent() const { return m_notModifiedSent; }
+
+    private:
+        void onNewConnection()
+        {
+            while (QTcpSocket *socket = m_server.nextPendingConnection())
+            {
+                connect(socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater);
+                connect(socket, &QTcpSocket::readyRead, this, [this, socket]
+                {
+                    m_buffer[socket] += socket->readAll();
+                    if (!m_buffer[socket].contains("\r\n\r\n")) { return; }
+                    this->answer(socket, m_buffer.take(socket));
+                });
+            }
+        }
+
+        void answer(QTcpSocket *socket, const QByteArray &request)
+        {
+            m_lastRequest.clear();
+            const QList<QByteArray> lines = request.left(request.indexOf("\r\n\r\n")).split('\n');
+            for (const QByteArray &line : lines.mid(1))
+            {
+                const int colon = line.indexOf(':');
+                if (colon > 0) { m_lastRequest.insert(line.left(colon).trimmed().toLower(), line.mid(colon + 1).trimmed()); }
+            }
+
+            const bool withValidator = !lines.first().contains("/novalidator");
+            const QByteArray etag("\"v1\"");
+            QByteArray response;
+            QByteArray content;
+            if (withValidator && m_lastRequest.value("if-none-match") == etag)
+            {
+                response = "HTTP/1.1 304 Not Modified\r\nETag: " + etag + "\r\n";
+                m_notModifiedSent++;
+            }
+            else
+            {
+                content = body();
+                response = "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\n";
+                if (withValidator) { response += "ETag: " + etag + "\r\n"; }
+                if (m_lastRequest.value("accept-encoding").contains("deflate"))
+                {
+                    content = qCompress(content).mid(4); // zlib stream without the Qt length prefix
+                    response += "Content-Encoding: deflate\r\n";
+                }
+                m_bodyBytesSent += content.size();
+            }
+            response += "Content-Length: " + QByteArray::number(content.size()) + "\r\nConnection: close\r\n\r\n" + content;
+            socket->write(response);
+            socket->disconnectFromHost();
+        }
+
+        QTcpServer m_server;
+        QHash<QTcpSocket *, QByteArray> m_buffer;
+        QHash<QByteArray, QByteArray> m_lastRequest;
+        int m_bodyBytesSent = 0;
+        int m_notModifiedSent = 0;
+    };
+
+    //! CHttpDiskCache tests
+    class CTestHttpDiskCache : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Fresh cache and access manager for each test
+        void init();
+
+        //! Clean up
+        void cleanup();
+
+        //! Second request is conditional and answered from the cache
+        void notModified();
+
+        //! Responses without validator are not stored
+        void noValidator();
+
+        //! Hit rates per URL
+        void hitRates();
+
+    private:
+        //! GET and wait for the reply, logged in m_log
+        QByteArray get(const QUrl &url, bool *fromCache = nullptr);
+
+        QTemporaryDir *m_dir = nullptr;
+        QNetworkAccessManager *m_nam = nullptr;
+        CHttpStub *m_stub = nullptr;
+        CUrlLogList m_log;
+    };
+
+    void CTestHttpDiskCache::init()
+    {
+        m_dir = new QTemporaryDir();
+        QVERIFY(m_dir->isValid());
+        m_nam = new QNetworkAccessManager(this);
+        m_nam->setCache(new CHttpDiskCache(m_dir->path(), CHttpDiskCache::DefaultMaximumCacheSize, m_nam));
+        m_stub = new CHttpStub(this);
+        m_log.clear();
+    }
+
+    void CTestHttpDiskCache::cleanup()
+    {
+        delete m_nam;
+        delete m_stub;
+        delete m_dir;
+        m_nam = nullptr;
+        m_stub = nullptr;
+        m_dir = nullptr;
+    }
+
+    void CTestHttpDiskCache::notModified()
+    {
+        const QUrl url = m_stub->url("/data.txt");
+        bool fromCache = true;
+        QCOMPARE(this->get(url, &fromCache), CHttpStub::body());
+        QVERIFY(!fromCache);
+        QVERIFY(m_stub->lastRequestHeader("if-none-match").isEmpty());
+        QVERIFY2(m_stub->lastRequestHeader("accept-encoding").contains("deflate"), "compressed transfer expected");
+        QVERIFY2(m_stub->bodyBytesSent() < CHttpStub::body().size(), "body expected to be compressed");
+
+        const int bytesSent = m_stub->bodyBytesSent();
+        QCOMPARE(this->get(url, &fromCache), CHttpStub::body());
+        QVERIFY(fromCache);
+        QCOMPARE(m_stub->lastRequestHeader("if-none-match"), QByteArray("\"v1\""));
+        QCOMPARE(m_stub->notModifiedSent(), 1);
+        QCOMPARE(m_stub->bodyBytesSent(), bytesSent);
+
+        // still revalidated, never used without asking the server
+        QCOMPARE(this->get(url, &fromCache), CHttpStub::body());
+        QVERIFY(fromCache);
+        QCOMPARE(m_stub->notModifiedSent(), 2);
+    }
+
+    void CTestHttpDiskCache::noValidator()
+    {
+        const QUrl url = m_stub->url("/novalidator.txt");
+        bool fromCache = true;
+        QCOMPARE(this->get(url, &fromCache), CHttpStub::body());
+        QVERIFY(!fromCache);
+        QCOMPARE(this->get(url, &fromCache), CHttpStub::body());
+        QVERIFY(!fromCache);
+        QVERIFY(m_stub->lastRequestHeader("if-none-match").isEmpty());
+        QCOMPARE(m_stub->notModifiedSent(), 0);
+    }
+
+    void CTestHttpDiskCache::hitRates()
+    {
+        const QUrl cached = m_stub->url("/data.txt");
+        const QUrl uncached = m_stub->url("/novalidator.txt");
+        for (int i = 0; i < 4; ++i) { this->get(cached); }
+        for (int i = 0; i < 2; ++i) { this->get(uncached); }
+
+        QCOMPARE(m_log.sizePending(), 0);
+        QCOMPARE(m_log.sizeFromCache(), 3);
+        const QStringList rates = m_log.getCacheHitRatesPerUrl().split('\n');
+        QCOMPARE(rates.size(), 2);
+        QVERIFY2(rates.contains(CUrl(cached).getFullUrl(false) + ": 3/4 from cache (75%)"), qPrintable(rates.join(", ")));
+        QVERIFY2(rates.contains(CUrl(uncached).getFullUrl(false) + ": 0/2 from cache (0%)"), qPrintable(rates.join(", ")));
+    }
+
+    QByteArray CTestHttpDiskCache::get(const QUrl &url, bool *fromCache)
+    {
+        QNetworkReply *reply = m_nam->get(QNetworkRequest(url));
+        m_log.addPendingUrl(url, reply, 100);
+        QSignalSpy finished(reply, &QNetworkReply::finished);
+        if (!reply->isFinished() && !finished.wait(5000)) { delete reply; return {}; }
+
+        m_log.markAsReceived(reply, reply->error() == QNetworkReply::NoError);
+        if (fromCache) { *fromCache = CNetworkUtils::isFromHttpCache(reply); }
+        const QByteArray data = reply->readAll();
+        reply->deleteLater();
+        return data;
+    }
+} // ns
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestHttpDiskCache);
+
+#include "testhttpdiskcache.moc"
+
+//! \endcond
@@ -0,0 +1,183 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblackmisc
+
+#include "blackmisc/latencytrace.h"
+#include "test.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTest>
+#include <QThread>
+#include <QVector>
+
+using namespace BlackMisc;
+
+namespace BlackMiscTest
+{
+    //! CLatencyTrace tests
+    class CTestLatencyTrace : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Reset before each test
+        void init();
+
+        //! Disable after each test
+        void cleanup();
+
+        //! Disabled spans record nothing
+        void disabled();
+
+        //! Only sampled callsigns are recorded
+        void sampling();
+
+        //! Histograms
+        void histograms();
+
+        //! Chrome trace JSON
+        void chromeTrace();
+
+        //! Spans of several threads
+        void multipleThreads();
+
+    private:
+        //! Span events in the Chrome trace
+        static QJsonArray spanEvents();
+    };
+
+    void CTestLatencyTrace::init()
+    {
+        CLatencyTrace::setSampledCallsigns({});
+        CLatencyTrace::reset();
+    }
+
+    void CTestLatencyTrace::cleanup()
+    {
+        CLatencyTrace::setEnabled(false);
+    }
+
+    void CTestLatencyTrace::disabled()
+    {
+        CLatencyTrace::setEnabled(false);
+        {
+            const CLatencySpan span(CLatencyTrace::FsdParse);
+        }
+        QVERIFY(spanEvents().isEmpty());
+        QCOMPARE(CLatencyTrace::getHistogramsAsText(), QStringLiteral("No latency trace spans"));
+    }
+
+    void CTestLatencyTrace::sampling()
+    {
+        CLatencyTrace::setEnabled(true);
+        CLatencyTrace::setSampledCallsigns({ "dlh123", " BAW1 " });
+        QCOMPARE(CLatencyTrace::getSampledCallsigns(), QStringList({ "BAW1", "DLH123" }));
+        QVERIFY(CLatencyTrace::isSampled("DLH123"));
+        QVERIFY(CLatencyTrace::isSampled(""));
+        QVERIFY(!CLatencyTrace::isSampled("AFR42"));
+
+        { const CLatencySpan span(CLatencyTrace::Interpolation, "DLH123"); }
+        { const CLatencySpan span(CLatencyTrace::Interpolation, "AFR42"); }
+        { const CLatencySpan span(CLatencyTrace::SimulatorSend); }
+
+        const QJsonArray events = spanEvents();
+        QCOMPARE(events.size(), 2);
+        QCOMPARE(events.at(0).toObject().value("args").toObject().value("callsign").toString(), QStringLiteral("DLH123"));
+        QCOMPARE(events.at(1).toObject().value("name").toString(), CLatencyTrace::stageName(CLatencyTrace::SimulatorSend));
+
+        CLatencyTrace::setSampledCallsigns({});
+        QVERIFY(CLatencyTrace::isSampled("AFR42"));
+    }
+
+    void CTestLatencyTrace::histograms()
+    {
+        CLatencyTrace::setEnabled(true);
+        for (int i = 0; i < 100; ++i)
+        {
+            CLatencyTrace::record(CLatencyTrace::StoreSituation, "DLH123", 0, (i < 90 ? 5 : 3000) * 1000);
+        }
+
+        const QString text = CLatencyTrace::getHistogramsAsText();
+        QVERIFY2(text.startsWith(CLatencyTrace::stageName(CLatencyTrace::StoreSituation)), qPrintable(text));
+        QVERIFY2(text.contains("n=100"), qPrintable(text));
+        QVERIFY2(text.contains("p50<8us"), qPrintable(text));
+        QVERIFY2(text.contains("p99<4096us"), qPrintable(text));
+        QVERIFY2(text.contains("max=3000.0us"), qPrintable(text));
+
+        CLatencyTrace::reset();
+        QCOMPARE(CLatencyTrace::getHistogramsAsText(), QStringLiteral("No latency trace spans"));
+    }
+
+    void CTestLatencyTrace::chromeTrace()
+    {
+        CLatencyTrace::setEnabled(true);
+        CLatencyTrace::record(CLatencyTrace::FsdRead, {}, 2000, 5000);
+
+        QJsonParseError error;
+        const QJsonDocument doc = QJsonDocument::fromJson(CLatencyTrace::toChromeTraceJson(), &error);
+        QCOMPARE(error.error, QJsonParseError::NoError);
+        const QJsonArray all = doc.object().value("traceEvents").toArray();
+        QCOMPARE(all.size(), 2);
+        QCOMPARE(all.at(0).toObject().value("ph").toString(), QStringLiteral("M"));
+
+        const QJsonObject span = all.at(1).toObject();
+        QCOMPARE(span.value("ph").toString(), QStringLiteral("X"));
+        QCOMPARE(span.value("ts").toDouble(), 2.0);
+        QCOMPARE(span.value("dur").toDouble(), 3.0);
+        QVERIFY(!span.contains("args"));
+    }
+
+    void CTestLatencyTrace::multipleThreads()
+    {
+        CLatencyTrace::setEnabled(true);
+        constexpr int Threads = 4;
+        constexpr int Spans = 1000;
+        QVector<QThread *> threads;
+        for (int t = 0; t < Threads; ++t)
+        {
+            threads.push_back(QThread::create([]
+            {
+                for (int i = 0; i < Spans; ++i) { const CLatencySpan span(CLatencyTrace::AirspaceMonitor, "DLH123"); }
+            }));
+            threads.back()->start();
+        }
+        for (QThread *thread : std::as_const(threads)) { QVERIFY(thread->wait(10000)); delete thread; }
+
+        const QString text = CLatencyTrace::getHistogramsAsText();
+        QVERIFY2(text.contains(QStringLiteral("n=%1").arg(Threads * Spans)), qPrintable(text));
+
+        // one thread name record per thread
+        QJsonParseError error;
+        const QJsonDocument doc = QJsonDocument::fromJson(CLatencyTrace::toChromeTraceJson(), &error);
+        QCOMPARE(error.error, QJsonParseError::NoError);
+        QCOMPARE(doc.object().value("traceEvents").toArray().size(), Threads * (Spans + 1));
+    }
+
+    QJsonArray CTestLatencyTrace::spanEvents()
+    {
+        QJsonArray spans;
+        const QJsonArray all = QJsonDocument::fromJson(CLatencyTrace::toChromeTraceJson()).object().value("traceEvents").toArray();
+        for (const QJsonValue &event : all)
+        {
+            if (event.toObject().value("ph").toString() == QLatin1String("X")) { spans.append(event); }
+        }
+        return spans;
+    }
+} // namespace
+
+//! main
+BLACKTEST_MAIN(BlackMiscTest::CTestLatencyTrace);
+
+#include "testlatencytrace.moc"
+
+//! \endcond
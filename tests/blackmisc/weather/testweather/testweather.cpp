@@ -25,6 +25,7 @@
 #include "blackmisc/weather/cloudlayerlist.h"
 #include "blackmisc/weather/metar.h"
 #include "blackmisc/weather/metardecoder.h"
+#include "blackmisc/weather/metarlist.h"
 #include "blackmisc/weather/presentweather.h"
 #include "blackmisc/weather/presentweatherlist.h"
 #include "blackmisc/weather/temperaturelayer.h"
@@ -63,6 +64,15 @@ namespace BlackMiscTest
 
         //! Testing METAR decoder
         void metarDecoder();
+
+        //! Testing METAR decoder with groups decoded by the regular expressions only
+        void metarDecoderSpecialGroups();
+
+        //! Testing bulk METAR decoding and airport index
+        void metarDecoderBulk();
+
+        //! Testing that the tokenizing fast paths decode like the regular expressions
+        void metarDecoderFastPathParity();
     };
 
     void CTestWeather::cloudLayer()
@@ -215,6 +225,120 @@ namespace BlackMiscTest
         QVERIFY2(cloudLayers2.findByBase(CAltitude(30000, CAltitude::AboveGround, CLengthUnit::ft())).getCoverage() == CCloudLayer::Scattered, "Failed to parse cloud layer in 30000 ft");
     }
 
+    void CTestWeather::metarDecoderSpecialGroups()
+    {
+        CMetarDecoder metarDecoder;
+        const CMetar metar = metarDecoder.decode("METAR KJFK 241751Z AUTO VRB03KT 1 1/2SM R04R/2000V4000FT BR OVC008 M02/M03 A2992 RERA WS R04R");
+        QVERIFY2(metar.getAirportIcaoCode() == CAirportIcaoCode("KJFK"), "Failed to parse airport code");
+        QVERIFY2(metar.getReportType() == CMetar::METAR, "Failed to parse report type");
+        QVERIFY2(metar.isAutomated(), "Failed to parse status");
+        QVERIFY2(metar.getWindLayer().isDirectionVariable(), "Failed to parse variable wind");
+        QVERIFY2(metar.getVisibility() == CLength(1.5, CLengthUnit::SM()), "Failed to parse visibility");
+        QVERIFY2(metar.getTemperature() == CTemperature(-2, CTemperatureUnit::C()), "Failed to parse temperature");
+        QVERIFY2(metar.getDewPoint() == CTemperature(-3, CTemperatureUnit::C()), "Failed to parse dew point");
+        QVERIFY2(metar.getAltimeter() == CPressure(29.92, CPressureUnit::inHg()), "Failed to parse altimeter");
+        QVERIFY2(metar.getCloudLayers().findByBase(CAltitude(800, CAltitude::AboveGround, CLengthUnit::ft())).getCoverage() == CCloudLayer::Overcast, "Failed to parse cloud layer in 800 ft");
+        QVERIFY2(metar.getPresentWeather().size() == 1, "Present weather has an incorrect size");
+
+        const CMetar metar2 = metarDecoder.decode("EDDF 241750Z 25012G25KT 210V280 CAVOK 18/09 Q1018 NOSIG");
+        QVERIFY2(metar2.getWindLayer().getGustSpeed() == CSpeed(25, CSpeedUnit::kts()), "Failed to parse wind gust speed");
+        QVERIFY2(metar2.getWindLayer().getDirectionFrom() == CAngle(210, CAngleUnit::deg()), "Failed to parse wind direction variation");
+        QVERIFY2(metar2.getWindLayer().getDirectionTo() == CAngle(280, CAngleUnit::deg()), "Failed to parse wind direction variation");
+        QVERIFY2(metar2.getAltimeter() == CPressure(1018, CPressureUnit::hPa()), "Failed to parse altimeter");
+
+        QVERIFY2(metarDecoder.decode("EDDM 321750Z 25012KT 9999 Q1018") == CMetar(), "Invalid day should fail");
+        QVERIFY2(metarDecoder.decode("EDDM 24175Z 25012KT 9999 Q1018") == CMetar(), "Missing day time should fail");
+    }
+
+    void CTestWeather::metarDecoderBulk()
+    {
+        const QStringList metarStrings =
+        {
+            "KLBB 241753Z 20009KT 10SM -SHRA FEW045 SCT220 SCT300 28/17 A3022",
+            "EDDM 241753Z 20009G11KT 9000NDV FEW045 SCT220 SCT300 ///// Q1013",
+            "EDDF 241750Z 25012G25KT 210V280 CAVOK 18/09 Q1018 NOSIG",
+            "LOWW 241750Z 31015KT 4000 -RA BR BKN012CB OVC025 12/11 Q1009",
+            "invalid"
+        };
+
+        QStringList manyMetarStrings;
+        for (int i = 0; i < 200; i++) { manyMetarStrings.append(metarStrings); }
+
+        CMetarDecoder metarDecoder;
+        const QVector<CMetar> metars = metarDecoder.decode(manyMetarStrings);
+        QCOMPARE(metars.size(), manyMetarStrings.size());
+        for (int i = 0; i < manyMetarStrings.size(); i++)
+        {
+            QVERIFY2(metars.at(i) == metarDecoder.decode(manyMetarStrings.at(i)), "Bulk decoding differs");
+        }
+        QVERIFY2(metars.at(4) == CMetar(), "Invalid METAR decoded");
+
+        const CMetarList metarList(metars.mid(0, metarStrings.size()));
+        const QHash<QString, CMetar> metarsByAirport = metarList.getMetarsByAirport();
+        QVERIFY2(metarsByAirport.value("EDDF") == metarList.getMetarForAirport(CAirportIcaoCode("EDDF")), "Index lookup differs");
+        QVERIFY2(!metarsByAirport.contains("EDDK"), "Unknown airport in index");
+    }
+
+    void CTestWeather::metarDecoderFastPathParity()
+    {
+        const QStringList metarStrings =
+        {
+            "KLBB 241753Z 20009KT 10SM -SHRA FEW045 SCT220 SCT300 28/17 A3022",
+            "EDDM 241753Z 20009G11KT 9000NDV FEW045 SCT220 SCT300 ///// Q1013",
+            "EDDF 241750Z 25012G25KT 210V280 CAVOK 18/09 Q1018 NOSIG",
+            "LOWW 241750Z 31015KT 4000 -RA BR BKN012CB OVC025 12/11 Q1009",
+            "METAR KJFK 241751Z AUTO VRB03KT 1 1/2SM R04R/2000V4000FT BR OVC008 M02/M03 A2992 RERA WS R04R",
+            "SPECI EGLL 241720Z 24018G32KT 220V290 0800 R27L/0600U +TSRA VV003 M01/M01 Q0998 WS ALL RWY",
+            "KSFO 241756Z COR 00000KT 1/4SM FG VV001 11/11 A3001",
+            "LFPG 241730Z 09005MPS 9999 SKC 21/M05 Q1030",
+            "UUEE 241730Z 34003MPS 1200 R24L/1100D -SN BKN004 M08/M09 Q1021",
+            "RJTT 241800Z 18010KT 150V210 9999 FEW020TCU 27/22 Q1006",
+            "YSSY 241800Z NIL",
+            "KORD 241751Z 27015G25KT 2SM +FZRA PL SCT010 BKN015 OVC025 M01/M03 A2980",
+            "EDDK 24175Z 25012KT 9999 Q1018",
+            "EDDM 321750Z 25012KT 9999 Q1018",
+            QString::fromUtf8("\xC3\x89""DDM 241750Z 25012KT 9999 Q1018"),      // non ASCII airport
+            QString::fromUtf8("EDDM 241750Z 25012KT 9999 \xD9\xA1""1/09 Q1018"), // non ASCII digit
+            "invalid",
+            ""
+        };
+
+        // the groups with one character changed, removed or appended, to hit the edges of the tokenizers
+        QStringList corpus(metarStrings);
+        for (const QString &metarString : metarStrings)
+        {
+            const QStringList tokens = metarString.split(' ');
+            for (int t = 0; t < tokens.size(); t++)
+            {
+                const QString &token = tokens.at(t);
+                QStringList variants { token + "X", token + "0", token.left(token.size() - 1) };
+                for (int c = 0; c < token.size(); c++)
+                {
+                    for (QChar replacement : { QChar('0'), QChar('9'), QChar('/'), QChar('V'), QChar('G') })
+                    {
+                        QString variant(token);
+                        variant[c] = replacement;
+                        variants.push_back(variant);
+                    }
+                }
+                for (const QString &variant : std::as_const(variants))
+                {
+                    QStringList changed(tokens);
+                    changed[t] = variant;
+                    corpus.push_back(changed.join(' '));
+                }
+            }
+        }
+
+        const CMetarDecoder fastDecoder(true);
+        const CMetarDecoder regExpDecoder(false);
+        for (const QString &metarString : std::as_const(corpus))
+        {
+            QVERIFY2(fastDecoder.decode(metarString) == regExpDecoder.decode(metarString), qPrintable("Fast path differs for: " + metarString));
+        }
+        QVERIFY2(fastDecoder.decode(corpus) == regExpDecoder.decode(corpus), "Bulk decoding differs");
+    }
+
 } // namespace
 
 //! main
@@ -0,0 +1,248 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblacksound
+
+#include "blacksound/dsp/biquadfilter.h"
+#include "blacksound/dsp/biquadfiltercascade.h"
+#include "blacksound/dsp/SimpleComp.h"
+#include "blacksound/dsp/SimpleGate.h"
+#include "blacksound/dsp/SimpleLimit.h"
+#include "test.h"
+
+#include <QTest>
+#include <QVector>
+#include <QtMath>
+#include <cstring>
+
+using namespace BlackSound::Dsp;
+using namespace chunkware_simple;
+
+namespace BlackSoundTest
+{
+    //! Block processing has to be bit identical to the per sample processing
+    class CTestDsp : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! BiQuadFilter::transform for a block
+        void biQuadFilterBlock();
+
+        //! BiQuadFilterCascade compared to the filters one after another
+        void biQuadFilterCascade();
+
+        //! Compressor
+        void compressor();
+
+        //! Gate
+        void gate();
+
+        //! Limiter
+        void limiter();
+
+    private:
+        //! Block sizes, 960 is 20ms at 48kHz
+        static const QVector<int> &blockSizes() { static const QVector<int> sizes { 1, 3, 7, 960, 4800 }; return sizes; }
+
+        //! Quiet, loud and very loud parts, interleaved stereo if channels is 2
+        static QVector<float> signal(int channels);
+
+        //! Filters of the VHF equalizer and some more
+        static QVector<BiQuadFilter> filters();
+
+        //! Identical samples?
+        static bool isIdentical(const QVector<float> &expected, const QVector<float> &actual);
+
+        //! Per frame processing as in CSimpleCompressorEffect before
+        template <class Processor>
+        static void processPerFrame(Processor &processor, QVector<float> &samples, int channels);
+
+        //! Compare block and per frame processing
+        template <class Processor>
+        static bool compareBlocks(const Processor &init, int channels, int blockSize);
+    };
+
+    void CTestDsp::biQuadFilterBlock()
+    {
+        const QVector<float> input = signal(1);
+        for (const BiQuadFilter &init : filters())
+        {
+            for (int blockSize : blockSizes())
+            {
+                BiQuadFilter perSample = init;
+                QVector<float> expected = input;
+                for (float &sample : expected) { sample = perSample.transform(sample); }
+
+                BiQuadFilter block = init;
+                QVector<float> actual = input;
+                for (int n = 0; n < actual.size(); n += blockSize) { block.transform(actual.data() + n, qMin(blockSize, actual.size() - n)); }
+                QVERIFY2(isIdentical(expected, actual), qPrintable(QStringLiteral("Block size %1").arg(blockSize)));
+            }
+        }
+    }
+
+    void CTestDsp::biQuadFilterCascade()
+    {
+        const QVector<float> input = signal(1);
+        const QVector<BiQuadFilter> allFilters = filters();
+        QVERIFY(allFilters.size() == BiQuadFilterCascade::MaxFilters);
+
+        for (int count = 1; count <= allFilters.size(); ++count)
+        {
+            for (int blockSize : blockSizes())
+            {
+                QVector<BiQuadFilter> chain = allFilters.mid(0, count);
+                QVector<float> expected = input;
+                for (float &sample : expected)
+                {
+                    for (BiQuadFilter &filter : chain) { sample = filter.transform(sample); }
+                }
+
+                BiQuadFilterCascade cascade(allFilters.mid(0, count));
+                QCOMPARE(cascade.size(), count);
+                QVector<float> actual = input;
+                for (int n = 0; n < actual.size(); n += blockSize) { cascade.transform(actual.data() + n, qMin(blockSize, actual.size() - n)); }
+                QVERIFY2(isIdentical(expected, actual), qPrintable(QStringLiteral("%1 filters, block size %2").arg(count).arg(blockSize)));
+            }
+        }
+
+        BiQuadFilterCascade full(allFilters);
+        QVERIFY(!full.push_back(allFilters.front()));
+        full.clear();
+        QVERIFY(full.isEmpty());
+    }
+
+    void CTestDsp::compressor()
+    {
+        // settings of CSimpleCompressorEffect, and with a low threshold
+        SimpleComp compressor;
+        compressor.setAttack(5.0);
+        compressor.setRelease(10.0);
+        compressor.setSampleRate(48000.0);
+        compressor.setThresh(16.0);
+        compressor.setRatio(6.0);
+        compressor.setMakeUpGain(-5.5);
+        compressor.initRuntime();
+
+        SimpleComp compressing = compressor;
+        compressing.setThresh(-20.0);
+        compressing.setRatio(0.2);
+
+        for (int channels : { 1, 2 })
+        {
+            for (int blockSize : blockSizes())
+            {
+                QVERIFY(compareBlocks(compressor, channels, blockSize));
+                QVERIFY(compareBlocks(compressing, channels, blockSize));
+            }
+        }
+    }
+
+    void CTestDsp::gate()
+    {
+        SimpleGate gate;
+        gate.setSampleRate(48000.0);
+        gate.setThresh(-30.0);
+        gate.initRuntime();
+
+        for (int channels : { 1, 2 })
+        {
+            for (int blockSize : blockSizes()) { QVERIFY(compareBlocks(gate, channels, blockSize)); }
+        }
+    }
+
+    void CTestDsp::limiter()
+    {
+        SimpleLimit limiter;
+        limiter.setSampleRate(48000.0);
+        limiter.setThresh(-6.0);
+        limiter.initRuntime();
+
+        for (int channels : { 1, 2 })
+        {
+            for (int blockSize : blockSizes()) { QVERIFY(compareBlocks(limiter, channels, blockSize)); }
+        }
+    }
+
+    QVector<float> CTestDsp::signal(int channels)
+    {
+        constexpr int Frames = 48000;
+        QVector<float> samples;
+        samples.reserve(Frames * channels);
+        for (int i = 0; i < Frames; ++i)
+        {
+            const int part = (i / 4800) % 3;
+            const double amplitude = part == 0 ? 0.001 : (part == 1 ? 0.3 : 1.5);
+            for (int c = 0; c < channels; ++c)
+            {
+                samples.push_back(static_cast<float>(amplitude * qSin(i * (0.07 + 0.01 * c)) * qSin(i * 0.0013)));
+            }
+        }
+        return samples;
+    }
+
+    QVector<BiQuadFilter> CTestDsp::filters()
+    {
+        return
+        {
+            BiQuadFilter::highPassFilter(44100, 310, 0.25),
+            BiQuadFilter::peakingEQ(44100, 450, 0.75, 17.0),
+            BiQuadFilter::peakingEQ(44100, 1450, 1.0, 25.0),
+            BiQuadFilter::peakingEQ(44100, 2000, 1.0, 25.0),
+            BiQuadFilter::lowPassFilter(44100, 2500, 0.25),
+            BiQuadFilter::highPassFilter(48000, 100, 0.7),
+            BiQuadFilter::lowPassFilter(48000, 5000, 0.7),
+            BiQuadFilter::peakingEQ(48000, 800, 1.0, -6.0)
+        };
+    }
+
+    bool CTestDsp::isIdentical(const QVector<float> &expected, const QVector<float> &actual)
+    {
+        if (expected.size() != actual.size()) { return false; }
+        return std::memcmp(expected.constData(), actual.constData(), static_cast<size_t>(expected.size()) * sizeof(float)) == 0;
+    }
+
+    template <class Processor>
+    void CTestDsp::processPerFrame(Processor &processor, QVector<float> &samples, int channels)
+    {
+        for (int sample = 0; sample < samples.size(); sample += channels)
+        {
+            double in1 = samples.at(sample);
+            double in2 = (channels == 1) ? 0 : samples.at(sample + 1);
+            processor.process(in1, in2);
+            samples[sample] = static_cast<float>(in1);
+            if (channels > 1) { samples[sample + 1] = static_cast<float>(in2); }
+        }
+    }
+
+    template <class Processor>
+    bool CTestDsp::compareBlocks(const Processor &init, int channels, int blockSize)
+    {
+        const QVector<float> input = signal(channels);
+        const int frames = input.size() / channels;
+
+        Processor perFrame = init;
+        QVector<float> expected = input;
+        processPerFrame(perFrame, expected, channels);
+
+        Processor block = init;
+        QVector<float> actual = input;
+        for (int n = 0; n < frames; n += blockSize) { block.process(actual.data() + n * channels, qMin(blockSize, frames - n), channels); }
+        return isIdentical(expected, actual);
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackSoundTest::CTestDsp);
+
+#include "testdsp.moc"
+
+//! \endcond
@@ -0,0 +1,208 @@
+/* Copyright (C) 2020
+ * swift project Community / Contributors
+ *
+ * This file is part of swift project. It is subject to the license terms in the LICENSE file found in the top-level
+ * directory of this distribution. No part of swift project, including this file, may be copied, modified, propagated,
+ * or distributed except according to the terms contained in the LICENSE file.
+ */
+
+//! \cond PRIVATE_TESTS
+//! \file
+//! \ingroup testblacksound
+
+#include "blacksound/sampleprovider/mixingsampleprovider.h"
+#include "blacksound/sampleprovider/parallelmixingsampleprovider.h"
+#include "blacksound/sampleprovider/sinusgenerator.h"
+#include "test.h"
+
+#include <QElapsedTimer>
+#include <QTest>
+#include <QThread>
+#include <QVector>
+#include <cstring>
+
+using namespace BlackSound::SampleProvider;
+
+namespace BlackSoundTest
+{
+    //! Input which needs longer than a frame to render
+    class CSlowSampleProvider : public ISampleProvider
+    {
+    public:
+        //! Ctor
+        CSlowSampleProvider(int delayMs, QObject *parent) : ISampleProvider(parent), m_delayMs(delayMs) {}
+
+        //! \copydoc ISampleProvider::readSamples
+        virtual int readSamples(QVector<float> &samples, qint64 count) override
+        {
+            QThread::msleep(static_cast<unsigned long>(m_delayMs));
+            samples.fill(1.0f, static_cast<int>(count));
+            return static_cast<int>(count);
+        }
+
+    private:
+        int m_delayMs = 0;
+    };
+
+    //! CParallelMixingSampleProvider tests
+    class CTestParallelMixing : public QObject
+    {
+        Q_OBJECT
+
+    private slots:
+        //! Offline rendering is identical to CMixingSampleProvider
+        void offlineLikeMixer();
+
+        //! Threaded rendering is identical to offline rendering if the inputs are in time
+        void threadedLikeOffline();
+
+        //! A slow input is an underrun, the other inputs are still mixed
+        void underrun();
+
+        //! Inputs are fixed once started
+        void fixedInputs();
+
+    private:
+        static constexpr int Receivers = 4; //!< inputs
+        static constexpr int Frames = 25;   //!< frames read
+
+        //! Add sinus generators as inputs
+        template <class Mixer>
+        static void addInputs(Mixer &mixer);
+
+        //! Read all frames in chunks of readSize
+        static QVector<float> readAll(ISampleProvider &mixer, int readSize);
+
+        //! Read all frames, waiting until each frame is rendered
+        static QVector<float> readAllWaiting(CParallelMixingSampleProvider &mixer);
+    };
+
+    void CTestParallelMixing::offlineLikeMixer()
+    {
+        CMixingSampleProvider mixer;
+        addInputs(mixer);
+        CParallelMixingSampleProvider offline(CParallelMixingSampleProvider::Offline);
+        addInputs(offline);
+
+        // odd read size as from the sound card, crossing the frames
+        const QVector<float> expected = readAll(mixer, 441);
+        const QVector<float> actual = readAll(offline, 441);
+        QCOMPARE(actual.size(), expected.size());
+        QVERIFY(std::memcmp(actual.constData(), expected.constData(), static_cast<size_t>(actual.size()) * sizeof(float)) == 0);
+        QCOMPARE(offline.getThreadCount(), 0);
+        QCOMPARE(offline.getMetrics().underruns, 0LL);
+        QCOMPARE(offline.getMetrics().frames, static_cast<qint64>(Frames));
+    }
+
+    void CTestParallelMixing::threadedLikeOffline()
+    {
+        CParallelMixingSampleProvider offline(CParallelMixingSampleProvider::Offline);
+        addInputs(offline);
+        CParallelMixingSampleProvider threaded(CParallelMixingSampleProvider::Threaded);
+        addInputs(threaded);
+
+        const QVector<float> expected = readAll(offline, CParallelMixingSampleProvider::FrameSize);
+        const QVector<float> actual = readAllWaiting(threaded);
+        QCOMPARE(actual.size(), expected.size());
+        QVERIFY(std::memcmp(actual.constData(), expected.constData(), static_cast<size_t>(actual.size()) * sizeof(float)) == 0);
+        QVERIFY(threaded.getThreadCount() >= 1);
+        QVERIFY(threaded.getThreadCount() <= Receivers);
+
+        const CParallelMixingSampleProvider::Metrics metrics = threaded.getMetrics();
+        QCOMPARE(metrics.underruns, 0LL);
+        QCOMPARE(metrics.frames, static_cast<qint64>(Frames));
+        QVERIFY(metrics.inputFrames >= Frames * Receivers);
+    }
+
+    void CTestParallelMixing::underrun()
+    {
+        CParallelMixingSampleProvider threaded(CParallelMixingSampleProvider::Threaded);
+        CSinusGenerator *sinus = new CSinusGenerator(400, &threaded); // deleted after the render threads are stopped
+        sinus->setGain(0.5);
+        threaded.addMixerInput(sinus);
+        threaded.addMixerInput(new CSlowSampleProvider(200, &threaded));
+
+        QVector<float> samples;
+        QCOMPARE(threaded.readSamples(samples, CParallelMixingSampleProvider::FrameSize), CParallelMixingSampleProvider::FrameSize); // first frame, rendered in place
+        QVERIFY(threaded.waitForNextFrame(1000));
+        QCOMPARE(threaded.readSamples(samples, CParallelMixingSampleProvider::FrameSize), CParallelMixingSampleProvider::FrameSize);
+
+        // the slow input now renders frame 2, reading must not wait for it
+        QElapsedTimer timer;
+        timer.start();
+        QCOMPARE(threaded.readSamples(samples, CParallelMixingSampleProvider::FrameSize), CParallelMixingSampleProvider::FrameSize);
+        QVERIFY(timer.elapsed() < 150);
+
+        const CParallelMixingSampleProvider::Metrics metrics = threaded.getMetrics();
+        QCOMPARE(metrics.frames, 3LL);
+        QVERIFY(metrics.underruns >= 1);
+        QVERIFY(metrics.framesWithUnderrun >= 1);
+        QVERIFY(metrics.maxRenderUs >= 190 * 1000);
+
+        // silence for the slow input, the sinus is still there
+        bool sinusOnly = true;
+        for (float sample : std::as_const(samples))
+        {
+            if (qAbs(sample) > 0.5f) { sinusOnly = false; }
+        }
+        QVERIFY(sinusOnly);
+
+        threaded.resetMetrics();
+        QCOMPARE(threaded.getMetrics().underruns, 0LL);
+    }
+
+    void CTestParallelMixing::fixedInputs()
+    {
+        CParallelMixingSampleProvider offline(CParallelMixingSampleProvider::Offline);
+        QVERIFY(offline.addMixerInput(new CSinusGenerator(400, &offline)));
+        QVector<float> samples;
+        QCOMPARE(offline.readSamples(samples, 10), 10);
+        QCOMPARE(samples.size(), 10);
+        QVERIFY(!offline.addMixerInput(new CSinusGenerator(800, &offline)));
+    }
+
+    template <class Mixer>
+    void CTestParallelMixing::addInputs(Mixer &mixer)
+    {
+        for (int i = 0; i < Receivers; ++i)
+        {
+            CSinusGenerator *input = new CSinusGenerator(300.0 + 170.0 * i, &mixer);
+            input->setGain(0.1 + 0.05 * i);
+            mixer.addMixerInput(input);
+        }
+    }
+
+    QVector<float> CTestParallelMixing::readAll(ISampleProvider &mixer, int readSize)
+    {
+        QVector<float> all;
+        QVector<float> samples;
+        const int total = Frames * CParallelMixingSampleProvider::FrameSize;
+        for (int read = 0; read < total; read += readSize)
+        {
+            const int count = qMin(readSize, total - read);
+            mixer.readSamples(samples, count);
+            all.append(samples.mid(0, count));
+        }
+        return all;
+    }
+
+    QVector<float> CTestParallelMixing::readAllWaiting(CParallelMixingSampleProvider &mixer)
+    {
+        QVector<float> all;
+        QVector<float> samples;
+        for (int frame = 0; frame < Frames; ++frame)
+        {
+            if (!mixer.waitForNextFrame(5000)) { return {}; }
+            mixer.readSamples(samples, CParallelMixingSampleProvider::FrameSize);
+            all.append(samples);
+        }
+        return all;
+    }
+} // ns
+
+//! main
+BLACKTEST_APPLESS_MAIN(BlackSoundTest::CTestParallelMixing);
+
+#include "testparallelmixing.moc"
+
+//! \endcond
@@ -68,6 +68,22 @@ int main(int argc, char *argv[]) \
     } \
 }
 
+//! Implements a main() function that executes all benchmarks in TestObject
+//! including instantiating a QCoreApplication object.
+//! In addition to the xml file the results are written to a csv file, one line per benchmark.
+#define BLACKTEST_BENCHMARK_MAIN(TestObject) \
+int main(int argc, char *argv[]) \
+{ \
+    try { \
+        QCoreApplication app(argc, argv); \
+        BLACKTEST_INIT(TestObject) \
+        args.append({ "-o", resultsFileName + "_benchmarkresults.csv,csv" }); \
+        return QTest::qExec(&to, args); \
+    } catch (...) { \
+        return EXIT_FAILURE; \
+    } \
+}
+
 //! \endcond
 
 #endif // guard
@@ -5,7 +5,9 @@ CONFIG += ordered
 
 SUBDIRS += blackmisc
 SUBDIRS += blackcore
+SUBDIRS += blacksound
 SUBDIRS += blackgui
+SUBDIRS += benchmarks
 
 # testblackmisc.file = blackmisc/testblackmisc.pro
 # testblackcore.file = blackcore/testblackcore.pro